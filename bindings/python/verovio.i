@@ -23,10 +23,18 @@
 
 // Because we transform the strings to dictionaries, we need this module
 %pythonbegin %{
+    import base64
     import json
     from typing import Optional, Union
 %}
 
+// Toolkit::ActivateOptionProfile
+%feature("shadow") vrv::Toolkit::ActivateOptionProfile(int) %{
+def activateOptionProfile(toolkit, handle: int) -> dict:
+    """Set the options of a registered option profile."""
+    return json.loads($action(toolkit, handle))
+%}
+
 // Toolkit::Edit
 %feature("shadow") vrv::Toolkit::Edit( const std::string & ) %{
 def edit(toolkit, editor_action: dict) -> bool:
@@ -41,6 +49,13 @@ def editInfo(toolkit) -> dict:
     return json.loads($action(toolkit))
 %}
 
+// Toolkit::ExtractCorpusFeatures
+%feature("shadow") vrv::Toolkit::ExtractCorpusFeatures(const std::string &) %{
+def extractCorpusFeatures(toolkit, options: dict) -> dict:
+    """Extract the descriptive features of a corpus of files and save them to a binary file."""
+    return json.loads($action(toolkit, json.dumps(options)))
+%}
+
 // Toolkit::GetAvailableOptions
 %feature("shadow") vrv::Toolkit::GetAvailableOptions() const %{
 def getAvailableOptions(toolkit) -> dict:
@@ -85,6 +100,13 @@ def getExpansionIdsForElement(toolkit, xml_id: str) -> dict:
     return json.loads($action(toolkit, xml_id))
 %}
 
+// Toolkit::GetLogEntries
+%feature("shadow") vrv::Toolkit::GetLogEntries() %{
+def getLogEntries(toolkit) -> dict:
+    """Get the log entries for the latest operation."""
+    return json.loads($action(toolkit))
+%}
+
 // Toolkit::GetMEI
 %feature("shadow") vrv::Toolkit::GetMEI(const std::string & = "") %{
 def getMEI(toolkit, options: Optional[dict] = None) -> str:
@@ -124,6 +146,13 @@ def redoLayout(toolkit, options: Optional[dict] = None) -> None:
     return $action(toolkit, json.dumps(options))
 %}
 
+// Toolkit::RegisterOptionProfile
+%feature("shadow") vrv::Toolkit::RegisterOptionProfile(const std::string &, const std::string &) %{
+def registerOptionProfile(toolkit, name: str, json_options: dict) -> int:
+    """Register a named option profile."""
+    return $action(toolkit, name, json.dumps(json_options))
+%}
+
 // Toolkit::RenderData
 %feature("shadow") vrv::Toolkit::RenderData(const std::string &, const std::string &) %{
 def renderData(toolkit, data, options: dict) -> str:
@@ -147,10 +176,12 @@ def renderToExpansionMapFile(toolkit, filename: str) -> bool:
 
 // Toolkit::RenderToTimemap
 %feature("shadow") vrv::Toolkit::RenderToTimemap(const std::string & = "") %{
-def renderToTimemap(toolkit, options: Optional[dict] = None) -> list:
+def renderToTimemap(toolkit, options: Optional[dict] = None) -> Union[list, bytes]:
     """Render a document to a timemap."""
     if options is None:
         options = {}
+    if options.get("format") == "binary":
+        return base64.b64decode($action(toolkit, json.dumps(options)))
     return json.loads($action(toolkit, json.dumps(options)))
 %}
 
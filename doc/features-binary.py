@@ -0,0 +1,58 @@
+# Reader for the binary corpus features (see FeatureCorpus::ToBinary)
+# Generate it with:
+#   verovio -r data --corpus files.txt -o features.bin
+# or:
+#   tk.extractCorpusFeatures({"inputs": ["a.mei", "b.krn"], "output": "features.bin"})
+# and read it with:
+#   python3 features-binary.py features.bin
+# The columns are memoryviews on the buffer and are not copied. With numpy, the same sections can be read with
+# numpy.frombuffer(buffer, dtype='<u4', count=n, offset=offset)
+import struct
+import sys
+
+
+def read_features(buffer):
+    magic, version, d, n, i, length, g, s = struct.unpack_from('<8I', buffer, 0)
+    if magic != 0x46565256 or version != 1:
+        raise ValueError('not a binary feature corpus')
+    view = memoryview(buffer)
+    offset = 32
+
+    def column(fmt, size, count):
+        nonlocal offset
+        values = view[offset:offset + size * count].cast(fmt)
+        offset += size * count
+        return values
+
+    features = {
+        'ngramLength': length,
+        'notes': column('I', 4, d + 1),
+        'intervals': column('I', 4, d + 1),
+        'ngrams': column('I', 4, d + 1),
+        'names': column('I', 4, d + 1),
+        'ngram': column('I', 4, g),
+        'pitchMIDI': column('B', 1, n),
+        'pitchDiatonic': column('B', 1, n),
+        'intervalChromatic': column('b', 1, i),
+        'intervalDiatonic': column('b', 1, i),
+    }
+    features['strings'] = view[offset:offset + s]
+    return features
+
+
+def get_document(features, d):
+    notes, intervals, ngrams, names = features['notes'], features['intervals'], features['ngrams'], features['names']
+    return {
+        'name': bytes(features['strings'][names[d]:names[d + 1]]).decode('utf-8'),
+        'pitchMIDI': list(features['pitchMIDI'][notes[d]:notes[d + 1]]),
+        'intervalChromatic': list(features['intervalChromatic'][intervals[d]:intervals[d + 1]]),
+        'intervalDiatonic': list(features['intervalDiatonic'][intervals[d]:intervals[d + 1]]),
+        'ngram': list(features['ngram'][ngrams[d]:ngrams[d + 1]]),
+    }
+
+
+if __name__ == '__main__':
+    with open(sys.argv[1], 'rb') as f:
+        features = read_features(f.read())
+    for d in range(len(features['notes']) - 1):
+        print(get_document(features, d))
@@ -0,0 +1,85 @@
+# Per-call latency of the toolkit query APIs
+# This script it expected to be run from ./bindings/python with:
+#   python3 ../../doc/query-benchmark.py file.mei --save results.json
+# Results of another build can be compared with:
+#   python3 ../../doc/query-benchmark.py file.mei --compare results.json
+# The JSON strings are not decoded in Python, so the time includes only the toolkit call.
+import argparse
+import json
+import re
+import statistics
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+
+def raw(tk, name):
+    # Call the SWIG function directly and not the Python wrapper decoding the JSON
+    function = getattr(verovio._verovio, 'toolkit_' + name, None)
+    if function:
+        return lambda *args: function(tk, *args)
+    return getattr(tk, name)
+
+
+def measure(call, args, repeat):
+    samples = []
+    for i in range(repeat):
+        start = time.perf_counter()
+        call(*args[i % len(args)])
+        samples.append((time.perf_counter() - start) * 1e6)
+    return statistics.median(samples), statistics.mean(samples)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input')
+    parser.add_argument('--repeat', type=int, default=2000)
+    parser.add_argument('--save', default='', help='write the results to a JSON file')
+    parser.add_argument('--compare', default='', help='compare with results written with --save')
+    args = parser.parse_args()
+
+    tk = verovio.toolkit(False)
+    tk.setResourcePath('../../data')
+    tk.setOptions({'xmlIdSeed': 1})
+    if not tk.loadFile(args.input):
+        sys.exit(f'Cannot load {args.input}')
+    tk.renderToSVG(1)
+
+    ids = re.findall(r'xml:id="([^"]+)"', tk.getMEI())
+    timemap = tk.renderToTimemap()
+    end = int(timemap[-1]['tstamp']) if timemap else 0
+    times = [(t,) for t in range(0, end + 1, max(1, end // 500))]
+    elements = [(i,) for i in ids[::max(1, len(ids) // 500)]]
+
+    calls = {
+        'getElementsAtTime': (raw(tk, 'getElementsAtTime'), times, args.repeat),
+        'getElementAttr': (raw(tk, 'getElementAttr'), elements, args.repeat),
+        'getTimesForElement': (raw(tk, 'getTimesForElement'), elements, args.repeat),
+        'getMIDIValuesForElement': (raw(tk, 'getMIDIValuesForElement'), elements, args.repeat),
+        'setOptions': (raw(tk, 'setOptions'), [('{"svgBoundingBoxes": false, "pageWidth": 2100}',)], args.repeat),
+        'renderToTimemap': (raw(tk, 'renderToTimemap'), [('{"includeRests": true}',)], max(1, args.repeat // 100)),
+        'getDescriptiveFeatures': (raw(tk, 'getDescriptiveFeatures'), [('{}',)], max(1, args.repeat // 100)),
+    }
+
+    baseline = {}
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+
+    results = {}
+    print(f'Verovio {tk.getVersion()} - {args.input} ({len(ids)} elements)')
+    print(f'{"API":<26}{"median (us)":>14}{"mean (us)":>14}{"baseline":>14}{"speedup":>10}')
+    for name, (call, call_args, repeat) in calls.items():
+        median, mean = measure(call, call_args, repeat)
+        results[name] = median
+        line = f'{name:<26}{median:>14.2f}{mean:>14.2f}'
+        if name in baseline:
+            line += f'{baseline[name]:>14.2f}{baseline[name] / median:>9.2f}x'
+        print(line)
+
+    if args.save:
+        with open(args.save, 'w') as f:
+            json.dump(results, f, indent=2)
@@ -0,0 +1,59 @@
+# Small client for the verovio command-line server mode
+# Start the server with:
+#   verovio --serve /tmp/verovio.sock
+# and send jobs with:
+#   python3 serve-client.py /tmp/verovio.sock file1.mei file2.mei --format svg --pages all
+# Alternatively, run the server on the standard input without a socket:
+#   python3 serve-client.py - file1.mei file2.mei --print-jobs | verovio --serve -
+import argparse
+import json
+import socket
+import sys
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('socket', help='path to the server socket, or - for printing the jobs')
+    parser.add_argument('inputs', nargs='+')
+    parser.add_argument('--format', default='svg')
+    parser.add_argument('--pages', default='1', help='a page number or "all"')
+    parser.add_argument('--options', default='{}', help='a JSON object of toolkit options')
+    parser.add_argument('--output-dir', default='', help='write the output files to this directory')
+    parser.add_argument('--print-jobs', action='store_true')
+    args = parser.parse_args()
+
+    jobs = []
+    for i, path in enumerate(args.inputs):
+        job = {
+            'id': i,
+            'input': path,
+            'format': args.format,
+            'pages': args.pages if args.pages == 'all' else int(args.pages),
+            'options': json.loads(args.options)
+        }
+        if args.output_dir:
+            name = path.split('/')[-1].rsplit('.', 1)[0]
+            job['output'] = f'{args.output_dir}/{name}'
+        jobs.append(json.dumps(job))
+
+    if args.print_jobs or args.socket == '-':
+        print('\n'.join(jobs))
+        sys.exit(0)
+
+    client = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    client.connect(args.socket)
+    stream = client.makefile('rw')
+    total = 0.0
+    for job in jobs:
+        stream.write(job + '\n')
+        stream.flush()
+        response = json.loads(stream.readline())
+        time = response.get('time', {})
+        total += time.get('total', 0.0)
+        status = 'ok' if response['ok'] else 'error: ' + response['error']
+        print(f"{args.inputs[response['id']]}: {status} "
+              f"(load {time.get('load', 0.0):.1f} ms, render {time.get('render', 0.0):.1f} ms, "
+              f"total {time.get('total', 0.0):.1f} ms)")
+        if response['log']:
+            print(response['log'], end='')
+    client.close()
+    print(f'{len(jobs)} job(s) in {total:.1f} ms')
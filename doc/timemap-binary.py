@@ -0,0 +1,55 @@
+# Reader for the binary timemap (see Timemap::ToBinary)
+# Generate it with:
+#   tk.renderToTimemapFile("timemap.bin", {"format": "binary"})
+# and read it with:
+#   python3 timemap-binary.py timemap.bin
+# The columns are memoryviews on the buffer and are not copied. With numpy, the same sections can be read with
+# numpy.frombuffer(buffer, dtype='<f8', count=n, offset=offset)
+import struct
+import sys
+
+LISTS = ['on', 'off', 'restsOn', 'restsOff', 'measureOn']
+
+
+def read_timemap(buffer):
+    magic, version, n, m, r, s, flags, _ = struct.unpack_from('<8I', buffer, 0)
+    if magic != 0x54565256 or version != 1:
+        raise ValueError('not a binary timemap')
+    view = memoryview(buffer)
+    offset = 32
+
+    def column(fmt, size, count):
+        nonlocal offset
+        values = view[offset:offset + size * count].cast(fmt)
+        offset += size * count
+        return values
+
+    timemap = {
+        'flags': flags,
+        'tstamp': column('d', 8, n),
+        'qstamp': column('d', 8, n),
+        'tempo': column('d', 8, n),
+        'lists': column('I', 4, 5 * n + 1),
+        'refs': column('I', 4, r),
+        'ids': column('I', 4, m + 1),
+    }
+    timemap['strings'] = view[offset:offset + s]
+    return timemap
+
+
+def get_ids(timemap, entry, list_name):
+    k = 5 * entry + LISTS.index(list_name)
+    lists, refs, ids, strings = timemap['lists'], timemap['refs'], timemap['ids'], timemap['strings']
+    return [bytes(strings[ids[j]:ids[j + 1]]).decode('utf-8') for j in refs[lists[k]:lists[k + 1]]]
+
+
+if __name__ == '__main__':
+    with open(sys.argv[1], 'rb') as f:
+        timemap = read_timemap(f.read())
+    for i in range(len(timemap['tstamp'])):
+        entry = {'tstamp': timemap['tstamp'][i], 'qstamp': timemap['qstamp'][i], 'tempo': timemap['tempo'][i]}
+        for name in LISTS:
+            ids = get_ids(timemap, i, name)
+            if ids:
+                entry[name] = ids
+        print(entry)
@@ -18,6 +18,9 @@ function getToolkitFunction(VerovioModule, method) {
     // void destructor(Toolkit *ic)
     mapping.destructor = VerovioModule.cwrap("vrvToolkit_destructor", null, ["number"]);
 
+    // char *activateOptionProfile(Toolkit *ic, int handle)
+    mapping.activateOptionProfile = VerovioModule.cwrap("vrvToolkit_activateOptionProfile", "string", ["number", "number"]);
+
     // bool edit(Toolkit *ic, const char *editorAction) 
     mapping.edit = VerovioModule.cwrap("vrvToolkit_edit", "number", ["number", "string"]);
 
@@ -57,12 +60,18 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getLog(Toolkit *ic)
     mapping.getLog = VerovioModule.cwrap("vrvToolkit_getLog", "string", ["number"]);
 
+    // char *getLogEntries(Toolkit *ic)
+    mapping.getLogEntries = VerovioModule.cwrap("vrvToolkit_getLogEntries", "string", ["number"]);
+
     // char *getMEI(Toolkit *ic, const char *options)
     mapping.getMEI = VerovioModule.cwrap("vrvToolkit_getMEI", "string", ["number", "string"]);
 
     // char *vrvToolkit_getNotatedIdForElement(Toolkit *tk, const char *xmlId);
     mapping.getNotatedIdForElement = VerovioModule.cwrap("vrvToolkit_getNotatedIdForElement", "string", ["number", "string"]);
 
+    // int getOptionProfile(Toolkit *ic, const char *name)
+    mapping.getOptionProfile = VerovioModule.cwrap("vrvToolkit_getOptionProfile", "number", ["number", "string"]);
+
     // char *getOptions(Toolkit *ic)
     mapping.getOptions = VerovioModule.cwrap("vrvToolkit_getOptions", "string", ["number"]);
 
@@ -99,9 +108,15 @@ function getToolkitFunction(VerovioModule, method) {
     // void redoPagePitchPosLayout(Toolkit *ic)
     mapping.redoPagePitchPosLayout = VerovioModule.cwrap("vrvToolkit_redoPagePitchPosLayout", null, ["number"]);
 
+    // int registerOptionProfile(Toolkit *ic, const char *name, const char *options)
+    mapping.registerOptionProfile = VerovioModule.cwrap("vrvToolkit_registerOptionProfile", "number", ["number", "string", "string"]);
+
     // char *renderData(Toolkit *ic, const char *data, const char *options)
     mapping.renderData = VerovioModule.cwrap("vrvToolkit_renderData", "string", ["number", "string", "string"]);
 
+    // char *renderMeasureWindowToSVG(Toolkit *ic, const char *startId, const char *endId, int xmlDeclaration)
+    mapping.renderMeasureWindowToSVG = VerovioModule.cwrap("vrvToolkit_renderMeasureWindowToSVG", "string", ["number", "string", "string", "number"]);
+
     // char *renderToExpansionMap(Toolkit *ic)
     mapping.renderToExpansionMap = VerovioModule.cwrap("vrvToolkit_renderToExpansionMap", "string", ["number"]);
 
@@ -114,6 +129,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderToSvg(Toolkit *ic, int pageNo, int xmlDeclaration)
     mapping.renderToSVG = VerovioModule.cwrap("vrvToolkit_renderToSVG", "string", ["number", "number", "number"]);
 
+    // char *renderToSVGGlyphSheet(Toolkit *ic, int xmlDeclaration)
+    mapping.renderToSVGGlyphSheet = VerovioModule.cwrap("vrvToolkit_renderToSVGGlyphSheet", "string", ["number", "number"]);
+
     // char *renderToTimemap(Toolkit *ic)
     mapping.renderToTimemap = VerovioModule.cwrap("vrvToolkit_renderToTimemap", "string", ["number", "string"]);
 
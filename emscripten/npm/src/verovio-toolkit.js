@@ -31,6 +31,10 @@ export class VerovioToolkit {
         this.proxy.destructor(this.ptr);
     }
 
+    activateOptionProfile(handle) {
+        return JSON.parse(this.proxy.activateOptionProfile(this.ptr, handle));
+    }
+
     edit(editorAction) {
         return this.proxy.edit(this.ptr, JSON.stringify(editorAction));
     }
@@ -83,6 +87,10 @@ export class VerovioToolkit {
         return this.proxy.getLog(this.ptr);
     }
 
+    getLogEntries() {
+        return JSON.parse(this.proxy.getLogEntries(this.ptr));
+    }
+
     getMEI(options = {}) {
         return this.proxy.getMEI(this.ptr, JSON.stringify(options));
     }
@@ -95,6 +103,10 @@ export class VerovioToolkit {
         return this.proxy.getNotatedIdForElement(this.ptr, xmlId);
     }
 
+    getOptionProfile(name) {
+        return this.proxy.getOptionProfile(this.ptr, name);
+    }
+
     getOptions(defaultValues) {
         if (defaultValues === true) {
             console.warn( "This function (with 'true' parameter) is deprecated. Use getDefaultOptions() instead." );
@@ -159,10 +171,19 @@ export class VerovioToolkit {
         this.proxy.redoPagePitchPosLayout(this.ptr);
     }
 
+    registerOptionProfile(name, options) {
+        options = this.preprocessOptions(options);
+        return this.proxy.registerOptionProfile(this.ptr, name, JSON.stringify(options));
+    }
+
     renderData(data, options) {
         return this.proxy.renderData(this.ptr, data, JSON.stringify(options));
     }
 
+    renderMeasureWindowToSVG(startId, endId, xmlDeclaration = false) {
+        return this.proxy.renderMeasureWindowToSVG(this.ptr, startId, endId, xmlDeclaration);
+    }
+
     renderToExpansionMap() {
         return JSON.parse(this.proxy.renderToExpansionMap(this.ptr));
     }
@@ -179,8 +200,17 @@ export class VerovioToolkit {
         return this.proxy.renderToSVG(this.ptr, pageNo, xmlDeclaration);
     }
 
+    renderToSVGGlyphSheet(xmlDeclaration = false) {
+        return this.proxy.renderToSVGGlyphSheet(this.ptr, xmlDeclaration);
+    }
+
     renderToTimemap(options = {}) {
-        return JSON.parse(this.proxy.renderToTimemap(this.ptr, JSON.stringify(options)));
+        const timemap = this.proxy.renderToTimemap(this.ptr, JSON.stringify(options));
+        // The binary timemap is returned as base64 and is given back as an ArrayBuffer
+        if (options.format === "binary") {
+            return Uint8Array.from(atob(timemap), c => c.charCodeAt(0)).buffer;
+        }
+        return JSON.parse(timemap);
     }
 
     resetOptions() {
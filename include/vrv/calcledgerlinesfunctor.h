@@ -38,23 +38,37 @@ public:
      * Functor interface
      */
     ///@{
+    FunctorCode VisitMeasure(Measure *measure) override;
+    FunctorCode VisitMeasureEnd(Measure *measure) override;
     FunctorCode VisitNote(Note *note) override;
+    FunctorCode VisitStaff(Staff *staff) override;
     FunctorCode VisitStaffEnd(Staff *staff) override;
     ///@}
 
 protected:
     //
 private:
+    /**
+     * Shorten ledger lines of the staff which overlap with neighbors
+     */
+    void AdjustStaffLedgerLines(Staff *staff);
+
     /**
      * Shorten ledger lines which overlap with neighbors
      */
     void AdjustLedgerLines(
         ArrayOfLedgerLines &lines, ArrayOfLedgerLines &cueLines, double cueScaling, int extension, int minExtension);
 
+    /**
+     * Adjust the staves of the measure without notes (and not visited) up to the staff (or to the end if NULL)
+     */
+    void AdjustSkippedStaves(Measure *measure, Staff *staff);
+
 public:
     //
 private:
-    //
+    // The last staff adjusted in the current measure
+    Staff *m_previousStaff;
 };
 
 } // namespace vrv
@@ -45,6 +45,12 @@ public:
      */
     void SetSystemWidth(int width) { m_systemWidth = width; }
 
+    /*
+     * Set if the content system continues after the content processed, when it is cast off by chunks.
+     * Visiting the same content system again then continues the current system.
+     */
+    void SetPartialContent(bool partialContent) { m_partialContent = partialContent; }
+
     /*
      * Functor interface
      */
@@ -88,6 +94,8 @@ private:
     bool m_smart;
     // The leftover system (last system with only one measure)
     System *m_leftoverSystem;
+    // Indicates that more content will be added to the content system
+    bool m_partialContent;
 };
 
 //----------------------------------------------------------------------------
@@ -122,6 +130,16 @@ public:
      */
     void SetPageHeight(int height) { m_pageHeight = height; }
 
+    /*
+     * Setters for continuing the cast off with another content page (progressive layout).
+     * ForcePageBreak makes the next system start a new page.
+     */
+    ///@{
+    void SetContentPage(Page *contentPage) { m_contentPage = contentPage; }
+    void SetCurrentPage(Page *currentPage) { m_currentPage = currentPage; }
+    void ForcePageBreak() { m_forcePageBreak = true; }
+    ///@}
+
     /*
      * Functor interface
      */
@@ -156,6 +174,8 @@ private:
     System *m_leftoverSystem;
     // The pending elements (Mdiv, Score) to be placed at the beginning of a page
     ArrayOfObjects m_pendingPageElements;
+    // A flag indicating that the next system has to start a new page
+    bool m_forcePageBreak;
 };
 
 //----------------------------------------------------------------------------
@@ -21,12 +21,18 @@ class MidiFile;
 
 namespace vrv {
 
+class CastOffPagesFunctor;
+class CastOffSystemsFunctor;
 class DocSelection;
+class FeatureExtractor;
 class FontInfo;
 class Glyph;
+struct MeasureWindowValues;
 class Pages;
 class Page;
 class Score;
+class ScoreDefOptimizeFunctor;
+class ScoreDefSetCurrentFunctor;
 
 enum DocType { Raw = 0, Rendering, Transcription, Facs };
 
@@ -227,6 +233,21 @@ public:
     FontInfo *GetFingeringFont(int staffSize);
     ///@}
 
+    /**
+     * Return a copy of the lyric font for the staff size.
+     * Unlike GetDrawingLyricFont, the member font is not changed and it can be called from parallel jobs.
+     */
+    FontInfo CalcDrawingLyricFont(int staffSize) const;
+
+    /**
+     * @name Give the calling thread its own drawing fonts, starting from the current ones, until they are reset.
+     * This includes the current fonts of the resources and is used for drawing on several threads at once.
+     */
+    ///@{
+    void SetThreadDrawingFonts() const;
+    void ResetThreadDrawingFonts() const;
+    ///@}
+
     /**
      * Get the ratio between the lyric font size and the music font size.
      * This is used when the music font is used within text.
@@ -256,6 +277,8 @@ public:
     /**
      * Prepare the timemap for MIDI and timemap file export.
      * Run trough all the layers and fill the score-time and performance timing variables.
+     * The score-time values do not depend on the MIDI tempo adjustment. When they have already been
+     * calculated, only the performance timing variables are updated for the new tempo adjustment.
      */
     void CalculateTimemap();
 
@@ -273,10 +296,10 @@ public:
     void ExportMIDI(smf::MidiFile *midiFile);
 
     /**
-     * Extract a timemap from the document to a JSON string.
+     * Extract a timemap from the document to a JSON string, or to a binary buffer (see Timemap::ToBinary).
      * Run trough all the layers and fill the timemap file content.
      */
-    bool ExportTimemap(std::string &output, bool includeRests, bool includeMeasures);
+    bool ExportTimemap(std::string &output, bool includeRests, bool includeMeasures, bool binary);
 
     /**
      *  Extract expansionMap from the document to JSON string.
@@ -288,11 +311,18 @@ public:
      */
     bool ExportFeatures(std::string &output, const std::string &options);
 
+    /**
+     * Extract music features with the extractor, calculating the timemap if necessary.
+     * Return false if the timemap could not be calculated.
+     */
+    bool ExtractFeatures(FeatureExtractor &extractor);
+
     /**
      * Set the initial scoreDef of each page.
      * This is necessary for integrating changes that occur within a page.
      * It uses the MusObject::SetPageScoreDef functor method for parsing the file.
      * This will be done only if m_currentScoreDefDone is false or force is true.
+     * It will also be done if the drawing values were modified by a measure window.
      */
     void ScoreDefSetCurrentDoc(bool force = false);
 
@@ -339,6 +369,25 @@ public:
      */
     void CastOffDocBase(bool useSb, bool usePb, bool smart = false);
 
+    /**
+     * Cast off the pending content when the document is laid out progressively.
+     * The pages are cast off until the document has at least pageCount pages (all if VRV_UNSET).
+     * The content is laid out horizontally and cast off into systems by chunks of measures, only as far as needed.
+     * See Options::m_progressiveLayout
+     */
+    void CastOffPendingPages(int pageCount = VRV_UNSET);
+
+    /**
+     * Return true if the document is laid out progressively and not completely cast off yet.
+     * In this case, the last page of the document holds the systems not cast off into pages yet.
+     */
+    bool HasPendingCastOff() const { return (m_castOffPendingPage != NULL); }
+
+    /**
+     * Return the page count, estimated from the pages already cast off if there are pending systems.
+     */
+    int GetEstimatedPageCount() const;
+
     /**
      * Undo the cast off of the entire document.
      * The document will then contain one single page with one single system.
@@ -490,6 +539,19 @@ public:
     void ReactivateSelection(bool resetAligners);
     ///@}
 
+    /**
+     * @name Methods for rendering a measure range without changing the cast off of the document.
+     * The measures (and the system elements in-between) are temporarily moved to a single system of a window page
+     * added at the end of the document. Only the window page is laid out, so the cost is proportional to the size of
+     * the window. ResetMeasureWindow moves the content back and restores its drawing values. Only the pages that held
+     * the window content are laid out again when rendered afterwards.
+     */
+    ///@{
+    Page *InitMeasureWindow(const std::string &startId, const std::string &endId);
+    void ResetMeasureWindow();
+    bool HasMeasureWindow() const { return (m_measureWindowPage != NULL); }
+    ///@}
+
     //----------//
     // Functors //
     //----------//
@@ -510,6 +572,50 @@ private:
      */
     int CalcMusicFontSize();
 
+    /**
+     * Delete the progressive cast off data, but not the pending page that is part of the document.
+     * The content and systems pages are not part of the document and are deleted.
+     */
+    void ClearPendingCastOff();
+
+    /**
+     * Delete the drawing scoreDefs kept for the content system.
+     */
+    void ClearCastOffContentScoreDefs();
+
+    /**
+     * Cast off the content into systems until the pending page has systemCount systems (all if VRV_UNSET).
+     */
+    void CastOffContentSystems(int systemCount);
+
+    /**
+     * Lay out horizontally and cast off into systems the next measureCount measures of the content (all if
+     * VRV_UNSET), without going beyond the end of the current content system. Return the number of measures cast off.
+     */
+    int CastOffContentChunk(int measureCount);
+
+    /**
+     * Set the current scoreDef (and optimize it) for the pages from firstPageIdx, which were cast off progressively.
+     * The processing starts from the state reached at the end of the previous pages.
+     */
+    void ScoreDefSetCurrentCastOffPages(int firstPageIdx);
+
+    /**
+     * Return true if one of the visible scores needs its scoreDef to be optimized.
+     */
+    bool ScoreDefNeedsOptimization();
+
+    /**
+     * Return the scoreDef with the drawing values at the beginning of the measure.
+     * Look for the last measure with a drawing scoreDef in the system, or use the one of the system.
+     */
+    ScoreDef *GetMeasureDrawingScoreDef(Measure *measure);
+
+    /**
+     * Return the object (the object itself or an ancestor) that is a child of a system, NULL if none.
+     */
+    Object *GetSystemChild(Object *object);
+
     /**
      * Generate the measure indices
      */
@@ -520,6 +626,12 @@ private:
      */
     void CollectVisibleScores();
 
+    /**
+     * Fill the performance timing variables of the measures, notes and rests from their score-time values
+     * and the current MIDI tempo adjustment.
+     */
+    void CalculateTimemapRealTime();
+
 public:
     Page *m_selectionPreceding;
     Page *m_selectionFollowing;
@@ -604,6 +716,48 @@ private:
      */
     bool m_isCastOff;
 
+    /**
+     * The page holding the systems not cast off yet and the functor used for casting them off.
+     * The scoreDef functors keep the state reached at the end of the pages cast off, for processing only the new
+     * ones. All are set only when the document is being laid out progressively.
+     */
+    ///@{
+    Page *m_castOffPendingPage;
+    CastOffPagesFunctor *m_castOffPagesFunctor;
+    ScoreDefSetCurrentFunctor *m_castOffScoreDefSetCurrent;
+    ScoreDefOptimizeFunctor *m_castOffScoreDefOptimize;
+    ///@}
+
+    /**
+     * The page holding the content not laid out horizontally yet, the page the functor casts off the systems to
+     * (with the system being filled), and the scoreDef functors processing the systems once they are complete.
+     * The shift is the position of the next measure of the content system (0 before any is cast off from it).
+     * The drawing scoreDefs of the measures cast off from the content system are kept while its staves refer to them.
+     * These are set while the content is not completely cast off into systems.
+     */
+    ///@{
+    Page *m_castOffContentPage;
+    Page *m_castOffSystemsPage;
+    CastOffSystemsFunctor *m_castOffSystemsFunctor;
+    ScoreDefSetCurrentFunctor *m_castOffSystemsScoreDefSetCurrent;
+    ScoreDefOptimizeFunctor *m_castOffSystemsScoreDefOptimize;
+    int m_castOffContentShift;
+    std::vector<ScoreDef *> m_castOffContentScoreDefs;
+    ///@}
+
+    /**
+     * The window page and the parent and position of each object moved to its system.
+     */
+    ///@{
+    Page *m_measureWindowPage;
+    std::vector<std::pair<Object *, int>> m_measureWindowOrigins;
+    ///@}
+
+    /**
+     * The drawing values of the window content in the document, kept aside while the content is in the window page.
+     */
+    MeasureWindowValues *m_measureWindowValues;
+
     /*
      * The following values are set in the Doc::SetDrawingPage.
      * They are all current values to be used when drawing a page in a View and
@@ -651,7 +805,8 @@ private:
     /**
      * A flag to indicate that the timemap has been calculated.  The
      * timemap needs to be prepared before MIDI files or timemap JSON files
-     * are generated. Value is 0.0 when no timemap has been generated.
+     * are generated. Value is 0.0 when no timemap has been generated, and otherwise
+     * the tempo adjustment used for the performance timing variables.
      */
     double m_timemapTempo;
 
@@ -689,6 +844,19 @@ private:
 
     /** Facsimile information */
     Facsimile *m_facsimile;
+
+    //----------------//
+    // Static members //
+    //----------------//
+
+    /** The drawing fonts of the thread, used in place of the ones above when set for the doc */
+    struct ThreadDrawingFonts {
+        const Doc *m_doc = NULL;
+        FontInfo m_drawingSmuflFont;
+        FontInfo m_drawingLyricFont;
+        FontInfo m_fingeringFont;
+    };
+    static thread_local ThreadDrawingFonts s_threadDrawingFonts;
 };
 
 } // namespace vrv
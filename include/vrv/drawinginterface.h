@@ -55,6 +55,12 @@ public:
      */
     ArrayOfObjects *GetDrawingList();
 
+    /**
+     * Return the objects of the drawing list with the given ClassId, in the order they were added.
+     * This avoids going through the full list when drawing it type by type (see View::DrawSystemList)
+     */
+    const ArrayOfObjects &GetDrawingListByClassId(ClassId classId) const;
+
     /**
      * Reset the drawing list.
      * Clears the list - called when the layer starts to be drawn
@@ -69,6 +75,9 @@ protected:
     /** The list of object for which drawing is postponed */
     ArrayOfObjects m_drawingList;
 
+    /** The same list bucketed by ClassId */
+    std::map<ClassId, ArrayOfObjects> m_drawingListByClassId;
+
 private:
     //
 };
@@ -110,7 +110,7 @@ protected:
 //--------------------------------------------------------------------------------
 // Comparator structs
 //--------------------------------------------------------------------------------
-// To be used with std::sort to find the object with a closest bounding
+// To be used with std::min_element to find the object with a closest bounding
 // box to a point defined by the x and y parameters of ClosestBB
 
 struct ClosestBB {
@@ -142,7 +142,7 @@ struct ClosestBB {
     }
 };
 
-// To be used with std::stable_sort to find the position to insert a new accid / divLine
+// To be used with std::min_element to find the position to insert a new accid / divLine
 // TODO: use closesBB instead
 struct ClosestNeume {
     int x;
@@ -152,19 +152,19 @@ struct ClosestNeume {
     {
         // check if neume has neume components
         if (!a->GetFirst(NC)) {
-            LogError("Neume %s doesn't have neume components.", a->GetID().c_str());
+            VRV_LOG_ERROR("Neume %s doesn't have neume components.", a->GetID().c_str());
             return true;
         }
         if (!b->GetFirst(NC)) {
-            LogError("Neume %s doesn't have neume components.", b->GetID().c_str());
+            VRV_LOG_ERROR("Neume %s doesn't have neume components.", b->GetID().c_str());
             return true;
         }
         if (!a->GetFirst(NC)->GetFacsimileInterface()) {
-            LogError("Neume component %s doesn't have facsimile.", a->GetFirst(NC)->GetID().c_str());
+            VRV_LOG_ERROR("Neume component %s doesn't have facsimile.", a->GetFirst(NC)->GetID().c_str());
             return true;
         }
         if (!b->GetFirst(NC)->GetFacsimileInterface()) {
-            LogError("Neume component %s doesn't have facsimile.", b->GetFirst(NC)->GetID().c_str());
+            VRV_LOG_ERROR("Neume component %s doesn't have facsimile.", b->GetFirst(NC)->GetID().c_str());
             return true;
         }
         Zone *zoneA = a->GetFirst(NC)->GetFacsimileInterface()->GetZone();
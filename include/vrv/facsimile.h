@@ -9,6 +9,7 @@
 #define __VRV_FACSIMILE_H__
 
 #include <cassert>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------
 
@@ -43,10 +44,58 @@ public:
     ///@}
     bool IsSupportedChild(Object *object) override;
 
+    /**
+     * Build an ID index of the descendants for a session of lookups, until ClearIndex is called.
+     * The content of the facsimile must not be changed during the session since the index is not updated.
+     */
+    ///@{
+    void IndexDescendants();
+    void ClearIndex();
+    bool IsIndexed() const { return m_isIndexed; }
+    ///@}
+
+    /**
+     * Find a descendant (e.g., a zone or a surface) by ID.
+     * The lookup uses the ID index when one was built with IndexDescendants and walks the tree otherwise.
+     */
+    ///@{
+    Object *FindIndexedDescendantByID(const std::string &id);
+    const Object *FindIndexedDescendantByID(const std::string &id) const;
+    ///@}
+
     Zone *FindZoneByID(const std::string &zoneId);
     const Zone *FindZoneByID(const std::string &zoneId) const;
+
+    /**
+     * Return the maximum x and y of the surfaces.
+     * The values are cached until a surface or a zone is added, deleted or shifted (see Object::Modify).
+     * Code changing the coordinates of a zone directly has to call ResetCachedExtents.
+     */
+    ///@{
     int GetMaxX() const;
     int GetMaxY() const;
+    void ResetCachedExtents()
+    {
+        m_cachedMaxX = VRV_UNSET;
+        m_cachedMaxY = VRV_UNSET;
+    }
+    ///@}
+
+private:
+    /**
+     * Compute the maximum x and y of the surfaces if they are not cached
+     */
+    void CacheExtents() const;
+
+public:
+    //
+private:
+    /** The ID index of the descendants during a session of lookups */
+    std::unordered_map<std::string, Object *> m_descendantsByID;
+    bool m_isIndexed;
+    /** The cached maximum x and y of the surfaces */
+    mutable int m_cachedMaxX;
+    mutable int m_cachedMaxY;
 };
 
 } // namespace vrv
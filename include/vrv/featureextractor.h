@@ -12,10 +12,6 @@
 
 #include "options.h"
 
-//----------------------------------------------------------------------------
-
-#include "jsonxx.h"
-
 namespace vrv {
 
 class FeatureExtractor {
@@ -45,8 +41,18 @@ public:
      */
     void ToJson(std::string &output);
 
+    /**
+     * Set the extractor to fill only the numeric pitches and not the strings and the IDs.
+     * This is what the corpus extraction needs and avoids allocating strings for each note.
+     */
+    void SetNumericOnly(bool numericOnly) { m_numericOnly = numericOnly; }
+
 private:
-    //
+    /**
+     * Fill the string features and the IDs for a note that is not tied to a previous one
+     */
+    void ExtractStrings(const Note *note);
+
 public:
     /**
      * A list of previous notes for interval calculation.
@@ -54,18 +60,103 @@ public:
      */
     std::list<const Note *> m_previousNotes;
 
-    jsonxx::Array m_pitchesChromatic;
-    jsonxx::Array m_pitchesChromaticWithDuration;
-    jsonxx::Array m_pitchesDiatonic;
-    jsonxx::Array m_pitchesIds;
+    std::vector<std::string> m_pitchesChromatic;
+    std::vector<std::string> m_pitchesChromaticWithDuration;
+    std::vector<std::string> m_pitchesDiatonic;
+    std::vector<std::vector<std::string>> m_pitchesIds;
+
+    std::vector<std::string> m_intervalsChromatic;
+    std::vector<std::string> m_intervalsDiatonic;
+    std::vector<std::string> m_intervalGrossContour;
+    std::vector<std::string> m_intervalRefinedContour;
+    std::vector<std::vector<std::string>> m_intervalsIds;
 
-    jsonxx::Array m_intervalsChromatic;
-    jsonxx::Array m_intervalsDiatonic;
-    jsonxx::Array m_intervalGrossContour;
-    jsonxx::Array m_intervalRefinedContour;
-    jsonxx::Array m_intervalsIds;
+    /**
+     * The MIDI and diatonic pitch of each entry in the pitch lists.
+     * The intervals are the differences between two consecutive pitches.
+     */
+    std::vector<int> m_pitchesMIDI;
+    std::vector<int> m_pitchesDiatonicValues;
+
+private:
+    /** A flag indicating that only the numeric pitches are filled */
+    bool m_numericOnly;
+};
 
+//----------------------------------------------------------------------------
+// FeatureCorpus
+//----------------------------------------------------------------------------
+
+/**
+ * This class gathers the features of a corpus of documents for building a search index.
+ * The documents are stored in slots that can be filled in any order and from several threads, as long as
+ * each slot is filled by only one thread.
+ */
+class FeatureCorpus {
+
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    FeatureCorpus(int documentCount, int ngramLength);
+    virtual ~FeatureCorpus() {}
+    ///@}
+
+    /**
+     * Fill the slot of a document with the pitches of the extractor.
+     * A document that could not be loaded is added with no extractor.
+     */
+    void SetDocument(int index, const std::string &name, const FeatureExtractor *extractor);
+
+    /**
+     * @name Getters for the totals of the corpus
+     */
+    ///@{
+    int GetDocumentCount() const { return (int)m_documents.size(); }
+    int GetNoteCount() const;
+    int GetIntervalCount() const;
+    int GetNgramCount() const;
+    ///@}
+
+    /**
+     * Write the corpus to the output string in a compact columnar binary format.
+     * All values are little-endian and each column is contiguous, so that it can be read without copying.
+     * The layout is:
+     * - header: 8 uint32 (magic "VRVF", version 1, document count D, note count N, interval count I,
+     *   n-gram length L, n-gram count G, string byte count S)
+     * - uint32 notes[D + 1], intervals[D + 1], ngrams[D + 1]: the document d has the notes from notes[d] to
+     *   notes[d + 1], and the same for the intervals and the n-grams
+     * - uint32 names[D + 1]: the name of the document d is the UTF-8 string from strings[names[d]] to
+     *   strings[names[d + 1]]
+     * - uint32 ngram[G]: the FNV-1a hash of the L consecutive chromatic intervals starting at each interval
+     * - uint8 pitchMIDI[N], uint8 pitchDiatonic[N]: the MIDI pitch and the diatonic pitch (octave * 7 + step)
+     * - int8 intervalChromatic[I], int8 intervalDiatonic[I]: the intervals in semitones and in steps
+     * - char strings[S]: the document names, without separators
+     * A document that could not be loaded has no notes.
+     */
+    void ToBinary(std::string &output) const;
+
+private:
+    /**
+     * The features of one document
+     */
+    struct FeatureDocument {
+        std::string m_name;
+        std::vector<uint8_t> m_pitchesMIDI;
+        std::vector<uint8_t> m_pitchesDiatonic;
+        std::vector<int8_t> m_intervalsChromatic;
+        std::vector<int8_t> m_intervalsDiatonic;
+        std::vector<uint32_t> m_ngrams;
+    };
+
+public:
+    //
 private:
+    /** The length of the interval n-grams */
+    int m_ngramLength;
+    /** The documents in the order of the input */
+    std::vector<FeatureDocument> m_documents;
 };
 
 } // namespace vrv
@@ -71,6 +71,22 @@ public:
     }
     ///@}
 
+    /**
+     * Getter/Setter for the ClassIds visited by the functor.
+     * When set, Object::Process skips the subtrees that do not contain any of them.
+     * The functor has to list all the ClassIds it needs to reach, including the ones of the
+     * container objects it processes in its own (e.g., an aligner processed on measure end).
+     * An empty set (default) means that all objects are visited.
+     */
+    ///@{
+    const ClassIdSet &GetVisitedClassIds() const { return m_visitedClassIds; }
+    void SetVisitedClassIds(const std::vector<ClassId> &classIds)
+    {
+        m_visitedClassIds.reset();
+        for (ClassId classId : classIds) m_visitedClassIds[classId] = true;
+    }
+    ///@}
+
     /**
      * Return true if the functor implements the end interface
      */
@@ -89,6 +105,8 @@ private:
     bool m_visibleOnly = true;
     // Direction
     bool m_direction = FORWARD;
+    // The ClassIds visited by the functor
+    ClassIdSet m_visitedClassIds;
 };
 
 //----------------------------------------------------------------------------
@@ -129,6 +129,12 @@ private:
     int m_stafflines = 5;
     int m_transpose = 0;
     ContainerElement m_containerElement;
+    /*
+     * The line being parsed and the pitches altered by the key signature
+     */
+    std::string m_abcLine;
+    std::string m_keyPitchAlter;
+    int m_keyPitchAlterAmount = 0;
     /*
      * ABC metadata stacks
      */
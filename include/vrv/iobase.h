@@ -72,6 +72,12 @@ public:
     // read
     virtual bool Import(std::string const &data) { return true; }
 
+    /**
+     * Import from a buffer that can be modified by the input (e.g., for parsing it in place).
+     * The content of the buffer is undefined afterwards. By default, the buffer is imported with Import.
+     */
+    virtual bool ImportInplace(std::string &data) { return this->Import(data); }
+
     /**
      * Getter for layoutInformation flag that is set to true during import
      * if layout information is found (and not to be ignored).
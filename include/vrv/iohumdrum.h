@@ -363,6 +363,25 @@ namespace humaux {
         // glissando start tokens
         std::vector<hum::HTp> glissStarts;
     };
+
+    /////////////////////////////////////////////////////////////////////
+
+    // HumdrumFilter == Apply the global filters of a file.  The filter
+    // pipeline of hum::Tool_filter re-parses the Humdrum text produced by
+    // each tool.  Tools that only edit the tokens of the file in place and
+    // output the file itself (such as autobeam) do not need that, so a
+    // pipeline is run directly by runInPlace(), which parses the output
+    // of a tool again only when the tool rewrites the file (for example
+    // when it changes the spine structure).
+    class HumdrumFilter : public hum::Tool_filter {
+    public:
+        bool runInPlace(hum::HumdrumFile &infile);
+
+    protected:
+        typedef bool (*PipelineTool)(const std::string &options, hum::HumdrumFile &infile);
+        static const std::map<std::string, PipelineTool> s_pipelineTools;
+    };
+
 } // namespace humaux
 
 class HumdrumSignifiers {
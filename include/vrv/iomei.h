@@ -199,8 +199,9 @@ public:
 
     /**
      * The main method for exporting the file to MEI.
+     * The xml elements are streamed to the output as the measures are completed.
      */
-    bool Export();
+    bool Export(std::ostream &output);
 
     /**
      * The main method for writing objects.
@@ -211,7 +212,8 @@ public:
     ///@}
 
     /**
-     * Return the output as a string by writing it to the stringstream member.
+     * Return the output as a string.
+     * The document is serialized directly into the returned string.
      */
     std::string GetOutput();
 
@@ -268,6 +270,30 @@ public:
     void SetRemoveIds(bool removeIds) { m_removeIds = removeIds; }
 
 private:
+    /**
+     * Export the file to MEI through the pugi writer
+     */
+    bool Export(pugi::xml_writer &writer);
+
+    /**
+     * @name Methods for streaming the xml elements to the writer during the export.
+     * The elements completed before the current node are written and removed from the document, so that it never
+     * holds more than the current path and the content of one measure. The start tags of the elements along the
+     * current node path are written when their first child is, and their end tags when they are completed.
+     * Streaming up to an empty path writes everything left in the document.
+     */
+    ///@{
+    void StreamNodes(const std::vector<pugi::xml_node> &path);
+    void StreamNode(pugi::xml_node node, int depth);
+    void StreamStartTag(pugi::xml_node node, int depth);
+    void StreamEndTag(pugi::xml_node node, int depth);
+    ///@}
+
+    /**
+     * Return true if the attributes of the node have to be pruned for MEI basic
+     */
+    bool IsPrunedNode(pugi::xml_node node) const;
+
     /**
      * Reset
      */
@@ -562,7 +588,6 @@ private:
 public:
     //
 private:
-    std::ostringstream m_streamStringOutput;
     int m_indent;
     bool m_scoreBasedMEI;
     /** A flag indicating that we want to produce MEI basic */
@@ -578,6 +603,15 @@ private:
     /** The object stack */
     std::deque<Object *> m_objectStack;
 
+    /** Streaming output */
+    ///@{
+    pugi::xml_writer *m_streamWriter;
+    std::string m_streamIndent;
+    unsigned int m_streamFlags;
+    /** The elements with their start tag written, from the root */
+    std::vector<pugi::xml_node> m_streamedNodes;
+    ///@}
+
     /** Score based filtering */
     ///@{
     bool m_hasFilter;
@@ -614,8 +648,10 @@ public:
     virtual ~MEIInput();
 
     bool Import(const std::string &mei) override;
+    bool ImportInplace(std::string &mei) override;
 
 private:
+    bool ImportDocument(pugi::xml_document &doc);
     bool ReadDoc(pugi::xml_node root);
     bool ReadIncipits(pugi::xml_node root);
 
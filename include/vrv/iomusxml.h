@@ -206,8 +206,11 @@ private:
 #ifndef NO_MUSICXML_SUPPORT
 public:
     bool Import(const std::string &musicxml) override;
+    bool ImportInplace(std::string &musicxml) override;
 
 private:
+    bool ImportDocument(pugi::xml_document &xmlDoc);
+
     /*
      * Top level method called from ImportFile or Import
      */
@@ -19,6 +19,7 @@
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+#include <bitset>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -578,22 +579,18 @@ private:
      *
      * The order in which they are called is important.
      * For example, KeySig have to be converted before Pitch, because pitch charachters used
-     * in KeySig needs to be consumed first
+     * in KeySig needs to be consumed first.
+     * ConvertScoreDefElements handles keySigs, clefs and meterSigs (or mensurs), and ConvertNotes rests, pitches,
+     * octaves, trills and fermatas, each in a single pass over the tokens
      */
     ///@{
-    bool ConvertKeySig();
-    bool ConvertClef();
-    bool ConvertMeterSigOrMensur();
+    bool ConvertScoreDefElements();
     bool ConvertMeasure();
     bool ConvertRepeatedFigure();
     bool ConvertRepeatedMeasure();
     bool ConvertMRestOrMultiRest();
-    bool ConvertPitch();
-    bool ConvertOctave();
-    bool ConvertTrill();
-    bool ConvertFermata();
+    bool ConvertNotes();
     bool ConvertAccidental();
-    bool ConvertRest();
     bool ConvertChord();
     bool ConvertBeam();
     bool ConvertGrace();
@@ -704,9 +701,17 @@ private:
      * - closing tags are missing (in non-pendantic modes)
      * - opening tags are not part of the PAE syntax (e.g., a chord)
      * Each token also stores the original position in the PAE string.
+     * This is a list and not a vector because the conversion passes insert tokens in the middle of it while keeping
+     * iterators and pointers to other tokens (e.g., the first note of a chord or the opening token of a fermata).
      */
     std::list<pae::Token> m_pae;
 
+    /**
+     * The set of (ASCII) input characters found in the tokens.
+     * Filled in AddToken and used by HasInput to skip converting passes.
+     */
+    std::bitset<128> m_inputChars;
+
     /**
      * A flag indicating the incipit is mensural.
      * Based on the \@clef of the input.
@@ -0,0 +1,217 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        jsonstream.h
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_JSONSTREAM_H__
+#define __VRV_JSONSTREAM_H__
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// JsonWriter
+//----------------------------------------------------------------------------
+
+/**
+ * This class writes JSON directly to a string without building a tree of values.
+ * The output is formatted exactly as jsonxx::Object::json() and jsonxx::Array::json(), which means that
+ * the keys of an object have to be written in alphabetical order for the output to be the same (this is asserted).
+ */
+class JsonWriter {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     * The output string is cleared.
+     */
+    ///@{
+    JsonWriter(std::string &output);
+    virtual ~JsonWriter() {}
+    ///@}
+
+    /**
+     * @name Start and end an object or an array.
+     * Ending the top-level object or array finalizes the output.
+     */
+    ///@{
+    void StartObject();
+    void EndObject() { this->End('}'); }
+    void StartArray();
+    void EndArray() { this->End(']'); }
+    ///@}
+
+    /**
+     * Write the key of the next value in an object
+     */
+    void Key(std::string_view key);
+
+    /**
+     * @name Write a value.
+     * Numbers are written with the precision of jsonxx (std::numeric_limits<long double>::digits10 + 1 significant
+     * digits), or with a fixed number of decimals if a precision is given.
+     */
+    ///@{
+    void String(std::string_view value);
+    void Number(double value, int precision = -1);
+    void Bool(bool value);
+    void Null();
+    void StringArray(const std::vector<std::string> &values);
+    ///@}
+
+private:
+    /**
+     * Write the indentation before a value, unless it follows a key
+     */
+    void Indent();
+
+    /**
+     * Close the current container
+     */
+    void End(char closing);
+
+    /**
+     * Replace the comma after the last value written with a space
+     */
+    void RemoveLastComma();
+
+    /**
+     * Append an escaped string
+     */
+    void Escape(std::string_view value);
+
+public:
+    //
+private:
+    /** The output string */
+    std::string &m_output;
+    /** The current depth */
+    int m_depth;
+    /** A flag indicating that the last token was a key */
+    bool m_afterKey;
+    /** The last key written in each open object, for checking the key order */
+    std::vector<std::string> m_keys;
+};
+
+//----------------------------------------------------------------------------
+// JsonReader
+//----------------------------------------------------------------------------
+
+enum class JsonType { Null, Bool, Number, String, Array, Object };
+
+/**
+ * This class parses a JSON string into a flat array of nodes referring to the input.
+ * Strings are unescaped only when they are read, so parsing does not allocate anything beyond the node array.
+ * The input must stay valid as long as the reader is used.
+ * Nodes are identified by their index, 0 being the root node. Members of an object are stored as a key node
+ * followed by its value node. The parser is as permissive as jsonxx: it accepts single-quoted strings, comments
+ * starting with //, trailing commas, and ignores what follows the root value.
+ */
+class JsonReader {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    JsonReader() {}
+    virtual ~JsonReader() {}
+    ///@}
+
+    /**
+     * Parse the input. Return false if it is not valid JSON.
+     */
+    bool Parse(std::string_view input);
+
+    /**
+     * @name Getters for a node.
+     * For an array or an object, GetSize returns the number of values or members, and GetText the full JSON text.
+     */
+    ///@{
+    bool Is(int node, JsonType type) const { return (node >= 0) && (m_nodes.at(node).m_type == type); }
+    int GetSize(int node) const { return m_nodes.at(node).m_size; }
+    bool GetBool(int node) const { return m_nodes.at(node).m_number != 0.0; }
+    double GetNumber(int node) const { return m_nodes.at(node).m_number; }
+    std::string GetString(int node) const;
+    std::string_view GetText(int node) const { return m_nodes.at(node).m_text; }
+    ///@}
+
+    /**
+     * @name Iterate over the values of an array or the members of an object.
+     * For an object, the iteration is over the keys, and the value of a key is the next node.
+     * Return -1 at the end.
+     */
+    ///@{
+    int GetFirst(int node) const { return (this->GetSize(node) > 0) ? node + 1 : -1; }
+    int GetNext(int parent, int node) const;
+    ///@}
+
+    /**
+     * Return the value node for a key in an object (-1 if not found).
+     * With duplicated keys, the last one is returned.
+     */
+    int Find(int object, std::string_view key) const;
+
+    /**
+     * Return the keys of an object in alphabetical order with their value node.
+     * With duplicated keys, the last one is kept.
+     */
+    std::vector<std::pair<std::string, int>> GetMembers(int object) const;
+
+    /**
+     * @name Read the value of a key in an object if it has the appropriate type.
+     * Return false and leave the value unchanged otherwise.
+     */
+    ///@{
+    bool Get(int object, std::string_view key, bool &value) const;
+    bool Get(int object, std::string_view key, int &value) const;
+    bool Get(int object, std::string_view key, double &value) const;
+    bool Get(int object, std::string_view key, std::string &value) const;
+    ///@}
+
+private:
+    struct JsonNode {
+        JsonType m_type;
+        /** The number of values or members for an array or an object */
+        int m_size;
+        /** The index of the node following the value and its descendants */
+        int m_next;
+        /** The value of a number, or 1.0 / 0.0 for a boolean */
+        double m_number;
+        /** The content of a string between the quotes, or the text of an array or an object */
+        std::string_view m_text;
+        /** A flag indicating that a string has escape sequences */
+        bool m_escaped;
+    };
+
+    /**
+     * @name Parsing methods, advancing m_pos
+     */
+    ///@{
+    bool ParseValue(int depth);
+    bool ParseString();
+    bool ParseContainer(bool isObject, int depth);
+    bool Match(char c);
+    bool Match(std::string_view literal);
+    void SkipWhitespace();
+    ///@}
+
+public:
+    //
+private:
+    /** The input */
+    std::string_view m_input;
+    /** The current position in the input when parsing */
+    size_t m_pos = 0;
+    /** The parsed nodes */
+    std::vector<JsonNode> m_nodes;
+};
+
+} // namespace vrv
+
+#endif // __VRV_JSONSTREAM_H__
@@ -171,6 +171,29 @@ public:
 
     void ResetStaffDefObjects();
 
+    /**
+     * @name Move the staffDef objects (including the cautionary ones) out of the layer and back.
+     * This keeps the drawing values while the layer is temporarily rendered elsewhere.
+     * The layer must not have any staffDef object when attaching them back.
+     */
+    ///@{
+    struct StaffDefObjects {
+        Clef *m_clef = NULL;
+        KeySig *m_keySig = NULL;
+        Mensur *m_mensur = NULL;
+        MeterSig *m_meterSig = NULL;
+        MeterSigGrp *m_meterSigGrp = NULL;
+        bool m_drawKeySigCancellation = false;
+        Clef *m_cautionClef = NULL;
+        KeySig *m_cautionKeySig = NULL;
+        Mensur *m_cautionMensur = NULL;
+        MeterSig *m_cautionMeterSig = NULL;
+        bool m_drawCautionKeySigCancel = false;
+    };
+    StaffDefObjects DetachStaffDefObjects();
+    void AttachStaffDefObjects(const StaffDefObjects &staffDefObjects);
+    ///@}
+
     /**
      * Set drawing clef, keysig, mensur, metersig, metersiggrp if necessary and if available.
      */
@@ -258,12 +258,15 @@ public:
 
     /**
      * @name Setter and getter of the drawing scoreDef
+     * DetachDrawingScoreDef passes the ownership of the drawing scoreDef to the caller, which can attach it back.
      */
     ///@{
     ScoreDef *GetDrawingScoreDef() { return m_drawingScoreDef; }
     const ScoreDef *GetDrawingScoreDef() const { return m_drawingScoreDef; }
     void SetDrawingScoreDef(ScoreDef *drawingScoreDef);
     void ResetDrawingScoreDef();
+    ScoreDef *DetachDrawingScoreDef();
+    void AttachDrawingScoreDef(ScoreDef *drawingScoreDef);
     ///@}
 
     /**
@@ -52,7 +52,6 @@ public:
     FunctorCode VisitChordEnd(Chord *chord) override;
     FunctorCode VisitLayer(Layer *layer) override;
     FunctorCode VisitLayerElement(LayerElement *layerElement) override;
-    FunctorCode VisitMeasure(Measure *measure) override;
     FunctorCode VisitStaff(Staff *staff) override;
     FunctorCode VisitTabGrpEnd(TabGrp *tabGrp) override;
     ///@}
@@ -66,12 +65,51 @@ public:
 private:
     // The current score time in the measure (incremented by each element)
     double m_currentScoreTime;
-    // The current real time in seconds in the measure (incremented by each element)
-    double m_currentRealTimeSeconds;
     // The current time alignment parameters
     AlignMeterParams m_meterParams;
     // The current notation type
     data_NOTATIONTYPE m_notationType;
+};
+
+//----------------------------------------------------------------------------
+// InitRealTimeFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class sets the real-time onsets and offsets of notes and rests from their score time.
+ * It uses the tempo of each measure and needs to be called after InitMaxMeasureDurationFunctor.
+ */
+class InitRealTimeFunctor : public Functor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    InitRealTimeFunctor();
+    virtual ~InitRealTimeFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitMeasure(Measure *measure) override;
+    FunctorCode VisitNote(Note *note) override;
+    FunctorCode VisitRest(Rest *rest) override;
+    ///@}
+
+protected:
+    //
+private:
+    //
+public:
+    //
+private:
     // The current tempo
     double m_currentTempo;
 };
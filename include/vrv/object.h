@@ -8,6 +8,7 @@
 #ifndef __VRV_OBJECT_H__
 #define __VRV_OBJECT_H__
 
+#include <atomic>
 #include <cstdlib>
 #include <functional>
 #include <iterator>
@@ -290,7 +291,11 @@ public:
      * Return a reference to the children that allows modification.
      * This method should be all only in AddChild overrides methods
      */
-    ArrayOfObjects &GetChildrenForModification() { return m_children; }
+    ArrayOfObjects &GetChildrenForModification()
+    {
+        this->ResetSubtreeClassIds();
+        return m_children;
+    }
 
     /**
      * Fill an array of pairs with all attributes and their values.
@@ -591,6 +596,18 @@ public:
      */
     void Modify(bool modified = true) const;
 
+    /**
+     * Return true if the object or any of its descendants is of one of the ClassIds of the set.
+     * The ClassIds present in the subtree are cached and the cache is invalidated by Object::Modify.
+     */
+    bool HasClassIdInSubtree(const ClassIdSet &classIds) const;
+
+    /**
+     * Fill the ClassId cache of the whole subtree.
+     * The cache is otherwise filled lazily and this must be called before processing subtrees in parallel.
+     */
+    void CacheSubtreeClassIds() const;
+
     /**
      * @name Setter and getter of the attribute flag
      */
@@ -649,6 +666,15 @@ public:
     void Process(ConstFunctor &functor, int deepness = UNLIMITED_DEPTH, bool skipFirst = false) const;
     ///@}
 
+    /**
+     * Process several functors in a single traversal of the tree.
+     * For each object, the functors are called in the order of the vector, and the end interface in the same order
+     * once the children have been processed. Each functor keeps its own code, filters and visited class ids, so the
+     * functors are processed as if run one after the other, as long as they do not depend on each other in another
+     * object than the one being visited. All the functors must have the same direction.
+     */
+    void Process(const std::vector<Functor *> &functors, int deepness = UNLIMITED_DEPTH, bool skipFirst = false);
+
     /**
      * Interface for class functor visitation
      */
@@ -701,8 +727,20 @@ private:
     ///@{
     bool SkipChildren(bool visibleOnly) const;
     bool FiltersApply(const Filters *filters, Object *object) const;
+    bool VisitedClassIdsApply(const ClassIdSet &classIds, const Object *object) const;
+    void ProcessFunctors(const std::vector<Functor *> &functors, uint32_t active, int deepness, bool skipFirst);
     ///@}
 
+    /**
+     * Return the ClassIds of all the descendants, (re-)building the cache if necessary.
+     */
+    const ClassIdSet &GetSubtreeClassIds() const;
+
+    /**
+     * Invalidate the ClassId cache of the object and of its ancestors.
+     */
+    void ResetSubtreeClassIds() const;
+
 public:
     /**
      * Keep an array of unsupported attributes as pairs.
@@ -748,8 +786,18 @@ private:
      * This is useful for object using sub-lists of objects when drawing.
      * For example, Beam has a list of children notes and this value indicates if the
      * list needs to be updated or not. Is is mostly an optimization feature.
+     * It is atomic because objects processed in parallel (see Page::ProcessMeasures) mark their shared ancestors.
      */
-    mutable bool m_isModified;
+    mutable std::atomic<bool> m_isModified;
+
+    /**
+     * The ClassIds of all the descendants of the object, used for pruning functor processing.
+     * The cache is valid only when m_subtreeClassIdsValid is true.
+     */
+    ///@{
+    mutable ClassIdSet m_subtreeClassIds;
+    mutable std::atomic<bool> m_subtreeClassIdsValid;
+    ///@}
 
     /**
      * Members used for caching iterator values.
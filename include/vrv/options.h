@@ -100,6 +100,7 @@ public:
     {
         m_shortOption = 0;
         m_isCmdOnly = false;
+        m_isLayoutIndependent = false;
     }
     virtual ~Option() {}
     virtual void CopyTo(Option *option) = 0;
@@ -117,6 +118,11 @@ public:
     virtual void Reset() = 0;
     virtual bool IsSet() const = 0;
 
+    /**
+     * Return true if the option has the same value as the option passed as parameter (of the same type)
+     */
+    virtual bool HasSameValue(const Option *option) const;
+
     void SetInfo(const std::string &title, const std::string &description);
     std::string GetTitle() const { return m_title; }
     std::string GetDescription() const { return m_description; }
@@ -126,6 +132,12 @@ public:
     bool IsCmdOnly() const { return m_isCmdOnly; }
     virtual bool IsArgumentRequired() const { return true; }
 
+    /**
+     * Mark the option as having no effect on the layout, meaning that it does not need to be redone when changed
+     */
+    void SetLayoutIndependent() { m_isLayoutIndependent = true; }
+    bool IsLayoutIndependent() const { return m_isLayoutIndependent; }
+
     /**
      * Return a JSON object for the option
      */
@@ -160,6 +172,8 @@ private:
     char m_shortOption;
     /* a flag indicating that the option is available only on the command line */
     bool m_isCmdOnly;
+    /* a flag indicating that the option has no effect on the layout */
+    bool m_isLayoutIndependent;
 };
 
 //----------------------------------------------------------------------------
@@ -185,6 +199,7 @@ public:
 
     void Reset() override;
     bool IsSet() const override;
+    bool HasSameValue(const Option *option) const override;
 
     bool GetValue() const { return m_value; }
     bool GetDefault() const { return m_defaultValue; }
@@ -229,6 +244,7 @@ public:
 
     void Reset() override;
     bool IsSet() const override;
+    bool HasSameValue(const Option *option) const override;
 
     double GetValue() const;
     double GetUnfactoredValue() const;
@@ -277,6 +293,7 @@ public:
 
     void Reset() override;
     bool IsSet() const override;
+    bool HasSameValue(const Option *option) const override;
 
     int GetValue() const;
     int GetUnfactoredValue() const;
@@ -321,6 +338,7 @@ public:
 
     void Reset() override;
     bool IsSet() const override;
+    bool HasSameValue(const Option *option) const override;
 
 private:
     //
@@ -357,6 +375,7 @@ public:
 
     void Reset() override;
     bool IsSet() const override;
+    bool HasSameValue(const Option *option) const override;
 
 private:
     std::string GetStr(const std::vector<std::string> &values) const;
@@ -396,6 +415,7 @@ public:
 
     void Reset() override;
     bool IsSet() const override;
+    bool HasSameValue(const Option *option) const override;
 
 private:
     //
@@ -599,6 +619,9 @@ public:
     // These options are only given for documentation - except for m_scale
     // They are ordered by short option alphabetical order
     OptionBool m_standardOutput;
+    OptionString m_serve;
+    OptionString m_corpus;
+    OptionInt m_corpusThreads;
     OptionString m_help;
     OptionBool m_allPages;
     OptionString m_inputFrom;
@@ -632,6 +655,7 @@ public:
     OptionBool m_incip;
     OptionBool m_justifyVertically;
     OptionBool m_landscape;
+    OptionInt m_layoutThreads;
     OptionDbl m_minLastJustification;
     OptionBool m_mmOutput;
     OptionBool m_moveScoreDefinitionToStaff;
@@ -650,6 +674,7 @@ public:
     OptionInt m_pageWidth;
     OptionIntMap m_pedalStyle;
     OptionBool m_preserveAnalyticalMarkup;
+    OptionBool m_progressiveLayout;
     OptionBool m_removeIds;
     OptionBool m_scaleToPageSize;
     OptionBool m_setLocale;
@@ -663,6 +688,8 @@ public:
     OptionBool m_svgHtml5;
     OptionBool m_svgFormatRaw;
     OptionBool m_svgRemoveXlink;
+    OptionBool m_svgGlyphSheet;
+    OptionString m_svgGlyphSheetUrl;
     OptionArray m_svgAdditionalAttribute;
     OptionDbl m_unit;
     OptionBool m_useFacsimile;
@@ -854,6 +881,48 @@ private:
     std::vector<OptionGrp *> m_grps;
 };
 
+//----------------------------------------------------------------------------
+// OptionProfile
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds a named set of option values validated once.
+ * The values are stored in options of their own, each of them paired with the option it sets.
+ */
+class OptionProfile {
+public:
+    // constructors and destructors
+    OptionProfile(const std::string &name) { m_name = name; }
+    virtual ~OptionProfile() {}
+
+    std::string GetName() const { return m_name; }
+
+    /**
+     * The options in which the values of the profile are set
+     */
+    Options *GetValues() { return &m_values; }
+
+    /**
+     * Add a value of the profile with the option it sets
+     */
+    void AddEntry(Option *value, Option *option) { m_entries.push_back({ value, option }); }
+
+    /**
+     * Copy the values to the options they set, and fill the list with the options that were changed
+     */
+    void Apply(std::vector<Option *> &changed) const;
+
+public:
+    /** The input and output formats set by the profile (empty if not set) */
+    std::string m_inputFrom;
+    std::string m_outputTo;
+
+private:
+    std::string m_name;
+    Options m_values;
+    std::vector<std::pair<Option *, Option *>> m_entries;
+};
+
 } // namespace vrv
 
 #endif // CUSTOM_VEROVIO_OPTIONS
@@ -87,6 +87,11 @@ public:
      */
     void LayOut(bool force = false);
 
+    /**
+     * Reset the layout flag so the page is laid out again the next time.
+     */
+    void ResetLayoutDone() { m_layoutDone = false; }
+
     /**
      * Do the layout for a transcription page (with layout information).
      * This only calculates positioning or layer element parts using provided layout of parents.
@@ -170,6 +175,29 @@ private:
      */
     bool IsJustificationRequired(const Doc *doc);
 
+    /**
+     * Process the functor on the page, with the systems processed in parallel when threadCount is greater than 1.
+     * Each system is then processed with its own copy of the functor and the copies are returned for merging
+     * their state. Other children of the page are processed with the functor itself once the systems are done.
+     * The page itself is visited with the functor before copying it, and at the end once everything is processed.
+     */
+    template <class FUNCTOR> std::vector<FUNCTOR> ProcessSystems(FUNCTOR &functor, int threadCount);
+
+    /**
+     * Process the functor on the page, with the measures processed in parallel when threadCount is greater than 1.
+     * The functor is then copied when reaching a measure and each measure is processed with its copy.
+     * This must only be used with functors for which the processing of a measure does not depend on other measures.
+     * Since the end of the systems and of the page is reached before the measures are processed, the functor must
+     * not implement the end interface for them (or for objects in general), which is checked at compile time.
+     */
+    template <class FUNCTOR> void ProcessMeasures(FUNCTOR &functor, int threadCount);
+
+    /**
+     * Check whether an extender element of the page is laid out in more than one system.
+     * The positioners of extenders are aligned across systems and cannot be adjusted in parallel.
+     */
+    bool HasCrossSystemExtenders();
+
     //
 public:
     /** Page width (MEI scoredef@page.width). Saved if != -1 */
@@ -337,7 +337,7 @@ public:
      * Getter and modifier for the interface / id pairs
      */
     ///@{
-    const ArrayOfPlistInterfaceIDPairs &GetInterfaceIDPairs() const { return m_interfaceIDPairs; }
+    const MapOfPlistInterfaceIDPairs &GetInterfaceIDPairs() const { return m_interfaceIDPairs; }
     void InsertInterfaceIDPair(const std::string &elementID, PlistInterface *interface);
     ///@}
 
@@ -355,8 +355,8 @@ private:
 public:
     //
 private:
-    // Holds the interface / id pairs to match
-    ArrayOfPlistInterfaceIDPairs m_interfaceIDPairs;
+    // Holds the id / interface pairs to match
+    MapOfPlistInterfaceIDPairs m_interfaceIDPairs;
 };
 
 //----------------------------------------------------------------------------
@@ -503,11 +503,17 @@ private:
     // Delegates to the pseudo functor of the interface
     FunctorCode CallPseudoFunctor(Object *timeSpanningObject);
 
+    // Remove the interface / owner pair from the list and from the index, skipping the index entry for skipID
+    ListOfSpanningInterOwnerPairs::iterator EraseInterfaceOwnerPair(
+        ListOfSpanningInterOwnerPairs::iterator iter, const std::string &skipID = "");
+
 public:
     //
 private:
     // The interface list that holds the current elements to match
     ListOfSpanningInterOwnerPairs m_timeSpanningInterfaces;
+    // The interfaces of the list indexed by the start and end id they still wait for
+    std::unordered_map<std::string, std::vector<ListOfSpanningInterOwnerPairs::iterator>> m_timeSpanningIDs;
     // Indicates whether we currently traverse a measure
     bool m_insideMeasure;
 };
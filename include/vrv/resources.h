@@ -73,7 +73,7 @@ public:
 
     /** Select a particular font */
     bool SetCurrentFont(const std::string &fontName, bool allowLoading = false);
-    std::string GetCurrentFont() const { return m_currentFontName; }
+    std::string GetCurrentFont() const { return this->GetCurrentFontName(); }
     bool IsFontLoaded(const std::string &fontName) const { return m_loadedFonts.find(fontName) != m_loadedFonts.end(); }
     ///@}
 
@@ -111,6 +111,15 @@ public:
     bool FontHasGlyphAvailable(const std::string &fontName, char32_t smuflCode) const;
     ///@}
 
+    /**
+     * @name Give the calling thread its own current font and text style, starting from the current ones, until they
+     * are reset. This is used for drawing on several threads at once (see View::DrawMeasures).
+     */
+    ///@{
+    void SetThreadCurrentFonts() const;
+    void ResetThreadCurrentFonts() const;
+    ///@}
+
     /**
      * Get the CSS font string for the corresponding font.
      * Return an empty string if the font has not been loaded.
@@ -160,7 +169,17 @@ private:
 
     bool LoadFont(const std::string &fontName, ZipFileReader *zipFile = NULL);
 
-    const GlyphTable &GetCurrentGlyphTable() const { return m_loadedFonts.at(m_currentFontName).GetGlyphTable(); };
+    /** The current font name and text style, which are the ones of the thread when set (see SetThreadCurrentFonts) */
+    ///@{
+    std::string &GetCurrentFontName();
+    const std::string &GetCurrentFontName() const;
+    StyleAttributes &GetCurrentStyle() const;
+    ///@}
+
+    const GlyphTable &GetCurrentGlyphTable() const
+    {
+        return m_loadedFonts.at(this->GetCurrentFontName()).GetGlyphTable();
+    };
     const GlyphTable &GetFallbackGlyphTable() const { return m_loadedFonts.at(m_fallbackFontName).GetGlyphTable(); };
 
     std::string m_path;
@@ -186,6 +205,14 @@ private:
 
     /** The default font style */
     static const StyleAttributes k_defaultStyle;
+
+    /** The current font and text style of the thread, used when set for these resources */
+    struct ThreadCurrentFonts {
+        const Resources *m_resources = NULL;
+        std::string m_currentFontName;
+        StyleAttributes m_currentStyle;
+    };
+    static thread_local ThreadCurrentFonts s_threadCurrentFonts;
 };
 
 } // namespace vrv
@@ -27,6 +27,82 @@ class Resources;
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// SvgGlyphSheet
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds the glyphs referenced by SVG output.
+ * Each SvgDeviceContext has its own sheet, written as <defs> in the page itself.
+ * A sheet can also be shared by several pages, which then refer to it with ids that are stable across them.
+ * In that case, the glyphs are written only once in a separate SVG with GetStringSVG.
+ */
+class SvgGlyphSheet {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     * The postfix is added to the glyph ids - without a postfix the ids are only the glyph codes
+     */
+    ///@{
+    SvgGlyphSheet(const std::string &postfix = "");
+    virtual ~SvgGlyphSheet() {}
+    ///@}
+
+    /**
+     * Remove all the glyphs from the sheet
+     */
+    void Reset();
+
+    /**
+     * Add the glyph to the sheet (if not already in it) and return its id
+     */
+    const std::string &InsertGlyphRef(const Glyph *glyph);
+
+    /**
+     * Return true if no glyph has been added to the sheet
+     */
+    bool IsEmpty() const { return m_smuflGlyphs.empty(); }
+
+    /**
+     * Append the symbols of all the glyphs to the <defs> node
+     */
+    void AppendDefs(pugi::xml_node defs) const;
+
+    /**
+     * Return the sheet as a standalone SVG with only the <defs>
+     */
+    std::string GetStringSVG(bool xmlDeclaration = false, int indent = 2, bool formatRaw = false) const;
+
+private:
+    //
+public:
+    //
+private:
+    // Here we hold references to all different glyphs used so far,
+    // including any glyph for the same code but from different fonts.
+    // They will be added at the end of the file as <defs>.
+    // With multiple font support we need to keep track of:
+    //  a) the glyph (to check if is has been already added)
+    //  b) the id assigned to glyphs on the (that is has been consumed by the already rendered elements)
+    // To keep things as similar as possible to previous versions we generate ids with as uuuu-ss (where uuuu is the
+    // Smulf code for the glyph and ss the per-session suffix) for most of the cases (single font usage). When the same
+    // glyph has been used from several fonts we use uuuu-n-ss where n indicates the collision count.
+    class GlyphRef {
+    public:
+        GlyphRef(const Glyph *glyph, int count, const std::string &postfix);
+        const Glyph *GetGlyph() const { return m_glyph; };
+        const std::string &GetRefId() const { return m_refId; };
+
+    private:
+        const Glyph *m_glyph;
+        std::string m_refId;
+    };
+    std::map<const Glyph *, GlyphRef> m_smuflGlyphs;
+    std::map<std::string, int> m_glyphCodeFontCounter;
+    // postfix to be added to font glyphs
+    std::string m_glyphPostfixId;
+};
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
@@ -249,6 +325,17 @@ public:
      */
     void SetSmuflTextFont(option_SMUFLTEXTFONT smuflTextFont) { m_smuflTextFont = smuflTextFont; }
 
+    /**
+     * Setter for a glyph sheet shared with other pages.
+     * The glyphs are then not included in the page but referred to in the sheet at the url.
+     * The url can be empty when the sheet is included in the same document as the page (e.g., in HTML).
+     */
+    void SetGlyphSheet(SvgGlyphSheet *glyphSheet, const std::string &url)
+    {
+        m_glyphSheet = glyphSheet;
+        m_glyphSheetUrl = url;
+    }
+
 private:
     /**
      * Copy the content of a file to the output stream.
@@ -283,7 +370,7 @@ private:
 
     /**
      * Flush the data to the internal buffer.
-     * Adds the xml tag if necessary and the <defs> from m_smuflGlyphs
+     * Adds the xml tag if necessary and the <defs> from m_glyphs
      */
     void Commit(bool xml_declaration);
 
@@ -291,7 +378,7 @@ private:
 
     std::string GetColor(int color);
 
-    pugi::xml_node AddChild(std::string name);
+    pugi::xml_node AddChild(const std::string &name);
 
     /**
      * Transform pen properties into stroke attributes
@@ -302,6 +389,26 @@ private:
     void AppendStrokeDashArray(pugi::xml_node node, const Pen &pen);
     ///@}
 
+    /**
+     * @name Allocation-free formatting of attribute values.
+     * The values are written one after the other into the m_formatBuffer scratch buffer, which is reused across
+     * primitives. Integers are written with std::to_chars and floating values as with "%f".
+     * The returned pointer is valid until the next call and is meant to be assigned directly to an attribute.
+     */
+    ///@{
+    template <typename... Args> const char *FormatToBuffer(const Args &...args)
+    {
+        m_formatBuffer.clear();
+        (this->AppendToBuffer(args), ...);
+        return m_formatBuffer.c_str();
+    }
+    void AppendToBuffer(int value);
+    void AppendToBuffer(double value);
+    void AppendToBuffer(char value) { m_formatBuffer.push_back(value); }
+    void AppendToBuffer(const char *value) { m_formatBuffer.append(value); }
+    void AppendToBuffer(const std::string &value) { m_formatBuffer.append(value); }
+    ///@}
+
 public:
     //
 private:
@@ -326,28 +433,11 @@ private:
     bool m_committed; // did we flushed the file?
     int m_originX, m_originY;
 
-    // Here we hold references to all different glyphs used so far,
-    // including any glyph for the same code but from different fonts.
-    // They will be added at the end of the file as <defs>.
-    // With multiple font support we need to keep track of:
-    //  a) the glyph (to check if is has been already added)
-    //  b) the id assigned to glyphs on the (that is has been consumed by the already rendered elements)
-    // To keep things as similar as possible to previous versions we generate ids with as uuuu-ss (where uuuu is the
-    // Smulf code for the glyph and ss the per-session suffix) for most of the cases (single font usage). When the same
-    // glyph has been used from several fonts we use uuuu-n-ss where n indicates the collision count.
-    class GlyphRef {
-    public:
-        GlyphRef(const Glyph *glyph, int count, const std::string &postfix);
-        const Glyph *GetGlyph() const { return m_glyph; };
-        const std::string &GetRefId() const { return m_refId; };
-
-    private:
-        const Glyph *m_glyph;
-        std::string m_refId;
-    };
-    const std::string InsertGlyphRef(const Glyph *glyph);
-    std::map<const Glyph *, GlyphRef> m_smuflGlyphs;
-    std::map<std::string, int> m_glyphCodeFontCounter;
+    // The glyphs used in the page, added at the end of the file as <defs>
+    SvgGlyphSheet m_glyphs;
+    // A glyph sheet shared with other pages (NULL by default) and its url
+    SvgGlyphSheet *m_glyphSheet;
+    std::string m_glyphSheetUrl;
 
     // pugixml data
     pugi::xml_document m_svgDoc;
@@ -375,10 +465,10 @@ private:
     bool m_removeXlink;
     // indentation value (-1 for tabs)
     int m_indent;
-    // postfix to be added to font glyphs
-    std::string m_glyphPostfixId;
     // embedding of the smufl text font
     option_SMUFLTEXTFONT m_smuflTextFont;
+    // scratch buffer for formatting attribute values
+    std::string m_formatBuffer;
 };
 
 } // namespace vrv
@@ -110,6 +110,18 @@ public:
     void ResetDrawingScoreDef();
     ///@}
 
+    /**
+     * @name Get the first and last measure of the system.
+     * The values are cached between CacheDrawingMeasures and ResetDrawingMeasures, which View::DrawSystem calls
+     * around the drawing of the system. The children of the system are not expected to change in-between.
+     */
+    ///@{
+    Measure *GetDrawingFirstMeasure();
+    Measure *GetDrawingLastMeasure();
+    void CacheDrawingMeasures();
+    void ResetDrawingMeasures();
+    ///@}
+
     /**
      * Check if the notes between the start and end have mixed drawing stem directions.
      * The start and end element are expected to be on the same staff and same layer.
@@ -238,6 +250,15 @@ private:
      */
     ScoreDef *m_drawingScoreDef;
 
+    /**
+     * The cached first and last measure (see System::CacheDrawingMeasures)
+     */
+    ///@{
+    bool m_drawingMeasuresCached;
+    Measure *m_drawingFirstMeasure;
+    Measure *m_drawingLastMeasure;
+    ///@}
+
     /**
      * A flag indicating if the system is optimized.
      * This does not mean that a staff is hidden, but only that it can be optimized.
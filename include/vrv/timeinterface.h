@@ -95,6 +95,11 @@ public:
      */
     bool VerifyMeasure(const Object *owner) const;
 
+    /**
+     * Return the fragment of the start \@xml:id as extracted by SetIDStr
+     */
+    const std::string &GetStartIDStr() const { return m_startID; }
+
     //-----------------//
     // Pseudo functors //
     //-----------------//
@@ -186,6 +191,11 @@ public:
      */
     void SetIDStr();
 
+    /**
+     * Return the fragment of the end \@xml:id as extracted by SetIDStr
+     */
+    const std::string &GetEndIDStr() const { return m_endID; }
+
     /**
      * Check if the end points are temporally ordered
      * @Return true if end temporally occurs after start
@@ -66,6 +66,24 @@ public:
      */
     void ToJson(std::string &output, bool includetRests, bool includetMeasures);
 
+    /**
+     * Write the current timemap to a compact columnar binary buffer.
+     * All values are little-endian and each section starts at an offset aligned to its type, so they
+     * can be read without copying with typed arrays in JavaScript or numpy.frombuffer in Python.
+     * The layout is:
+     * - header: 8 uint32 (magic "VRVT", version 1, entry count N, ID count M, reference count R,
+     *   string byte count S, flags with bit 0 for rests and bit 1 for measures, 0)
+     * - float64 tstamp[N]: the real time of each entry in milliseconds
+     * - float64 qstamp[N]: the score time of each entry in quarter notes
+     * - float64 tempo[N]: the tempo at each entry (0.0 if not known yet)
+     * - uint32 lists[5 * N + 1]: for the entry i and the list k (notes on, notes off, rests on, rests off,
+     *   measure on), the references are refs[lists[5 * i + k]] to refs[lists[5 * i + k + 1]]
+     * - uint32 refs[R]: indexes in the ID table
+     * - uint32 ids[M + 1]: the ID j is the UTF-8 string from strings[ids[j]] to strings[ids[j + 1]]
+     * - char strings[S]: the ID table, without separators
+     */
+    void ToBinary(std::string &output, bool includeRests, bool includeMeasures);
+
 private:
     //
 public:
@@ -8,6 +8,8 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -22,7 +24,10 @@
 namespace vrv {
 
 class EditorToolkit;
+class JsonReader;
+class LogSink;
 class RuntimeClock;
+class SvgGlyphSheet;
 
 /**
  * @defgroup nodoc Public methods that are not listed in the documentation
@@ -96,6 +101,17 @@ public:
      */
     std::string GetLog();
 
+    /**
+     * Get the log entries for the latest operation.
+     *
+     * Each entry has a level, a code identifying the kind of message, the ID of the element (when available)
+     * and the message. The number of entries is bounded and the number of the ones dropped is given.
+     * Logging to buffer needs to be enabled.
+     *
+     * @return A stringified JSON object with the "entries" and the number of entries "dropped"
+     */
+    std::string GetLogEntries();
+
     /**
      * Return the version number.
      *
@@ -190,6 +206,7 @@ public:
      * Return the number of pages in the loaded document.
      *
      * The number of pages depends one the page size and if encoded layout was taken into account or not.
+     * With progressive layout, the number is an estimate until all the pages have been rendered.
      *
      * @return The number of pages
      */
@@ -242,6 +259,38 @@ public:
      */
     void ResetOptions();
 
+    /**
+     * Register a named option profile.
+     *
+     * The options are validated once and kept for being activated with ActivateOptionProfile.
+     * Registering a profile with the name of an existing one replaces it and keeps its handle.
+     *
+     * @param name The name of the profile
+     * @param jsonOptions A stringified JSON object with the options of the profile
+     * @return The handle of the profile, or -1 if an option is not valid
+     */
+    int RegisterOptionProfile(const std::string &name, const std::string &jsonOptions);
+
+    /**
+     * Return the handle of a registered option profile.
+     *
+     * @param name The name of the profile
+     * @return The handle of the profile, or -1 if no profile is registered with this name
+     */
+    int GetOptionProfile(const std::string &name) const;
+
+    /**
+     * Set the options of a registered option profile.
+     *
+     * Only the options with a different value are set.
+     * The "layout" flag of the returned object is false when none of them changes the layout, in which case
+     * calling RedoLayout is not necessary.
+     *
+     * @param handle The handle returned by RegisterOptionProfile
+     * @return A stringified JSON object with the list of options changed and the "layout" flag
+     */
+    std::string ActivateOptionProfile(int handle);
+
     /**
      * Print formatted option usage for specific category (with max/min/default values) to output stream.
      */
@@ -357,6 +406,32 @@ public:
      */
     std::string RenderToSVG(int pageNo = 1, bool xmlDeclaration = false);
 
+    /**
+     * Render a measure range to SVG as a single system.
+     *
+     * The cast off of the document is not changed and only the measure range is laid out.
+     * This is meant for rendering a window moving through the score.
+     *
+     * @param startId The ID of the first measure
+     * @param endId The ID of the last measure
+     * @param xmlDeclaration True for including the xml declaration in the SVG output
+     * @return The SVG as a string
+     */
+    std::string RenderMeasureWindowToSVG(
+        const std::string &startId, const std::string &endId, bool xmlDeclaration = false);
+
+    /**
+     * Render the glyph sheet shared by the SVG pages.
+     *
+     * With the svgGlyphSheet option, the pages refer to the music font glyphs in a shared sheet instead of including
+     * them. The sheet gathers the glyphs of all the pages of the document rendered so far by the toolkit. It is
+     * cleared when a document is loaded.
+     *
+     * @param xmlDeclaration True for including the xml declaration in the SVG output
+     * @return The SVG glyph sheet as a string
+     */
+    std::string RenderToSVGGlyphSheet(bool xmlDeclaration = false);
+
     /**
      * Render a page to SVG and save it to the file.
      *
@@ -409,6 +484,9 @@ public:
     /**
      * Render a document to a timemap.
      *
+     * With the "format" option set to "binary", the timemap is returned in a compact columnar binary
+     * format (see Timemap::ToBinary) encoded in base64.
+     *
      * @param jsonOptions A stringified JSON objects with the timemap options
      * @return The timemap as a string
      */
@@ -538,6 +616,22 @@ public:
      */
     std::string GetDescriptiveFeatures(const std::string &jsonOptions);
 
+    /**
+     * Extract the descriptive features of a corpus of files and save them to a binary file.
+     *
+     * The files are loaded in parallel by a pool of toolkits with the options of this toolkit, but without layout.
+     * The output is a compact columnar file with the pitches, the intervals and the hashed interval n-grams of
+     * each file in the order of the input, for building a search index (see FeatureCorpus::ToBinary).
+     * The content of this toolkit is not changed.
+     *
+     * @remark nojs
+     *
+     * @param jsonOptions A stringified JSON object with the "inputs" (array of filenames), the "output" filename,
+     * and optionally the number of "threads" (all the cores by default) and the "ngramLength" (4 by default)
+     * @return A stringified JSON object with the counts, the files that could not be loaded and the throughput
+     */
+    std::string ExtractCorpusFeatures(const std::string &jsonOptions);
+
     /**
      * Return array of IDs of elements being currently played.
      *
@@ -766,18 +860,19 @@ protected:
     void PrintOptionUsageOutput(const vrv::Option *option, std::ostream &output) const;
 
     /**
-     * Resets the vrv::logBuffer.
+     * Clear the log sink of the toolkit and set it as the one of the current thread.
      */
     void ResetLogBuffer();
 
     /**
-     * Start capturing std::cerr from an external codebase for redirection to vrv::logBuffer.
+     * Start capturing std::cerr from an external codebase for redirection to the log sink.
      * Only one capture should be active at a given time.  Finish by calling LogRedirectStop.
+     * Nothing is captured when m_redirectCerr is false.
      */
     void LogRedirectStart();
 
     /**
-     * End capturing std::cerr from an external codebase for redirection to vrv::logBuffer.
+     * End capturing std::cerr from an external codebase for redirection to the log sink.
      */
     void LogRedirectStop();
 
@@ -786,13 +881,30 @@ protected:
      */
     bool LoadData(const std::string &data, bool resetLogBuffer);
 
+    /**
+     * Load a string data that can be imported in place when inplaceData is given.
+     * inplaceData has to point to the data, and its content is undefined afterwards.
+     */
+    bool LoadData(const std::string &data, bool resetLogBuffer, std::string *inplaceData);
+
 private:
     bool SetFont(const std::string &fontName);
-    bool IsUTF16(const std::string &filename);
-    bool LoadUTF16File(const std::string &filename);
-    bool IsZip(const std::string &filename);
-    bool LoadZipFile(const std::string &filename);
+    bool IsUTF16(const std::string &content);
+    bool LoadUTF16Data(const std::string &content);
+    bool IsZip(const std::string &content);
     bool LoadZipData(const std::vector<unsigned char> &bytes);
+
+    /**
+     * Write the MEI to the stream, or to the output string if the stream is NULL.
+     * Used by GetMEI and SaveFile.
+     */
+    bool WriteMEI(const std::string &jsonOptions, std::ostream *stream, std::string &output);
+
+    /**
+     * Write the timemap to the output string, and set binary to true if the binary format was requested.
+     * Used by RenderToTimemap and RenderToTimemapFile.
+     */
+    void WriteTimemap(const std::string &jsonOptions, std::string &output, bool &binary);
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
 
     /**
@@ -803,6 +915,12 @@ private:
      */
     std::string GetOptions(bool defaultValues) const;
 
+    /**
+     * Set the value of an option from a JSON value.
+     * Return false if the type of the value is not supported or if the value is not valid.
+     */
+    bool SetOptionValue(Option *option, const JsonReader &json, int value) const;
+
 public:
     //
 private:
@@ -814,8 +932,14 @@ private:
 
     Options *m_options;
 
+    /** The registered option profiles, with their index as handle */
+    std::vector<OptionProfile *> m_optionProfiles;
+
     std::optional<std::locale> m_previousLocale;
 
+    /** The sink receiving the logs of the thread that last used the toolkit */
+    std::shared_ptr<LogSink> m_logSink;
+
     /**
      * The C buffer string.
      */
@@ -833,18 +957,35 @@ private:
      */
     std::streambuf *m_cerrOriginalBuf;
 
+    /**
+     * False for the toolkits run in parallel with others (see ExtractCorpusFeatures).
+     * std::cerr is shared by all the threads, which can write to it while it is redirected.
+     */
+    bool m_redirectCerr;
+
     EditorToolkit *m_editorToolkit;
 
+    /**
+     * The glyph sheet shared by the SVG pages rendered with the svgGlyphSheet option
+     */
+    SvgGlyphSheet *m_svgGlyphSheet;
+
 #ifndef NO_RUNTIME
     /** Measuring runtime */
     RuntimeClock *m_runtimeClock;
 #endif
 
+    /**
+     * The Humdrum buffer, owned by the toolkit so that several toolkits can load data in parallel
+     */
+    char *m_humdrumBuffer;
+
     //----------------//
     // Static members //
     //----------------//
 
-    static char *m_humdrumBuffer;
+    /** The mutex held while std::cerr is redirected, since std::cerr is shared by all the toolkits */
+    static std::mutex s_cerrMutex;
 };
 
 } // namespace vrv
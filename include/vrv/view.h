@@ -199,6 +199,12 @@ public:
     void SetSlurHandling(SlurHandling slurHandling) { m_slurHandling = slurHandling; }
     ///@}
 
+    /**
+     * Set the number of threads for drawing the staves of consecutive measures in parallel.
+     * This is used only with a bounding box device context for the horizontal values (see Page::LayOutHorizontally)
+     */
+    void SetThreadCount(int threadCount) { m_threadCount = threadCount; }
+
 protected:
     /**
      * @name Methods for drawing System, ScoreDef, StaffDef, Staff, and Layer.
@@ -229,6 +235,11 @@ protected:
     void DrawBarLineDots(DeviceContext *dc, Staff *staff, BarLine *barLine);
     void DrawLedgerLines(DeviceContext *dc, Staff *staff, const ArrayOfLedgerLines &lines, bool below, bool cueSize);
     void DrawMeasure(DeviceContext *dc, Measure *measure, System *system);
+    void DrawMeasures(DeviceContext *dc, const std::vector<Measure *> &measures, System *system);
+    void DrawMeasuresInParallel(DeviceContext *dc, const std::vector<Measure *> &measures, System *system);
+    void DrawMeasureNumber(DeviceContext *dc, Measure *measure, System *system);
+    void DrawMeasureStaves(DeviceContext *dc, Measure *measure, System *system);
+    void DrawMeasureBarLines(DeviceContext *dc, Measure *measure, System *system);
     void DrawMeterSigGrp(DeviceContext *dc, Layer *layer, Staff *staff);
     void DrawMNum(DeviceContext *dc, MNum *mnum, Measure *measure, System *system, int yOffset);
     void DrawStaff(DeviceContext *dc, Staff *staff, Measure *measure, System *system);
@@ -238,6 +249,8 @@ protected:
     void DrawLayerDefLabels(
         DeviceContext *dc, ScoreDef *scoreDef, Staff *staff, StaffDef *staffDef, int x, bool abbreviations = false);
     void DrawSystemDivider(DeviceContext *dc, System *system, Measure *firstMeasure);
+    void CalcBeamSpanSegments(Object *parent, System *system);
+    void AddToSystemDrawingList(System *system, Object *object);
     ///@}
 
     /**
@@ -697,6 +710,17 @@ protected:
      */
     SlurHandling m_slurHandling;
 
+    /**
+     * The number of threads for drawing the staves of the measures (see SetThreadCount)
+     */
+    int m_threadCount;
+
+    /**
+     * The objects to add to the drawing list of the system once the measure is done, when its staves are drawn in
+     * parallel with other measures. NULL otherwise (see AddToSystemDrawingList).
+     */
+    ArrayOfObjects *m_postponedSystemObjects;
+
     /**
      * The current drawing score def.
      * The is set when starting to draw a page in DrawCurrentPage and then
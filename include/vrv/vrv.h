@@ -11,9 +11,13 @@
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #ifndef _WIN32
@@ -34,22 +38,129 @@ class Object;
  * Most of them differ if they are used in the command line tool or in emscripten
  */
 
+/**
+ * Logging macros.
+ * The log level is checked before the arguments are evaluated, so a disabled log costs only a comparison.
+ * Without DEBUG, VRV_LOG_DEBUG is compiled out and its arguments are only type-checked.
+ * VRV_LOG_ELEMENT_ERROR and VRV_LOG_ELEMENT_WARNING take the ID of the element the message refers to as first argument.
+ */
+#define VRV_LOG_ERROR(...) VRV_LOG(::vrv::LOG_ERROR, "", __VA_ARGS__)
+#define VRV_LOG_WARNING(...) VRV_LOG(::vrv::LOG_WARNING, "", __VA_ARGS__)
+#define VRV_LOG_INFO(...) VRV_LOG(::vrv::LOG_INFO, "", __VA_ARGS__)
+#define VRV_LOG_ELEMENT_ERROR(id, ...) VRV_LOG(::vrv::LOG_ERROR, id, __VA_ARGS__)
+#define VRV_LOG_ELEMENT_WARNING(id, ...) VRV_LOG(::vrv::LOG_WARNING, id, __VA_ARGS__)
+#if defined(DEBUG)
+#define VRV_LOG_DEBUG(...) VRV_LOG(::vrv::LOG_DEBUG, "", __VA_ARGS__)
+#else
+#define VRV_LOG_DEBUG(...) ((void)sizeof((::vrv::LogMessage(::vrv::LOG_DEBUG, "", __VA_ARGS__), 0)))
+#endif
+#define VRV_LOG(level, id, ...) ((::vrv::logLevel >= (level)) ? ::vrv::LogMessage(level, id, __VA_ARGS__) : (void)0)
+
+/**
+ * Format and log a message, to be called through the macros above.
+ * The code of the message is a hash of the format string, which identifies messages of the same kind.
+ */
+void LogMessage(LogLevel level, const std::string &id, const char *fmt, ...);
+
+/**
+ * Logging functions, with the same behaviour as the macros above but with the arguments always evaluated.
+ * They are kept for code outside the library and LogDebug is a no-op without DEBUG.
+ */
 void LogDebug(const char *fmt, ...);
 void LogError(const char *fmt, ...);
 void LogInfo(const char *fmt, ...);
 void LogWarning(const char *fmt, ...);
+void LogElementError(const std::string &id, const char *fmt, ...);
+void LogElementWarning(const std::string &id, const char *fmt, ...);
+
+//----------------------------------------------------------------------------
+// LogSink
+//----------------------------------------------------------------------------
+
+/**
+ * A log entry with its level, its code and the ID of the element it refers to (if any)
+ */
+struct LogEntry {
+    LogLevel m_level;
+    uint32_t m_code;
+    std::string m_id;
+    std::string m_message;
+};
+
+/**
+ * This class buffers the log entries when logging to buffer is enabled.
+ * The number of entries is bounded, as is the number of entries with the same code. Messages beyond these limits
+ * are only counted and are not formatted at all. Identical messages are kept only once.
+ * Each toolkit has its own sink, which receives the logs of the thread that last used the toolkit.
+ */
+class LogSink {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    LogSink() { m_dropped = 0; }
+    virtual ~LogSink() {}
+    ///@}
+
+    /**
+     * Return false if no more entry with the code can be added, and count the message as dropped.
+     * This avoids formatting messages that would be dropped anyway.
+     */
+    bool CanAdd(uint32_t code);
+
+    /**
+     * Add an entry, unless the same message is already buffered or the limits are reached.
+     * Only the entries added count towards the limits.
+     */
+    void Add(LogEntry &&entry);
+
+    /**
+     * Remove all the entries and reset the counts
+     */
+    void Clear();
+
+    /**
+     * @name Getters
+     */
+    ///@{
+    std::vector<LogEntry> GetEntries() const;
+    int GetDropped() const;
+    ///@}
+
+    /**
+     * Return the entries as lines prefixed by their level, as they are written to stderr.
+     */
+    std::string GetString() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<LogEntry> m_entries;
+    /** The messages buffered with their level prefix for checking duplicates */
+    std::unordered_set<std::string> m_lines;
+    /** The number of entries added for each code */
+    std::unordered_map<uint32_t, int> m_codeCounts;
+    /** The number of entries dropped because of the limits */
+    int m_dropped;
+};
+
+/**
+ * Set the sink receiving the logs of the current thread.
+ * The sink is held weakly, and logs go to a default sink when it is null or destroyed.
+ */
+void SetLogSink(const std::shared_ptr<LogSink> &sink);
+std::shared_ptr<LogSink> GetLogSink();
 
 /**
- * Member and functions specific to logging that uses a vector of string to buffer the logs.
+ * Return the prefix of a log line for the level
  */
-extern std::vector<std::string> logBuffer;
-bool LogBufferContains(const std::string &s);
-void LogString(std::string message, LogLevel level);
+const char *LogLevelPrefix(LogLevel level);
 
 /**
- * Convert a string to a logLevel
+ * Convert a string to a logLevel and back
  */
 LogLevel StrToLogLevel(const std::string &level);
+std::string LogLevelToStr(LogLevel level);
 
 /**
  * Utility for comparing doubles
@@ -152,6 +263,20 @@ extern struct timeval start;
 void LogElapsedTimeStart();
 void LogElapsedTimeStop(const char *msg = "unspecified operation");
 
+//----------------------------------------------------------------------------
+// Parallel processing
+//----------------------------------------------------------------------------
+
+/**
+ * Run the job for each index from 0 to count - 1 on up to threadCount threads.
+ * The indexes are handed out in order and the calling thread takes part in the processing.
+ * The threads are kept in a pool shared by all the runs, which are processed one at a time.
+ * With a thread count of 1 (or when threads are not available) all jobs are run in order on the calling thread, as
+ * are the jobs started from a job.
+ * The jobs must be independent from each other.
+ */
+void RunParallelJobs(int count, int threadCount, const std::function<void(int)> &job);
+
 //----------------------------------------------------------------------------
 // Notation type checks
 //----------------------------------------------------------------------------
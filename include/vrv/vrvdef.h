@@ -9,11 +9,13 @@
 #define __VRV_DEF_H__
 
 #include <algorithm>
+#include <bitset>
 #include <functional>
 #include <list>
 #include <map>
 #include <set>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -351,11 +353,11 @@ typedef std::vector<BeamElementCoord *> ArrayOfBeamElementCoords;
 
 typedef std::vector<std::pair<int, int>> ArrayOfIntPairs;
 
-typedef std::multimap<std::string, LinkingInterface *> MapOfLinkingInterfaceIDPairs;
+typedef std::unordered_multimap<std::string, LinkingInterface *> MapOfLinkingInterfaceIDPairs;
 
 typedef std::map<std::string, Note *> MapOfNoteIDPairs;
 
-typedef std::vector<std::pair<PlistInterface *, std::string>> ArrayOfPlistInterfaceIDPairs;
+typedef std::unordered_multimap<std::string, PlistInterface *> MapOfPlistInterfaceIDPairs;
 
 typedef std::vector<CurveSpannedElement *> ArrayOfCurveSpannedElements;
 
@@ -393,6 +395,8 @@ typedef std::map<std::string, std::function<Object *(void)>> MapOfStrConstructor
 
 typedef std::map<std::string, ClassId> MapOfStrClassIds;
 
+typedef std::bitset<UNSPECIFIED + 1> ClassIdSet;
+
 typedef std::vector<std::pair<LayerElement *, LayerElement *>> MeasureTieEndpoints;
 
 typedef bool (*NotePredicate)(const Note *);
@@ -24,6 +24,8 @@ namespace vrv {
 AdjustArpegFunctor::AdjustArpegFunctor(Doc *doc) : DocFunctor(doc)
 {
     m_measureAligner = NULL;
+    // Alignments are reached by processing the MeasureAligner at the end of the measure
+    this->SetVisitedClassIds({ ARPEG, ALIGNMENT });
 }
 
 FunctorCode AdjustArpegFunctor::VisitAlignment(Alignment *alignment)
@@ -83,7 +83,7 @@ FunctorCode AdjustClefChangesFunctor::VisitClef(Clef *clef)
 
     // This should never happen because we always have at least barline alignments - even empty
     if (!previousAlignment || !nextAlignment) {
-        LogDebug("No alignment found before and after the clef change");
+        VRV_LOG_DEBUG("No alignment found before and after the clef change");
         return FUNCTOR_CONTINUE;
     }
 
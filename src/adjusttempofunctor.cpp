@@ -24,6 +24,7 @@ namespace vrv {
 AdjustTempoFunctor::AdjustTempoFunctor(Doc *doc) : DocFunctor(doc)
 {
     m_systemAligner = NULL;
+    this->SetVisitedClassIds({ TEMPO });
 }
 
 FunctorCode AdjustTempoFunctor::VisitSystem(System *system)
@@ -49,8 +49,8 @@ FunctorCode AdjustXOverflowFunctor::VisitControlElement(ControlElement *controlE
 
     // Something is probably not right if nothing found - maybe no @staff
     if (positioners.empty()) {
-        LogDebug("Something was wrong when searching positioners for %s '%s'", controlElement->GetClassName().c_str(),
-            controlElement->GetID().c_str());
+        VRV_LOG_DEBUG("Something was wrong when searching positioners for %s '%s'",
+            controlElement->GetClassName().c_str(), controlElement->GetID().c_str());
         return FUNCTOR_SIBLINGS;
     }
 
@@ -85,16 +85,14 @@ FunctorCode AdjustCrossStaffYPosFunctor::VisitChord(Chord *chord)
 
 FunctorCode AdjustCrossStaffYPosFunctor::VisitSystem(System *system)
 {
-    ArrayOfObjects *drawingList = system->GetDrawingList();
-    for (auto &item : *drawingList) {
-        if (item->Is(BEAMSPAN)) {
-            // Here we could check that the beamSpan is actually cross-staff. Otherwise doing this is pointless
-            BeamSpan *beamSpan = vrv_cast<BeamSpan *>(item);
-            assert(beamSpan);
-            BeamSpanSegment *segment = beamSpan->GetSegmentForSystem(system);
-            if (segment) {
-                segment->CalcBeam(segment->GetLayer(), segment->GetStaff(), m_doc, beamSpan, beamSpan->m_drawingPlace);
-            }
+    const ArrayOfObjects &drawingList = system->GetDrawingListByClassId(BEAMSPAN);
+    for (auto &item : drawingList) {
+        // Here we could check that the beamSpan is actually cross-staff. Otherwise doing this is pointless
+        BeamSpan *beamSpan = vrv_cast<BeamSpan *>(item);
+        assert(beamSpan);
+        BeamSpanSegment *segment = beamSpan->GetSegmentForSystem(system);
+        if (segment) {
+            segment->CalcBeam(segment->GetLayer(), segment->GetStaff(), m_doc, beamSpan, beamSpan->m_drawingPlace);
         }
     }
 
@@ -68,7 +68,7 @@ int Arpeg::GetDrawingX() const
     }
 
     // Otherwise get the measure - no cast to Measure is necessary
-    LogDebug("Accessing an arpeg x without positioner");
+    VRV_LOG_DEBUG("Accessing an arpeg x without positioner");
     const Object *measure = this->GetFirstAncestor(MEASURE);
     assert(measure);
 
@@ -79,7 +79,7 @@ int Arpeg::GetDrawingX() const
 bool Arpeg::IsValidRef(const Object *ref) const
 {
     if (!ref->Is({ CHORD, NOTE })) {
-        LogWarning(
+        VRV_LOG_WARNING(
             "%s is not supported as @plist target for %s", ref->GetClassName().c_str(), this->GetClassName().c_str());
         return false;
     }
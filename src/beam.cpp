@@ -445,7 +445,7 @@ bool BeamSegment::NeedToResetPosition(Staff *staff, const Doc *doc, BeamDrawingI
     beamInterface->m_drawingPlace = (newDirection == STEMDIRECTION_up) ? BEAMPLACE_above : BEAMPLACE_below;
     if ((newDirection == STEMDIRECTION_down) && (m_uniformStemLength > 0)) m_uniformStemLength *= -1;
 
-    LogWarning("Insufficient space to draw mixed beam, starting at '%s'. Drawing '%s' instead.",
+    VRV_LOG_WARNING("Insufficient space to draw mixed beam, starting at '%s'. Drawing '%s' instead.",
         m_beamElementCoordRefs.at(0)->m_element->GetID().c_str(),
         (beamInterface->m_drawingPlace == BEAMPLACE_above) ? "above" : "below");
 
@@ -1845,14 +1845,14 @@ data_STEMDIRECTION BeamElementCoord::GetStemDir() const
     }
 
     if (!m_element) {
-        LogDebug("Element not set in BeamElementCoord");
+        VRV_LOG_DEBUG("Element not set in BeamElementCoord");
         return STEMDIRECTION_NONE;
     }
 
     AttStems *stemInterface = dynamic_cast<AttStems *>(m_element);
 
     if (!stemInterface) {
-        LogDebug("Element is not an AttStems");
+        VRV_LOG_DEBUG("Element is not an AttStems");
         return STEMDIRECTION_NONE;
     }
 
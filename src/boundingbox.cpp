@@ -319,7 +319,7 @@ int BoundingBox::GetRectangles(const SMuFLGlyphAnchor &anchor, Point rect[2][2],
         }
     }
     if (!glyphRect) {
-        LogDebug("Illogical values for anchor points in glyph '%02x'", m_smuflGlyph);
+        VRV_LOG_DEBUG("Illogical values for anchor points in glyph '%02x'", m_smuflGlyph);
     }
 
     rect[0][0] = Point(this->GetSelfLeft(), this->GetSelfTop());
@@ -353,7 +353,7 @@ int BoundingBox::GetRectangles(const SMuFLGlyphAnchor &anchor1, const SMuFLGlyph
         }
     }
     if (!glyphRect) {
-        LogDebug("Illogical values for anchor points in glyph '%02x'", m_smuflGlyph);
+        VRV_LOG_DEBUG("Illogical values for anchor points in glyph '%02x'", m_smuflGlyph);
     }
 
     rect[0][0] = Point(this->GetSelfLeft(), this->GetSelfTop());
@@ -772,7 +772,7 @@ int BoundingBox::Intersects(const FloatingCurvePositioner *curve, Accessor type,
         }
     }
     else {
-        LogDebug("This should not happen");
+        VRV_LOG_DEBUG("This should not happen");
     }
 
     return 0;
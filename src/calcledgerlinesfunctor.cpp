@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------
 
 #include "doc.h"
+#include "measure.h"
 #include "note.h"
 #include "staff.h"
 
@@ -19,7 +20,27 @@ namespace vrv {
 // CalcLedgerLinesFunctor
 //----------------------------------------------------------------------------
 
-CalcLedgerLinesFunctor::CalcLedgerLinesFunctor(Doc *doc) : DocFunctor(doc) {}
+CalcLedgerLinesFunctor::CalcLedgerLinesFunctor(Doc *doc) : DocFunctor(doc)
+{
+    // Staves without notes are not visited but can receive ledger lines from cross-staff notes and are adjusted
+    // when the next staff or the end of the measure is reached
+    this->SetVisitedClassIds({ NOTE });
+    m_previousStaff = NULL;
+}
+
+FunctorCode CalcLedgerLinesFunctor::VisitMeasure(Measure *measure)
+{
+    m_previousStaff = NULL;
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode CalcLedgerLinesFunctor::VisitMeasureEnd(Measure *measure)
+{
+    this->AdjustSkippedStaves(measure, NULL);
+
+    return FUNCTOR_CONTINUE;
+}
 
 FunctorCode CalcLedgerLinesFunctor::VisitNote(Note *note)
 {
@@ -58,7 +79,44 @@ FunctorCode CalcLedgerLinesFunctor::VisitNote(Note *note)
     return FUNCTOR_SIBLINGS;
 }
 
+FunctorCode CalcLedgerLinesFunctor::VisitStaff(Staff *staff)
+{
+    Measure *measure = vrv_cast<Measure *>(staff->GetFirstAncestor(MEASURE));
+    assert(measure);
+    this->AdjustSkippedStaves(measure, staff);
+
+    return FUNCTOR_CONTINUE;
+}
+
 FunctorCode CalcLedgerLinesFunctor::VisitStaffEnd(Staff *staff)
+{
+    this->AdjustStaffLedgerLines(staff);
+    if (staff->GetParent()->Is(MEASURE)) m_previousStaff = staff;
+
+    return FUNCTOR_CONTINUE;
+}
+
+void CalcLedgerLinesFunctor::AdjustSkippedStaves(Measure *measure, Staff *staff)
+{
+    // Staves can also be nested in editorial markup - look only at the ones that are children of the measure
+    if (staff && (staff->GetParent() != measure)) return;
+
+    const ArrayOfObjects &children = measure->GetChildren();
+    auto iter = children.begin();
+    if (m_previousStaff) {
+        iter = std::find(children.begin(), children.end(), m_previousStaff);
+        if (iter != children.end()) ++iter;
+    }
+    for (; (iter != children.end()) && (*iter != staff); ++iter) {
+        if (!(*iter)->Is(STAFF)) continue;
+        Staff *skippedStaff = vrv_cast<Staff *>(*iter);
+        assert(skippedStaff);
+        this->AdjustStaffLedgerLines(skippedStaff);
+        m_previousStaff = skippedStaff;
+    }
+}
+
+void CalcLedgerLinesFunctor::AdjustStaffLedgerLines(Staff *staff)
 {
     const int extension = m_doc->GetDrawingLedgerLineExtension(staff->m_drawingStaffSize, false);
     const int minExtension = m_doc->GetDrawingMinimalLedgerLineExtension(staff->m_drawingStaffSize, false);
@@ -67,8 +125,6 @@ FunctorCode CalcLedgerLinesFunctor::VisitStaffEnd(Staff *staff)
         staff->GetLedgerLinesAbove(), staff->GetLedgerLinesAboveCue(), cueScaling, extension, minExtension);
     this->AdjustLedgerLines(
         staff->GetLedgerLinesBelow(), staff->GetLedgerLinesBelowCue(), cueScaling, extension, minExtension);
-
-    return FUNCTOR_CONTINUE;
 }
 
 void CalcLedgerLinesFunctor::AdjustLedgerLines(
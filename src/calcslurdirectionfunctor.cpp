@@ -51,7 +51,7 @@ FunctorCode CalcSlurDirectionFunctor::VisitSlur(Slur *slur)
     // If curve direction is prescribed as mixed, use it if boundary lies in different staves
     if (slur->GetCurvedir() == curvature_CURVEDIR_mixed) {
         if (slur->HasBulge()) {
-            LogWarning("Mixed curve direction is ignored for slurs with prescribed bulge.");
+            VRV_LOG_WARNING("Mixed curve direction is ignored for slurs with prescribed bulge.");
         }
         else {
             const int startStaffN = start->GetAncestorStaff(RESOLVE_CROSS_STAFF)->GetN();
@@ -65,7 +65,7 @@ FunctorCode CalcSlurDirectionFunctor::VisitSlur(Slur *slur)
                 return FUNCTOR_CONTINUE;
             }
             else {
-                LogWarning("Mixed curve direction is ignored for slurs starting and ending on the same staff.");
+                VRV_LOG_WARNING("Mixed curve direction is ignored for slurs starting and ending on the same staff.");
             }
         }
     }
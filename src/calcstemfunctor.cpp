@@ -192,7 +192,7 @@ FunctorCode CalcStemFunctor::VisitFTrem(FTrem *fTrem)
     }
 
     if (fTrem->GetElementCoords()->size() != 2) {
-        LogError("Stem calculation: <fTrem> element has invalid number of descendants.");
+        VRV_LOG_ERROR("Stem calculation: <fTrem> element has invalid number of descendants.");
         return FUNCTOR_CONTINUE;
     }
 
@@ -58,6 +58,7 @@ CastOffSystemsFunctor::CastOffSystemsFunctor(Page *page, Doc *doc, bool smart) :
     m_systemWidth = 0;
     m_currentScoreDefWidth = 0;
     m_smart = smart;
+    m_partialContent = false;
 }
 
 FunctorCode CastOffSystemsFunctor::VisitEditorialElement(EditorialElement *editorialElement)
@@ -101,7 +102,8 @@ FunctorCode CastOffSystemsFunctor::VisitMeasure(Measure *measure)
     int drawingXRel = measure->GetDrawingXRel();
 
     Object *nextMeasure = m_contentSystem->GetNext(measure, MEASURE);
-    const bool isLeftoverMeasure = ((NULL == nextMeasure) && m_doc->GetOptions()->m_breaksNoWidow.GetValue()
+    const bool isLeftoverMeasure = ((NULL == nextMeasure) && !m_partialContent
+        && m_doc->GetOptions()->m_breaksNoWidow.GetValue()
         && (m_doc->GetOptions()->m_breaks.GetValue() != BREAKS_encoded));
     if (m_currentSystem->GetChildCount() > 0) {
         // We have overflowing content (dir, dynam, tempo) larger than 5 units, keep it as pending
@@ -209,6 +211,9 @@ FunctorCode CastOffSystemsFunctor::VisitScoreDef(ScoreDef *scoreDef)
 
 FunctorCode CastOffSystemsFunctor::VisitSystem(System *system)
 {
+    // The content system is cast off by chunks and we carry on with the current system
+    if (system == m_contentSystem) return FUNCTOR_CONTINUE;
+
     // We are starting a new system we need to cast off
     m_contentSystem = system;
     // We also need to create a new target system and add it to the page
@@ -224,6 +229,12 @@ FunctorCode CastOffSystemsFunctor::VisitSystem(System *system)
 
 FunctorCode CastOffSystemsFunctor::VisitSystemEnd(System *system)
 {
+    // The pending elements will go with the next measures of the content system
+    if (m_partialContent) return FUNCTOR_CONTINUE;
+
+    // The content system is complete and the next one will start a new system
+    m_contentSystem = NULL;
+
     if (m_pendingElements.empty()) return FUNCTOR_CONTINUE;
 
     // Otherwise add all pendings objects
@@ -285,6 +296,7 @@ CastOffPagesFunctor::CastOffPagesFunctor(Page *contentPage, Doc *doc, Page *curr
     m_pgHead2Height = 0;
     m_pgFoot2Height = 0;
     m_leftoverSystem = NULL;
+    m_forcePageBreak = false;
 }
 
 FunctorCode CastOffPagesFunctor::VisitPageEnd(Page *page)
@@ -352,8 +364,9 @@ FunctorCode CastOffPagesFunctor::VisitSystem(System *system)
 
     const int systemMaxPerPage = m_doc->GetOptions()->m_systemMaxPerPage.GetValue();
     const int systemChildCount = m_currentPage->GetChildCount(SYSTEM);
-    if ((systemMaxPerPage && (systemMaxPerPage == systemChildCount))
+    if (m_forcePageBreak || (systemMaxPerPage && (systemMaxPerPage == systemChildCount))
         || ((systemChildCount > 0) && (system->GetDrawingYRel() - system->GetHeight() - currentShift < 0))) {
+        m_forcePageBreak = false;
         // If this is the last system in the list, it doesn't fit the page and it's a leftover system (has just one
         // measure) => add the system content to the previous system
         Object *nextSystem = m_contentPage->GetNext(system, SYSTEM);
@@ -198,7 +198,7 @@ bool Chord::IsSupportedChild(Object *child)
 void Chord::AddChild(Object *child)
 {
     if (!this->IsSupportedChild(child)) {
-        LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
+        VRV_LOG_ERROR("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
         return;
     }
 
@@ -572,7 +572,7 @@ FunctorCode ConvertMarkupAnalyticalFunctor::VisitNote(Note *note)
                 }
             }
             else {
-                LogWarning("Expected @tie median or terminal in note '%s', skipping it", note->GetID().c_str());
+                VRV_LOG_WARNING("Expected @tie median or terminal in note '%s', skipping it", note->GetID().c_str());
             }
             iter = m_currentNotes.erase(iter);
             // we are done for this note
@@ -674,7 +674,7 @@ void ConvertMarkupArticFunctor::SplitMultival(Artic *artic) const
     // Multiple valued attributes cannot be preserved as such
     if (artic->IsAttribute()) {
         artic->IsAttribute(false);
-        LogInfo("Multiple valued attribute @artic on '%s' permanently converted to <artic> elements",
+        VRV_LOG_INFO("Multiple valued attribute @artic on '%s' permanently converted to <artic> elements",
             parent->GetID().c_str());
     }
 }
@@ -125,7 +125,7 @@ std::pair<double, double> BezierCurve::EstimateCurveParamForControlPoints() cons
 
 const Resources *DeviceContext::GetResources(bool showWarning) const
 {
-    if (!m_resources && showWarning) LogWarning("Requested resources unavailable.");
+    if (!m_resources && showWarning) VRV_LOG_WARNING("Requested resources unavailable.");
     return m_resources;
 }
 
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <math.h>
 
@@ -19,6 +20,7 @@
 #include "beatrpt.h"
 #include "castofffunctor.h"
 #include "chord.h"
+#include "clef.h"
 #include "comparison.h"
 #include "convertfunctor.h"
 #include "docselection.h"
@@ -36,6 +38,7 @@
 #include "measure.h"
 #include "mensur.h"
 #include "metersig.h"
+#include "metersiggrp.h"
 #include "midifunctor.h"
 #include "miscfunctor.h"
 #include "mnum.h"
@@ -80,6 +83,43 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// Static members
+//----------------------------------------------------------------------------
+
+thread_local Doc::ThreadDrawingFonts Doc::s_threadDrawingFonts;
+
+//----------------------------------------------------------------------------
+// MeasureWindowValues
+//----------------------------------------------------------------------------
+
+/**
+ * The drawing values of the measure window content in the document and the pages holding it.
+ * The staffDef objects and the scoreDefs are owned until they are attached back.
+ */
+struct MeasureWindowValues {
+    ~MeasureWindowValues()
+    {
+        for (auto &[layer, staffDefObjects] : m_layers) {
+            for (Object *object : { (Object *)staffDefObjects.m_clef, (Object *)staffDefObjects.m_keySig,
+                     (Object *)staffDefObjects.m_mensur, (Object *)staffDefObjects.m_meterSig,
+                     (Object *)staffDefObjects.m_meterSigGrp, (Object *)staffDefObjects.m_cautionClef,
+                     (Object *)staffDefObjects.m_cautionKeySig, (Object *)staffDefObjects.m_cautionMensur,
+                     (Object *)staffDefObjects.m_cautionMeterSig }) {
+                if (object) delete object;
+            }
+        }
+        for (auto &[measure, drawingScoreDef, left, right] : m_measures) {
+            if (drawingScoreDef) delete drawingScoreDef;
+        }
+    }
+
+    std::vector<std::pair<Layer *, Layer::StaffDefObjects>> m_layers;
+    std::vector<std::tuple<Measure *, ScoreDef *, data_BARRENDITION, data_BARRENDITION>> m_measures;
+    std::vector<std::tuple<Staff *, StaffDef *, Tuning *>> m_staves;
+    std::vector<Page *> m_pages;
+};
+
 //----------------------------------------------------------------------------
 // Doc
 //----------------------------------------------------------------------------
@@ -91,6 +131,15 @@ Doc::Doc() : Object(DOC, "doc-")
     // owned pointers need to be set to NULL;
     m_selectionPreceding = NULL;
     m_selectionFollowing = NULL;
+    m_castOffPagesFunctor = NULL;
+    m_castOffScoreDefSetCurrent = NULL;
+    m_castOffScoreDefOptimize = NULL;
+    m_castOffContentPage = NULL;
+    m_castOffSystemsPage = NULL;
+    m_castOffSystemsFunctor = NULL;
+    m_castOffSystemsScoreDefSetCurrent = NULL;
+    m_castOffSystemsScoreDefOptimize = NULL;
+    m_measureWindowValues = NULL;
 
     this->Reset();
 }
@@ -98,6 +147,9 @@ Doc::Doc() : Object(DOC, "doc-")
 Doc::~Doc()
 {
     this->ClearSelectionPages();
+    this->ClearPendingCastOff();
+
+    if (m_measureWindowValues) delete m_measureWindowValues;
 
     delete m_options;
 }
@@ -107,6 +159,15 @@ void Doc::Reset()
     Object::Reset();
 
     this->ClearSelectionPages();
+    this->ClearPendingCastOff();
+
+    // The window page was deleted with the pages
+    m_measureWindowPage = NULL;
+    m_measureWindowOrigins.clear();
+    if (m_measureWindowValues) {
+        delete m_measureWindowValues;
+        m_measureWindowValues = NULL;
+    }
 
     m_type = Raw;
     m_notationType = NOTATIONTYPE_NONE;
@@ -160,6 +221,55 @@ void Doc::ClearSelectionPages()
     m_selectionEnd = "";
 }
 
+void Doc::ClearPendingCastOff()
+{
+    if (m_castOffPagesFunctor) {
+        delete m_castOffPagesFunctor;
+        m_castOffPagesFunctor = NULL;
+    }
+    if (m_castOffScoreDefSetCurrent) {
+        delete m_castOffScoreDefSetCurrent;
+        m_castOffScoreDefSetCurrent = NULL;
+    }
+    if (m_castOffScoreDefOptimize) {
+        delete m_castOffScoreDefOptimize;
+        m_castOffScoreDefOptimize = NULL;
+    }
+    m_castOffPendingPage = NULL;
+
+    // The content and systems pages are not part of the document
+    if (m_castOffContentPage) {
+        delete m_castOffContentPage;
+        m_castOffContentPage = NULL;
+    }
+    if (m_castOffSystemsPage) {
+        delete m_castOffSystemsPage;
+        m_castOffSystemsPage = NULL;
+    }
+    if (m_castOffSystemsFunctor) {
+        delete m_castOffSystemsFunctor;
+        m_castOffSystemsFunctor = NULL;
+    }
+    if (m_castOffSystemsScoreDefSetCurrent) {
+        delete m_castOffSystemsScoreDefSetCurrent;
+        m_castOffSystemsScoreDefSetCurrent = NULL;
+    }
+    if (m_castOffSystemsScoreDefOptimize) {
+        delete m_castOffSystemsScoreDefOptimize;
+        m_castOffSystemsScoreDefOptimize = NULL;
+    }
+    m_castOffContentShift = 0;
+    this->ClearCastOffContentScoreDefs();
+}
+
+void Doc::ClearCastOffContentScoreDefs()
+{
+    for (ScoreDef *scoreDef : m_castOffContentScoreDefs) {
+        delete scoreDef;
+    }
+    m_castOffContentScoreDefs.clear();
+}
+
 void Doc::SetType(DocType type)
 {
     m_type = type;
@@ -183,14 +293,14 @@ bool Doc::GenerateDocumentScoreDef()
 {
     Measure *measure = vrv_cast<Measure *>(this->FindDescendantByType(MEASURE));
     if (!measure) {
-        LogError("No measure found for generating a scoreDef");
+        VRV_LOG_ERROR("No measure found for generating a scoreDef");
         return false;
     }
 
     ListOfObjects staves = measure->FindAllDescendantsByType(STAFF, false);
 
     if (staves.empty()) {
-        LogError("No staff found for generating a scoreDef");
+        VRV_LOG_ERROR("No staff found for generating a scoreDef");
         return false;
     }
 
@@ -208,7 +318,7 @@ bool Doc::GenerateDocumentScoreDef()
     }
     scoreDef->AddChild(staffGrp);
 
-    LogInfo("ScoreDef generated");
+    VRV_LOG_INFO("ScoreDef generated");
 
     return true;
 }
@@ -356,7 +466,11 @@ void Doc::CalculateTimemap()
         return;
     }
 
-    m_timemapTempo = 0.0;
+    // Only the tempo adjustment changed, the score-time values can be kept
+    if (m_timemapTempo != 0.0) {
+        this->CalculateTimemapRealTime();
+        return;
+    }
 
     // This happens if the document was never cast off (breaks none option in the toolkit)
     if (!m_drawingPage) {
@@ -366,6 +480,22 @@ void Doc::CalculateTimemap()
         page->LayOutHorizontally();
     }
 
+    // Calculate the onset and offset times (w.r.t. the measure) for every note
+    InitOnsetOffsetFunctor initOnsetOffset;
+    this->Process(initOnsetOffset);
+
+    // Adjust the duration of tied notes
+    InitTimemapTiesFunctor initTimemapTies;
+    initTimemapTies.SetDirection(BACKWARD);
+    this->Process(initTimemapTies);
+
+    this->CalculateTimemapRealTime();
+}
+
+void Doc::CalculateTimemapRealTime()
+{
+    m_timemapTempo = 0.0;
+
     double tempo = MIDI_TEMPO;
 
     // Set tempo
@@ -377,20 +507,15 @@ void Doc::CalculateTimemap()
         tempo = Tempo::CalcTempo(scoreDef);
     }
 
-    // We first calculate the maximum duration of each measure
+    // We first calculate the maximum duration and the tempo of each measure
     InitMaxMeasureDurationFunctor initMaxMeasureDuration;
     initMaxMeasureDuration.SetCurrentTempo(tempo);
     initMaxMeasureDuration.SetTempoAdjustment(m_options->m_midiTempoAdjustment.GetValue());
     this->Process(initMaxMeasureDuration);
 
-    // Then calculate the onset and offset times (w.r.t. the measure) for every note
-    InitOnsetOffsetFunctor initOnsetOffset;
-    this->Process(initOnsetOffset);
-
-    // Adjust the duration of tied notes
-    InitTimemapTiesFunctor initTimemapTies;
-    initTimemapTies.SetDirection(BACKWARD);
-    this->Process(initTimemapTies);
+    // Then calculate the real onset and offset times for every note and rest
+    InitRealTimeFunctor initRealTime;
+    this->Process(initRealTime);
 
     m_timemapTempo = m_options->m_midiTempoAdjustment.GetValue();
 }
@@ -402,7 +527,7 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
         CalculateTimemap();
     }
     if (!this->HasTimemap()) {
-        LogWarning("Calculation of the timemap failed, MIDI cannot be exported.");
+        VRV_LOG_WARNING("Calculation of the timemap failed, MIDI cannot be exported.");
     }
 
     double tempo = MIDI_TEMPO;
@@ -469,7 +594,7 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
                         midiFile->addTracks(midiTrack + 1 - midiFile->getTrackCount());
                     }
                     if (midiTrack > 255) {
-                        LogWarning("A high MIDI track number was assigned to staff %d", staffDef->GetN());
+                        VRV_LOG_WARNING("A high MIDI track number was assigned to staff %d", staffDef->GetN());
                     }
                 }
                 if (instrdef->HasMidiInstrnum()) {
@@ -539,15 +664,15 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
     }
 }
 
-bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeasures)
+bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeasures, bool binary)
 {
     if (!this->HasTimemap()) {
         // generate MIDI timemap before progressing
         CalculateTimemap();
     }
     if (!this->HasTimemap()) {
-        LogWarning("Calculation of the timemap failed, the timemap cannot be exported.");
-        output = "{}";
+        VRV_LOG_WARNING("Calculation of the timemap failed, the timemap cannot be exported.");
+        output = binary ? "" : "{}";
         return false;
     }
     Timemap timemap;
@@ -555,7 +680,12 @@ bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeas
     generateTimemap.SetCueExclusion(this->GetOptions()->m_midiNoCue.GetValue());
     this->Process(generateTimemap);
 
-    timemap.ToJson(output, includeRests, includeMeasures);
+    if (binary) {
+        timemap.ToBinary(output, includeRests, includeMeasures);
+    }
+    else {
+        timemap.ToJson(output, includeRests, includeMeasures);
+    }
 
     return true;
 }
@@ -571,20 +701,29 @@ bool Doc::ExportExpansionMap(std::string &output)
 }
 
 bool Doc::ExportFeatures(std::string &output, const std::string &options)
+{
+    FeatureExtractor extractor(options);
+    if (!this->ExtractFeatures(extractor)) {
+        output = "{}";
+        return false;
+    }
+    extractor.ToJson(output);
+
+    return true;
+}
+
+bool Doc::ExtractFeatures(FeatureExtractor &extractor)
 {
     if (!this->HasTimemap()) {
         // generate MIDI timemap before progressing
         CalculateTimemap();
     }
     if (!this->HasTimemap()) {
-        LogWarning("Calculation of the timemap failed, the features cannot be exported.");
-        output = "{}";
+        VRV_LOG_WARNING("Calculation of the timemap failed, the features cannot be exported.");
         return false;
     }
-    FeatureExtractor extractor(options);
     GenerateFeaturesFunctor generateFeatures(&extractor);
     this->Process(generateFeatures);
-    extractor.ToJson(output);
 
     return true;
 }
@@ -636,7 +775,7 @@ void Doc::PrepareData()
             return (entry.first->HasStartid() && entry.first->HasEndid());
         });
     if (unmatchedElements > 0) {
-        LogWarning("%d time spanning element(s) with startid and endid could not be matched.", unmatchedElements);
+        VRV_LOG_WARNING("%d time spanning element(s) with startid and endid could not be matched.", unmatchedElements);
     }
 
     /************ Resolve @startid (only) ************/
@@ -659,7 +798,7 @@ void Doc::PrepareData()
 
     // If some are still there, then it is probably an issue in the encoding
     if (!prepareTimestamps.GetInterfaceIDPairs().empty()) {
-        LogWarning("%d time spanning element(s) with timestamps could not be matched.",
+        VRV_LOG_WARNING("%d time spanning element(s) with timestamps could not be matched.",
             prepareTimestamps.GetInterfaceIDPairs().size());
     }
 
@@ -678,13 +817,15 @@ void Doc::PrepareData()
 
     // If some are still there, then it is probably an issue in the encoding
     if (!prepareLinking.GetNextIDPairs().empty()) {
-        LogWarning("%d element(s) with a @next could not match the target", prepareLinking.GetNextIDPairs().size());
+        VRV_LOG_WARNING("%d element(s) with a @next could not match the target",
+            prepareLinking.GetNextIDPairs().size());
     }
     if (!prepareLinking.GetSameasIDPairs().empty()) {
-        LogWarning("%d element(s) with a @sameas could not match the target", prepareLinking.GetSameasIDPairs().size());
+        VRV_LOG_WARNING("%d element(s) with a @sameas could not match the target",
+            prepareLinking.GetSameasIDPairs().size());
     }
     if (!prepareLinking.GetStemSameasIDPairs().empty()) {
-        LogWarning("%d element(s) with a @stem.sameas could not match the target",
+        VRV_LOG_WARNING("%d element(s) with a @stem.sameas could not match the target",
             prepareLinking.GetStemSameasIDPairs().size());
     }
 
@@ -702,7 +843,8 @@ void Doc::PrepareData()
 
     // If some are still there, then it is probably an issue in the encoding
     if (!preparePlist.GetInterfaceIDPairs().empty()) {
-        LogWarning("%d element(s) with a @plist could not match the target", preparePlist.GetInterfaceIDPairs().size());
+        VRV_LOG_WARNING("%d element(s) with a @plist could not match the target",
+            preparePlist.GetInterfaceIDPairs().size());
     }
 
     /************ Resolve cross staff ************/
@@ -741,21 +883,43 @@ void Doc::PrepareData()
     IntTree_t::const_iterator layers;
     IntTree_t::const_iterator verses;
 
+    // We also index the staves by @n in document order. Processing by staff/layer/verse then only visits the
+    // staves with the corresponding @n instead of traversing the whole document each time
+    std::map<int, std::vector<std::pair<Staff *, Measure *>>> stavesByN;
+    for (Object *object : this->FindAllDescendantsByType(STAFF, false)) {
+        Staff *staff = vrv_cast<Staff *>(object);
+        assert(staff);
+        stavesByN[staff->GetN()].push_back({ staff, vrv_cast<Measure *>(staff->GetFirstAncestor(MEASURE)) });
+    }
+
+    // Process the staves with @n and end each measure once its staves are processed
+    auto processStaves = [&stavesByN](Functor &functor, int staffN) {
+        const std::vector<std::pair<Staff *, Measure *>> &staffMeasures = stavesByN[staffN];
+        for (auto iter = staffMeasures.begin(); iter != staffMeasures.end(); ++iter) {
+            iter->first->Process(functor);
+            const bool stop = (functor.GetCode() == FUNCTOR_STOP);
+            auto next = std::next(iter);
+            const bool measureEnd = (stop || (next == staffMeasures.end()) || (next->second != iter->second));
+            if (iter->second && measureEnd && functor.ImplementsEndInterface()) {
+                functor.SetCode(iter->second->AcceptEnd(functor));
+            }
+            if (stop) break;
+        }
+    };
+
     /************ Resolve some pointers by layer ************/
 
     Filters filters;
     for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             filters.Clear();
-            // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves->first);
+            // Create ad comparison object for the layer @n
             AttNIntegerComparison matchLayer(LAYER, layers->first);
-            filters.Add(&matchStaff);
             filters.Add(&matchLayer);
 
             PreparePointersByLayerFunctor preparePointersByLayer;
             preparePointersByLayer.SetFilters(&filters);
-            this->Process(preparePointersByLayer);
+            processStaves(preparePointersByLayer, staves->first);
         }
     }
 
@@ -769,15 +933,13 @@ void Doc::PrepareData()
         for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
             for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
                 filters.Clear();
-                // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves->first);
+                // Create ad comparison object for the layer @n
                 AttNIntegerComparison matchLayer(LAYER, layers->first);
-                filters.Add(&matchStaff);
                 filters.Add(&matchLayer);
 
                 prepareDelayedTurns.SetFilters(&filters);
                 prepareDelayedTurns.ResetCurrent();
-                this->Process(prepareDelayedTurns);
+                processStaves(prepareDelayedTurns, staves->first);
             }
         }
     }
@@ -791,10 +953,8 @@ void Doc::PrepareData()
                 // std::cout << staves->first << " => " << layers->first << " => " << verses->first << '\n';
                 filters.Clear();
                 // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves->first);
                 AttNIntegerComparison matchLayer(LAYER, layers->first);
                 AttNIntegerComparison matchVerse(VERSE, verses->first);
-                filters.Add(&matchStaff);
                 filters.Add(&matchLayer);
                 filters.Add(&matchVerse);
 
@@ -802,7 +962,9 @@ void Doc::PrepareData()
                 // m_drawingLastNote is set only if the syl has a forward connector
                 PrepareLyricsFunctor prepareLyrics;
                 prepareLyrics.SetFilters(&filters);
-                this->Process(prepareLyrics);
+                processStaves(prepareLyrics, staves->first);
+                // Close the syl left open at the end of the document
+                this->AcceptEnd(prepareLyrics);
             }
         }
     }
@@ -817,7 +979,7 @@ void Doc::PrepareData()
 
     // Something must be wrong in the encoding because a TimeSpanningInterface was left open
     if (!prepareStaffCurrentTimeSpanning.GetTimeSpanningElements().empty()) {
-        LogDebug("%d time spanning elements could not be set as running",
+        VRV_LOG_DEBUG("%d time spanning elements could not be set as running",
             prepareStaffCurrentTimeSpanning.GetTimeSpanningElements().size());
     }
 
@@ -827,42 +989,29 @@ void Doc::PrepareData()
     for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             filters.Clear();
-            // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves->first);
+            // Create ad comparison object for the layer @n
             AttNIntegerComparison matchLayer(LAYER, layers->first);
-            filters.Add(&matchStaff);
             filters.Add(&matchLayer);
 
             // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first staff
             PrepareRptFunctor prepareRpt(this);
             prepareRpt.SetFilters(&filters);
-            this->Process(prepareRpt);
+            processStaves(prepareRpt, staves->first);
         }
     }
 
-    /************ Resolve endings ************/
+    /************ Resolve endings, floating groups, cue size and @altsym ************/
 
     // Prepare the endings (pointers to the measure after and before the boundaries)
     PrepareMilestonesFunctor prepareMilestones;
-    this->Process(prepareMilestones);
-
-    /************ Resolve floating groups for vertical alignment ************/
-
-    // Prepare the floating drawing groups
+    // Prepare the floating drawing groups for vertical alignment
     PrepareFloatingGrpsFunctor prepareFloatingGrps;
-    this->Process(prepareFloatingGrps);
-
-    /************ Resolve cue size ************/
-
     // Prepare the drawing cue size
     PrepareCueSizeFunctor prepareCueSize;
-    this->Process(prepareCueSize);
-
-    /************ Resolve @altsym ************/
-
-    // Try to match all pointing elements using @next, @sameas and @stem.sameas
+    // Try to match all pointing elements using @altsym
     PrepareAltSymFunctor prepareAltSym;
-    this->Process(prepareAltSym);
+    // These only set values on the object being visited (or use their own state), so they can be run in one traversal
+    this->Process({ &prepareMilestones, &prepareFloatingGrps, &prepareCueSize, &prepareAltSym });
 
     /************ Instanciate LayerElement parts (stem, flag, dots, etc) ************/
 
@@ -878,9 +1027,11 @@ void Doc::PrepareData()
 
     /************ Resolve @facs ************/
     if (this->IsFacs()) {
-        // Associate zones with elements
+        // Associate zones with elements, with the zones indexed for the lookups
         PrepareFacsimileFunctor prepareFacsimile(this->GetFacsimile());
+        this->GetFacsimile()->IndexDescendants();
         this->Process(prepareFacsimile);
+        this->GetFacsimile()->ClearIndex();
 
         // Add default syl zone if one is not present.
         for (Object *object : prepareFacsimile.GetZonelessSyls()) {
@@ -960,7 +1111,7 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     assert(pages);
 
     if (this->IsCastOff()) {
-        LogDebug("Document is already cast off");
+        VRV_LOG_DEBUG("Document is already cast off");
         return;
     }
 
@@ -972,6 +1123,36 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     Page *unCastOffPage = this->SetDrawingPage(0);
     assert(unCastOffPage);
 
+    // With progressive layout, the content is laid out horizontally and cast off by chunks, only until the first page
+    // is full. With encoded system breaks, the systems are cast off at once and only the pages are cast off by chunks.
+    if (m_options->m_progressiveLayout.GetValue() && (!useSb || usePb || smart)) {
+        pages->DetachChild(0);
+        this->ResetDataPage();
+
+        for (Score *score : scores) {
+            score->CalcRunningElementHeight(this);
+        }
+
+        m_castOffContentPage = unCastOffPage;
+        m_castOffSystemsPage = new Page();
+        m_castOffSystemsFunctor = new CastOffSystemsFunctor(m_castOffSystemsPage, this, smart);
+        m_castOffSystemsFunctor->SetSystemWidth(m_drawingPageContentWidth);
+        m_castOffSystemsScoreDefSetCurrent = new ScoreDefSetCurrentFunctor(this);
+        m_castOffSystemsScoreDefOptimize = new ScoreDefOptimizeFunctor(this);
+        m_castOffContentShift = 0;
+
+        m_castOffPendingPage = new Page();
+        m_castOffPagesFunctor = new CastOffPagesFunctor(m_castOffPendingPage, this, NULL);
+        m_castOffPagesFunctor->SetPageHeight(m_drawingPageContentHeight);
+        m_castOffScoreDefSetCurrent = new ScoreDefSetCurrentFunctor(this);
+        m_castOffScoreDefOptimize = new ScoreDefOptimizeFunctor(this);
+        pages->AddChild(m_castOffPendingPage);
+
+        m_isCastOff = true;
+        this->CastOffPendingPages(1);
+        return;
+    }
+
     // Check if the the horizontal layout is cached by looking at the first measure
     // The cache is not set the first time, or can be reset by Doc::UnCastOffDoc
     Measure *firstMeasure = vrv_cast<Measure *>(unCastOffPage->FindDescendantByType(MEASURE));
@@ -1014,13 +1195,7 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     this->ResetDataPage();
     this->SetDrawingPage(0);
 
-    bool optimize = false;
-    for (Score *score : scores) {
-        if (score->ScoreDefNeedsOptimization(m_options->m_condense.GetValue())) {
-            optimize = true;
-            break;
-        }
-    }
+    const bool optimize = this->ScoreDefNeedsOptimization();
 
     // Reset the scoreDef at the beginning of each system
     this->ScoreDefSetCurrentDoc(true);
@@ -1031,6 +1206,29 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     // Here we redo the alignment because of the new scoreDefs
     // Because of the new scoreDef, we need to reset cached drawingX
     castOffSinglePage->ResetCachedDrawingX();
+
+    // With progressive layout (and encoded system breaks), the systems are kept in a pending page
+    if (m_options->m_progressiveLayout.GetValue()) {
+        pages->DetachChild(0);
+        this->ResetDataPage();
+
+        for (Score *score : scores) {
+            score->CalcRunningElementHeight(this);
+        }
+
+        m_castOffPendingPage = castOffSinglePage;
+        m_castOffPagesFunctor = new CastOffPagesFunctor(castOffSinglePage, this, NULL);
+        m_castOffPagesFunctor->SetPageHeight(m_drawingPageContentHeight);
+        m_castOffPagesFunctor->SetLeftoverSystem(leftoverSystem);
+        m_castOffScoreDefSetCurrent = new ScoreDefSetCurrentFunctor(this);
+        m_castOffScoreDefOptimize = new ScoreDefOptimizeFunctor(this);
+        pages->AddChild(castOffSinglePage);
+
+        m_isCastOff = true;
+        this->CastOffPendingPages(1);
+        return;
+    }
+
     castOffSinglePage->LayOutVertically();
 
     // Detach the contentPage to prepare for CastOffPages
@@ -1059,16 +1257,423 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     m_isCastOff = true;
 }
 
+void Doc::CastOffPendingPages(int pageCount)
+{
+    if (!this->HasPendingCastOff()) return;
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+    assert(m_castOffPagesFunctor);
+
+    // Detach the pending page - the pages are cast off page by page as in CastOffDocBase
+    pages->DetachChild(m_castOffPendingPage->GetIdx());
+    this->ResetDataPage();
+    const int firstPageIdx = pages->GetChildCount();
+
+    // The number of systems laid out vertically in one go is based on the number of pages requested
+    int chunkFactor = 1;
+    while ((m_castOffPendingPage->GetChildCount(SYSTEM) > 0) || m_castOffContentPage) {
+        const int castOffPageCount = pages->GetChildCount();
+        if ((pageCount != VRV_UNSET) && (castOffPageCount >= pageCount)) break;
+
+        int chunkSize = VRV_UNSET;
+        if (pageCount != VRV_UNSET) {
+            int systemsPerPage = 8;
+            if (castOffPageCount > 0) {
+                int systemCount = 0;
+                for (Object *page : pages->GetChildren()) systemCount += page->GetChildCount(SYSTEM);
+                systemsPerPage = std::max(1, systemCount / castOffPageCount);
+            }
+            // Always lay out one more page since the last one is discarded
+            chunkSize = (pageCount - castOffPageCount + 1) * systemsPerPage * chunkFactor;
+        }
+
+        // Cast off the systems of the chunk still missing from the content
+        this->CastOffContentSystems(chunkSize);
+        const int pendingSystemCount = m_castOffPendingPage->GetChildCount(SYSTEM);
+        if (pendingSystemCount == 0) break;
+        chunkSize = (chunkSize == VRV_UNSET) ? pendingSystemCount : std::min(chunkSize, pendingSystemCount);
+
+        // Move the systems of the chunk (with the page elements in-between) to a new page
+        Page *chunkPage = new Page();
+        int systemCount = 0;
+        for (int i = 0; i < m_castOffPendingPage->GetChildCount(); ++i) {
+            Object *child = m_castOffPendingPage->GetChild(i);
+            if (child->Is(SYSTEM)) {
+                if (systemCount == chunkSize) break;
+                ++systemCount;
+            }
+            chunkPage->AddChild(m_castOffPendingPage->Relinquish(i));
+        }
+        m_castOffPendingPage->ClearRelinquishedChildren();
+        const bool isLastChunk = (m_castOffPendingPage->GetChildCount(SYSTEM) == 0) && !m_castOffContentPage;
+
+        // Lay out the chunk vertically
+        pages->AddChild(chunkPage);
+        ScoreDefSetCurrentPageFunctor scoreDefSetCurrentPage(this);
+        this->Process(scoreDefSetCurrentPage, 3);
+        this->SetDrawingPage(chunkPage->GetIdx());
+        chunkPage->LayOutVertically();
+        pages->DetachChild(chunkPage->GetIdx());
+        this->ResetDataPage();
+
+        // Cast off the pages with the functor, which keeps its state between the chunks
+        if (castOffPageCount == 0) {
+            Page *castOffFirstPage = new Page();
+            pages->AddChild(castOffFirstPage);
+            m_castOffPagesFunctor->SetCurrentPage(castOffFirstPage);
+        }
+        m_castOffPagesFunctor->SetContentPage(chunkPage);
+        chunkPage->Process(*m_castOffPagesFunctor);
+        delete chunkPage;
+
+        if (isLastChunk) break;
+
+        // The last page might not be complete - move its content back to the pending page
+        Page *lastPage = vrv_cast<Page *>(pages->DetachChild(pages->GetChildCount() - 1));
+        assert(lastPage);
+        for (int i = lastPage->GetChildCount() - 1; i >= 0; --i) {
+            m_castOffPendingPage->InsertChild(lastPage->DetachChild(i), 0);
+        }
+        delete lastPage;
+
+        if (pages->GetChildCount() == castOffPageCount) {
+            // No page could be completed with this chunk - try with a larger one
+            chunkFactor *= 2;
+        }
+        if (pages->GetChildCount() > 0) {
+            // Otherwise we are still on the first page and the functor can carry on
+            m_castOffPagesFunctor->SetCurrentPage(vrv_cast<Page *>(pages->GetLast()));
+            m_castOffPagesFunctor->ForcePageBreak();
+        }
+    }
+
+    const bool isDone = (m_castOffPendingPage->GetChildCount(SYSTEM) == 0) && !m_castOffContentPage;
+    if (!isDone) {
+        pages->AddChild(m_castOffPendingPage);
+    }
+
+    // The pages cast off previously are unchanged
+    this->ScoreDefSetCurrentCastOffPages(firstPageIdx);
+
+    if (isDone) {
+        // Everything has been cast off
+        delete m_castOffPendingPage;
+        this->ClearPendingCastOff();
+    }
+}
+
+void Doc::CastOffContentSystems(int systemCount)
+{
+    if (!m_castOffContentPage) return;
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+    assert(m_castOffPendingPage && !m_castOffPendingPage->GetParent());
+
+    // The content page comes after the pending page, from which it can get its score
+    pages->AddChild(m_castOffPendingPage);
+    pages->AddChild(m_castOffContentPage);
+
+    // The number of measures laid out in one go is based on the number of measures per system so far
+    int measureCount = 0;
+    int castOffSystemCount = 0;
+    while (m_castOffContentPage) {
+        const int pendingSystemCount = m_castOffPendingPage->GetChildCount(SYSTEM);
+        if ((systemCount != VRV_UNSET) && (pendingSystemCount >= systemCount)) break;
+
+        int chunkSize = VRV_UNSET;
+        if (systemCount != VRV_UNSET) {
+            // Without a system cast off yet, they are likely to have more than the measures so far
+            const int measuresPerSystem = (castOffSystemCount > 0) ? std::max(1, measureCount / castOffSystemCount)
+                                                                   : std::max(4, measureCount * 2);
+            chunkSize = (systemCount - pendingSystemCount) * measuresPerSystem;
+        }
+        measureCount += this->CastOffContentChunk(chunkSize);
+        castOffSystemCount += m_castOffPendingPage->GetChildCount(SYSTEM) - pendingSystemCount;
+    }
+
+    if (m_castOffContentPage) {
+        pages->DetachChild(m_castOffContentPage->GetIdx());
+    }
+    pages->DetachChild(m_castOffPendingPage->GetIdx());
+    this->ResetDataPage();
+}
+
+int Doc::CastOffContentChunk(int measureCount)
+{
+    assert(m_castOffContentPage && m_castOffContentPage->GetParent());
+    assert(m_castOffSystemsPage && m_castOffSystemsFunctor);
+
+    // The page elements before the content system are cast off with it
+    System *contentSystem = vrv_cast<System *>(m_castOffContentPage->GetFirst(SYSTEM));
+
+    // Find the end of the chunk, and the end of the layout with one more measure since the spacing of the
+    // following measure (e.g., lyrics) can change the width of the last one
+    int chunkEnd = VRV_UNSET;
+    int layoutEnd = VRV_UNSET;
+    int chunkMeasureCount = 0;
+    if (contentSystem) {
+        for (int i = 0; i < contentSystem->GetChildCount(); ++i) {
+            Object *child = contentSystem->GetChild(i);
+            if (!child->Is(MEASURE) && !child->FindDescendantByType(MEASURE)) continue;
+            if ((measureCount != VRV_UNSET) && (chunkMeasureCount == measureCount)) {
+                layoutEnd = i + 1;
+                break;
+            }
+            ++chunkMeasureCount;
+            chunkEnd = i + 1;
+        }
+    }
+    const bool partialContent = (layoutEnd != VRV_UNSET);
+
+    // Keep the content after the chunk aside - the objects are detached from the end and in reverse order
+    ArrayOfObjects systemTail;
+    ArrayOfObjects pageTail;
+    if (partialContent) {
+        for (int i = contentSystem->GetChildCount() - 1; i >= layoutEnd; --i) {
+            systemTail.push_back(contentSystem->DetachChild(i));
+        }
+    }
+    // Without more content in the system, the page elements up to the next system go with the chunk
+    int pageEnd = m_castOffContentPage->GetChildCount();
+    if (contentSystem) {
+        pageEnd = contentSystem->GetIdx() + 1;
+        if (!partialContent) {
+            Object *nextSystem = m_castOffContentPage->GetNext(contentSystem, SYSTEM);
+            pageEnd = (nextSystem) ? nextSystem->GetIdx() : m_castOffContentPage->GetChildCount();
+        }
+    }
+    for (int i = m_castOffContentPage->GetChildCount() - 1; i >= pageEnd; --i) {
+        pageTail.push_back(m_castOffContentPage->DetachChild(i));
+    }
+
+    if (contentSystem) {
+        ScoreDefSetCurrentPageFunctor scoreDefSetCurrentPage(this);
+        this->Process(scoreDefSetCurrentPage, 3);
+        this->ResetDataPage();
+        this->SetDrawingPage(m_castOffContentPage->GetIdx());
+
+        // Check if the horizontal layout is cached as in CastOffDocBase, but for all the measures of the chunk
+        ListOfObjects measures = contentSystem->FindAllDescendantsByType(MEASURE, false);
+        const bool hasCache = !measures.empty() && std::all_of(measures.begin(), measures.end(), [](Object *object) {
+            return vrv_cast<Measure *>(object)->HasCachedHorizontalLayout();
+        });
+        // With measures already cast off from the content system, an empty measure stands for them in the layout
+        // since the first measure of a system is laid out differently (e.g., with a system start line)
+        int placeholderEnd = 0;
+        if (!hasCache) {
+            Measure *placeholder = NULL;
+            if (m_castOffContentShift > 0) {
+                placeholder = new Measure();
+                contentSystem->InsertChild(placeholder, 0);
+            }
+            m_castOffContentPage->LayOutHorizontally();
+            if (placeholder) {
+                placeholderEnd = placeholder->GetDrawingXRel() + placeholder->GetWidth();
+                delete contentSystem->DetachChild(placeholder->GetIdx());
+            }
+        }
+
+        // The measure after the chunk is not cast off and will be laid out again with the next chunk
+        if (partialContent) {
+            for (int i = contentSystem->GetChildCount() - 1; i >= chunkEnd; --i) {
+                systemTail.push_back(contentSystem->DetachChild(i));
+            }
+        }
+
+        if (!hasCache) {
+            // The measures of the chunk follow the ones already cast off from the content system
+            for (Object *object : contentSystem->FindAllDescendantsByType(MEASURE, false)) {
+                Measure *measure = vrv_cast<Measure *>(object);
+                measure->SetDrawingXRel(measure->GetDrawingXRel() - placeholderEnd + m_castOffContentShift);
+            }
+            m_castOffContentPage->LayOutHorizontallyWithCache();
+        }
+        else {
+            m_castOffContentPage->LayOutHorizontallyWithCache(true);
+        }
+
+        Object *lastMeasure = contentSystem->FindDescendantByType(MEASURE, UNLIMITED_DEPTH, BACKWARD);
+        if (lastMeasure) {
+            Measure *measure = vrv_cast<Measure *>(lastMeasure);
+            m_castOffContentShift = measure->GetDrawingXRel() + measure->GetCachedWidth();
+        }
+    }
+
+    m_castOffSystemsFunctor->SetPartialContent(partialContent);
+    m_castOffContentPage->Process(*m_castOffSystemsFunctor);
+    // The page elements have been moved to the systems page
+    m_castOffContentPage->ClearRelinquishedChildren();
+
+    if (contentSystem) {
+        contentSystem->ClearRelinquishedChildren();
+        assert(contentSystem->GetChildCount() == 0);
+        for (auto it = systemTail.rbegin(); it != systemTail.rend(); ++it) {
+            contentSystem->AddChild(*it);
+        }
+        // The content system is complete
+        if (!partialContent) {
+            delete m_castOffContentPage->DetachChild(contentSystem->GetIdx());
+            m_castOffContentShift = 0;
+            this->ClearCastOffContentScoreDefs();
+        }
+    }
+    for (auto it = pageTail.rbegin(); it != pageTail.rend(); ++it) {
+        m_castOffContentPage->AddChild(*it);
+    }
+    const bool isLastChunk = (m_castOffContentPage->GetChildCount() == 0);
+
+    // Move the systems (with the page elements in-between) to the pending page, but not the one being filled
+    int systemsEnd = m_castOffSystemsPage->GetChildCount();
+    if (partialContent) {
+        Object *currentSystem = m_castOffSystemsPage->GetLast(SYSTEM);
+        if (currentSystem) systemsEnd = currentSystem->GetIdx();
+    }
+    ArrayOfObjects objects;
+    for (int i = 0; i < systemsEnd; ++i) {
+        objects.push_back(m_castOffSystemsPage->Relinquish(i));
+    }
+    m_castOffSystemsPage->ClearRelinquishedChildren();
+
+    // Store the cast off system widths and set the scoreDefs as done for the whole page in CastOffDocBase
+    const bool optimize = this->ScoreDefNeedsOptimization();
+    for (Object *object : objects) {
+        m_castOffPendingPage->AddChild(object);
+        if (object->Is(SYSTEM)) {
+            AlignMeasuresFunctor alignMeasures(this);
+            alignMeasures.StoreCastOffSystemWidths(true);
+            object->Process(alignMeasures);
+        }
+        // The staves of the content system can still refer to the drawing scoreDef of a measure before them
+        if (partialContent) {
+            for (Object *child : object->FindAllDescendantsByType(MEASURE, false)) {
+                ScoreDef *drawingScoreDef = vrv_cast<Measure *>(child)->DetachDrawingScoreDef();
+                if (drawingScoreDef) m_castOffContentScoreDefs.push_back(drawingScoreDef);
+            }
+        }
+        ScoreDefUnsetCurrentFunctor scoreDefUnsetCurrent;
+        object->Process(scoreDefUnsetCurrent);
+        object->Process(*m_castOffSystemsScoreDefSetCurrent);
+        if (optimize) object->Process(*m_castOffSystemsScoreDefOptimize);
+        ScoreDefSetGrpSymFunctor scoreDefSetGrpSym;
+        object->Process(scoreDefSetGrpSym);
+        object->ResetCachedDrawingX();
+    }
+
+    if (isLastChunk) {
+        // Everything has been cast off into systems
+        m_castOffPagesFunctor->SetLeftoverSystem(m_castOffSystemsFunctor->GetLeftoverSystem());
+        this->ResetDataPage();
+        delete m_castOffContentPage->GetParent()->DetachChild(m_castOffContentPage->GetIdx());
+        m_castOffContentPage = NULL;
+        assert(m_castOffSystemsPage->GetChildCount() == 0);
+        delete m_castOffSystemsPage;
+        m_castOffSystemsPage = NULL;
+    }
+
+    return chunkMeasureCount;
+}
+
+void Doc::ScoreDefSetCurrentCastOffPages(int firstPageIdx)
+{
+    assert(m_castOffScoreDefSetCurrent && m_castOffScoreDefOptimize);
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    for (int i = firstPageIdx; i < pages->GetChildCount(); ++i) {
+        ScoreDefUnsetCurrentFunctor scoreDefUnsetCurrent;
+        pages->GetChild(i)->Process(scoreDefUnsetCurrent);
+    }
+
+    ScoreDefSetCurrentPageFunctor scoreDefSetCurrentPage(this);
+    this->Process(scoreDefSetCurrentPage, 3);
+
+    const bool optimize = this->ScoreDefNeedsOptimization();
+    for (int i = firstPageIdx; i < pages->GetChildCount(); ++i) {
+        Page *page = vrv_cast<Page *>(pages->GetChild(i));
+        assert(page);
+        if (page != m_castOffPendingPage) {
+            page->Process(*m_castOffScoreDefSetCurrent);
+            if (optimize) page->Process(*m_castOffScoreDefOptimize);
+        }
+        else {
+            // The pending page will be cast off again and is processed with a copy of the state
+            ScoreDefSetCurrentFunctor scoreDefSetCurrent(*m_castOffScoreDefSetCurrent);
+            page->Process(scoreDefSetCurrent);
+            if (optimize) {
+                ScoreDefOptimizeFunctor scoreDefOptimize(*m_castOffScoreDefOptimize);
+                page->Process(scoreDefOptimize);
+            }
+        }
+        ScoreDefSetGrpSymFunctor scoreDefSetGrpSym;
+        page->Process(scoreDefSetGrpSym);
+    }
+
+    m_currentScoreDefDone = true;
+}
+
+int Doc::GetEstimatedPageCount() const
+{
+    const int pageCount = this->GetPageCount();
+    if (!this->HasPendingCastOff()) return pageCount;
+
+    // The pending page is always the last one
+    const int castOffPageCount = pageCount - 1;
+    if (castOffPageCount == 0) return pageCount;
+
+    const Pages *pages = this->GetPages();
+    assert(pages);
+    int systemCount = 0;
+    int measureCount = 0;
+    for (const Object *page : pages->GetChildren()) {
+        if (page == m_castOffPendingPage) continue;
+        systemCount += page->GetChildCount(SYSTEM);
+        measureCount += page->GetDescendantCount(MEASURE);
+    }
+    const double systemsPerPage = (double)systemCount / (double)castOffPageCount;
+    double pendingSystemCount = m_castOffPendingPage->GetChildCount(SYSTEM);
+
+    // The content not cast off into systems yet is estimated from the measures per system
+    if (m_castOffContentPage && (measureCount > 0)) {
+        int contentMeasureCount = m_castOffContentPage->GetDescendantCount(MEASURE);
+        if (m_castOffSystemsPage) contentMeasureCount += m_castOffSystemsPage->GetDescendantCount(MEASURE);
+        pendingSystemCount += (double)contentMeasureCount * systemCount / measureCount;
+    }
+
+    return castOffPageCount + std::max(1, (int)ceil(pendingSystemCount / systemsPerPage));
+}
+
+bool Doc::ScoreDefNeedsOptimization()
+{
+    for (Score *score : this->GetVisibleScores()) {
+        if (score->ScoreDefNeedsOptimization(m_options->m_condense.GetValue())) return true;
+    }
+    return false;
+}
+
 void Doc::UnCastOffDoc(bool resetCache)
 {
     if (!this->IsCastOff()) {
-        LogDebug("Document is not cast off");
+        VRV_LOG_DEBUG("Document is not cast off");
         return;
     }
 
     Pages *pages = this->GetPages();
     assert(pages);
 
+    // The pending page is part of the document and is un-cast off with the other pages, as is the content after it
+    if (m_castOffSystemsPage) {
+        pages->AddChild(m_castOffSystemsPage);
+        m_castOffSystemsPage = NULL;
+    }
+    if (m_castOffContentPage) {
+        pages->AddChild(m_castOffContentPage);
+        m_castOffContentPage = NULL;
+    }
+    this->ClearPendingCastOff();
+
     Page *unCastOffPage = new Page();
     UnCastOffFunctor unCastOff(unCastOffPage);
     unCastOff.SetResetCache(resetCache);
@@ -1091,7 +1696,7 @@ void Doc::UnCastOffDoc(bool resetCache)
 void Doc::CastOffEncodingDoc()
 {
     if (this->IsCastOff()) {
-        LogDebug("Document is already cast off");
+        VRV_LOG_DEBUG("Document is already cast off");
         return;
     }
 
@@ -1174,13 +1779,13 @@ void Doc::InitSelectionDoc(DocSelection &selection, bool resetCache)
     this->ScoreDefSetCurrentDoc(true);
 
     if (pages->GetChildCount() < 2) {
-        LogWarning("Selection could not be made");
+        VRV_LOG_WARNING("Selection could not be made");
         m_selectionStart = "";
         m_selectionEnd = "";
         return;
     }
     else if (pages->GetChildCount() == 2) {
-        LogWarning("Selection end '%s' could not be found", m_selectionEnd.c_str());
+        VRV_LOG_WARNING("Selection end '%s' could not be found", m_selectionEnd.c_str());
         // Add an empty page to make it work
         pages->AddChild(new Page());
     }
@@ -1203,6 +1808,198 @@ void Doc::ResetSelectionDoc(bool resetCache)
     this->UnCastOffDoc(resetCache);
 }
 
+Page *Doc::InitMeasureWindow(const std::string &startId, const std::string &endId)
+{
+    if (this->HasMeasureWindow()) this->ResetMeasureWindow();
+
+    if (!this->IsCastOff() || this->HasSelection() || this->IsTranscription() || this->IsFacs()) {
+        VRV_LOG_WARNING("A measure window can only be rendered for a cast off document without selection");
+        return NULL;
+    }
+
+    Measure *startMeasure = dynamic_cast<Measure *>(this->FindDescendantByID(startId));
+    Measure *endMeasure = dynamic_cast<Measure *>(this->FindDescendantByID(endId));
+    // The measures can be in a system or in an ending (or another system element) of a system
+    Object *startObject = (startMeasure) ? this->GetSystemChild(startMeasure) : NULL;
+    Object *endObject = (endMeasure) ? this->GetSystemChild(endMeasure) : NULL;
+    if (!startObject) {
+        VRV_LOG_WARNING("Measure window start '%s' could not be found", startId.c_str());
+        return NULL;
+    }
+    if (!endObject) {
+        VRV_LOG_WARNING("Measure window end '%s' could not be found", endId.c_str());
+        return NULL;
+    }
+
+    // Collect the system children from the start measure to the end measure
+    Pages *pages = this->GetPages();
+    assert(pages);
+    Page *startPage = vrv_cast<Page *>(startMeasure->GetFirstAncestor(PAGE));
+    assert(startPage);
+    std::vector<Page *> windowPages;
+    bool started = false;
+    bool ended = false;
+    for (int i = startPage->GetIdx(); (i < pages->GetChildCount()) && !ended; ++i) {
+        for (Object *child : pages->GetChild(i)->GetChildren()) {
+            if (!child->Is(SYSTEM)) continue;
+            for (int j = 0; j < child->GetChildCount(); ++j) {
+                Object *systemChild = child->GetChild(j);
+                if (systemChild == startObject) started = true;
+                if (!started) continue;
+                m_measureWindowOrigins.push_back({ child, j });
+                if (windowPages.empty() || (windowPages.back() != pages->GetChild(i))) {
+                    windowPages.push_back(vrv_cast<Page *>(pages->GetChild(i)));
+                }
+                if (systemChild == endObject) {
+                    ended = true;
+                    break;
+                }
+            }
+            if (ended) break;
+        }
+    }
+    if (!ended) {
+        VRV_LOG_WARNING("Measure window end '%s' is not after the start '%s'", endId.c_str(), startId.c_str());
+        m_measureWindowOrigins.clear();
+        return NULL;
+    }
+
+    // The window scoreDef is based on the drawing values at the beginning of the start measure
+    Score *windowScore = new Score();
+    windowScore->SetLabel("[windowScore]");
+    *windowScore->GetScoreDef() = *this->GetMeasureDrawingScoreDef(startMeasure);
+    windowScore->GetScoreDef()->ResetFromDrawingValues();
+
+    // Move the content to the window system - detaching in reverse order keeps the origin indexes valid
+    System *windowSystem = new System();
+    ArrayOfObjects windowObjects(m_measureWindowOrigins.size(), NULL);
+    for (int i = (int)m_measureWindowOrigins.size() - 1; i >= 0; --i) {
+        windowObjects.at(i) = m_measureWindowOrigins.at(i).first->DetachChild(m_measureWindowOrigins.at(i).second);
+    }
+    for (Object *object : windowObjects) {
+        windowSystem->AddChild(object);
+    }
+
+    m_measureWindowPage = new Page();
+    m_measureWindowPage->AddChild(windowScore);
+    m_measureWindowPage->AddChild(windowSystem);
+    pages->AddChild(m_measureWindowPage);
+
+    // Keep the drawing values of the content aside for restoring them in ResetMeasureWindow
+    m_measureWindowValues = new MeasureWindowValues();
+    m_measureWindowValues->m_pages = windowPages;
+    for (Object *object : windowSystem->FindAllDescendantsByType(LAYER)) {
+        Layer *layer = vrv_cast<Layer *>(object);
+        assert(layer);
+        m_measureWindowValues->m_layers.push_back({ layer, layer->DetachStaffDefObjects() });
+    }
+    for (Object *object : windowSystem->FindAllDescendantsByType(MEASURE)) {
+        Measure *measure = vrv_cast<Measure *>(object);
+        assert(measure);
+        m_measureWindowValues->m_measures.push_back({ measure, measure->DetachDrawingScoreDef(),
+            measure->GetDrawingLeftBarLine(), measure->GetDrawingRightBarLine() });
+    }
+    for (Object *object : windowSystem->FindAllDescendantsByType(STAFF)) {
+        Staff *staff = vrv_cast<Staff *>(object);
+        assert(staff);
+        m_measureWindowValues->m_staves.push_back({ staff, staff->m_drawingStaffDef, staff->m_drawingTuning });
+    }
+
+    // Set the drawing values for the window page only
+    ScoreDefUnsetCurrentFunctor scoreDefUnsetCurrent;
+    m_measureWindowPage->Process(scoreDefUnsetCurrent);
+    m_measureWindowPage->m_score = windowScore;
+    m_measureWindowPage->m_scoreEnd = windowScore;
+    ScoreDefSetCurrentFunctor scoreDefSetCurrent(this);
+    m_measureWindowPage->Process(scoreDefSetCurrent);
+    ScoreDefSetGrpSymFunctor scoreDefSetGrpSym;
+    m_measureWindowPage->Process(scoreDefSetGrpSym);
+
+    this->SetDrawingPage(m_measureWindowPage->GetIdx());
+    m_measureWindowPage->LayOut(true);
+
+    return m_measureWindowPage;
+}
+
+void Doc::ResetMeasureWindow()
+{
+    if (!this->HasMeasureWindow()) return;
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    // The floating positioners and the staff alignments of the window system are about to be deleted
+    ResetVerticalAlignmentFunctor resetVerticalAlignment;
+    m_measureWindowPage->Process(resetVerticalAlignment);
+
+    // Remove the drawing values of the window and restore the ones of the document
+    ScoreDefUnsetCurrentFunctor scoreDefUnsetCurrent;
+    m_measureWindowPage->Process(scoreDefUnsetCurrent);
+    assert(m_measureWindowValues);
+    for (auto &[layer, staffDefObjects] : m_measureWindowValues->m_layers) {
+        layer->AttachStaffDefObjects(staffDefObjects);
+    }
+    m_measureWindowValues->m_layers.clear();
+    for (auto &[measure, drawingScoreDef, left, right] : m_measureWindowValues->m_measures) {
+        measure->AttachDrawingScoreDef(drawingScoreDef);
+        measure->SetDrawingLeftBarLine(left);
+        measure->SetDrawingRightBarLine(right);
+    }
+    m_measureWindowValues->m_measures.clear();
+    for (auto &[staff, drawingStaffDef, drawingTuning] : m_measureWindowValues->m_staves) {
+        staff->m_drawingStaffDef = drawingStaffDef;
+        staff->m_drawingTuning = drawingTuning;
+    }
+
+    this->ResetDataPage();
+    pages->DetachChild(m_measureWindowPage->GetIdx());
+
+    System *windowSystem = vrv_cast<System *>(m_measureWindowPage->FindDescendantByType(SYSTEM, 1));
+    assert(windowSystem);
+    assert(windowSystem->GetChildCount() == (int)m_measureWindowOrigins.size());
+
+    // Move the content back in the original order
+    for (const auto &[parent, idx] : m_measureWindowOrigins) {
+        parent->InsertChild(windowSystem->DetachChild(0), idx);
+    }
+
+    delete m_measureWindowPage;
+    m_measureWindowPage = NULL;
+    m_measureWindowOrigins.clear();
+
+    // The layout of the content was replaced by the one of the window
+    for (Page *page : m_measureWindowValues->m_pages) {
+        page->ResetLayoutDone();
+    }
+    delete m_measureWindowValues;
+    m_measureWindowValues = NULL;
+}
+
+Object *Doc::GetSystemChild(Object *object)
+{
+    while (object->GetParent() && !object->GetParent()->Is(SYSTEM)) {
+        object = object->GetParent();
+    }
+    return (object->GetParent()) ? object : NULL;
+}
+
+ScoreDef *Doc::GetMeasureDrawingScoreDef(Measure *measure)
+{
+    System *system = vrv_cast<System *>(measure->GetFirstAncestor(SYSTEM));
+    assert(system);
+
+    // The previous measures can also be in endings
+    const ListOfObjects measures = system->FindAllDescendantsByType(MEASURE, false);
+    auto iter = std::find(measures.rbegin(), measures.rend(), measure);
+    assert(iter != measures.rend());
+    for (; iter != measures.rend(); ++iter) {
+        Measure *previous = vrv_cast<Measure *>(*iter);
+        if (previous->GetDrawingScoreDef()) return previous->GetDrawingScoreDef();
+    }
+    assert(system->GetDrawingScoreDef());
+    return system->GetDrawingScoreDef();
+}
+
 bool Doc::HasSelection() const
 {
     return (!m_selectionStart.empty() && !m_selectionEnd.empty());
@@ -1218,7 +2015,8 @@ void Doc::DeactiveateSelection()
     // We need to delete the selection scoreDef
     Score *selectionScore = vrv_cast<Score *>(selectionPage->FindDescendantByType(SCORE));
     assert(selectionScore);
-    if (selectionScore->GetLabel() != "[selectionScore]") LogError("Deleting wrong score element. Something is wrong");
+    if (selectionScore->GetLabel() != "[selectionScore]")
+        VRV_LOG_ERROR("Deleting wrong score element. Something is wrong");
     selectionPage->DeleteChild(selectionScore);
 
     pages->InsertChild(m_selectionPreceding, 0);
@@ -1336,19 +2134,19 @@ void Doc::ConvertMarkupDoc(bool permanent)
 {
     if (m_markup == MARKUP_DEFAULT) return;
 
-    LogInfo("Converting markup...");
+    VRV_LOG_INFO("Converting markup...");
 
     if (m_markup & MARKUP_GRACE_ATTRIBUTE) {
     }
 
     if (m_markup & MARKUP_ARTIC_MULTIVAL) {
-        LogInfo("Converting artic markup...");
+        VRV_LOG_INFO("Converting artic markup...");
         ConvertMarkupArticFunctor convertMarkupArtic;
         this->Process(convertMarkupArtic);
     }
 
     if ((m_markup & MARKUP_ANALYTICAL_FERMATA) || (m_markup & MARKUP_ANALYTICAL_TIE)) {
-        LogInfo("Converting analytical markup...");
+        VRV_LOG_INFO("Converting analytical markup...");
         /************ Prepare processing by staff/layer/verse ************/
 
         // We need to populate processing lists for processing the document by Layer (for matching @tie) and
@@ -1383,14 +2181,14 @@ void Doc::ConvertMarkupDoc(bool permanent)
                 // After having processed one layer, we check if we have open ties - if yes, we
                 // must reset them and they will be ignored.
                 for (Note *note : convertMarkupAnalytical.GetCurrentNotes()) {
-                    LogWarning("Unable to match @tie of note '%s', skipping it", note->GetID().c_str());
+                    VRV_LOG_WARNING("Unable to match @tie of note '%s', skipping it", note->GetID().c_str());
                 }
             }
         }
     }
 
     if (m_markup & MARKUP_SCOREDEF_DEFINITIONS) {
-        LogInfo("Converting scoreDef markup...");
+        VRV_LOG_INFO("Converting scoreDef markup...");
         ConvertMarkupScoreDefFunctor convertMarkupScoreDef(this);
         this->Process(convertMarkupScoreDef);
     }
@@ -1399,7 +2197,9 @@ void Doc::ConvertMarkupDoc(bool permanent)
 void Doc::SyncFromFacsimileDoc()
 {
     PrepareFacsimileFunctor prepareFacsimile(this->GetFacsimile());
+    this->GetFacsimile()->IndexDescendants();
     this->Process(prepareFacsimile);
+    this->GetFacsimile()->ClearIndex();
 
     SyncFromFacsimileFunctor syncFromFacsimileFunctor(this);
     this->Process(syncFromFacsimileFunctor);
@@ -1434,7 +2234,7 @@ void Doc::TransposeDoc()
     if (m_options->m_transpose.IsSet()) {
         // Transpose the entire document
         if (m_options->m_transposeMdiv.IsSet()) {
-            LogWarning("\"%s\" is ignored when \"%s\" is set as well. Please use only one of the two options.",
+            VRV_LOG_WARNING("\"%s\" is ignored when \"%s\" is set as well. Please use only one of the two options.",
                 m_options->m_transposeMdiv.GetKey().c_str(), m_options->m_transpose.GetKey().c_str());
         }
         TransposeFunctor transpose(this, &transposer);
@@ -1470,7 +2270,7 @@ void Doc::ExpandExpansions()
 
     Expansion *start = dynamic_cast<Expansion *>(this->FindDescendantByID(expansionId));
     if (start == NULL) {
-        LogWarning("Expansion ID '%s' not found. Nothing expanded.", expansionId.c_str());
+        VRV_LOG_WARNING("Expansion ID '%s' not found. Nothing expanded.", expansionId.c_str());
         return;
     }
 
@@ -1853,23 +2653,50 @@ double Doc::GetCueScaling() const
 
 FontInfo *Doc::GetDrawingSmuflFont(int staffSize, bool graceSize)
 {
-    m_drawingSmuflFont.SetFaceName(this->GetResources().GetCurrentFont().c_str());
+    FontInfo &font
+        = (s_threadDrawingFonts.m_doc == this) ? s_threadDrawingFonts.m_drawingSmuflFont : m_drawingSmuflFont;
+    font.SetFaceName(this->GetResources().GetCurrentFont().c_str());
     int value = m_drawingSmuflFontSize * staffSize / 100;
     if (graceSize) value = value * m_options->m_graceFactor.GetValue();
-    m_drawingSmuflFont.SetPointSize(value);
-    return &m_drawingSmuflFont;
+    font.SetPointSize(value);
+    return &font;
 }
 
 FontInfo *Doc::GetDrawingLyricFont(int staffSize)
 {
-    m_drawingLyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
-    return &m_drawingLyricFont;
+    FontInfo &font
+        = (s_threadDrawingFonts.m_doc == this) ? s_threadDrawingFonts.m_drawingLyricFont : m_drawingLyricFont;
+    font.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
+    return &font;
+}
+
+FontInfo Doc::CalcDrawingLyricFont(int staffSize) const
+{
+    FontInfo lyricFont = m_drawingLyricFont;
+    lyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
+    return lyricFont;
 }
 
 FontInfo *Doc::GetFingeringFont(int staffSize)
 {
-    m_fingeringFont.SetPointSize(m_fingeringFontSize * staffSize / 100);
-    return &m_fingeringFont;
+    FontInfo &font = (s_threadDrawingFonts.m_doc == this) ? s_threadDrawingFonts.m_fingeringFont : m_fingeringFont;
+    font.SetPointSize(m_fingeringFontSize * staffSize / 100);
+    return &font;
+}
+
+void Doc::SetThreadDrawingFonts() const
+{
+    s_threadDrawingFonts.m_drawingSmuflFont = m_drawingSmuflFont;
+    s_threadDrawingFonts.m_drawingLyricFont = m_drawingLyricFont;
+    s_threadDrawingFonts.m_fingeringFont = m_fingeringFont;
+    s_threadDrawingFonts.m_doc = this;
+    m_resources.SetThreadCurrentFonts();
+}
+
+void Doc::ResetThreadDrawingFonts() const
+{
+    s_threadDrawingFonts.m_doc = NULL;
+    m_resources.ResetThreadCurrentFonts();
 }
 
 double Doc::GetMusicToLyricFontSizeRatio() const
@@ -48,13 +48,13 @@ bool DocSelection::Parse(const std::string &selection)
     if (selection.empty()) return true;
 
     if (!json.parse(selection)) {
-        LogWarning("Cannot parse JSON std::string. No selection set.");
+        VRV_LOG_WARNING("Cannot parse JSON std::string. No selection set.");
         return false;
     }
     // No start and no end - we reset the selection
     else if (!json.has<jsonxx::String>("start") && !json.has<jsonxx::String>("end")
         && !json.has<jsonxx::String>("measureRange")) {
-        LogWarning("Cannot extract a selection.");
+        VRV_LOG_WARNING("Cannot extract a selection.");
         return false;
     }
     else {
@@ -92,7 +92,7 @@ bool DocSelection::Parse(const std::string &selection)
             // Check values
             if (m_selectionRangeStart == VRV_UNSET || m_selectionRangeEnd == VRV_UNSET
                 || (m_selectionRangeEnd != -1 && m_selectionRangeStart > m_selectionRangeEnd)) {
-                LogWarning("Selection 'measureRange' could not be parsed. No selection set.");
+                VRV_LOG_WARNING("Selection 'measureRange' could not be parsed. No selection set.");
                 m_selectionRangeStart = VRV_UNSET;
                 m_selectionRangeEnd = VRV_UNSET;
                 return false;
@@ -100,7 +100,7 @@ bool DocSelection::Parse(const std::string &selection)
         }
         else {
             if (!json.has<jsonxx::String>("start") || !json.has<jsonxx::String>("end")) {
-                LogWarning("Selection requires 'start' and 'end'. No selection set.");
+                VRV_LOG_WARNING("Selection requires 'start' and 'end'. No selection set.");
                 return false;
             }
             m_selectionStart = json.get<jsonxx::String>("start");
@@ -126,7 +126,7 @@ void DocSelection::Set(Doc *doc)
         ListOfObjects measures = doc->FindAllDescendantsByType(MEASURE, false);
 
         if (measures.empty()) {
-            LogWarning("No measure found for selection '%s'.", m_measureRange.c_str());
+            VRV_LOG_WARNING("No measure found for selection '%s'.", m_measureRange.c_str());
             return;
         }
 
@@ -139,7 +139,7 @@ void DocSelection::Set(Doc *doc)
             selectionStartId = (*it)->GetID();
         }
         else {
-            LogWarning("Measure range start for selection '%s' could not be found.", m_measureRange.c_str());
+            VRV_LOG_WARNING("Measure range start for selection '%s' could not be found.", m_measureRange.c_str());
             return;
         }
 
@@ -152,7 +152,7 @@ void DocSelection::Set(Doc *doc)
             selectionEndId = (*it)->GetID();
         }
         else {
-            LogWarning("Measure range end for selection '%s' could not be found.", m_measureRange.c_str());
+            VRV_LOG_WARNING("Measure range end for selection '%s' could not be found.", m_measureRange.c_str());
             return;
         }
         doc->m_selectionStart = selectionStartId;
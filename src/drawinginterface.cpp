@@ -44,13 +44,17 @@ DrawingListInterface::~DrawingListInterface() {}
 void DrawingListInterface::Reset()
 {
     m_drawingList.clear();
+    m_drawingListByClassId.clear();
 }
 
 void DrawingListInterface::AddToDrawingList(Object *object)
 {
-    if (std::find(m_drawingList.begin(), m_drawingList.end(), object) == m_drawingList.end()) {
+    // Looking in the bucket is enough for checking if the object is already in the list
+    ArrayOfObjects &bucket = m_drawingListByClassId[object->GetClassId()];
+    if (std::find(bucket.begin(), bucket.end(), object) == bucket.end()) {
         // someName not in name, add it
         m_drawingList.push_back(object);
+        bucket.push_back(object);
     }
 
     /*
@@ -65,9 +69,18 @@ ArrayOfObjects *DrawingListInterface::GetDrawingList()
     return &m_drawingList;
 }
 
+const ArrayOfObjects &DrawingListInterface::GetDrawingListByClassId(ClassId classId) const
+{
+    static const ArrayOfObjects emptyList;
+
+    auto it = m_drawingListByClassId.find(classId);
+    return (it != m_drawingListByClassId.end()) ? it->second : emptyList;
+}
+
 void DrawingListInterface::ResetDrawingList()
 {
     m_drawingList.clear();
+    m_drawingListByClassId.clear();
 }
 
 //----------------------------------------------------------------------------
@@ -235,7 +248,7 @@ void BeamDrawingInterface::InitCoords(const ListOfObjects &childList, Staff *sta
         }
         current = dynamic_cast<LayerElement *>(*iter);
         if (current == NULL) {
-            LogDebug("Error accessing element in Beam list");
+            VRV_LOG_DEBUG("Error accessing element in Beam list");
             return;
         }
 
@@ -243,7 +256,7 @@ void BeamDrawingInterface::InitCoords(const ListOfObjects &childList, Staff *sta
 
     // elementCount must be greater than 0 here
     if (elementCount == 0) {
-        LogDebug("Beam with no notes of duration > 8 detected. Exiting DrawBeam.");
+        VRV_LOG_DEBUG("Beam with no notes of duration > 8 detected. Exiting DrawBeam.");
         return;
     }
 }
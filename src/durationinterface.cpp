@@ -96,7 +96,7 @@ double DurationInterface::GetInterfaceAlignmentMensuralDuration(int num, int num
     if (noteDur == DUR_NONE) noteDur = DUR_4;
 
     if (!currentMensur) {
-        LogWarning("No current mensur for calculating duration");
+        VRV_LOG_WARNING("No current mensur for calculating duration");
         return DUR_MENSURAL_REF;
     }
 
@@ -227,7 +227,7 @@ bool DurationInterface::IsMensuralDur() const
 bool DurationInterface::HasIdenticalDurationInterface(const DurationInterface *otherDurationInterface) const
 {
     // This should never happen because it is fully implemented
-    LogError("DurationInterface::HasIdenticalDurationInterface missing");
+    VRV_LOG_ERROR("DurationInterface::HasIdenticalDurationInterface missing");
     assert(false);
     return false;
     /*
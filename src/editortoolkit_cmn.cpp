@@ -48,12 +48,12 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
 
     // Read JSON actions
     if (!json.parse(json_editorAction)) {
-        LogError("Cannot parse JSON std::string.");
+        VRV_LOG_ERROR("Cannot parse JSON std::string.");
         return false;
     }
 
     if (!json.has<jsonxx::String>("action")) {
-        LogWarning("Incorrectly formatted JSON action.");
+        VRV_LOG_WARNING("Incorrectly formatted JSON action.");
     }
 
     std::string action = json.get<jsonxx::String>("action");
@@ -70,12 +70,12 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
     }
 
     if (!json.has<jsonxx::Object>("param") && !json.has<jsonxx::Array>("param")) {
-        LogWarning("Incorrectly formatted JSON param.");
+        VRV_LOG_WARNING("Incorrectly formatted JSON param.");
     }
 
     if (action == "chain") {
         if (!json.has<jsonxx::Array>("param")) {
-            LogError("Incorrectly formatted JSON action");
+            VRV_LOG_ERROR("Incorrectly formatted JSON action");
             return false;
         }
         return this->Chain(json.get<jsonxx::Array>("param"));
@@ -85,7 +85,7 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
         if (this->ParseDeleteAction(json.get<jsonxx::Object>("param"), elementId)) {
             return this->Delete(elementId);
         }
-        LogWarning("Could not parse the delete action");
+        VRV_LOG_WARNING("Could not parse the delete action");
     }
     else if (action == "drag") {
         std::string elementId;
@@ -93,7 +93,7 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
         if (this->ParseDragAction(json.get<jsonxx::Object>("param"), elementId, x, y)) {
             return this->Drag(elementId, x, y);
         }
-        LogWarning("Could not parse the drag action");
+        VRV_LOG_WARNING("Could not parse the drag action");
     }
     else if (action == "keyDown") {
         std::string elementId;
@@ -102,7 +102,7 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
         if (this->ParseKeyDownAction(json.get<jsonxx::Object>("param"), elementId, key, shiftKey, ctrlKey)) {
             return this->KeyDown(elementId, key, shiftKey, ctrlKey);
         }
-        LogWarning("Could not parse the keyDown action");
+        VRV_LOG_WARNING("Could not parse the keyDown action");
     }
     else if (action == "insert") {
         std::string elementType, startid, endid;
@@ -114,17 +114,17 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
                 return this->Insert(elementType, startid, endid);
             }
         }
-        LogWarning("Could not parse the insert action");
+        VRV_LOG_WARNING("Could not parse the insert action");
     }
     else if (action == "set") {
         std::string elementId, attribute, value;
         if (this->ParseSetAction(json.get<jsonxx::Object>("param"), elementId, attribute, value)) {
             return this->Set(elementId, attribute, value);
         }
-        LogWarning("Could not parse the set action");
+        VRV_LOG_WARNING("Could not parse the set action");
     }
     else {
-        LogWarning("Unknown action type '%s'.", action.c_str());
+        VRV_LOG_WARNING("Unknown action type '%s'.", action.c_str());
     }
     return false;
 }
@@ -267,16 +267,16 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     Object *end = m_doc->GetDrawingPage()->FindDescendantByID(endid);
     // Check if both start and end elements exist
     if (!start || !end) {
-        LogInfo("Elements start and end ids '%s' and '%s' could not be found", startid.c_str(), endid.c_str());
+        VRV_LOG_INFO("Elements start and end ids '%s' and '%s' could not be found", startid.c_str(), endid.c_str());
         return false;
     }
     // Check if it is a LayerElement
     if (!dynamic_cast<LayerElement *>(start)) {
-        LogInfo("Element '%s' is not supported as start element", start->GetClassName().c_str());
+        VRV_LOG_INFO("Element '%s' is not supported as start element", start->GetClassName().c_str());
         return false;
     }
     if (!dynamic_cast<LayerElement *>(end)) {
-        LogInfo("Element '%s' is not supported as end element", start->GetClassName().c_str());
+        VRV_LOG_INFO("Element '%s' is not supported as end element", start->GetClassName().c_str());
         return false;
     }
 
@@ -294,7 +294,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
         element = new Hairpin();
     }
     else {
-        LogInfo("Inserting control event '%s' is not supported", elementType.c_str());
+        VRV_LOG_INFO("Inserting control event '%s' is not supported", elementType.c_str());
         return false;
     }
 
@@ -318,7 +318,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     Object *start = m_doc->GetDrawingPage()->FindDescendantByID(startid);
     // Check if both start and end elements exist
     if (!start) {
-        LogInfo("Element start id '%s' could not be found", startid.c_str());
+        VRV_LOG_INFO("Element start id '%s' could not be found", startid.c_str());
         return false;
     }
     if (elementType == "note") {
@@ -326,7 +326,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     }
     // Check if it is a LayerElement
     if (!dynamic_cast<LayerElement *>(start)) {
-        LogInfo("Element '%s' is not supported as start element", start->GetClassName().c_str());
+        VRV_LOG_INFO("Element '%s' is not supported as start element", start->GetClassName().c_str());
         return false;
     }
 
@@ -341,7 +341,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
         element = new Dynam();
     }
     else {
-        LogInfo("Inserting control event '%s' is not supported", elementType.c_str());
+        VRV_LOG_INFO("Inserting control event '%s' is not supported", elementType.c_str());
         return false;
     }
 
@@ -425,7 +425,7 @@ bool EditorToolkitCMN::InsertNote(Object *object)
     assert(object);
 
     if (!object->Is({ CHORD, NOTE, REST })) {
-        LogInfo("Inserting a note is possible only in a chord, note or rest");
+        VRV_LOG_INFO("Inserting a note is possible only in a chord, note or rest");
         return false;
     }
 
@@ -450,7 +450,7 @@ bool EditorToolkitCMN::InsertNote(Object *object)
         }
 
         if (currentNote->HasEditorialContent()) {
-            LogInfo("Inserting a note where a note has editorial content is not "
+            VRV_LOG_INFO("Inserting a note where a note has editorial content is not "
                     "possible");
             return false;
         }
@@ -459,7 +459,7 @@ bool EditorToolkitCMN::InsertNote(Object *object)
         ClassIdsComparison lyricsComparison({ VERSE, SYL });
         currentNote->FindAllDescendantsByComparison(&lyric, &lyricsComparison);
         if (!lyric.empty()) {
-            LogInfo("Inserting a note where a note has lyric content is not possible");
+            VRV_LOG_INFO("Inserting a note where a note has lyric content is not possible");
             return false;
         }
         Chord *chord = new Chord();
@@ -513,7 +513,7 @@ bool EditorToolkitCMN::DeleteNote(Note *note)
     Beam *beam = note->GetAncestorBeam();
     if (chord) {
         if (chord->HasEditorialContent()) {
-            LogInfo("Deleting a note in a chord that has editorial content is not "
+            VRV_LOG_INFO("Deleting a note in a chord that has editorial content is not "
                     "possible");
             return false;
         }
@@ -55,7 +55,7 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
 
     // Read JSON actions
     if (!json.parse(json_editorAction)) {
-        LogError("Cannot parse JSON std::string.");
+        VRV_LOG_ERROR("Cannot parse JSON std::string.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Cannot parse JSON from std::string " + json_editorAction);
         return false;
@@ -63,7 +63,7 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
 
     if (!json.has<jsonxx::String>("action")
         || (!json.has<jsonxx::Object>("param") && !json.has<jsonxx::Array>("param"))) {
-        LogWarning("Incorrectly formatted JSON action");
+        VRV_LOG_WARNING("Incorrectly formatted JSON action");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "JSON action misformatted.");
         return false;
@@ -72,7 +72,7 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
     std::string action = json.get<jsonxx::String>("action");
 
     if (action != "chain" && json.has<jsonxx::Array>("param")) {
-        LogWarning("Only 'chain' uses 'param' as an array.");
+        VRV_LOG_WARNING("Only 'chain' uses 'param' as an array.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "'param' can only be an array for a chain action.");
         return false;
@@ -84,7 +84,7 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
         if (this->ParseDragAction(json.get<jsonxx::Object>("param"), &elementId, &x, &y)) {
             return this->Drag(elementId, x, y);
         }
-        LogWarning("Could not parse the drag action");
+        VRV_LOG_WARNING("Could not parse the drag action");
     }
     else if (action == "insert") {
         std::string elementType, startId, endId, staffId;
@@ -94,63 +94,63 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
                 json.get<jsonxx::Object>("param"), &elementType, &staffId, &ulx, &uly, &lrx, &lry, &attributes)) {
             return this->Insert(elementType, staffId, ulx, uly, lrx, lry, attributes);
         }
-        LogWarning("Could not parse the insert action");
+        VRV_LOG_WARNING("Could not parse the insert action");
     }
     else if (action == "insertToSyllable") {
         std::string elementId;
         if (this->ParseInsertToSyllableAction(json.get<jsonxx::Object>("param"), &elementId)) {
             return this->InsertToSyllable(elementId);
         }
-        LogWarning("Could not parse the insert action");
+        VRV_LOG_WARNING("Could not parse the insert action");
     }
     else if (action == "moveOutsideSyllable") {
         std::string elementId;
         if (this->ParseMoveOutsideSyllableAction(json.get<jsonxx::Object>("param"), &elementId)) {
             return this->MoveOutsideSyllable(elementId);
         }
-        LogWarning("Could not parse the insert action");
+        VRV_LOG_WARNING("Could not parse the insert action");
     }
     else if (action == "displaceClefOctave") {
         std::string elementId, direction;
         if (this->ParseDisplaceClefAction(json.get<jsonxx::Object>("param"), &elementId, &direction)) {
             return this->DisplaceClefOctave(elementId, direction);
         }
-        LogWarning("Could not parse the displace clef octave action");
+        VRV_LOG_WARNING("Could not parse the displace clef octave action");
     }
     else if (action == "set") {
         std::string elementId, attrType, attrValue;
         if (this->ParseSetAction(json.get<jsonxx::Object>("param"), &elementId, &attrType, &attrValue)) {
             return this->Set(elementId, attrType, attrValue);
         }
-        LogWarning("Could not parse the set action");
+        VRV_LOG_WARNING("Could not parse the set action");
     }
     else if (action == "setText") {
         std::string elementId, text;
         if (this->ParseSetTextAction(json.get<jsonxx::Object>("param"), &elementId, &text)) {
             return this->SetText(elementId, text);
         }
-        LogWarning("Could not parse the set text action");
+        VRV_LOG_WARNING("Could not parse the set text action");
     }
     else if (action == "setClef") {
         std::string elementId, shape;
         if (this->ParseSetClefAction(json.get<jsonxx::Object>("param"), &elementId, &shape)) {
             return this->SetClef(elementId, shape);
         }
-        LogWarning("Could not parse the set clef action");
+        VRV_LOG_WARNING("Could not parse the set clef action");
     }
     else if (action == "setLiquescent") {
         std::string elementId, curve;
         if (this->ParseSetLiquescentAction(json.get<jsonxx::Object>("param"), &elementId, &curve)) {
             return this->SetLiquescent(elementId, curve);
         }
-        LogWarning("Could not parse the set liquescent action");
+        VRV_LOG_WARNING("Could not parse the set liquescent action");
     }
     else if (action == "remove") {
         std::string elementId;
         if (this->ParseRemoveAction(json.get<jsonxx::Object>("param"), &elementId)) {
             return this->Remove(elementId);
         }
-        LogWarning("Could not parse the remove action");
+        VRV_LOG_WARNING("Could not parse the remove action");
     }
     else if (action == "resize") {
         std::string elementId;
@@ -158,7 +158,7 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
         if (this->ParseResizeAction(json.get<jsonxx::Object>("param"), &elementId, &ulx, &uly, &lrx, &lry)) {
             return this->Resize(elementId, ulx, uly, lrx, lry);
         }
-        LogWarning("Could not parse the resize action");
+        VRV_LOG_WARNING("Could not parse the resize action");
     }
     else if (action == "resizeRotate") {
         std::string elementId;
@@ -171,7 +171,7 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
     }
     else if (action == "chain") {
         if (!json.has<jsonxx::Array>("param")) {
-            LogError("Incorrectly formatted JSON action");
+            VRV_LOG_ERROR("Incorrectly formatted JSON action");
             return false;
         }
         return this->Chain(json.get<jsonxx::Array>("param"));
@@ -202,14 +202,14 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
         if (this->ParseMatchHeightAction(json.get<jsonxx::Object>("param"), &elementId)) {
             return this->MatchHeight(elementId);
         }
-        LogWarning("Could not parse the insert action");
+        VRV_LOG_WARNING("Could not parse the insert action");
     }
     else if (action == "merge") {
         std::vector<std::string> elementIds;
         if (this->ParseMergeAction(json.get<jsonxx::Object>("param"), &elementIds)) {
             return this->Merge(elementIds);
         }
-        LogWarning("Could not parse merge action");
+        VRV_LOG_WARNING("Could not parse merge action");
     }
     else if (action == "split") {
         std::string elementId;
@@ -217,7 +217,7 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
         if (this->ParseSplitAction(json.get<jsonxx::Object>("param"), &elementId, &x)) {
             return this->Split(elementId, x);
         }
-        LogWarning("Could not parse split action");
+        VRV_LOG_WARNING("Could not parse split action");
     }
     else if (action == "changeGroup") {
         std::string elementId;
@@ -225,7 +225,7 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
         if (this->ParseChangeGroupAction(json.get<jsonxx::Object>("param"), &elementId, &contour)) {
             return this->ChangeGroup(elementId, contour);
         }
-        LogWarning("Could not parse change group action");
+        VRV_LOG_WARNING("Could not parse change group action");
     }
     else if (action == "toggleLigature") {
         std::vector<std::string> elementIds;
@@ -233,24 +233,24 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
         if (this->ParseToggleLigatureAction(json.get<jsonxx::Object>("param"), &elementIds)) {
             return this->ToggleLigature(elementIds);
         }
-        LogWarning("Could not parse toggle ligature action");
+        VRV_LOG_WARNING("Could not parse toggle ligature action");
     }
     else if (action == "changeStaff") {
         std::string elementId;
         if (this->ParseChangeStaffAction(json.get<jsonxx::Object>("param"), &elementId)) {
             return this->ChangeStaff(elementId);
         }
-        LogWarning("Could not parse change staff action");
+        VRV_LOG_WARNING("Could not parse change staff action");
     }
     else if (action == "changeStaffTo") {
         std::string elementId, staffId;
         if (this->ParseChangeStaffToAction(json.get<jsonxx::Object>("param"), &elementId, &staffId)) {
             return this->ChangeStaffTo(elementId, staffId);
         }
-        LogWarning("Could not parse change staff action");
+        VRV_LOG_WARNING("Could not parse change staff action");
     }
     else {
-        LogWarning("Unknown action type '%s'.", action.c_str());
+        VRV_LOG_WARNING("Unknown action type '%s'.", action.c_str());
     }
     m_editInfo.import("status", "FAILURE");
     m_editInfo.import("message", "Action " + action + " could not be parsed or is unknown.");
@@ -264,7 +264,7 @@ bool EditorToolkitNeume::Chain(jsonxx::Array actions)
     jsonxx::Object results;
     for (int i = 0; i < (int)actions.size(); i++) {
         if (!actions.has<jsonxx::Object>(0)) {
-            LogError("Action %d was not an object", i);
+            VRV_LOG_ERROR("Action %d was not an object", i);
             m_editInfo.reset();
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Action " + std::to_string(i) + " was not an object.");
@@ -493,7 +493,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
 {
     std::string status = "OK", message = "";
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get drawing page.");
+        VRV_LOG_ERROR("Could not get drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get drawing page.");
         return false;
@@ -507,7 +507,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
         element = m_doc->FindDescendantByID(elementId);
     }
     if (!element) {
-        LogWarning("element is null");
+        VRV_LOG_WARNING("element is null");
         status = "WARNING";
         message += "Element is null. ";
     }
@@ -525,7 +525,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
     else if (element->HasInterface(INTERFACE_PITCH) || element->Is(NEUME) || element->Is(SYLLABLE)) {
         Layer *layer = dynamic_cast<Layer *>(element->GetFirstAncestor(LAYER));
         if (!layer) {
-            LogError("Element does not have Layer parent. This should not happen.");
+            VRV_LOG_ERROR("Element does not have Layer parent. This should not happen.");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Element does not have Layer parent.");
             return false;
@@ -605,7 +605,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
     else if (element->Is(CLEF)) {
         Clef *clef = dynamic_cast<Clef *>(element);
         if (!clef->HasFacs()) {
-            LogError("Clef dragging is only supported for clefs with facsimiles!");
+            VRV_LOG_ERROR("Clef dragging is only supported for clefs with facsimiles!");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Clef dragging is only supported for clefs with facsimiles.");
             return false;
@@ -657,7 +657,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
     else if (element->Is(STAFF)) {
         Staff *staff = vrv_cast<Staff *>(element);
         if (!staff->HasFacs()) {
-            LogError("Staff dragging is only supported for staves with facsimiles!");
+            VRV_LOG_ERROR("Staff dragging is only supported for staves with facsimiles!");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Staff dragging is only supported for staves with facsimiles.");
             return false;
@@ -688,7 +688,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
     else if (element->Is(SYL)) {
         Syl *syl = dynamic_cast<Syl *>(element);
         if (!syl->HasFacs()) {
-            LogError("Syl (boundingbox) dragging is only supported for syls with facsimiles!");
+            VRV_LOG_ERROR("Syl (boundingbox) dragging is only supported for syls with facsimiles!");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Syl dragging is only supported for syls with facsimiles.");
             return false;
@@ -702,7 +702,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
     else if (element->Is(ACCID)) {
         Accid *accid = dynamic_cast<Accid *>(element);
         if (!accid->HasFacs()) {
-            LogError("Accid dragging is only supported for accid with facsimiles!");
+            VRV_LOG_ERROR("Accid dragging is only supported for accid with facsimiles!");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Accid dragging is only supported for accid with facsimiles.");
             return false;
@@ -718,7 +718,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
     else if (element->Is(DIVLINE)) {
         DivLine *divLine = dynamic_cast<DivLine *>(element);
         if (!divLine->HasFacs()) {
-            LogError("DivLine dragging is only supported for divLine with facsimiles!");
+            VRV_LOG_ERROR("DivLine dragging is only supported for divLine with facsimiles!");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "DivLine dragging is only supported for divLine with facsimiles.");
             return false;
@@ -733,7 +733,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
         ChangeStaff(elementId);
     }
     else {
-        LogWarning("Unsupported element for dragging.");
+        VRV_LOG_WARNING("Unsupported element for dragging.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Unsupported element for dragging.");
         return false;
@@ -751,13 +751,13 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
     std::vector<std::pair<std::string, std::string>> attributes)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get drawing page");
+        VRV_LOG_ERROR("Could not get drawing page");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get drawing page.");
         return false;
     }
     if (!m_doc->HasFacsimile()) {
-        LogError("Drawing page without facsimile");
+        VRV_LOG_ERROR("Drawing page without facsimile");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Drawing page without facsimile is unsupported.");
         return false;
@@ -770,15 +770,14 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
     // Find closest valid staff
     if (staffId == "auto") {
         ListOfObjects staves = m_doc->FindAllDescendantsByType(STAFF, false);
-        std::vector<Object *> stavesVector(staves.begin(), staves.end());
 
         ClosestBB comp;
         comp.x = ulx;
         comp.y = uly;
 
         if (staves.size() > 0) {
-            std::sort(stavesVector.begin(), stavesVector.end(), comp);
-            staff = dynamic_cast<Staff *>(stavesVector.at(0));
+            // Only the closest one is needed, no need to sort them all
+            staff = dynamic_cast<Staff *>(*std::min_element(staves.begin(), staves.end(), comp));
         }
         else {
             staff = NULL;
@@ -846,7 +845,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
     }
 
     if (staff == NULL) {
-        LogError("A staff must exist in the page to add a non-staff element.");
+        VRV_LOG_ERROR("A staff must exist in the page to add a non-staff element.");
         delete zone;
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "A staff must exist in the page to add a non-staff element.");
@@ -923,7 +922,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
             delete syllable;
             delete neume;
             delete nc;
-            LogError("Failed to set pitch.");
+            VRV_LOG_ERROR("Failed to set pitch.");
 
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Failed to set pitch.");
@@ -985,7 +984,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
                     newUly = uly;
                 }
                 else {
-                    LogError("Unsupported character in contour.");
+                    VRV_LOG_ERROR("Unsupported character in contour.");
                     delete newNc;
                     delete newZone;
                     m_editInfo.import("status", "FAILURE");
@@ -1047,7 +1046,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
             }
         }
         if (clefShape == CLEFSHAPE_NONE) {
-            LogError("A clef shape must be specified.");
+            VRV_LOG_ERROR("A clef shape must be specified.");
             delete clef;
 
             m_editInfo.import("status", "FAILURE");
@@ -1121,7 +1120,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
         zone->SetLry(uly + noteHeight);
         layer->ReorderByXPos();
         if (!AdjustPitchFromPosition(custos)) {
-            LogError("Failed to set pitch.");
+            VRV_LOG_ERROR("Failed to set pitch.");
 
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Failed to set pitch.");
@@ -1145,7 +1144,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
             }
         }
         if (accidTypeW == ACCIDENTAL_WRITTEN_NONE) {
-            LogError("A accid type must be specified.");
+            VRV_LOG_ERROR("A accid type must be specified.");
             delete accid;
             delete zone;
 
@@ -1211,7 +1210,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
             }
         }
         if (divLineTypeW == divLineLog_FORM_NONE) {
-            LogError("A divLine type must be specified.");
+            VRV_LOG_ERROR("A divLine type must be specified.");
             delete divLine;
             delete zone;
 
@@ -1246,7 +1245,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
     }
     else {
         delete zone;
-        LogError("Unsupported type '%s' for insertion", elementType.c_str());
+        VRV_LOG_ERROR("Unsupported type '%s' for insertion", elementType.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Unsupported type '" + elementType + "' for insertion.");
         return false;
@@ -1265,13 +1264,13 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
 bool EditorToolkitNeume::InsertToSyllable(std::string elementId)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get drawing page");
+        VRV_LOG_ERROR("Could not get drawing page");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get drawing page.");
         return false;
     }
     if (!m_doc->HasFacsimile()) {
-        LogError("Drawing page without facsimile");
+        VRV_LOG_ERROR("Drawing page without facsimile");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Drawing page without facsimile is unsupported.");
         return false;
@@ -1283,13 +1282,13 @@ bool EditorToolkitNeume::InsertToSyllable(std::string elementId)
     assert(parent);
 
     if (element == NULL) {
-        LogError("No element exists with ID '%s'.", elementId.c_str());
+        VRV_LOG_ERROR("No element exists with ID '%s'.", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "No element exists with ID" + elementId + ".");
         return false;
     }
     if (!(element->Is(DIVLINE) || element->Is(ACCID) || element->Is(CLEF))) {
-        LogError("Element is of type %s, but only Divlines and Accids can be inserted into syllables.",
+        VRV_LOG_ERROR("Element is of type %s, but only Divlines and Accids can be inserted into syllables.",
             element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message",
@@ -1298,7 +1297,7 @@ bool EditorToolkitNeume::InsertToSyllable(std::string elementId)
         return false;
     }
     if (!parent->Is(LAYER)) {
-        LogError("The selected %s is not a child of layer.", element->GetClassName().c_str());
+        VRV_LOG_ERROR("The selected %s is not a child of layer.", element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "The selected " + element->GetClassName() + "is not a child of layer.");
         return false;
@@ -1312,7 +1311,7 @@ bool EditorToolkitNeume::InsertToSyllable(std::string elementId)
         uly = element->GetFacsimileInterface()->GetZone()->GetUly();
     }
     else {
-        LogError("Selected '%s' without facsimile", element->GetClassName().c_str());
+        VRV_LOG_ERROR("Selected '%s' without facsimile", element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Selected '" + element->GetClassName() + "' without facsimile is unsupported.");
         return false;
@@ -1327,20 +1326,18 @@ bool EditorToolkitNeume::InsertToSyllable(std::string elementId)
     staff->FindAllDescendantsByComparison(&neumes, &ac);
 
     if (neumes.empty()) {
-        LogError("A syllable must exist in the staff to insert a '%s' into.", element->GetClassName().c_str());
+        VRV_LOG_ERROR("A syllable must exist in the staff to insert a '%s' into.", element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import(
             "message", "A syllable must exist in the staff to insert a '" + element->GetClassName() + "' into.");
         return false;
     }
 
-    std::vector<Object *> neumesVector(neumes.begin(), neumes.end());
     ClosestNeume compN;
     compN.x = ulx;
     compN.y = uly;
-    std::sort(neumesVector.begin(), neumesVector.end(), compN);
 
-    Object *neume = neumesVector.at(0);
+    Object *neume = *std::min_element(neumes.begin(), neumes.end(), compN);
     assert(neume);
     // get nearest syllable using nearest neume
     Object *syllable = neume->GetParent();
@@ -1415,13 +1412,13 @@ bool EditorToolkitNeume::InsertToSyllable(std::string elementId)
 bool EditorToolkitNeume::MoveOutsideSyllable(std::string elementId)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get drawing page");
+        VRV_LOG_ERROR("Could not get drawing page");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get drawing page.");
         return false;
     }
     if (!m_doc->HasFacsimile()) {
-        LogError("Drawing page without facsimile");
+        VRV_LOG_ERROR("Drawing page without facsimile");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Drawing page without facsimile is unsupported.");
         return false;
@@ -1433,13 +1430,13 @@ bool EditorToolkitNeume::MoveOutsideSyllable(std::string elementId)
     assert(parent);
 
     if (element == NULL) {
-        LogError("No element exists with ID '%s'.", elementId.c_str());
+        VRV_LOG_ERROR("No element exists with ID '%s'.", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "No element exists with ID" + elementId + ".");
         return false;
     }
     if (!(element->Is(DIVLINE) || element->Is(ACCID) || element->Is(CLEF))) {
-        LogError("Element is of type %s, but only Divlines, Accids, and Clefs can be moved out of syllables.",
+        VRV_LOG_ERROR("Element is of type %s, but only Divlines, Accids, and Clefs can be moved out of syllables.",
             element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message",
@@ -1448,7 +1445,7 @@ bool EditorToolkitNeume::MoveOutsideSyllable(std::string elementId)
         return false;
     }
     if (!parent->Is(SYLLABLE)) {
-        LogError("The selected %s is not a child of syllable.", element->GetClassName().c_str());
+        VRV_LOG_ERROR("The selected %s is not a child of syllable.", element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "The selected " + element->GetClassName() + "is not a child of syllable.");
         return false;
@@ -1538,14 +1535,14 @@ bool EditorToolkitNeume::MoveOutsideSyllable(std::string elementId)
 bool EditorToolkitNeume::DisplaceClefOctave(std::string elementId, std::string direction)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
     }
 
     if (direction != "above" && direction != "below") {
-        LogError("Direction can only be either \"above\" or \"below\".");
+        VRV_LOG_ERROR("Direction can only be either \"above\" or \"below\".");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Direction can only be either \"above\" or \"below\".");
         return false;
@@ -1554,7 +1551,7 @@ bool EditorToolkitNeume::DisplaceClefOctave(std::string elementId, std::string d
     Page *page = m_doc->GetDrawingPage();
     Object *obj = page->FindDescendantByID(elementId);
     if (obj == NULL || !obj->Is(CLEF)) {
-        LogError("This action can only be done on clefs!");
+        VRV_LOG_ERROR("This action can only be done on clefs!");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "This action can only be done on clefs!");
         return false;
@@ -1570,7 +1567,7 @@ bool EditorToolkitNeume::DisplaceClefOctave(std::string elementId, std::string d
     int octaveDis = prevDirection * (clef->GetDis() / 7) + move;
 
     if (octaveDis > 3 || octaveDis < -3) {
-        LogError("Clefs can only be displaced 3 octaves.");
+        VRV_LOG_ERROR("Clefs can only be displaced 3 octaves.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Clefs can only be displaced 3 octaves.");
         return false;
@@ -1622,13 +1619,13 @@ bool EditorToolkitNeume::DisplaceClefOctave(std::string elementId, std::string d
 bool EditorToolkitNeume::MatchHeight(std::string elementId)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get drawing page");
+        VRV_LOG_ERROR("Could not get drawing page");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get drawing page.");
         return false;
     }
     if (!m_doc->HasFacsimile()) {
-        LogError("Drawing page without facsimile");
+        VRV_LOG_ERROR("Drawing page without facsimile");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Drawing page without facsimile is unsupported.");
         return false;
@@ -1638,13 +1635,14 @@ bool EditorToolkitNeume::MatchHeight(std::string elementId)
     assert(element);
     Object *staffParent = element->GetFirstAncestor(STAFF);
     if (element == NULL) {
-        LogError("No element exists with ID '%s'.", elementId.c_str());
+        VRV_LOG_ERROR("No element exists with ID '%s'.", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "No element exists with ID" + elementId + ".");
         return false;
     }
     if (!element->Is(SYL)) {
-        LogError("Element is of type %s, but only <syl> element can match height.", element->GetClassName().c_str());
+        VRV_LOG_ERROR("Element is of type %s, but only <syl> element can match height.",
+            element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import(
             "message", "Element is of type " + element->GetClassName() + ", but only <syl> element can match height.");
@@ -1661,7 +1659,7 @@ bool EditorToolkitNeume::MatchHeight(std::string elementId)
         height = element->GetFacsimileInterface()->GetZone()->GetLry() - uly;
     }
     else {
-        LogError("Selected '%s' without facsimile", element->GetClassName().c_str());
+        VRV_LOG_ERROR("Selected '%s' without facsimile", element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Selected '" + element->GetClassName() + "' without facsimile is unsupported.");
         return false;
@@ -1726,14 +1724,14 @@ bool EditorToolkitNeume::Merge(std::vector<std::string> elementIds)
             staves.push_back(obj);
         }
         else {
-            LogError("Staff with ID '%s' does not exist!", it->c_str());
+            VRV_LOG_ERROR("Staff with ID '%s' does not exist!", it->c_str());
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Staff with ID '" + *it + "' does not exist.");
             return false;
         }
     }
     if (staves.size() < 2) {
-        LogError("At least two staves must be provided.");
+        VRV_LOG_ERROR("At least two staves must be provided.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "At least two staves must be provided.");
         return false;
@@ -1882,7 +1880,7 @@ bool EditorToolkitNeume::SetText(std::string elementId, const std::string &text)
     }
     Object *element = m_doc->GetDrawingPage()->FindDescendantByID(elementId);
     if (element == NULL) {
-        LogWarning("No element with ID '%s' exists", elementId.c_str());
+        VRV_LOG_WARNING("No element with ID '%s' exists", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "No element with ID '" + elementId + "' exists.");
         return false;
@@ -1949,7 +1947,7 @@ bool EditorToolkitNeume::SetText(std::string elementId, const std::string &text)
                     syl->AttachZone(zone);
                 }
                 else {
-                    LogWarning("Could not create bounding box for syl.");
+                    VRV_LOG_WARNING("Could not create bounding box for syl.");
                     message += "Could not create bounding box for syl. ";
                     status = "WARNING";
                     delete zone;
@@ -1963,7 +1961,7 @@ bool EditorToolkitNeume::SetText(std::string elementId, const std::string &text)
         }
     }
     else {
-        LogError("Element type '%s' is unsupported for SetText", element->GetClassName().c_str());
+        VRV_LOG_ERROR("Element type '%s' is unsupported for SetText", element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Element type '" + element->GetClassName() + "' is unsupported for SetText.");
         return false;
@@ -1979,7 +1977,7 @@ bool EditorToolkitNeume::SetText(std::string elementId, const std::string &text)
 bool EditorToolkitNeume::SetClef(std::string elementId, std::string shape)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
@@ -2003,7 +2001,7 @@ bool EditorToolkitNeume::SetClef(std::string elementId, std::string shape)
     if (clef->GetShape() != clefShape) {
         success = AttModule::SetShared(clef, "shape", shape);
         if (!success) {
-            LogError("Unable to set clef shape");
+            VRV_LOG_ERROR("Unable to set clef shape");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Unable to set clef shape.");
             return false;
@@ -2036,7 +2034,7 @@ bool EditorToolkitNeume::SetClef(std::string elementId, std::string shape)
 bool EditorToolkitNeume::SetLiquescent(std::string elementId, std::string curve)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
@@ -2080,7 +2078,7 @@ bool EditorToolkitNeume::SetLiquescent(std::string elementId, std::string curve)
 bool EditorToolkitNeume::SortStaves()
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get drawing page.");
+        VRV_LOG_ERROR("Could not get drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get drawing page.");
         return false;
@@ -2121,7 +2119,7 @@ bool EditorToolkitNeume::SortStaves()
 bool EditorToolkitNeume::Split(std::string elementId, int x)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page");
+        VRV_LOG_ERROR("Could not get the drawing page");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
@@ -2129,14 +2127,14 @@ bool EditorToolkitNeume::Split(std::string elementId, int x)
     Staff *staff = dynamic_cast<Staff *>(m_doc->GetDrawingPage()->FindDescendantByID(elementId));
     // Validate parameters
     if (staff == NULL) {
-        LogError("Either no element exists with ID '%s' or it is not a staff.", elementId.c_str());
+        VRV_LOG_ERROR("Either no element exists with ID '%s' or it is not a staff.", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Either no element exists with ID '" + elementId + "' or it is not a staff.");
         return false;
     }
 
     if (staff->GetZone()->GetUlx() > x || staff->GetZone()->GetLrx() < x) {
-        LogError("The 'x' parameter is not within the bounds of the original staff.");
+        VRV_LOG_ERROR("The 'x' parameter is not within the bounds of the original staff.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "The 'x' parameter is not within bounds of the original staff.");
         return false;
@@ -2151,7 +2149,7 @@ bool EditorToolkitNeume::Split(std::string elementId, int x)
     std::vector<std::pair<std::string, std::string>> v;
 
     if (!this->Insert("staff", "auto", newUlx, newUly, newLrx, newLry, v)) {
-        LogError("Failed to create a second staff.");
+        VRV_LOG_ERROR("Failed to create a second staff.");
         m_editInfo.reset();
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Failed to create a second staff.");
@@ -2161,7 +2159,7 @@ bool EditorToolkitNeume::Split(std::string elementId, int x)
         = dynamic_cast<Staff *>(m_doc->GetDrawingPage()->FindDescendantByID(m_editInfo.get<jsonxx::String>("uuid")));
     assert(splitStaff);
     if (splitStaff == NULL) {
-        LogError("Split staff is null");
+        VRV_LOG_ERROR("Split staff is null");
         m_editInfo.reset();
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Split staff is null.");
@@ -2218,7 +2216,7 @@ bool EditorToolkitNeume::Split(std::string elementId, int x)
 void EditorToolkitNeume::UnlinkSyllable(Syllable *syllable)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return;
@@ -2272,7 +2270,7 @@ void EditorToolkitNeume::UnlinkSyllable(Syllable *syllable)
 bool EditorToolkitNeume::Remove(std::string elementId)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
@@ -2327,7 +2325,7 @@ bool EditorToolkitNeume::Remove(std::string elementId)
         result = parent->DeleteChild(element);
 
         if (!result) {
-            LogError("Failed to delete the desired element (%s)", elementId.c_str());
+            VRV_LOG_ERROR("Failed to delete the desired element (%s)", elementId.c_str());
             m_editInfo.reset();
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Failed to delete the desired element (" + elementId + ").");
@@ -2384,7 +2382,7 @@ bool EditorToolkitNeume::Remove(std::string elementId)
         result = page->DeleteChild(system);
 
         if (!result) {
-            LogError("Failed to delete the desired element (%s)", elementId.c_str());
+            VRV_LOG_ERROR("Failed to delete the desired element (%s)", elementId.c_str());
             m_editInfo.reset();
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Failed to delete the desired element (" + elementId + ").");
@@ -2410,7 +2408,7 @@ bool EditorToolkitNeume::Remove(std::string elementId)
     }
 
     if (!result) {
-        LogError("Failed to delete the desired element (%s)", elementId.c_str());
+        VRV_LOG_ERROR("Failed to delete the desired element (%s)", elementId.c_str());
         m_editInfo.reset();
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Failed to delete the desired element (" + elementId + ").");
@@ -2427,7 +2425,7 @@ bool EditorToolkitNeume::Remove(std::string elementId)
             std::string neumeId = element->GetID();
             result &= parent->DeleteChild(element);
             if (!result) {
-                LogError("Failed to delete empty neume (%s)", neumeId.c_str());
+                VRV_LOG_ERROR("Failed to delete empty neume (%s)", neumeId.c_str());
                 m_editInfo.reset();
                 m_editInfo.import("status", "FAILURE");
                 m_editInfo.import("message", "Failed to delete empty neume (" + neumeId + ").");
@@ -2450,7 +2448,7 @@ bool EditorToolkitNeume::Remove(std::string elementId)
             std::string syllableId = element->GetID();
             result &= parent->DeleteChild(element);
             if (!result) {
-                LogError("Failed to delete empty syllable (%s)", syllableId.c_str());
+                VRV_LOG_ERROR("Failed to delete empty syllable (%s)", syllableId.c_str());
                 m_editInfo.reset();
                 m_editInfo.import("status", "FAILURE");
                 m_editInfo.import("message", "Failed to delete empty syllable (" + syllableId + ").");
@@ -2468,13 +2466,13 @@ bool EditorToolkitNeume::Remove(std::string elementId)
 bool EditorToolkitNeume::Resize(std::string elementId, int ulx, int uly, int lrx, int lry, float rotate)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
     }
     if (!m_doc->HasFacsimile()) {
-        LogWarning("Resizing is only available in facsimile mode.");
+        VRV_LOG_WARNING("Resizing is only available in facsimile mode.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Resizing is only available in facsimile mode.");
         return false;
@@ -2482,7 +2480,7 @@ bool EditorToolkitNeume::Resize(std::string elementId, int ulx, int uly, int lrx
 
     Object *obj = m_doc->GetDrawingPage()->FindDescendantByID(elementId);
     if (obj == NULL) {
-        LogError("Object with ID '%s' not found.", elementId.c_str());
+        VRV_LOG_ERROR("Object with ID '%s' not found.", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Object with ID '" + elementId + "' could not be found.");
         return false;
@@ -2491,7 +2489,7 @@ bool EditorToolkitNeume::Resize(std::string elementId, int ulx, int uly, int lrx
         Staff *staff = vrv_cast<Staff *>(obj);
         assert(staff);
         if (!staff->HasFacs()) {
-            LogError("This staff does not have a facsimile.");
+            VRV_LOG_ERROR("This staff does not have a facsimile.");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "This staff does not have a facsimile.");
             return false;
@@ -2529,7 +2527,7 @@ bool EditorToolkitNeume::Resize(std::string elementId, int ulx, int uly, int lrx
         Syl *syl = vrv_cast<Syl *>(obj);
         assert(syl);
         if (!syl->HasFacs()) {
-            LogError("This syl (bounding box) does not have a facsimile");
+            VRV_LOG_ERROR("This syl (bounding box) does not have a facsimile");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "This syl does not have a facsimile.");
             return false;
@@ -2560,7 +2558,7 @@ bool EditorToolkitNeume::Resize(std::string elementId, int ulx, int uly, int lrx
         zone->Modify();
     }
     else {
-        LogError("Element of type '%s' is unsupported.", obj->GetClassName().c_str());
+        VRV_LOG_ERROR("Element of type '%s' is unsupported.", obj->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Element of type '" + obj->GetClassName() + "' is unsupported.");
         return false;
@@ -2585,13 +2583,13 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
 
     // Get the current drawing page
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
     }
     if (elementIds.size() == 0) {
-        LogWarning("No element IDs to group!");
+        VRV_LOG_WARNING("No element IDs to group!");
         status = "WARNING";
         message = "No element IDs to group!";
         m_editInfo.import("status", status);
@@ -2606,7 +2604,7 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
         elementClass = NEUME;
     }
     else {
-        LogError("Invalid groupType: %s", groupType.c_str());
+        VRV_LOG_ERROR("Invalid groupType: %s", groupType.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Invalid groupType: " + groupType);
         return false;
@@ -2617,14 +2615,14 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
         // Verify that the children are of the same type
         Object *el = m_doc->GetDrawingPage()->FindDescendantByID(*it);
         if (el == NULL) {
-            LogError("Could not get element with ID %s", it->c_str());
+            VRV_LOG_ERROR("Could not get element with ID %s", it->c_str());
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Could not get element with ID " + *it);
             return false;
         }
         if (el->GetClassId() != elementClass) {
-            LogError("Element %s was of class %s. Expected class %s", el->GetID().c_str(), el->GetClassName().c_str(),
-                groupType.c_str());
+            VRV_LOG_ERROR("Element %s was of class %s. Expected class %s", el->GetID().c_str(),
+                el->GetClassName().c_str(), groupType.c_str());
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message",
                 "Element " + el->GetID() + " was of class " + el->GetClassName() + " but expected class " + groupType
@@ -2635,7 +2633,7 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
         // Get a set of parents and the number of children they have
         Object *par = el->GetParent();
         if (par == NULL) {
-            LogError("Parent of %s is null!", el->GetID().c_str());
+            VRV_LOG_ERROR("Parent of %s is null!", el->GetID().c_str());
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Parent of " + el->GetID() + " is null.");
             return false;
@@ -2703,13 +2701,13 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
     }
 
     if (parents.size() == 0) {
-        LogError("Could not get the parent.");
+        VRV_LOG_ERROR("Could not get the parent.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the parent.");
         return false;
     }
     else if (parents.size() == 1) {
-        LogError("The selected elements are already grouped.");
+        VRV_LOG_ERROR("The selected elements are already grouped.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "The selected elements are already grouped.");
         return false;
@@ -2751,7 +2749,7 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
     // check if share second level parent
     secondParent = (*parents.begin()).first->GetParent();
     if (secondParent == NULL) {
-        LogError("No second level parent!");
+        VRV_LOG_ERROR("No second level parent!");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "No second level parent.");
         return false;
@@ -2762,7 +2760,7 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
         Object *par = parentPair.first;
         int expected;
         if (par->GetParent() != secondParent) {
-            LogError("No shared second level parent!");
+            VRV_LOG_ERROR("No shared second level parent!");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "No shared second level parent.");
             return false;
@@ -2996,7 +2994,7 @@ bool EditorToolkitNeume::Ungroup(std::string groupType, std::vector<std::string>
 
     // Check if you can get drawing page
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
@@ -3059,7 +3057,7 @@ bool EditorToolkitNeume::Ungroup(std::string groupType, std::vector<std::string>
                         secondNc = NULL;
                     }
                     else {
-                        LogError("Unable to toggle ligature within ungroup ncs!");
+                        VRV_LOG_ERROR("Unable to toggle ligature within ungroup ncs!");
                         m_editInfo.import("status", "FAILURE");
                         m_editInfo.import("message", "Unable to toggle ligature within ungroup ncs.");
                         return false;
@@ -3137,7 +3135,7 @@ bool EditorToolkitNeume::Ungroup(std::string groupType, std::vector<std::string>
             }
 
             else {
-                LogError("Invalid groupType for ungrouping");
+                VRV_LOG_ERROR("Invalid groupType for ungrouping");
                 m_editInfo.import("status", "FAILURE");
                 m_editInfo.import("message", "Invalid groupType for ungrouping.");
                 return false;
@@ -3253,7 +3251,7 @@ bool EditorToolkitNeume::SplitNeume(std::string neumeId, std::string ncId)
 {
     // Check if you can get drawing page
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
@@ -3276,7 +3274,7 @@ bool EditorToolkitNeume::SplitNeume(std::string neumeId, std::string ncId)
     // get index
     int nLen = fparent->GetChildCount();
     if (nLen == 0) {
-        LogError("The selected neume has no children.");
+        VRV_LOG_ERROR("The selected neume has no children.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "The selected neume has no children.");
         return false;
@@ -3285,7 +3283,7 @@ bool EditorToolkitNeume::SplitNeume(std::string neumeId, std::string ncId)
     // get the index of selected nc in the neume
     int fIdx = fparent->GetChildIndex(elNc);
     if (fIdx == -1) {
-        LogError("The selected neume component is not a child of the selected neume.");
+        VRV_LOG_ERROR("The selected neume component is not a child of the selected neume.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "The selected neume component is not a child of the selected neume.");
         return false;
@@ -3331,14 +3329,14 @@ bool EditorToolkitNeume::ChangeGroup(std::string elementId, std::string contour)
 {
     // Check if you can get drawing page
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
     }
     Neume *el = dynamic_cast<Neume *>(m_doc->GetDrawingPage()->FindDescendantByID(elementId));
     if (el == NULL) {
-        LogError("Unable to find neume with id %s", elementId.c_str());
+        VRV_LOG_ERROR("Unable to find neume with id %s", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Unable to find neume with id " + elementId + ".");
         return false;
@@ -3357,7 +3355,7 @@ bool EditorToolkitNeume::ChangeGroup(std::string elementId, std::string contour)
         }
     }
     if (!firstChild) {
-        LogError("Unable to find first child.");
+        VRV_LOG_ERROR("Unable to find first child.");
         return false;
     }
     // Get the coordinates of the remaining child.
@@ -3401,7 +3399,7 @@ bool EditorToolkitNeume::ChangeGroup(std::string elementId, std::string contour)
             newLry = initialLry;
         }
         else {
-            LogError("Unsupported character in contour.");
+            VRV_LOG_ERROR("Unsupported character in contour.");
             delete newNc;
             delete zone;
             m_editInfo.import("status", "FAILURE");
@@ -3445,7 +3443,7 @@ bool EditorToolkitNeume::ToggleLigature(std::vector<std::string> elementIds)
     std::string secondNcId = elementIds[1];
     // Check if you can get drawing page
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page.");
+        VRV_LOG_ERROR("Could not get the drawing page.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
@@ -3460,7 +3458,7 @@ bool EditorToolkitNeume::ToggleLigature(std::vector<std::string> elementIds)
     int firstIdx = firstNc->GetIdx();
     int secondIdx = secondNc->GetIdx();
     if (std::abs(firstIdx - secondIdx) != 1) {
-        LogError("The selected ncs are not adjacent.");
+        VRV_LOG_ERROR("The selected ncs are not adjacent.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "The selected ncs are not adjacent.");
         return false;
@@ -3516,7 +3514,7 @@ bool EditorToolkitNeume::ToggleLigature(std::vector<std::string> elementIds)
     }
 
     if (!(success1 && success2)) {
-        LogWarning("Unable to update ligature attribute");
+        VRV_LOG_WARNING("Unable to update ligature attribute");
         m_editInfo.import("message", "Unable to update ligature attribute.");
         m_editInfo.import("status", "WARNING");
         return false;
@@ -3533,14 +3531,14 @@ bool EditorToolkitNeume::ToggleLigature(std::vector<std::string> elementIds)
 bool EditorToolkitNeume::ChangeStaff(std::string elementId)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page");
+        VRV_LOG_ERROR("Could not get the drawing page");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
     }
 
     if (!m_doc->HasFacsimile()) {
-        LogWarning("Staff re-association is only available in facsimile mode.");
+        VRV_LOG_WARNING("Staff re-association is only available in facsimile mode.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Staff re-association is only available in facsimile mode.");
         return false;
@@ -3549,7 +3547,7 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
     Object *element = m_doc->GetDrawingPage()->FindDescendantByID(elementId);
     assert(element);
     if (element == NULL) {
-        LogError("No element exists with ID '%s'.", elementId.c_str());
+        VRV_LOG_ERROR("No element exists with ID '%s'.", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "No element exists with ID" + elementId + ".");
         return false;
@@ -3557,7 +3555,8 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
 
     if (!(element->Is(SYLLABLE) || element->Is(CUSTOS) || element->Is(CLEF) || element->Is(DIVLINE)
             || element->Is(ACCID))) {
-        LogError("Element is of type %s, but only Syllables, Custos, Clefs, Divlines, and Accids can change staves.",
+        VRV_LOG_ERROR(
+            "Element is of type %s, but only Syllables, Custos, Clefs, Divlines, and Accids can change staves.",
             element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message",
@@ -3566,9 +3565,7 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         return false;
     }
 
-    ListOfObjects stavesList = m_doc->FindAllDescendantsByType(STAFF, false);
-
-    std::vector<Object *> staves(stavesList.begin(), stavesList.end());
+    ListOfObjects staves = m_doc->FindAllDescendantsByType(STAFF, false);
 
     ClosestBB comp;
 
@@ -3580,7 +3577,7 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         int ulx, uly, lrx, lry;
         LayerElement *layerElement = dynamic_cast<LayerElement *>(element);
         if (!layerElement->GenerateZoneBounds(&ulx, &uly, &lrx, &lry)) {
-            LogError("Couldn't generate bounding box for syllable.");
+            VRV_LOG_ERROR("Couldn't generate bounding box for syllable.");
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Couldn't generate bounding box for syllable.");
             return false;
@@ -3589,7 +3586,7 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         comp.y = (uly + lry) / 2;
     }
     else {
-        LogError("This element does not have a facsimile.");
+        VRV_LOG_ERROR("This element does not have a facsimile.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "This element does not have a facsimile.");
         return false;
@@ -3599,11 +3596,10 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
 
     // find the nearest staff line
     if (staves.size() > 0) {
-        std::sort(staves.begin(), staves.end(), comp);
-        staff = dynamic_cast<Staff *>(staves.front());
+        staff = dynamic_cast<Staff *>(*std::min_element(staves.begin(), staves.end(), comp));
     }
     else {
-        LogError("Could not find any staves. This should not happen");
+        VRV_LOG_ERROR("Could not find any staves. This should not happen");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not find any staves. This should not happen");
         return false;
@@ -3613,7 +3609,7 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
     Staff *sParent = vrv_cast<Staff *>(parent->GetFirstAncestor(STAFF));
     assert(parent);
     if (parent == NULL || sParent == NULL) {
-        LogError("Couldn't find staff parent of element with id '%s'", elementId.c_str());
+        VRV_LOG_ERROR("Couldn't find staff parent of element with id '%s'", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Couldn't find staff parent of element with id " + elementId);
         return false;
@@ -3622,7 +3618,7 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
     Layer *layer = vrv_cast<Layer *>(staff->FindDescendantByType(LAYER));
     assert(LAYER);
     if (layer == NULL) {
-        LogError("Couldn't find layer child of staff. This should not happen");
+        VRV_LOG_ERROR("Couldn't find layer child of staff. This should not happen");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Couldn't find layer child of staff. This should not happen");
         return false;
@@ -3689,7 +3685,7 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
 
         // Adjust clefline
         if (!AdjustClefLineFromPosition(dynamic_cast<Clef *>(element), staff)) {
-            LogError("Could not adjust clef line of %s", element->GetID().c_str());
+            VRV_LOG_ERROR("Could not adjust clef line of %s", element->GetID().c_str());
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Failed to set clef line from facsimile.");
             return false;
@@ -3718,7 +3714,7 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         parent->ReorderByXPos();
         if (!(element->Is(ACCID) || element->Is(DIVLINE))) {
             if (!AdjustPitchFromPosition(element)) {
-                LogError("Could not adjust pitch of %s", element->GetID().c_str());
+                VRV_LOG_ERROR("Could not adjust pitch of %s", element->GetID().c_str());
                 m_editInfo.import("status", "FAILURE");
                 m_editInfo.import("message", "Failed to properly set pitch.");
                 m_editInfo.import("elementId", element->GetID());
@@ -3738,14 +3734,14 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
 bool EditorToolkitNeume::ChangeStaffTo(std::string elementId, std::string staffId)
 {
     if (!m_doc->GetDrawingPage()) {
-        LogError("Could not get the drawing page");
+        VRV_LOG_ERROR("Could not get the drawing page");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not get the drawing page.");
         return false;
     }
 
     if (!m_doc->HasFacsimile()) {
-        LogWarning("Staff re-association is only available in facsimile mode.");
+        VRV_LOG_WARNING("Staff re-association is only available in facsimile mode.");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Staff re-association is only available in facsimile mode.");
         return false;
@@ -3754,14 +3750,14 @@ bool EditorToolkitNeume::ChangeStaffTo(std::string elementId, std::string staffI
     Object *element = m_doc->GetDrawingPage()->FindDescendantByID(elementId);
     assert(element);
     if (element == NULL) {
-        LogError("No element exists with ID '%s'.", elementId.c_str());
+        VRV_LOG_ERROR("No element exists with ID '%s'.", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "No element exists with ID" + elementId + ".");
         return false;
     }
 
     if (!(element->Is(CLEF) || element->Is(DIVLINE) || element->Is(ACCID))) {
-        LogError("Element is of type %s, but only Clefs, Divlines, and Accids can change to a specified staff.",
+        VRV_LOG_ERROR("Element is of type %s, but only Clefs, Divlines, and Accids can change to a specified staff.",
             element->GetClassName().c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message",
@@ -3773,7 +3769,7 @@ bool EditorToolkitNeume::ChangeStaffTo(std::string elementId, std::string staffI
     Staff *staff = dynamic_cast<Staff *>(m_doc->GetDrawingPage()->FindDescendantByID(staffId));
 
     if (!staff) {
-        LogError("Could not find any staves. This should not happen");
+        VRV_LOG_ERROR("Could not find any staves. This should not happen");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Could not find any staves. This should not happen");
         return false;
@@ -3783,7 +3779,7 @@ bool EditorToolkitNeume::ChangeStaffTo(std::string elementId, std::string staffI
     Staff *sParent = dynamic_cast<Staff *>(parent->GetFirstAncestor(STAFF));
     assert(parent);
     if (parent == NULL || sParent == NULL) {
-        LogError("Couldn't find staff parent of element with id '%s'", elementId.c_str());
+        VRV_LOG_ERROR("Couldn't find staff parent of element with id '%s'", elementId.c_str());
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Couldn't find staff parent of element with id " + elementId);
         return false;
@@ -3792,7 +3788,7 @@ bool EditorToolkitNeume::ChangeStaffTo(std::string elementId, std::string staffI
     Layer *layer = dynamic_cast<Layer *>(staff->FindDescendantByType(LAYER));
     assert(LAYER);
     if (layer == NULL) {
-        LogError("Couldn't find layer child of staff. This should not happen");
+        VRV_LOG_ERROR("Couldn't find layer child of staff. This should not happen");
         m_editInfo.import("status", "FAILURE");
         m_editInfo.import("message", "Couldn't find layer child of staff. This should not happen");
         return false;
@@ -3859,7 +3855,7 @@ bool EditorToolkitNeume::ChangeStaffTo(std::string elementId, std::string staffI
 
         // Adjust clefline
         if (!AdjustClefLineFromPosition(dynamic_cast<Clef *>(element), staff)) {
-            LogError("Could not adjust clef line of %s", element->GetID().c_str());
+            VRV_LOG_ERROR("Could not adjust clef line of %s", element->GetID().c_str());
             m_editInfo.import("status", "FAILURE");
             m_editInfo.import("message", "Failed to set clef line from facsimile.");
             return false;
@@ -3997,13 +3993,13 @@ bool EditorToolkitNeume::ParseMergeAction(jsonxx::Object param, std::vector<std:
 bool EditorToolkitNeume::ParseSplitAction(jsonxx::Object param, std::string *elementId, int *x)
 {
     if (!param.has<jsonxx::String>("elementId")) {
-        LogWarning("Could not parse 'elementId'.");
+        VRV_LOG_WARNING("Could not parse 'elementId'.");
         return false;
     }
     (*elementId) = param.get<jsonxx::String>("elementId");
 
     if (!param.has<jsonxx::Number>("x")) {
-        LogWarning("Could not parse 'x'.");
+        VRV_LOG_WARNING("Could not parse 'x'.");
         return false;
     }
     (*x) = param.get<jsonxx::Number>("x");
@@ -4015,17 +4011,17 @@ bool EditorToolkitNeume::ParseSetAction(
     jsonxx::Object param, std::string *elementId, std::string *attrType, std::string *attrValue)
 {
     if (!param.has<jsonxx::String>("elementId")) {
-        LogWarning("Could not parse 'elementId'");
+        VRV_LOG_WARNING("Could not parse 'elementId'");
         return false;
     }
     (*elementId) = param.get<jsonxx::String>("elementId");
     if (!param.has<jsonxx::String>("attrType")) {
-        LogWarning("Could not parse 'attrType'");
+        VRV_LOG_WARNING("Could not parse 'attrType'");
         return false;
     }
     (*attrType) = param.get<jsonxx::String>("attrType");
     if (!param.has<jsonxx::String>("attrValue")) {
-        LogWarning("Could not parse 'attrValue'");
+        VRV_LOG_WARNING("Could not parse 'attrValue'");
         return false;
     }
     (*attrValue) = param.get<jsonxx::String>("attrValue");
@@ -4035,12 +4031,12 @@ bool EditorToolkitNeume::ParseSetAction(
 bool EditorToolkitNeume::ParseSetTextAction(jsonxx::Object param, std::string *elementId, std::string *text)
 {
     if (!param.has<jsonxx::String>("elementId")) {
-        LogWarning("Could not parse 'elementId'");
+        VRV_LOG_WARNING("Could not parse 'elementId'");
         return false;
     }
     *elementId = param.get<jsonxx::String>("elementId");
     if (!param.has<jsonxx::String>("text")) {
-        LogWarning("Could not parse 'text'");
+        VRV_LOG_WARNING("Could not parse 'text'");
         return false;
     }
     *text = param.get<jsonxx::String>("text");
@@ -4050,12 +4046,12 @@ bool EditorToolkitNeume::ParseSetTextAction(jsonxx::Object param, std::string *e
 bool EditorToolkitNeume::ParseSetClefAction(jsonxx::Object param, std::string *elementId, std::string *shape)
 {
     if (!param.has<jsonxx::String>("elementId")) {
-        LogWarning("Could not parse 'elementId'");
+        VRV_LOG_WARNING("Could not parse 'elementId'");
         return false;
     }
     *elementId = param.get<jsonxx::String>("elementId");
     if (!param.has<jsonxx::String>("shape")) {
-        LogWarning("Could not parse 'shape'");
+        VRV_LOG_WARNING("Could not parse 'shape'");
         return false;
     }
     *shape = param.get<jsonxx::String>("shape");
@@ -4065,12 +4061,12 @@ bool EditorToolkitNeume::ParseSetClefAction(jsonxx::Object param, std::string *e
 bool EditorToolkitNeume::ParseSetLiquescentAction(jsonxx::Object param, std::string *elementId, std::string *curve)
 {
     if (!param.has<jsonxx::String>("elementId")) {
-        LogWarning("Could not parse 'elementId'");
+        VRV_LOG_WARNING("Could not parse 'elementId'");
         return false;
     }
     *elementId = param.get<jsonxx::String>("elementId");
     if (!param.has<jsonxx::String>("curve")) {
-        LogWarning("Could not parse 'curve'");
+        VRV_LOG_WARNING("Could not parse 'curve'");
         return false;
     }
     *curve = param.get<jsonxx::String>("curve");
@@ -4149,13 +4145,13 @@ bool EditorToolkitNeume::ParseUngroupAction(
 bool EditorToolkitNeume::ParseSplitNeumeAction(jsonxx::Object param, std::string *elementId, std::string *ncId)
 {
     if (!param.has<jsonxx::String>("elementId")) {
-        LogWarning("Could not parse 'elementId'.");
+        VRV_LOG_WARNING("Could not parse 'elementId'.");
         return false;
     }
     (*elementId) = param.get<jsonxx::String>("elementId");
 
     if (!param.has<jsonxx::String>("ncId")) {
-        LogWarning("Could not parse 'ncId'.");
+        VRV_LOG_WARNING("Could not parse 'ncId'.");
         return false;
     }
     (*ncId) = param.get<jsonxx::String>("ncId");
@@ -4214,7 +4210,7 @@ bool EditorToolkitNeume::AdjustPitchFromPosition(Object *obj, Clef *clef)
 
         // Check interfaces
         if ((custos->GetPitchInterface() == NULL) || (custos->GetFacsimileInterface() == NULL)) {
-            LogError("Element is lacking an interface which is required for pitch adjusting");
+            VRV_LOG_ERROR("Element is lacking an interface which is required for pitch adjusting");
             return false;
         }
         PitchInterface *pi = custos->GetPitchInterface();
@@ -4222,7 +4218,7 @@ bool EditorToolkitNeume::AdjustPitchFromPosition(Object *obj, Clef *clef)
 
         // Check for facsimile
         if (!fi->HasFacs() || !staff->HasFacs()) {
-            LogError("Could not adjust pitch: the element or staff lacks facsimile data");
+            VRV_LOG_ERROR("Could not adjust pitch: the element or staff lacks facsimile data");
             return false;
         }
 
@@ -4249,7 +4245,7 @@ bool EditorToolkitNeume::AdjustPitchFromPosition(Object *obj, Clef *clef)
             pi->SetPname(PITCHNAME_g);
         }
         else {
-            LogError("Clef %s does not have valid shape. Shape is %s", clef->GetID().c_str(), clef->GetShape());
+            VRV_LOG_ERROR("Clef %s does not have valid shape. Shape is %s", clef->GetID().c_str(), clef->GetShape());
             return false;
         }
         pi->SetOct(3);
@@ -4282,7 +4278,8 @@ bool EditorToolkitNeume::AdjustPitchFromPosition(Object *obj, Clef *clef)
         obj->FindAllDescendantsByComparison(&pitchedChildren, &ic);
 
         if (pitchedChildren.empty()) {
-            LogWarning("Syllable/neume had no pitched children to reorder for syllable/neume %s", obj->GetID().c_str());
+            VRV_LOG_WARNING("Syllable/neume had no pitched children to reorder for syllable/neume %s",
+                obj->GetID().c_str());
             return true;
         }
 
@@ -4304,7 +4301,8 @@ bool EditorToolkitNeume::AdjustPitchFromPosition(Object *obj, Clef *clef)
             case CLEFSHAPE_F: pname = PITCHNAME_f; break;
             case CLEFSHAPE_G: pname = PITCHNAME_g; break;
             default:
-                LogError("Clef %s does not have valid shape. Shape is %s", clef->GetID().c_str(), clef->GetShape());
+                VRV_LOG_ERROR("Clef %s does not have valid shape. Shape is %s", clef->GetID().c_str(),
+                    clef->GetShape());
                 return false;
         }
 
@@ -4315,7 +4313,7 @@ bool EditorToolkitNeume::AdjustPitchFromPosition(Object *obj, Clef *clef)
 
             FacsimileInterface *fi = (*it)->GetFacsimileInterface();
             if (fi == NULL || !fi->HasFacs()) {
-                LogError("Could not adjust pitch: child %s does not have facsimile data", (*it)->GetID().c_str());
+                VRV_LOG_ERROR("Could not adjust pitch: child %s does not have facsimile data", (*it)->GetID().c_str());
                 return false;
             }
 
@@ -4343,7 +4341,7 @@ bool EditorToolkitNeume::AdjustPitchFromPosition(Object *obj, Clef *clef)
     }
 
     else {
-        LogError("AdjustPitchFromPosition should only be called on custos or syllables."
+        VRV_LOG_ERROR("AdjustPitchFromPosition should only be called on custos or syllables."
                  "It has been called on %s, whose id is %s",
             obj->GetClassName().c_str(), obj->GetID().c_str());
         return false;
@@ -16,6 +16,7 @@
 
 #include "editorial.h"
 #include "expansion.h"
+#include "jsonstream.h"
 #include "linkinginterface.h"
 #include "plistinterface.h"
 #include "timeinterface.h"
@@ -265,14 +266,13 @@ void ExpansionMap::GeneratePredictableIDs(Object *source, Object *target)
 
 void ExpansionMap::ToJson(std::string &output)
 {
-    jsonxx::Object expansionmap;
+    JsonWriter writer(output);
+    writer.StartObject();
     for (auto &[id, ids] : m_map) {
-        jsonxx::Array expandedIds;
-        for (auto i : ids) expandedIds << i;
-        expansionmap << id << expandedIds;
-        ;
+        writer.Key(id);
+        writer.StringArray(ids);
     }
-    output = expansionmap.json();
+    writer.EndObject();
 }
 
 } // namespace vrv
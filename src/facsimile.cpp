@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 
 //----------------------------------------------------------------------------
@@ -26,11 +27,20 @@ namespace vrv {
 
 static const ClassRegistrar<Facsimile> s_factory("facsimile", FACSIMILE);
 
-Facsimile::Facsimile() : Object(FACSIMILE, "facsimile-"), AttTyped() {}
+Facsimile::Facsimile() : Object(FACSIMILE, "facsimile-"), AttTyped()
+{
+    m_isIndexed = false;
+    m_cachedMaxX = VRV_UNSET;
+    m_cachedMaxY = VRV_UNSET;
+}
 
 Facsimile::~Facsimile() {}
 
-void Facsimile::Reset() {}
+void Facsimile::Reset()
+{
+    this->ClearIndex();
+    this->ResetCachedExtents();
+}
 
 bool Facsimile::IsSupportedChild(Object *object)
 {
@@ -38,46 +48,84 @@ bool Facsimile::IsSupportedChild(Object *object)
         assert(dynamic_cast<Surface *>(object));
     }
     else {
-        LogError("Unsupported child '%s' of facsimile", object->GetClassName().c_str());
+        VRV_LOG_ERROR("Unsupported child '%s' of facsimile", object->GetClassName().c_str());
         return false;
     }
     return true;
 }
 
+void Facsimile::IndexDescendants()
+{
+    m_descendantsByID.clear();
+
+    ListOfConstObjects descendants;
+    this->FillFlatList(descendants);
+    for (const Object *object : descendants) {
+        if (object == this) continue;
+        // Keep the first one in case of duplicated IDs, as FindDescendantByID does
+        m_descendantsByID.emplace(object->GetID(), const_cast<Object *>(object));
+    }
+    m_isIndexed = true;
+}
+
+void Facsimile::ClearIndex()
+{
+    m_descendantsByID.clear();
+    m_isIndexed = false;
+}
+
+Object *Facsimile::FindIndexedDescendantByID(const std::string &id)
+{
+    return const_cast<Object *>(std::as_const(*this).FindIndexedDescendantByID(id));
+}
+
+const Object *Facsimile::FindIndexedDescendantByID(const std::string &id) const
+{
+    if (!m_isIndexed) return this->FindDescendantByID(id);
+
+    auto it = m_descendantsByID.find(id);
+    const Object *object = (it != m_descendantsByID.end()) ? it->second : NULL;
+    assert(!object || (object->GetID() == id));
+    return object;
+}
+
 Zone *Facsimile::FindZoneByID(const std::string &zoneId)
 {
-    return dynamic_cast<Zone *>(this->FindDescendantByID(zoneId));
+    return dynamic_cast<Zone *>(this->FindIndexedDescendantByID(zoneId));
 }
 
 const Zone *Facsimile::FindZoneByID(const std::string &zoneId) const
 {
-    return dynamic_cast<const Zone *>(this->FindDescendantByID(zoneId));
+    return dynamic_cast<const Zone *>(this->FindIndexedDescendantByID(zoneId));
 }
 
 int Facsimile::GetMaxX() const
 {
-    ListOfConstObjects surfaces = this->FindAllDescendantsByType(SURFACE);
-
-    int max = 0;
-    for (const Object *object : surfaces) {
-        const Surface *surface = vrv_cast<const Surface *>(object);
-        assert(surface);
-        max = (surface->GetMaxX() > max) ? surface->GetMaxX() : max;
-    }
-    return max;
+    this->CacheExtents();
+    return m_cachedMaxX;
 }
 
 int Facsimile::GetMaxY() const
 {
-    ListOfConstObjects surfaces = this->FindAllDescendantsByType(SURFACE);
+    this->CacheExtents();
+    return m_cachedMaxY;
+}
 
-    int max = 0;
-    for (const Object *object : surfaces) {
-        const Surface *surface = vrv_cast<const Surface *>(object);
+void Facsimile::CacheExtents() const
+{
+    // Adding, removing or shifting a zone marks the facsimile as modified
+    if (!this->IsModified() && (m_cachedMaxX != VRV_UNSET)) return;
+
+    m_cachedMaxX = 0;
+    m_cachedMaxY = 0;
+    for (const Object *child : this->GetChildren()) {
+        if (!child->Is(SURFACE)) continue;
+        const Surface *surface = vrv_cast<const Surface *>(child);
         assert(surface);
-        max = (surface->GetMaxY() > max) ? surface->GetMaxY() : max;
+        m_cachedMaxX = std::max(m_cachedMaxX, surface->GetMaxX());
+        m_cachedMaxY = std::max(m_cachedMaxY, surface->GetMaxY());
     }
-    return max;
+    this->Modify(false);
 }
 
 } // namespace vrv
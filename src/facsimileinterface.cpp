@@ -111,9 +111,9 @@ FunctorCode FacsimileInterface::InterfacePrepareFacsimile(PrepareFacsimileFuncto
     assert(functor.GetFacsimile());
     Facsimile *facsimile = functor.GetFacsimile();
     std::string facsID = ExtractIDFragment(this->GetFacs());
-    Object *facsDescendant = facsimile->FindDescendantByID(facsID);
+    Object *facsDescendant = facsimile->FindIndexedDescendantByID(facsID);
     if (!facsDescendant) {
-        LogWarning("Could not find @facs '%s' in facsimile element", facsID.c_str());
+        VRV_LOG_WARNING("Could not find @facs '%s' in facsimile element", facsID.c_str());
         return FUNCTOR_CONTINUE;
     }
 
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 
@@ -18,6 +19,7 @@
 #include "doc.h"
 #include "gracegrp.h"
 #include "iopae.h"
+#include "jsonstream.h"
 #include "layer.h"
 #include "mdiv.h"
 #include "measure.h"
@@ -38,6 +40,8 @@ namespace vrv {
 FeatureExtractor::FeatureExtractor(const std::string &options)
 {
     // We currently have no option support
+    m_numericOnly = false;
+
     this->Reset();
 }
 
@@ -60,114 +64,250 @@ void FeatureExtractor::Extract(const Object *object)
 
         // Check if the note is tied to a previous one and skip it if yes
         if (note->GetScoreTimeTiedDuration() == -1.0) {
-            // Check if we need to add it to the previous interval ids
-            const int intervalsIdsSize = (int)m_intervalsIds.size();
-            if (intervalsIdsSize > 0) m_intervalsIds.get<jsonxx::Array>(intervalsIdsSize - 1) << note->GetID();
-            // Same for pitch ids
-            const int pitchesIdsSize = (int)m_pitchesIds.size();
-            if (pitchesIdsSize > 0) m_pitchesIds.get<jsonxx::Array>(pitchesIdsSize - 1) << note->GetID();
+            if (!m_numericOnly) {
+                // Check if we need to add it to the previous interval ids
+                if (!m_intervalsIds.empty()) m_intervalsIds.back().push_back(note->GetID());
+                // Same for pitch ids
+                if (!m_pitchesIds.empty()) m_pitchesIds.back().push_back(note->GetID());
+            }
             m_previousNotes.push_back(note);
             return;
         }
 
-        std::stringstream pitch;
-        std::stringstream pitchWithDuration;
-
-        pitchWithDuration << PAEOutput::GetPaeDur(note->GetDur(), note->GetDots());
-
-        data_OCTAVE oct = note->GetOct();
-        char octSign = (oct > 3) ? '\'' : ',';
-        int signCount = (oct > 3) ? (oct - 3) : (4 - oct);
-        std::string octaves = std::string(signCount, octSign);
-        pitch << octaves;
-        pitchWithDuration << octaves;
-
-        const Accid *accid = vrv_cast<const Accid *>(note->FindDescendantByType(ACCID));
-        if (accid) {
-            // We need to check both written and gestural accidentals
-            std::string accidStrWritten;
-            switch (accid->GetAccid()) {
-                case (ACCIDENTAL_WRITTEN_s): accidStrWritten = "x"; break;
-                case (ACCIDENTAL_WRITTEN_f): accidStrWritten = "b"; break;
-                case (ACCIDENTAL_WRITTEN_ss): accidStrWritten = "xx"; break;
-                case (ACCIDENTAL_WRITTEN_x): accidStrWritten = "xx"; break;
-                case (ACCIDENTAL_WRITTEN_ff): accidStrWritten = "bb"; break;
-                // case (ACCIDENTAL_WRITTEN_n): accidStrWritten = "n"; break;
-                default: accidStrWritten = "";
-            }
-            std::string accidStr;
-            switch (accid->GetAccidGes()) {
-                case (ACCIDENTAL_GESTURAL_s): accidStr = "x"; break;
-                case (ACCIDENTAL_GESTURAL_f): accidStr = "b"; break;
-                case (ACCIDENTAL_GESTURAL_ss): accidStr = "xx"; break;
-                case (ACCIDENTAL_GESTURAL_ff): accidStr = "bb"; break;
-                // case (ACCIDENTAL_GESTURAL_n): accidStr = "n"; break;
-                default: accidStr = accidStrWritten;
-            }
-            pitch << accidStr;
-            pitchWithDuration << accidStr;
-        }
+        m_pitchesMIDI.push_back(note->GetMIDIPitch());
+        m_pitchesDiatonicValues.push_back(note->GetDiatonicPitch());
+
+        if (!m_numericOnly) this->ExtractStrings(note);
 
-        std::string pname = note->AttPitch::PitchnameToStr(note->GetPname());
-        std::transform(pname.begin(), pname.end(), pname.begin(), ::toupper);
-        pitch << pname;
-        pitchWithDuration << pname;
-
-        m_pitchesChromatic << pitch.str();
-        m_pitchesChromaticWithDuration << pitchWithDuration.str();
-        m_pitchesDiatonic << pname;
-        jsonxx::Array pitchesIds;
-        pitchesIds << note->GetID();
-        m_pitchesIds << jsonxx::Value(pitchesIds);
-
-        // We have a previous note (or more with tied notes), so we can calculate an interval
-        if (!m_previousNotes.empty()) {
-            const int intervalChromatic = note->GetMIDIPitch() - m_previousNotes.front()->GetMIDIPitch();
-            if (intervalChromatic == 0) {
-                m_intervalGrossContour << "s";
-                m_intervalRefinedContour << "s";
-            }
-            else if (intervalChromatic < 0) {
-                m_intervalGrossContour << "D";
-                m_intervalRefinedContour << ((intervalChromatic < -2) ? "D" : "d");
-            }
-            else {
-                m_intervalGrossContour << "U";
-                m_intervalRefinedContour << ((intervalChromatic > 2) ? "U" : "u");
-            }
-            m_intervalsChromatic << StringFormat("%d", intervalChromatic);
-            std::string intervalDiatonicStr
-                = StringFormat("%d", note->GetDiatonicPitch() - m_previousNotes.front()->GetDiatonicPitch());
-            m_intervalsDiatonic << intervalDiatonicStr;
-            jsonxx::Array intervalsIds;
-            for (const Note *previousNote : m_previousNotes) {
-                intervalsIds << previousNote->GetID();
-            }
-            intervalsIds << note->GetID();
-            m_intervalsIds << jsonxx::Value(intervalsIds);
-        }
         m_previousNotes.clear();
         m_previousNotes.push_back(note);
     }
 }
 
+void FeatureExtractor::ExtractStrings(const Note *note)
+{
+    std::string pitch;
+
+    data_OCTAVE oct = note->GetOct();
+    char octSign = (oct > 3) ? '\'' : ',';
+    int signCount = (oct > 3) ? (oct - 3) : (4 - oct);
+    pitch.append(signCount, octSign);
+
+    const Accid *accid = vrv_cast<const Accid *>(note->FindDescendantByType(ACCID));
+    if (accid) {
+        // We need to check both written and gestural accidentals
+        std::string accidStrWritten;
+        switch (accid->GetAccid()) {
+            case (ACCIDENTAL_WRITTEN_s): accidStrWritten = "x"; break;
+            case (ACCIDENTAL_WRITTEN_f): accidStrWritten = "b"; break;
+            case (ACCIDENTAL_WRITTEN_ss): accidStrWritten = "xx"; break;
+            case (ACCIDENTAL_WRITTEN_x): accidStrWritten = "xx"; break;
+            case (ACCIDENTAL_WRITTEN_ff): accidStrWritten = "bb"; break;
+            // case (ACCIDENTAL_WRITTEN_n): accidStrWritten = "n"; break;
+            default: accidStrWritten = "";
+        }
+        std::string accidStr;
+        switch (accid->GetAccidGes()) {
+            case (ACCIDENTAL_GESTURAL_s): accidStr = "x"; break;
+            case (ACCIDENTAL_GESTURAL_f): accidStr = "b"; break;
+            case (ACCIDENTAL_GESTURAL_ss): accidStr = "xx"; break;
+            case (ACCIDENTAL_GESTURAL_ff): accidStr = "bb"; break;
+            // case (ACCIDENTAL_GESTURAL_n): accidStr = "n"; break;
+            default: accidStr = accidStrWritten;
+        }
+        pitch += accidStr;
+    }
+
+    std::string pname = note->AttPitch::PitchnameToStr(note->GetPname());
+    std::transform(pname.begin(), pname.end(), pname.begin(), ::toupper);
+    pitch += pname;
+
+    m_pitchesChromaticWithDuration.push_back(PAEOutput::GetPaeDur(note->GetDur(), note->GetDots()) + pitch);
+    m_pitchesChromatic.push_back(std::move(pitch));
+    m_pitchesDiatonic.push_back(pname);
+    m_pitchesIds.push_back({ note->GetID() });
+
+    // We have a previous note (or more with tied notes), so we can calculate an interval
+    if (!m_previousNotes.empty()) {
+        const int intervalChromatic = note->GetMIDIPitch() - m_previousNotes.front()->GetMIDIPitch();
+        if (intervalChromatic == 0) {
+            m_intervalGrossContour.push_back("s");
+            m_intervalRefinedContour.push_back("s");
+        }
+        else if (intervalChromatic < 0) {
+            m_intervalGrossContour.push_back("D");
+            m_intervalRefinedContour.push_back((intervalChromatic < -2) ? "D" : "d");
+        }
+        else {
+            m_intervalGrossContour.push_back("U");
+            m_intervalRefinedContour.push_back((intervalChromatic > 2) ? "U" : "u");
+        }
+        m_intervalsChromatic.push_back(std::to_string(intervalChromatic));
+        m_intervalsDiatonic.push_back(
+            std::to_string(note->GetDiatonicPitch() - m_previousNotes.front()->GetDiatonicPitch()));
+        std::vector<std::string> intervalsIds;
+        intervalsIds.reserve(m_previousNotes.size() + 1);
+        for (const Note *previousNote : m_previousNotes) {
+            intervalsIds.push_back(previousNote->GetID());
+        }
+        intervalsIds.push_back(note->GetID());
+        m_intervalsIds.push_back(std::move(intervalsIds));
+    }
+}
+
 void FeatureExtractor::ToJson(std::string &output)
 {
-    jsonxx::Object o;
+    auto writeIds = [](JsonWriter &writer, const std::vector<std::vector<std::string>> &ids) {
+        writer.StartArray();
+        for (const std::vector<std::string> &values : ids) writer.StringArray(values);
+        writer.EndArray();
+    };
+
+    // Keys in alphabetical order
+    JsonWriter writer(output);
+    writer.StartObject();
+    writer.Key("intervalGrossContour");
+    writer.StringArray(m_intervalGrossContour);
+    writer.Key("intervalRefinedContour");
+    writer.StringArray(m_intervalRefinedContour);
+    writer.Key("intervalsChromatic");
+    writer.StringArray(m_intervalsChromatic);
+    writer.Key("intervalsDiatonic");
+    writer.StringArray(m_intervalsDiatonic);
+    writer.Key("intervalsIds");
+    writeIds(writer, m_intervalsIds);
+    writer.Key("pitchesChromatic");
+    writer.StringArray(m_pitchesChromatic);
+    writer.Key("pitchesChromaticWithDuration");
+    writer.StringArray(m_pitchesChromaticWithDuration);
+    writer.Key("pitchesDiatonic");
+    writer.StringArray(m_pitchesDiatonic);
+    writer.Key("pitchesIds");
+    writeIds(writer, m_pitchesIds);
+    writer.EndObject();
+
+    VRV_LOG_DEBUG("%s", output.c_str());
+}
+
+//----------------------------------------------------------------------------
+// FeatureCorpus
+//----------------------------------------------------------------------------
+
+FeatureCorpus::FeatureCorpus(int documentCount, int ngramLength)
+{
+    m_ngramLength = std::max(1, ngramLength);
+    m_documents.resize(std::max(0, documentCount));
+}
 
-    o << "pitchesChromaticWithDuration" << m_pitchesChromaticWithDuration;
-    o << "pitchesChromatic" << m_pitchesChromatic;
-    o << "pitchesDiatonic" << m_pitchesDiatonic;
-    o << "pitchesIds" << m_pitchesIds;
+void FeatureCorpus::SetDocument(int index, const std::string &name, const FeatureExtractor *extractor)
+{
+    FeatureDocument &document = m_documents.at(index);
+    document = FeatureDocument();
+    document.m_name = name;
+    if (!extractor) return;
 
-    o << "intervalsChromatic" << m_intervalsChromatic;
-    o << "intervalsDiatonic" << m_intervalsDiatonic;
-    o << "intervalGrossContour" << m_intervalGrossContour;
-    o << "intervalRefinedContour" << m_intervalRefinedContour;
-    o << "intervalsIds" << m_intervalsIds;
+    const int noteCount = (int)extractor->m_pitchesMIDI.size();
+    document.m_pitchesMIDI.reserve(noteCount);
+    document.m_pitchesDiatonic.reserve(noteCount);
+    for (int i = 0; i < noteCount; ++i) {
+        document.m_pitchesMIDI.push_back((uint8_t)std::clamp(extractor->m_pitchesMIDI.at(i), 0, 127));
+        document.m_pitchesDiatonic.push_back((uint8_t)std::clamp(extractor->m_pitchesDiatonicValues.at(i), 0, 255));
+    }
+
+    // The intervals are computed from the original values and not from the clamped ones
+    for (int i = 1; i < noteCount; ++i) {
+        const int chromatic = extractor->m_pitchesMIDI.at(i) - extractor->m_pitchesMIDI.at(i - 1);
+        const int diatonic = extractor->m_pitchesDiatonicValues.at(i) - extractor->m_pitchesDiatonicValues.at(i - 1);
+        document.m_intervalsChromatic.push_back((int8_t)std::clamp(chromatic, -127, 127));
+        document.m_intervalsDiatonic.push_back((int8_t)std::clamp(diatonic, -127, 127));
+    }
+
+    // FNV-1a hash of each n-gram of chromatic intervals
+    const int intervalCount = (int)document.m_intervalsChromatic.size();
+    for (int i = 0; i + m_ngramLength <= intervalCount; ++i) {
+        uint32_t hash = 2166136261u;
+        for (int j = i; j < i + m_ngramLength; ++j) {
+            hash = (hash ^ (uint8_t)document.m_intervalsChromatic.at(j)) * 16777619u;
+        }
+        document.m_ngrams.push_back(hash);
+    }
+}
+
+int FeatureCorpus::GetNoteCount() const
+{
+    int count = 0;
+    for (const FeatureDocument &document : m_documents) count += (int)document.m_pitchesMIDI.size();
+    return count;
+}
+
+int FeatureCorpus::GetIntervalCount() const
+{
+    int count = 0;
+    for (const FeatureDocument &document : m_documents) count += (int)document.m_intervalsChromatic.size();
+    return count;
+}
 
-    output = o.json();
-    LogDebug("%s", output.c_str());
+int FeatureCorpus::GetNgramCount() const
+{
+    int count = 0;
+    for (const FeatureDocument &document : m_documents) count += (int)document.m_ngrams.size();
+    return count;
+}
+
+void FeatureCorpus::ToBinary(std::string &output) const
+{
+    const uint32_t documentCount = (uint32_t)m_documents.size();
+
+    std::vector<uint32_t> notes = { 0 };
+    std::vector<uint32_t> intervals = { 0 };
+    std::vector<uint32_t> ngrams = { 0 };
+    std::vector<uint32_t> names = { 0 };
+    notes.reserve(documentCount + 1);
+    intervals.reserve(documentCount + 1);
+    ngrams.reserve(documentCount + 1);
+    names.reserve(documentCount + 1);
+    for (const FeatureDocument &document : m_documents) {
+        notes.push_back(notes.back() + (uint32_t)document.m_pitchesMIDI.size());
+        intervals.push_back(intervals.back() + (uint32_t)document.m_intervalsChromatic.size());
+        ngrams.push_back(ngrams.back() + (uint32_t)document.m_ngrams.size());
+        names.push_back(names.back() + (uint32_t)document.m_name.size());
+    }
+
+    // The magic number is "VRVF" as little-endian bytes
+    const uint32_t header[8] = { 0x46565256, 1, documentCount, notes.back(), intervals.back(), (uint32_t)m_ngramLength,
+        ngrams.back(), names.back() };
+
+    output.clear();
+    output.reserve(sizeof(header) + (4 * (documentCount + 1) + ngrams.back()) * sizeof(uint32_t)
+        + 2 * notes.back() + 2 * intervals.back() + names.back());
+
+    auto writeUInt32 = [&output](uint32_t value) {
+        for (int i = 0; i < 4; ++i) output.push_back((char)((value >> (8 * i)) & 0xFF));
+    };
+
+    for (uint32_t value : header) writeUInt32(value);
+    for (uint32_t value : notes) writeUInt32(value);
+    for (uint32_t value : intervals) writeUInt32(value);
+    for (uint32_t value : ngrams) writeUInt32(value);
+    for (uint32_t value : names) writeUInt32(value);
+    for (const FeatureDocument &document : m_documents) {
+        for (uint32_t value : document.m_ngrams) writeUInt32(value);
+    }
+    for (const FeatureDocument &document : m_documents) {
+        output.append(document.m_pitchesMIDI.begin(), document.m_pitchesMIDI.end());
+    }
+    for (const FeatureDocument &document : m_documents) {
+        output.append(document.m_pitchesDiatonic.begin(), document.m_pitchesDiatonic.end());
+    }
+    for (const FeatureDocument &document : m_documents) {
+        output.append(document.m_intervalsChromatic.begin(), document.m_intervalsChromatic.end());
+    }
+    for (const FeatureDocument &document : m_documents) {
+        output.append(document.m_intervalsDiatonic.begin(), document.m_intervalsDiatonic.end());
+    }
+    for (const FeatureDocument &document : m_documents) {
+        output += document.m_name;
+    }
 }
 
 } // namespace vrv
@@ -26,7 +26,7 @@ namespace vrv {
 
 GenericLayerElement::GenericLayerElement() : LayerElement(GENERIC_ELEMENT, "generic-")
 {
-    LogError("Creating generic element without name");
+    VRV_LOG_ERROR("Creating generic element without name");
     m_className = "[unspecified]";
     this->Reset();
 }
@@ -105,7 +105,7 @@ bool Harm::GetRootPitch(TransPitch &pitch, unsigned int &pos) const
         pitch = TransPitch(pname, accid, 4);
         return true;
     }
-    LogWarning("Failed to extract a pitch.");
+    VRV_LOG_WARNING("Failed to extract a pitch.");
     return false;
 }
 
@@ -219,7 +219,7 @@ void MeasureAligner::AdjustProportionally(const ArrayOfAdjustmentTuples &adjustm
         assert(end);
         int dist = std::get<2>(*iter);
         if (dist == 0) {
-            LogDebug("Trying to adjust alignment with a distance of 0;");
+            VRV_LOG_DEBUG("Trying to adjust alignment with a distance of 0;");
             continue;
         }
         // We need to store them because they are going to be changed in the loop below
@@ -66,16 +66,9 @@ namespace vrv {
 
 #ifndef NO_ABC_SUPPORT
 
-// Global variables:
-std::string abcLine;
-#define MAX_DATA_LEN 1024 // One line of the abc file would not be that long!
-char dataKey[MAX_DATA_LEN];
-char dataValue[MAX_DATA_LEN]; // ditto as above
-
+// Global constants:
 const std::string pitch = "FCGDAEB";
 const std::string shorthandDecoration = ".~HLMOPSTuv";
-std::string keyPitchAlter = "";
-int keyPitchAlterAmount = 0;
 
 //----------------------------------------------------------------------------
 // ABCInput
@@ -112,20 +105,20 @@ void ABCInput::ParseABC(std::istream &infile)
     Section *section = NULL;
     CreateHeader();
     while (!infile.eof()) {
-        std::getline(infile, abcLine);
+        std::getline(infile, m_abcLine);
         ++m_lineNum;
-        if (!abcLine.empty() && (abcLine.at(0) == 'X')) {
+        if (!m_abcLine.empty() && (m_abcLine.at(0) == 'X')) {
             while (!infile.eof()) {
-                if (abcLine.length() >= 3) {
-                    this->readInformationField(abcLine.at(0), abcLine.substr(2));
-                    if (abcLine.at(0) == 'K') break;
+                if (m_abcLine.length() >= 3) {
+                    this->readInformationField(m_abcLine.at(0), m_abcLine.substr(2));
+                    if (m_abcLine.at(0) == 'K') break;
                 }
-                std::getline(infile, abcLine);
+                std::getline(infile, m_abcLine);
                 ++m_lineNum;
             }
             if (infile.eof()) break;
             if (m_title.empty()) {
-                LogWarning("ABC import: Title field missing, creating empty title");
+                VRV_LOG_WARNING("ABC import: Title field missing, creating empty title");
                 m_title.push_back(std::make_pair("", 0));
             }
             // add work entry to meiHead
@@ -139,26 +132,26 @@ void ABCInput::ParseABC(std::istream &infile)
             // if m_div is not initialized - we didn't read X element, so continue until we do
             continue;
         }
-        if (abcLine.empty() || (abcLine.find_first_not_of(' ') == std::string::npos)) {
+        if (m_abcLine.empty() || (m_abcLine.find_first_not_of(' ') == std::string::npos)) {
             // abc tunes are separated from each other by empty lines
             this->FlushControlElements(score, section);
             continue;
         }
-        else if (abcLine.at(0) == '%')
+        else if (m_abcLine.at(0) == '%')
             // skipping comments and stylesheet directives
             continue;
-        else if ((abcLine.length() >= 3) && (abcLine.at(1) == ':') && (abcLine.at(0) != '|')) {
-            if (abcLine.at(0) != 'K') {
-                this->readInformationField(abcLine.at(0), abcLine.substr(2));
+        else if ((m_abcLine.length() >= 3) && (m_abcLine.at(1) == ':') && (m_abcLine.at(0) != '|')) {
+            if (m_abcLine.at(0) != 'K') {
+                this->readInformationField(m_abcLine.at(0), m_abcLine.substr(2));
             }
             else {
-                LogWarning("ABC import: Key changes not supported");
+                VRV_LOG_WARNING("ABC import: Key changes not supported");
             }
         }
         else {
             m_verseNumber = 1;
             m_lineNoteArray.clear();
-            this->readMusicCode(abcLine, section);
+            this->readMusicCode(m_abcLine, section);
         }
     }
 
@@ -442,7 +435,7 @@ void ABCInput::AddOrnaments(LayerElement *element)
 void ABCInput::AddTie()
 {
     if (!m_tieStack.empty()) {
-        LogWarning("ABC import: '%s' already tied", m_ID.c_str());
+        VRV_LOG_WARNING("ABC import: '%s' already tied", m_ID.c_str());
         return;
     }
     if (!m_ID.empty()) {
@@ -464,7 +457,7 @@ void ABCInput::EndSlur()
 {
     if (!m_slurStack.empty()) {
         if (!m_slurStack.back()->HasStartid()) {
-            LogError("ABC import: Empty slur found");
+            VRV_LOG_ERROR("ABC import: Empty slur found");
             m_slurStack.pop_back();
             return;
         }
@@ -477,14 +470,14 @@ void ABCInput::EndSlur()
         }
         return;
     }
-    LogWarning("ABC import: Closing slur for element '%s' could not be matched", m_ID.c_str());
+    VRV_LOG_WARNING("ABC import: Closing slur for element '%s' could not be matched", m_ID.c_str());
 }
 
 void ABCInput::parseDecoration(const std::string &decorationString)
 {
     // shorthand decorations hard-coded !
     if (isdigit(decorationString[0])) {
-        LogWarning("ABC import: Fingering not supported", decorationString.c_str());
+        VRV_LOG_WARNING("ABC import: Fingering not supported", decorationString.c_str());
         return;
     }
     if (!strcmp(decorationString.c_str(), ".")) {
@@ -552,7 +545,7 @@ void ABCInput::parseDecoration(const std::string &decorationString)
         m_dynam.push_back(decorationString);
     }
     else {
-        LogWarning("ABC import: Decoration %s not supported", decorationString.c_str());
+        VRV_LOG_WARNING("ABC import: Decoration %s not supported", decorationString.c_str());
     }
 }
 
@@ -564,7 +557,7 @@ void ABCInput::parseDecoration(const std::string &decorationString)
 void ABCInput::parseInstruction(const std::string &instruction)
 {
     if (!strncmp(instruction.c_str(), "abc-include", 11)) {
-        LogWarning("ABC import: Include field is ignored");
+        VRV_LOG_WARNING("ABC import: Include field is ignored");
     }
     else if (!strncmp(instruction.c_str(), "linebreak", 9)) {
         if (instruction.find("<none>") != std::string::npos) {
@@ -574,7 +567,7 @@ void ABCInput::parseInstruction(const std::string &instruction)
         else {
             m_linebreak = '$';
             m_layoutInformation = LAYOUT_ENCODED;
-            LogWarning("ABC import: Default linebreaks are used for now.");
+            VRV_LOG_WARNING("ABC import: Default linebreaks are used for now.");
         }
     }
     else if (!strncmp(instruction.c_str(), "decoration", 10)) {
@@ -677,16 +670,16 @@ void ABCInput::parseKey(std::string &keyString)
         if (accidNum < 0) {
             keySig = StringFormat("%df", abs(accidNum));
             posStart = pitch.size() - posEnd;
-            keyPitchAlterAmount = -1;
+            m_keyPitchAlterAmount = -1;
         }
         else {
             keySig = StringFormat("%ds", accidNum);
-            keyPitchAlterAmount = 1;
+            m_keyPitchAlterAmount = 1;
         }
 
         // m_doc->m_scoreDef.SetSig(keySig);
         m_key->SetSig(m_key->AttKeySigLog::StrToKeysignature(keySig));
-        keyPitchAlter = pitch.substr(posStart, posEnd);
+        m_keyPitchAlter = pitch.substr(posStart, posEnd);
     }
 
     // set clef
@@ -710,7 +703,7 @@ void ABCInput::parseKey(std::string &keyString)
         m_clef->SetLine(4);
     }
     else if (keyString.find("perc") != std::string::npos) {
-        LogWarning("ABC Input: Drum clef is not supported");
+        VRV_LOG_WARNING("ABC Input: Drum clef is not supported");
     }
     else if (keyString.find("none") != std::string::npos) {
         i += 4;
@@ -802,7 +795,7 @@ void ABCInput::parseTempo(const std::string &tempoString)
     // this has to be fixed
     tempo->SetTstamp(1);
     m_tempoStack.push_back(tempo);
-    LogWarning("ABC import: Tempo definitions are not fully supported yet");
+    VRV_LOG_WARNING("ABC import: Tempo definitions are not fully supported yet");
 }
 
 void ABCInput::parseReferenceNumber(const std::string &referenceNumberString)
@@ -813,7 +806,7 @@ void ABCInput::parseReferenceNumber(const std::string &referenceNumberString)
     if (!referenceNumberString.empty()) {
         const int mdivNum = atoi(referenceNumberString.c_str());
         if (mdivNum < 1) {
-            LogError("ABC import: reference number should be a positive integer");
+            VRV_LOG_ERROR("ABC import: reference number should be a positive integer");
         }
         m_mdiv->SetN(std::to_string(mdivNum));
     }
@@ -981,7 +974,7 @@ void ABCInput::FlushControlElements(Score *score, Section *section)
             layer = dynamic_cast<Layer *>(section->FindDescendantByID(iter->first));
         }
         if (!layer) {
-            LogWarning("ABC import: Element '%s' could not be assigned to layer '%s'",
+            VRV_LOG_WARNING("ABC import: Element '%s' could not be assigned to layer '%s'",
                 iter->second->GetClassName().c_str(), iter->first.c_str());
             delete iter->second;
             iter->second = NULL;
@@ -1054,36 +1047,36 @@ void ABCInput::parseLyrics()
     constexpr std::string_view delimiters = "~\\-_ ";
     // skipping w:, so start from third element
     std::size_t start = 2;
-    std::size_t found = abcLine.find_first_of(delimiters, 2);
+    std::size_t found = m_abcLine.find_first_of(delimiters, 2);
     while (found != std::string::npos) {
         // Counter indicates for how many notes verse should be held. This defaults to 1, unless '_' is found
         int counter = 1;
         std::string syllable = "";
         sylLog_CON sylType = sylLog_CON_NONE;
-        if (abcLine.at(found) == '_') {
-            while ((found < abcLine.size()) && (abcLine.at(found) == '_')) {
+        if (m_abcLine.at(found) == '_') {
+            while ((found < m_abcLine.size()) && (m_abcLine.at(found) == '_')) {
                 ++counter;
                 ++found;
             }
             --found;
             sylType = sylLog_CON_u;
         }
-        else if (abcLine.at(found) == '~') {
+        else if (m_abcLine.at(found) == '~') {
             counter = 0;
             sylType = sylLog_CON_s;
         }
-        else if (abcLine.at(found) == '-') {
+        else if (m_abcLine.at(found) == '-') {
             sylType = sylLog_CON_d;
         }
-        else if (abcLine.at(found) == '\\') {
-            if ((found + 1 < abcLine.size()) && (abcLine.at(found + 1) == '-')) {
+        else if (m_abcLine.at(found) == '\\') {
+            if ((found + 1 < m_abcLine.size()) && (m_abcLine.at(found + 1) == '-')) {
                 counter = 0;
                 ++found;
                 sylType = sylLog_CON_d;
             }
         }
         // separate syllable from delimiters to form syl that we want to add
-        syllable = abcLine.substr(start, found - start);
+        syllable = m_abcLine.substr(start, found - start);
         syllable.erase(
             std::remove_if(syllable.begin(), syllable.end(), [](unsigned char x) { return (x == '_') || (x == '\\'); }),
             syllable.end());
@@ -1101,10 +1094,10 @@ void ABCInput::parseLyrics()
 
         // find next delimeter in the string
         start = found + 1;
-        found = abcLine.find_first_of(delimiters, start);
+        found = m_abcLine.find_first_of(delimiters, start);
         // if none found, the rest of the string is going to serve as last syl
-        if ((found == std::string::npos) && (start < abcLine.size())) {
-            std::string syllable = abcLine.substr(start);
+        if ((found == std::string::npos) && (start < m_abcLine.size())) {
+            std::string syllable = m_abcLine.substr(start);
             if (!syllable.empty() && syllable[syllable.size() - 1] == '\r') syllable.erase(syllable.size() - 1);
             Text *sylText = new Text();
             sylText->SetText(UTF8to32(syllable));
@@ -1162,7 +1155,7 @@ void ABCInput::readInformationField(const char &dataKey, std::string value)
     while (isspace(value[0])) value = value.substr(1);
 
     if (dataKey == '+') {
-        LogWarning("ABC import: Field continuation (+) is not supported");
+        VRV_LOG_WARNING("ABC import: Field continuation (+) is not supported");
         return;
     }
 
@@ -1181,13 +1174,13 @@ void ABCInput::readInformationField(const char &dataKey, std::string value)
         case 'Q': parseTempo(value); break;
         case 'S': m_info.push_back(std::make_pair(std::make_pair(value, m_lineNum), dataKey)); break;
         case 'T': m_title.push_back(std::make_pair(value, m_lineNum)); break;
-        case 'U': LogWarning("ABC import: User defined sympols are not supported"); break;
-        case 'V': LogWarning("ABC import: Multi-voice music is not supported"); break;
+        case 'U': VRV_LOG_WARNING("ABC import: User defined sympols are not supported"); break;
+        case 'V': VRV_LOG_WARNING("ABC import: Multi-voice music is not supported"); break;
         case 'w': parseLyrics(); break;
-        case 'W': LogWarning("ABC import: Lyrics are not supported yet"); break;
+        case 'W': VRV_LOG_WARNING("ABC import: Lyrics are not supported yet"); break;
         case 'X': parseReferenceNumber(value); break;
         case 'Z': m_info.push_back(std::make_pair(std::make_pair(value, m_lineNum), dataKey)); break;
-        default: LogWarning("ABC import: Information field %c is ignored", dataKey);
+        default: VRV_LOG_WARNING("ABC import: Information field %c is ignored", dataKey);
     }
 }
 
@@ -1378,13 +1371,13 @@ void ABCInput::readMusicCode(const std::string &musicCode, Section *section)
                 }
             }
 
-            if (keyPitchAlter.find(static_cast<char>(toupper(musicCode.at(i)))) != std::string::npos) {
+            if (m_keyPitchAlter.find(static_cast<char>(toupper(musicCode.at(i)))) != std::string::npos) {
                 auto accid = vrv_cast<Accid *>(note->GetFirst(ACCID));
                 if (!accid) {
                     accid = new Accid();
                     note->AddChild(accid);
                     accid->IsAttribute(true);
-                    accid->SetAccidGes((keyPitchAlterAmount < 0) ? ACCIDENTAL_GESTURAL_f : ACCIDENTAL_GESTURAL_s);
+                    accid->SetAccidGes((m_keyPitchAlterAmount < 0) ? ACCIDENTAL_GESTURAL_f : ACCIDENTAL_GESTURAL_s);
                 }
             }
 
@@ -1445,7 +1438,7 @@ void ABCInput::readMusicCode(const std::string &musicCode, Section *section)
                 // won't work for num > 12
                 num = num - num / 3;
             }
-            if ((numbase & (numbase - 1)) != 0) LogError("ABC import: note length divider must be power of 2");
+            if ((numbase & (numbase - 1)) != 0) VRV_LOG_ERROR("ABC import: note length divider must be power of 2");
             int dur = (num == 0) ? 4 : m_unitDur * numbase / num;
 
             // set grace
@@ -1573,7 +1566,7 @@ void ABCInput::readMusicCode(const std::string &musicCode, Section *section)
                 // won't work for num > 12
                 num = num - num / 3;
             }
-            if ((numbase & (numbase - 1)) != 0) LogError("ABC import: note length divider must be power of 2");
+            if ((numbase & (numbase - 1)) != 0) VRV_LOG_ERROR("ABC import: note length divider must be power of 2");
             int dur = m_unitDur * numbase / num;
 
             if (m_broken < 0) {
@@ -1596,7 +1589,7 @@ void ABCInput::readMusicCode(const std::string &musicCode, Section *section)
         // padding
         else if (musicCode.at(i) == 'y') {
             // Pad *pad = new Pad;
-            LogWarning("ABC import: Extra space not supported");
+            VRV_LOG_WARNING("ABC import: Extra space not supported");
         }
 
         // rests
@@ -1650,7 +1643,7 @@ void ABCInput::readMusicCode(const std::string &musicCode, Section *section)
                 // won't work for num > 12
                 num = num - num / 3;
             }
-            if ((numbase & (numbase - 1)) != 0) LogError("ABC import: note length divider must be power of 2");
+            if ((numbase & (numbase - 1)) != 0) VRV_LOG_ERROR("ABC import: note length divider must be power of 2");
             int dur = m_unitDur * numbase / num;
 
             if (m_broken < 0) {
@@ -1687,7 +1680,7 @@ void ABCInput::readMusicCode(const std::string &musicCode, Section *section)
             ++i;
             if (musicCode.at(i) == '^' || musicCode.at(i) == '_' || musicCode.at(i) == '<' || musicCode.at(i) == '>'
                 || musicCode.at(i) == '@') {
-                LogWarning("ABC import: Annotations are not fully support yet");
+                VRV_LOG_WARNING("ABC import: Annotations are not fully support yet");
                 ++i;
             }
             std::string chordSymbol;
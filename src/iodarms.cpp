@@ -166,7 +166,7 @@ int DarmsInput::parseMeter(int pos, const char *data)
     else if (data[pos] == 'O') {
         if (data[pos + 1] == '/') {
             pos++;
-            LogWarning("DARMS import: O/ not supported");
+            VRV_LOG_WARNING("DARMS import: O/ not supported");
         }
         meter->SetSign(MENSURATIONSIGN_O);
         pos++;
@@ -190,7 +190,7 @@ int DarmsInput::parseMeter(int pos, const char *data)
         }
         else {
             pos++;
-            if (data[pos] == '-') LogWarning("DARMS import: Time signature numbers should be divided with ':'.");
+            if (data[pos] == '-') VRV_LOG_WARNING("DARMS import: Time signature numbers should be divided with ':'.");
             // same as above, get one or two nums
             n1 = data[++pos] - ASCII_NUMBER_OFFSET; // old school conversion to int
             if (isdigit(data[pos + 1])) {
@@ -200,7 +200,7 @@ int DarmsInput::parseMeter(int pos, const char *data)
 
             meter->SetNumbase(n1);
         }
-        LogDebug("DARMS import: Meter is: %i %i", meter->GetNumbase(), meter->GetNumbase());
+        VRV_LOG_DEBUG("DARMS import: Meter is: %i %i", meter->GetNumbase(), meter->GetNumbase());
     }
 
     m_layer->AddChild(meter);
@@ -219,7 +219,7 @@ int DarmsInput::do_globalSpec(int pos, const char *data)
         case 'I': // Voice nr.
             // the next digit should be a number, but we do not care what
             if (!isdigit(data[++pos])) {
-                LogWarning("DARMS import: Expected number after 'I'");
+                VRV_LOG_WARNING("DARMS import: Expected number after 'I'");
             }
             break;
 
@@ -234,7 +234,7 @@ int DarmsInput::do_globalSpec(int pos, const char *data)
                 UnrollKeysig(quantity, data[pos]);
             }
             else {
-                LogWarning("DARMS import: Invalid char for 'K': %c", data[pos]);
+                VRV_LOG_WARNING("DARMS import: Invalid char for 'K': %c", data[pos]);
             }
             break;
 
@@ -255,7 +255,7 @@ int DarmsInput::do_globalSpec(int pos, const char *data)
              NR	rest in place of notehead
              */
             if (!isdigit(data[++pos]) && data[++pos] != 'R') {
-                LogWarning("DARMS import: Expected number or 'R' after N");
+                VRV_LOG_WARNING("DARMS import: Expected number or 'R' after N");
             }
             else { // we honor only notehead 7, diamond
                 if (data[pos] == 0x07 + ASCII_NUMBER_OFFSET) m_antique_notation = true;
@@ -283,7 +283,7 @@ int DarmsInput::do_Clef(int pos, const char *data)
             case 3: mclef->SetLine(2); break;
             case 5: mclef->SetLine(3); break;
             case 7: mclef->SetLine(4); break;
-            default: LogWarning("DARMS import: Invalid C clef on line %i", position); break;
+            default: VRV_LOG_WARNING("DARMS import: Invalid C clef on line %i", position); break;
         }
         m_clef_offset = 21 - position; // 21 is the position in the array, position is of the clef
     }
@@ -292,7 +292,7 @@ int DarmsInput::do_Clef(int pos, const char *data)
         switch (position) {
             case 1: mclef->SetLine(1); break;
             case 3: mclef->SetLine(2); break;
-            default: LogWarning("DARMS import: Invalid G clef on line %i", position); break;
+            default: VRV_LOG_WARNING("DARMS import: Invalid G clef on line %i", position); break;
         }
         m_clef_offset = 25 - position;
     }
@@ -305,13 +305,13 @@ int DarmsInput::do_Clef(int pos, const char *data)
                 ;
                 break;
             case 7: mclef->SetLine(5); break;
-            default: LogWarning("DARMS import: Invalid F clef on line %i", position); break;
+            default: VRV_LOG_WARNING("DARMS import: Invalid F clef on line %i", position); break;
         }
         m_clef_offset = 15 - position;
     }
     else {
         // what the...
-        LogWarning("DARMS import: Invalid clef specification: %c", data[pos]);
+        VRV_LOG_WARNING("DARMS import: Invalid clef specification: %c", data[pos]);
         // avoiding memory leak
         delete mclef;
         return 0; // fail
@@ -385,7 +385,7 @@ int DarmsInput::do_Note(int pos, const char *data, bool rest)
         case 'Y': duration = DURATION_128; break;
         case 'Z': duration = DURATION_256; break;
 
-        default: LogWarning("DARMS import: Unknown note duration: %c", data[pos]); return 0;
+        default: VRV_LOG_WARNING("DARMS import: Unknown note duration: %c", data[pos]); return 0;
     }
 
     if (data[pos + 1] == '.') {
@@ -487,7 +487,7 @@ bool DarmsInput::Import(const std::string &data_str)
         char c = data[pos];
 
         if (c == '!') {
-            LogDebug("DARMS import: Global spec. at %i", pos);
+            VRV_LOG_DEBUG("DARMS import: Global spec. at %i", pos);
             res = do_globalSpec(pos, data);
             if (res) pos = res;
             // if notehead type was specified in the !Nx option preserve it
@@ -543,6 +543,102 @@ namespace humaux {
         return out;
     }
 
+    /////////////////////////////////////////////////////////////////////
+
+    //////////////////////////////
+    //
+    // runInPlaceTool -- Run a tool that only adds or removes signifiers in
+    //     the tokens of the file.  Its text output, if any, is the file
+    //     itself, so it is not read again.
+    //
+
+    template <class TOOL> static bool runInPlaceTool(const std::string &options, hum::HumdrumFile &infile)
+    {
+        TOOL tool;
+        tool.process(options);
+        tool.run(infile);
+        if (tool.hasError()) {
+            tool.getError(std::cerr);
+            return false;
+        }
+        return true;
+    }
+
+    //////////////////////////////
+    //
+    // runRewritingTool -- Run a tool that outputs a new file, which is
+    //     parsed again in place of the input.
+    //
+
+    template <class TOOL> static bool runRewritingTool(const std::string &options, hum::HumdrumFile &infile)
+    {
+        TOOL tool;
+        tool.process(options);
+        tool.run(infile);
+        if (tool.hasError()) {
+            tool.getError(std::cerr);
+            return false;
+        }
+        if (tool.hasHumdrumText()) {
+            infile.readString(tool.getHumdrumText());
+        }
+        return true;
+    }
+
+    //////////////////////////////
+    //
+    // HumdrumFilter::s_pipelineTools -- The tools that runInPlace() can run.
+    //     Tools that analyze the file before editing its tokens (such as tie)
+    //     are run as rewriting tools, since their analyses would otherwise
+    //     not be updated.
+    //
+
+    const std::map<std::string, HumdrumFilter::PipelineTool> HumdrumFilter::s_pipelineTools = {
+        { "autoaccid", &runInPlaceTool<hum::Tool_autoaccid> }, //
+        { "autobeam", &runInPlaceTool<hum::Tool_autobeam> }, //
+        { "autostem", &runInPlaceTool<hum::Tool_autostem> }, //
+        { "extract", &runRewritingTool<hum::Tool_extract> }, //
+        { "humtr", &runInPlaceTool<hum::Tool_humtr> }, //
+        { "kernify", &runRewritingTool<hum::Tool_kernify> }, //
+        { "myank", &runRewritingTool<hum::Tool_myank> }, //
+        { "restfill", &runInPlaceTool<hum::Tool_restfill> }, //
+        { "rid", &runRewritingTool<hum::Tool_rid> }, //
+        { "satb2gs", &runRewritingTool<hum::Tool_satb2gs> }, //
+        { "tie", &runRewritingTool<hum::Tool_tie> }, //
+        { "transpose", &runRewritingTool<hum::Tool_transpose> }, //
+        { "trillspell", &runInPlaceTool<hum::Tool_trillspell> } //
+    };
+
+    //////////////////////////////
+    //
+    // HumdrumFilter::runInPlace -- Run the global filters of the file when
+    //     all the tools of the pipeline are known.  Return false without
+    //     changing the file otherwise, in which case the pipeline has to be
+    //     run with hum::Tool_filter::run().
+    //
+
+    bool HumdrumFilter::runInPlace(hum::HumdrumFile &infile)
+    {
+        initialize(infile);
+        std::vector<std::pair<std::string, std::string>> commands;
+        getCommandList(commands, infile);
+        for (auto &command : commands) {
+            if (s_pipelineTools.count(command.first) == 0) {
+                return false;
+            }
+        }
+
+        for (auto &command : commands) {
+            if (!s_pipelineTools.at(command.first)(command.second, infile)) {
+                break;
+            }
+        }
+
+        removeGlobalFilterLines(infile);
+        infile.createLinesFromTokens();
+        return true;
+    }
+
 } // end namespace humaux
 
 #endif /* NO_HUMDRUM_SUPPORT */
@@ -660,7 +756,7 @@ bool HumdrumInput::Import(const std::string &content)
         return result;
     }
     catch (char *str) {
-        LogError("%s", str);
+        VRV_LOG_ERROR("%s", str);
         return false;
     }
 
@@ -715,9 +811,12 @@ bool HumdrumInput::convertHumdrum()
     }
 
     // Apply Humdrum tools if there are any filters in the file.
-    hum::Tool_filter filter;
+    humaux::HumdrumFilter filter;
     for (int i = 0; i < m_infiles.getCount(); ++i) {
         if (m_infiles[i].hasGlobalFilters()) {
+            if (filter.runInPlace(m_infiles[i])) {
+                continue;
+            }
             filter.run(m_infiles[i]);
             if (filter.hasHumdrumText()) {
                 m_infiles[i].readString(filter.getHumdrumText());
@@ -729,7 +828,8 @@ bool HumdrumInput::convertHumdrum()
     }
 
     // Apply Humdrum tools to the entire set if they are
-    // at the universal level.
+    // at the universal level.  These tools select or combine
+    // files, so their output is parsed again.
     if (m_infiles.hasUniversalFilters()) {
         filter.runUniversal(m_infiles);
         if (filter.hasHumdrumText()) {
@@ -737,7 +837,8 @@ bool HumdrumInput::convertHumdrum()
         }
     }
 
-    // Kernify files if they have no stafflike spine.
+    // Kernify files if they have no stafflike spine.  This adds
+    // a spine, so the output is parsed again.
     hum::Tool_kernify kernify;
     for (int i = 0; i < m_infiles.getCount(); ++i) {
         if (hasNoStaves(m_infiles[i])) {
@@ -2011,7 +2112,7 @@ void HumdrumInput::processHangingTieStart(humaux::HumdrumTie &tieinfo)
     int subindex = tieinfo.getStartSubindex();
     Measure *measure = tieinfo.getStartMeasure();
     if (measure == NULL) {
-        LogWarning("In HumdrumInput::processHangingTieStart: Start measure is NULL");
+        VRV_LOG_WARNING("In HumdrumInput::processHangingTieStart: Start measure is NULL");
         return;
     }
     // int metercount = tieinfo.getMeterTop();
@@ -2670,7 +2771,7 @@ void HumdrumInput::parseEmbeddedOptions(Doc *doc)
             if (value.empty()) {
                 std::stringstream warning;
                 warning << "In HumdrumInput::parseEmbeddedOptions: value is empty for parameter " << key;
-                LogWarning(warning.str().c_str());
+                VRV_LOG_WARNING(warning.str().c_str());
                 continue;
             }
             inputparameters[pkey] = pvalue;
@@ -2691,7 +2792,7 @@ void HumdrumInput::parseEmbeddedOptions(Doc *doc)
                 if (value.empty()) {
                     std::stringstream warning;
                     warning << "In HumdrumInput::parseEmbeddedOptions: Value is empty for parameter " << key;
-                    LogWarning(warning.str().c_str());
+                    VRV_LOG_WARNING(warning.str().c_str());
                     continue;
                 }
                 inputparameters[pkey] = pvalue;
@@ -2707,7 +2808,7 @@ void HumdrumInput::parseEmbeddedOptions(Doc *doc)
             std::stringstream warning;
             warning << "In HumdrumInput::parseEmbeddedOptions: option ";
             warning << inputoption.first << " is not recognized";
-            LogWarning(warning.str().c_str());
+            VRV_LOG_WARNING(warning.str().c_str());
             continue;
         }
 
@@ -4964,10 +5065,10 @@ void HumdrumInput::createHumdrumVerbatimExtMeta(pugi::xml_node meiHead)
         std::stringstream warning;
         warning << "In HumdrumInput::createHumdrumVerbatimExtMeta: ExtMeta parse error: ";
         warning << result.description();
-        LogWarning(warning.str().c_str());
+        VRV_LOG_WARNING(warning.str().c_str());
         std::stringstream warning2;
         warning2 << "   xmldata string is: " << xmldata.str();
-        LogWarning(warning2.str().c_str());
+        VRV_LOG_WARNING(warning2.str().c_str());
         return;
     }
 
@@ -6297,11 +6398,11 @@ bool HumdrumInput::processStaffDecoration(const std::string &decoration)
     if (!validQ) {
         std::stringstream warning;
         warning << "In HumdrumInput::processStaffDecoration: Decoration is invalid: " << decoration;
-        LogWarning(warning.str().c_str());
+        VRV_LOG_WARNING(warning.str().c_str());
         if (d != decoration) {
             std::stringstream warning;
             warning << "In HumdrumInput::processStaffDecoration: Staff version: " << d;
-            LogWarning(warning.str().c_str());
+            VRV_LOG_WARNING(warning.str().c_str());
         }
         StaffGrp *sg = new StaffGrp();
         setGroupSymbol(sg, staffGroupingSym_SYMBOL_bracket);
@@ -6885,7 +6986,7 @@ bool HumdrumInput::prepareFooter(
     Doc tempdoc;
     MEIInput input(&tempdoc);
     if (!input.Import(meifile)) {
-        LogError("Error importing data");
+        VRV_LOG_ERROR("Error importing data");
         return false;
     }
 
@@ -6906,7 +7007,7 @@ bool HumdrumInput::prepareFooter(
     }
     Object *detached = pgfoot->GetParent()->DetachChild(index);
     if (detached != pgfoot) {
-        LogWarning("In HumdrumInput::prepareFooter: Detached element is not the pgHead.");
+        VRV_LOG_WARNING("In HumdrumInput::prepareFooter: Detached element is not the pgHead.");
         if (detached) {
             delete detached;
         }
@@ -6927,7 +7028,7 @@ bool HumdrumInput::prepareFooter(
     }
     detached = pgfoot2->GetParent()->DetachChild(index);
     if (detached != pgfoot2) {
-        LogWarning("In HumdrumInput::prepareFooter: Detached element is not a pgFoot element");
+        VRV_LOG_WARNING("In HumdrumInput::prepareFooter: Detached element is not a pgFoot element");
         if (detached) {
             delete detached;
         }
@@ -7061,7 +7162,7 @@ bool HumdrumInput::prepareHeader(
     Doc tempdoc;
     MEIInput input(&tempdoc);
     if (!input.Import(meifile)) {
-        LogError("Error importing data");
+        VRV_LOG_ERROR("Error importing data");
         return false;
     }
 
@@ -7081,7 +7182,7 @@ bool HumdrumInput::prepareHeader(
     }
     Object *detached = pghead->GetParent()->DetachChild(index);
     if (detached != pghead) {
-        LogWarning("In HumdrumInput::prepareHeader: Detached element is not the pgHead");
+        VRV_LOG_WARNING("In HumdrumInput::prepareHeader: Detached element is not the pgHead");
         if (detached) {
             delete detached;
         }
@@ -8087,234 +8188,233 @@ bool HumdrumInput::isBlackNotation(hum::HTp starting)
 std::string HumdrumInput::getLabelFromInstrumentCode(hum::HTp icode, const std::string &transpose)
 {
 
-    static std::map<std::string, std::string> codeToLabel;
-    if (codeToLabel.empty()) {
-        codeToLabel["piano"] = "Piano";
-        codeToLabel["accor"] = "Accordion";
-        codeToLabel["alto"] = "Alto";
-        codeToLabel["anvil"] = "Anvil";
-        codeToLabel["archl"] = "Archlute";
-        codeToLabel["armon"] = "Harmonic";
-        codeToLabel["arpa"] = "Harp";
-        codeToLabel["bagpI"] = "Irish bagpipe";
-        codeToLabel["bagpS"] = "Scottish bagpipe";
-        codeToLabel["banjo"] = "Banjo";
-        codeToLabel["bansu"] = "Bansuri";
-        codeToLabel["barit"] = "Baritone";
-        codeToLabel["mbari"] = "High baritone";
-        codeToLabel["baset"] = "Bassett horn";
-        codeToLabel["bass"] = "Bass";
-        codeToLabel["bdrum"] = "Bass drum";
-        codeToLabel["bongo"] = "Bongo";
-        codeToLabel["bguit"] = "Bass guitar";
-        codeToLabel["biwa"] = "Biwa";
-        codeToLabel["bscan"] = "Singing bass";
-        codeToLabel["bspro"] = "Basso profondo";
-        codeToLabel["brush"] = "Brush";
-        codeToLabel["calam"] = "Chalumeau";
-        codeToLabel["calpe"] = "Calliope";
-        codeToLabel["calto"] = "Contralto";
-        codeToLabel["campn"] = "Bells";
-        codeToLabel["cangl"] = "English horn";
-        codeToLabel["canto"] = "Canto";
-        codeToLabel["caril"] = "Carillon";
-        codeToLabel["castr"] = "Castrato";
-        codeToLabel["casts"] = "Castanets";
-        codeToLabel["cbass"] = "Contrabass";
-        codeToLabel["cello"] = "Violoncello";
-        codeToLabel["cemba"] = "Harpsichord";
-        codeToLabel["cetra"] = "Cittern";
-        codeToLabel["chain"] = "Chain";
-        codeToLabel["chime"] = "Tubular bells";
-        codeToLabel["chcym"] = "China cymbal";
-        codeToLabel["chlma"] = "Soprano shawm";
-        codeToLabel["chlmt"] = "Tenor shawm";
-        codeToLabel["clap"] = "Hand clap";
-        codeToLabel["clara"] = "Alto Clarinet";
-        codeToLabel["clarb"] = "Bass Clarinet";
-        codeToLabel["claro"] = "Sopranino clarinet";
-        codeToLabel["clarp"] = "Piccolo clarinet";
-        codeToLabel["clars"] = "Clarinet";
-        codeToLabel["clave"] = "Claves";
-        codeToLabel["clavi"] = "Clavichord";
-        codeToLabel["clest"] = "Celesta";
-        codeToLabel["clrno"] = "Clarino";
-        codeToLabel["colsp"] = "Coloratura soprano";
-        codeToLabel["conga"] = "Conga";
-        codeToLabel["cor"] = "Horn";
-        codeToLabel["cornm"] = "Cornemuse";
-        codeToLabel["corno"] = "Cornett";
-        codeToLabel["cornt"] = "Cornet";
-        codeToLabel["coro"] = "Chorus";
-        codeToLabel["crshc"] = "Crash cymbal";
-        codeToLabel["ctenor"] = "Contratenor";
-        codeToLabel["ctina"] = "concertina";
-        codeToLabel["drmsp"] = "Dramatic soprano";
-        codeToLabel["drum"] = "Drum";
-        codeToLabel["drumP"] = "Small drum";
-        codeToLabel["dulc"] = "Dulcimer";
-        codeToLabel["eguit"] = "Electric guitar";
-        codeToLabel["fag_c"] = "Contrabassoon";
-        codeToLabel["fagot"] = "Bassoon";
-        codeToLabel["false"] = "Falsetto";
-        codeToLabel["feme"] = "Female voice";
-        codeToLabel["fife"] = "Fife";
-        codeToLabel["fingc"] = "Finger Cymbals";
-        codeToLabel["flex"] = "Flexatone";
-        codeToLabel["flt"] = "Flute";
-        codeToLabel["flt_a"] = "Alto flute";
-        codeToLabel["flt_b"] = "Bass flute";
-        codeToLabel["fltda"] = "Alto recorder";
-        codeToLabel["fltdb"] = "Bass recorder";
-        codeToLabel["fltdn"] = "Sopranino recorder";
-        codeToLabel["fltds"] = "Soprano recorder";
-        codeToLabel["fltdt"] = "Tenor recorder";
-        codeToLabel["flugh"] = "Flugelhorn";
-        codeToLabel["forte"] = "Fortepiano";
-        codeToLabel["glock"] = "Glockenspiel";
-        codeToLabel["gen"] = "Generic instrument";
-        codeToLabel["genT"] = "Generic treble instrument";
-        codeToLabel["genB"] = "Generic bass instrument";
-        codeToLabel["gong"] = "Gong";
-        codeToLabel["guitr"] = "Guitar";
-        codeToLabel["hammd"] = "Hammond eletronic organ";
-        codeToLabel["hbell"] = "Hand bells";
-        codeToLabel["heck"] = "Heckelphone";
-        codeToLabel["heltn"] = "Heroic tenor";
-        codeToLabel["hichi"] = "Hichiriki";
-        codeToLabel["hurdy"] = "Hurdy-gurdy";
-        codeToLabel["kitv"] = "Kit violin";
-        codeToLabel["klav"] = "Generic keyboard";
-        codeToLabel["kokyu"] = "Kokyu";
-        codeToLabel["komun"] = "Koumngo";
-        codeToLabel["koto"] = "Koto";
-        codeToLabel["kruma"] = "Alto crumhorn";
-        codeToLabel["krumb"] = "Bass crumhorn";
-        codeToLabel["krums"] = "Crumhorn";
-        codeToLabel["krumt"] = "Tenor crumhorn";
-        codeToLabel["lion"] = "Lion's roar";
-        codeToLabel["liuto"] = "Lute";
-        codeToLabel["lyrsp"] = "Lyric soprano";
-        codeToLabel["lyrtn"] = "Lyric tenor";
-        codeToLabel["male"] = "Male voice";
-        codeToLabel["mando"] = "Mandolin";
-        codeToLabel["marac"] = "Maracas";
-        codeToLabel["marim"] = "Marimba";
-        codeToLabel["mezzo"] = "Mezzo soprano";
-        codeToLabel["nfant"] = "Child's voice";
-        codeToLabel["nokan"] = "Nokan";
-        codeToLabel["oboe"] = "Oboe";
-        codeToLabel["oboeD"] = "Oboe d'amore";
-        codeToLabel["ocari"] = "Ocarina";
-        codeToLabel["ondes"] = "Ondes Martenot";
-        codeToLabel["ophic"] = "Ophicleide";
-        codeToLabel["organ"] = "Organ";
-        codeToLabel["oud"] = "Oud";
-        codeToLabel["panpi"] = "Panpipes";
-        codeToLabel["paila"] = "Timbales";
-        codeToLabel["pbell"] = "Bell plate";
-        codeToLabel["pguit"] = "Portuguese guitar";
-        codeToLabel["physh"] = "Physharmonica";
-        codeToLabel["piano"] = "Piano";
-        codeToLabel["piatt"] = "Cymbales";
-        codeToLabel["picco"] = "Piccolo";
-        codeToLabel["pipa"] = "Pipa";
-        codeToLabel["piri"] = "Piri";
-        codeToLabel["porta"] = "Portative organ";
-        codeToLabel["psalt"] = "Psaltery";
-        codeToLabel["qin"] = "Qin";
-        codeToLabel["quinto"] = "Quinto";
-        codeToLabel["quitr"] = "Gittern";
-        codeToLabel["rackt"] = "Rackett";
-        codeToLabel["ratch"] = "Ratchet";
-        codeToLabel["ratl"] = "Rattle";
-        codeToLabel["rebec"] = "Rebec";
-        codeToLabel["recit"] = "Recitativo";
-        codeToLabel["reedo"] = "Reed organ";
-        codeToLabel["rhode"] = "Rhodes piano";
-        codeToLabel["ridec"] = "Ride cymbal";
-        codeToLabel["sarod"] = "Sarod";
-        codeToLabel["sarus"] = "Sarrusophone";
-        codeToLabel["saxA"] = "Alto saxophone";
-        codeToLabel["saxB"] = "Bass saxophone";
-        codeToLabel["saxN"] = "Sopranino saxophone";
-        codeToLabel["saxR"] = "Baritone saxophone";
-        codeToLabel["saxS"] = "Saxophone";
-        codeToLabel["saxT"] = "Tenor saxophone";
-        codeToLabel["sbell"] = "Sleigh bells";
-        codeToLabel["sdrum"] = "Snare drum";
-        codeToLabel["serp"] = "Serpent";
-        codeToLabel["sesto"] = "Sesto";
-        codeToLabel["shaku"] = "Shakuhachi";
-        codeToLabel["shami"] = "Shamisen";
-        codeToLabel["sheng"] = "Sheng";
-        codeToLabel["sho"] = "Sho";
-        codeToLabel["siren"] = "Siren";
-        codeToLabel["sitar"] = "Sitar";
-        codeToLabel["slap"] = "Slapstick";
-        codeToLabel["soprn"] = "Soprano";
-        codeToLabel["spshc"] = "Splash cymbal";
-        codeToLabel["spok"] = "Spoken voice";
-        codeToLabel["spokF"] = "Female spoken voice";
-        codeToLabel["spokM"] = "Male spoken voice";
-        codeToLabel["steel"] = "Steel drum";
-        codeToLabel["stim"] = "Sprechstimme";
-        codeToLabel["stimS"] = "Soprano Sprechstimme";
-        codeToLabel["stimA"] = "Alto Sprechstimme";
-        codeToLabel["stimC"] = "Contralto Sprechstimme";
-        codeToLabel["stimR"] = "Baritone Sprechstimme";
-        codeToLabel["stimB"] = "Bass Sprechstimme";
-        codeToLabel["strdr"] = "String drum";
-        codeToLabel["sxhA"] = "Alto saxhorn";
-        codeToLabel["sxhB"] = "Bass saxhorn";
-        codeToLabel["sxhC"] = "Contrabass saxhorn";
-        codeToLabel["sxhR"] = "Baritons saxhorn";
-        codeToLabel["sxhS"] = "Saxhorn";
-        codeToLabel["sxhT"] = "Tenor saxhorn";
-        codeToLabel["synth"] = "Synthesizer";
-        codeToLabel["tabla"] = "Tabla";
-        codeToLabel["tambn"] = "Tambourine";
-        codeToLabel["tambu"] = "Tambura";
-        codeToLabel["tambr"] = "Tambur";
-        codeToLabel["tblok"] = "Temple blocks";
-        codeToLabel["tdrum"] = "Tenor drum";
-        codeToLabel["tenor"] = "Tenor";
-        codeToLabel["timpa"] = "Timpani";
-        codeToLabel["tiorb"] = "Theorbo";
-        codeToLabel["tom"] = "Tom-tom";
-        codeToLabel["trngl"] = "Triangle";
-        codeToLabel["troma"] = "Alto trombone";
-        codeToLabel["tromb"] = "Bass trombone";
-        codeToLabel["tromp"] = "Trumpet";
-        codeToLabel["tromP"] = "Piccolo trumpet";
-        codeToLabel["tromB"] = "Bass trumpet";
-        codeToLabel["tromt"] = "Trombone";
-        codeToLabel["tuba"] = "Tuba";
-        codeToLabel["tubaB"] = "Bass Tuba";
-        codeToLabel["tubaC"] = "Contrabass Tuba";
-        codeToLabel["tubaT"] = "Tenor Tuba";
-        codeToLabel["tubaU"] = "Subcontrabass Tuba";
-        codeToLabel["ukule"] = "Ukulele";
-        codeToLabel["vibra"] = "Vibraphone";
-        codeToLabel["vina"] = "Vina";
-        codeToLabel["viola"] = "Viola";
-        codeToLabel["violb"] = "Bass viola da gamba";
-        codeToLabel["viold"] = "Viola d'amore";
-        codeToLabel["viole"] = "violone";
-        codeToLabel["violn"] = "Violin";
-        codeToLabel["violp"] = "Piccolo violin";
-        codeToLabel["viols"] = "Viola da gamba";
-        codeToLabel["violt"] = "Tenor viola da gamba";
-        codeToLabel["vox"] = "Voice";
-        codeToLabel["wblok"] = "Woodblock";
-        codeToLabel["xylo"] = "Xylophone";
-        codeToLabel["zithr"] = "Zither";
-        codeToLabel["zurna"] = "Zurna";
-    }
+    static const std::map<std::string, std::string> codeToLabel = {
+        { "piano", "Piano" },
+        { "accor", "Accordion" },
+        { "alto", "Alto" },
+        { "anvil", "Anvil" },
+        { "archl", "Archlute" },
+        { "armon", "Harmonic" },
+        { "arpa", "Harp" },
+        { "bagpI", "Irish bagpipe" },
+        { "bagpS", "Scottish bagpipe" },
+        { "banjo", "Banjo" },
+        { "bansu", "Bansuri" },
+        { "barit", "Baritone" },
+        { "mbari", "High baritone" },
+        { "baset", "Bassett horn" },
+        { "bass", "Bass" },
+        { "bdrum", "Bass drum" },
+        { "bongo", "Bongo" },
+        { "bguit", "Bass guitar" },
+        { "biwa", "Biwa" },
+        { "bscan", "Singing bass" },
+        { "bspro", "Basso profondo" },
+        { "brush", "Brush" },
+        { "calam", "Chalumeau" },
+        { "calpe", "Calliope" },
+        { "calto", "Contralto" },
+        { "campn", "Bells" },
+        { "cangl", "English horn" },
+        { "canto", "Canto" },
+        { "caril", "Carillon" },
+        { "castr", "Castrato" },
+        { "casts", "Castanets" },
+        { "cbass", "Contrabass" },
+        { "cello", "Violoncello" },
+        { "cemba", "Harpsichord" },
+        { "cetra", "Cittern" },
+        { "chain", "Chain" },
+        { "chime", "Tubular bells" },
+        { "chcym", "China cymbal" },
+        { "chlma", "Soprano shawm" },
+        { "chlmt", "Tenor shawm" },
+        { "clap", "Hand clap" },
+        { "clara", "Alto Clarinet" },
+        { "clarb", "Bass Clarinet" },
+        { "claro", "Sopranino clarinet" },
+        { "clarp", "Piccolo clarinet" },
+        { "clars", "Clarinet" },
+        { "clave", "Claves" },
+        { "clavi", "Clavichord" },
+        { "clest", "Celesta" },
+        { "clrno", "Clarino" },
+        { "colsp", "Coloratura soprano" },
+        { "conga", "Conga" },
+        { "cor", "Horn" },
+        { "cornm", "Cornemuse" },
+        { "corno", "Cornett" },
+        { "cornt", "Cornet" },
+        { "coro", "Chorus" },
+        { "crshc", "Crash cymbal" },
+        { "ctenor", "Contratenor" },
+        { "ctina", "concertina" },
+        { "drmsp", "Dramatic soprano" },
+        { "drum", "Drum" },
+        { "drumP", "Small drum" },
+        { "dulc", "Dulcimer" },
+        { "eguit", "Electric guitar" },
+        { "fag_c", "Contrabassoon" },
+        { "fagot", "Bassoon" },
+        { "false", "Falsetto" },
+        { "feme", "Female voice" },
+        { "fife", "Fife" },
+        { "fingc", "Finger Cymbals" },
+        { "flex", "Flexatone" },
+        { "flt", "Flute" },
+        { "flt_a", "Alto flute" },
+        { "flt_b", "Bass flute" },
+        { "fltda", "Alto recorder" },
+        { "fltdb", "Bass recorder" },
+        { "fltdn", "Sopranino recorder" },
+        { "fltds", "Soprano recorder" },
+        { "fltdt", "Tenor recorder" },
+        { "flugh", "Flugelhorn" },
+        { "forte", "Fortepiano" },
+        { "glock", "Glockenspiel" },
+        { "gen", "Generic instrument" },
+        { "genT", "Generic treble instrument" },
+        { "genB", "Generic bass instrument" },
+        { "gong", "Gong" },
+        { "guitr", "Guitar" },
+        { "hammd", "Hammond eletronic organ" },
+        { "hbell", "Hand bells" },
+        { "heck", "Heckelphone" },
+        { "heltn", "Heroic tenor" },
+        { "hichi", "Hichiriki" },
+        { "hurdy", "Hurdy-gurdy" },
+        { "kitv", "Kit violin" },
+        { "klav", "Generic keyboard" },
+        { "kokyu", "Kokyu" },
+        { "komun", "Koumngo" },
+        { "koto", "Koto" },
+        { "kruma", "Alto crumhorn" },
+        { "krumb", "Bass crumhorn" },
+        { "krums", "Crumhorn" },
+        { "krumt", "Tenor crumhorn" },
+        { "lion", "Lion's roar" },
+        { "liuto", "Lute" },
+        { "lyrsp", "Lyric soprano" },
+        { "lyrtn", "Lyric tenor" },
+        { "male", "Male voice" },
+        { "mando", "Mandolin" },
+        { "marac", "Maracas" },
+        { "marim", "Marimba" },
+        { "mezzo", "Mezzo soprano" },
+        { "nfant", "Child's voice" },
+        { "nokan", "Nokan" },
+        { "oboe", "Oboe" },
+        { "oboeD", "Oboe d'amore" },
+        { "ocari", "Ocarina" },
+        { "ondes", "Ondes Martenot" },
+        { "ophic", "Ophicleide" },
+        { "organ", "Organ" },
+        { "oud", "Oud" },
+        { "panpi", "Panpipes" },
+        { "paila", "Timbales" },
+        { "pbell", "Bell plate" },
+        { "pguit", "Portuguese guitar" },
+        { "physh", "Physharmonica" },
+        { "piatt", "Cymbales" },
+        { "picco", "Piccolo" },
+        { "pipa", "Pipa" },
+        { "piri", "Piri" },
+        { "porta", "Portative organ" },
+        { "psalt", "Psaltery" },
+        { "qin", "Qin" },
+        { "quinto", "Quinto" },
+        { "quitr", "Gittern" },
+        { "rackt", "Rackett" },
+        { "ratch", "Ratchet" },
+        { "ratl", "Rattle" },
+        { "rebec", "Rebec" },
+        { "recit", "Recitativo" },
+        { "reedo", "Reed organ" },
+        { "rhode", "Rhodes piano" },
+        { "ridec", "Ride cymbal" },
+        { "sarod", "Sarod" },
+        { "sarus", "Sarrusophone" },
+        { "saxA", "Alto saxophone" },
+        { "saxB", "Bass saxophone" },
+        { "saxN", "Sopranino saxophone" },
+        { "saxR", "Baritone saxophone" },
+        { "saxS", "Saxophone" },
+        { "saxT", "Tenor saxophone" },
+        { "sbell", "Sleigh bells" },
+        { "sdrum", "Snare drum" },
+        { "serp", "Serpent" },
+        { "sesto", "Sesto" },
+        { "shaku", "Shakuhachi" },
+        { "shami", "Shamisen" },
+        { "sheng", "Sheng" },
+        { "sho", "Sho" },
+        { "siren", "Siren" },
+        { "sitar", "Sitar" },
+        { "slap", "Slapstick" },
+        { "soprn", "Soprano" },
+        { "spshc", "Splash cymbal" },
+        { "spok", "Spoken voice" },
+        { "spokF", "Female spoken voice" },
+        { "spokM", "Male spoken voice" },
+        { "steel", "Steel drum" },
+        { "stim", "Sprechstimme" },
+        { "stimS", "Soprano Sprechstimme" },
+        { "stimA", "Alto Sprechstimme" },
+        { "stimC", "Contralto Sprechstimme" },
+        { "stimR", "Baritone Sprechstimme" },
+        { "stimB", "Bass Sprechstimme" },
+        { "strdr", "String drum" },
+        { "sxhA", "Alto saxhorn" },
+        { "sxhB", "Bass saxhorn" },
+        { "sxhC", "Contrabass saxhorn" },
+        { "sxhR", "Baritons saxhorn" },
+        { "sxhS", "Saxhorn" },
+        { "sxhT", "Tenor saxhorn" },
+        { "synth", "Synthesizer" },
+        { "tabla", "Tabla" },
+        { "tambn", "Tambourine" },
+        { "tambu", "Tambura" },
+        { "tambr", "Tambur" },
+        { "tblok", "Temple blocks" },
+        { "tdrum", "Tenor drum" },
+        { "tenor", "Tenor" },
+        { "timpa", "Timpani" },
+        { "tiorb", "Theorbo" },
+        { "tom", "Tom-tom" },
+        { "trngl", "Triangle" },
+        { "troma", "Alto trombone" },
+        { "tromb", "Bass trombone" },
+        { "tromp", "Trumpet" },
+        { "tromP", "Piccolo trumpet" },
+        { "tromB", "Bass trumpet" },
+        { "tromt", "Trombone" },
+        { "tuba", "Tuba" },
+        { "tubaB", "Bass Tuba" },
+        { "tubaC", "Contrabass Tuba" },
+        { "tubaT", "Tenor Tuba" },
+        { "tubaU", "Subcontrabass Tuba" },
+        { "ukule", "Ukulele" },
+        { "vibra", "Vibraphone" },
+        { "vina", "Vina" },
+        { "viola", "Viola" },
+        { "violb", "Bass viola da gamba" },
+        { "viold", "Viola d'amore" },
+        { "viole", "violone" },
+        { "violn", "Violin" },
+        { "violp", "Piccolo violin" },
+        { "viols", "Viola da gamba" },
+        { "violt", "Tenor viola da gamba" },
+        { "vox", "Voice" },
+        { "wblok", "Woodblock" },
+        { "xylo", "Xylophone" },
+        { "zithr", "Zither" },
+        { "zurna", "Zurna" }
+    };
 
     std::string code = icode->substr(2);
 
-    std::string output = codeToLabel[code];
+    auto it = codeToLabel.find(code);
+    std::string output = (it != codeToLabel.end()) ? it->second : "";
 
     if (output.empty()) {
         // Could not find an automatic name for the instrument.
@@ -8893,7 +8993,7 @@ void HumdrumInput::setMensurationSymbol(
         std::stringstream warning;
         warning << "In HumdrumInput::setMensurationSymbol: Problem parsing mensuration: ";
         warning << metdata;
-        LogWarning(warning.str().c_str());
+        VRV_LOG_WARNING(warning.str().c_str());
         return;
     }
 
@@ -8957,7 +9057,7 @@ void HumdrumInput::setMensurationSymbol(
                 warning.str("");
                 warning << "In HumdrumInput::setMensurationSymbol: Unknown prolation ";
                 warning << prolatio << " in " << mensurtok;
-                LogWarning(warning.str().c_str());
+                VRV_LOG_WARNING(warning.str().c_str());
         }
         switch (tempus) {
             case 2: vrvmensur->SetTempus(TEMPUS_2); break;
@@ -8967,7 +9067,7 @@ void HumdrumInput::setMensurationSymbol(
                 warning.str("");
                 warning << "In HumdrumInput::setMensurationSymbol: Unknown tempus ";
                 warning << tempus << " in " << mensurtok;
-                LogWarning(warning.str().c_str());
+                VRV_LOG_WARNING(warning.str().c_str());
         }
         switch (modus) {
             case 2: vrvmensur->SetModusminor(MODUSMINOR_2); break;
@@ -8977,7 +9077,7 @@ void HumdrumInput::setMensurationSymbol(
                 warning.str("");
                 warning << "In HumdrumInput::setMensurationSymbol: Unknown modus ";
                 warning << modus << " in " << mensurtok;
-                LogWarning(warning.str().c_str());
+                VRV_LOG_WARNING(warning.str().c_str());
         }
         switch (maximodus) {
             case 2: vrvmensur->SetModusmaior(MODUSMAIOR_2); break;
@@ -8987,7 +9087,7 @@ void HumdrumInput::setMensurationSymbol(
                 warning.str("");
                 warning << "In HumdrumInput::setMensurationSymbol: Unknown maximodus ";
                 warning << maximodus << " in " << mensurtok;
-                LogWarning(warning.str().c_str());
+                VRV_LOG_WARNING(warning.str().c_str());
         }
     }
 
@@ -8997,14 +9097,14 @@ void HumdrumInput::setMensurationSymbol(
         std::stringstream warning;
         warning << "In HumdrumInput::setMensrationSymbol: ";
         warning << "Initialization problem, not setting mensuration information";
-        LogWarning(warning.str().c_str());
+        VRV_LOG_WARNING(warning.str().c_str());
         std::stringstream warning2;
         warning2 << "   Staff index = " << staffindex;
-        LogWarning(warning2.str().c_str());
+        VRV_LOG_WARNING(warning2.str().c_str());
         return;
     }
     if (staffindex >= (int)ss.size()) {
-        LogWarning("InHumdrumInput::setMensurationSymbol: Problem with staff indexing in mensuration processing");
+        VRV_LOG_WARNING("InHumdrumInput::setMensurationSymbol: Problem with staff indexing in mensuration processing");
         return;
     }
 
@@ -10191,7 +10291,7 @@ void HumdrumInput::storeStaffLayerTokensForMeasure(int startline, int endline)
                 std::stringstream warning;
                 warning << "In HumdrumInput::storeStaffLayerTokensForMeasure:";
                 warning << "Staff inex problem for track " << track;
-                LogWarning(warning.str().c_str());
+                VRV_LOG_WARNING(warning.str().c_str());
             }
             if ((int)lt[staffindex].size() < layerindex + 1) {
                 lt[staffindex].resize(lt[staffindex].size() + 1);
@@ -11200,7 +11300,7 @@ void HumdrumInput::addHarmFloatsForMeasure(int startline, int endline)
                 std::stringstream warning;
                 warning << "In HumdrumInput::addHarmFloatsForMeasure: ";
                 warning << "Unknown type of harm data " << datatype;
-                LogWarning(warning.str().c_str());
+                VRV_LOG_WARNING(warning.str().c_str());
                 continue;
             }
         }
@@ -12581,7 +12681,7 @@ void HumdrumInput::setMxHarmContent(Rend *rend, const std::string &content)
             std::stringstream warning;
             warning << "In HumdrumInput::setMxHarmContent: ";
             warning << "Should not get here if correct input: " << content;
-            LogWarning(warning.str().c_str());
+            VRV_LOG_WARNING(warning.str().c_str());
         }
     }
 
@@ -13250,7 +13350,7 @@ bool HumdrumInput::checkForTremolo(
         std::stringstream warning;
         warning << "In HumdrumInput::checkForTremolo: ";
         warning << "Problem with tremolo2 calculation, beam count: " << beams;
-        LogWarning(warning.str().c_str());
+        VRV_LOG_WARNING(warning.str().c_str());
         return false;
     }
 
@@ -13291,7 +13391,7 @@ bool HumdrumInput::checkForInvisibleBeam(
     int beamnum = tgs.at(layerindex).beamstart;
     for (int i = layerindex; i < (int)tgs.size(); ++i) {
         if (!tgs.at(i).token) {
-            LogWarning("In HumdrumInput::checkForInvisibleBeam: Encountered NULL token");
+            VRV_LOG_WARNING("In HumdrumInput::checkForInvisibleBeam: Encountered NULL token");
             return false;
         }
         int len = (int)tgs.at(i).token->size();
@@ -14022,10 +14122,10 @@ bool HumdrumInput::fillContentsOfLayer(int track, int startline, int endline, in
                     std::stringstream warning;
                     warning << "In HumdrumInput::fillContentsOfLayer: ";
                     warning << "Strange error when adding rest " << trest;
-                    LogWarning(warning.str().c_str());
+                    VRV_LOG_WARNING(warning.str().c_str());
                     std::stringstream warning2;
                     warning2 << "   Line: " << trest->getLineNumber() << ", Field: " << trest->getFieldNumber();
-                    LogWarning(warning2.str().c_str());
+                    VRV_LOG_WARNING(warning2.str().c_str());
                 }
             }
 
@@ -16092,7 +16192,7 @@ void HumdrumInput::convertMensuralToken(
             }
         }
         else {
-            LogWarning("In HumdrumInput::convertMensuralToken: Unmatched ligature ending");
+            VRV_LOG_WARNING("In HumdrumInput::convertMensuralToken: Unmatched ligature ending");
         }
     }
     if (roff) {
@@ -17959,7 +18059,7 @@ void HumdrumInput::processLinkedDirection(int index, hum::HTp token, int staffin
             std::stringstream warning;
             warning << "In HumdrumInput::processLinkedDirection: dirtok for ";
             warning << token << " is empty";
-            LogWarning(warning.str().c_str());
+            VRV_LOG_WARNING(warning.str().c_str());
         }
         hum::HumNum tstamp = getMeasureTstamp(token, staffindex);
         if (token->isMensLike()) {
@@ -18007,7 +18107,7 @@ void HumdrumInput::processLinkedDirection(int index, hum::HTp token, int staffin
             std::stringstream warning;
             warning << "In HumdrumInput::processLinkedDirection: (2) dirtok for ";
             warning << token << " is empty";
-            LogWarning(warning.str().c_str());
+            VRV_LOG_WARNING(warning.str().c_str());
         }
 
         if (token->isMensLike()) {
@@ -19947,7 +20047,7 @@ template <class ELEMENT> void HumdrumInput::setAttachmentType(ELEMENT *element,
 template <class ELEMENT> void HumdrumInput::attachToToken(ELEMENT *element, hum::HTp token)
 {
     if (token->isNull()) {
-        LogWarning("In HumdrumInput::attachToToken: Cannot input null tokens into this function");
+        VRV_LOG_WARNING("In HumdrumInput::attachToToken: Cannot input null tokens into this function");
         return;
     }
     if (token->isChord()) {
@@ -23215,14 +23315,14 @@ Beam *HumdrumInput::insertGBeam(
 void HumdrumInput::removeBeam(std::vector<std::string> &elements, std::vector<void *> &pointers)
 {
     if (elements.back() != "beam") {
-        LogWarning("In HumdrumInput::removeBeam: Error removing beam");
+        VRV_LOG_WARNING("In HumdrumInput::removeBeam: Error removing beam");
         std::stringstream warning;
-        LogWarning("   Element stack: ");
+        VRV_LOG_WARNING("   Element stack: ");
         for (int i = (int)elements.size() - 1; i >= 0; i--) {
             std::stringstream warning;
             warning.str("");
             warning << "      " << i << ":\t" << elements[i];
-            LogWarning(warning.str().c_str());
+            VRV_LOG_WARNING(warning.str().c_str());
         }
         return;
     }
@@ -23237,13 +23337,13 @@ void HumdrumInput::removeBeam(std::vector<std::string> &elements, std::vector<vo
 void HumdrumInput::removeGBeam(std::vector<std::string> &elements, std::vector<void *> &pointers)
 {
     if (elements.back() != "gbeam") {
-        LogWarning("In HumdrumInput::removeGBeam: Error removing gbeam");
-        LogWarning("   Element stack: ");
+        VRV_LOG_WARNING("In HumdrumInput::removeGBeam: Error removing gbeam");
+        VRV_LOG_WARNING("   Element stack: ");
         for (int i = (int)elements.size() - 1; i >= 0; i--) {
             std::stringstream warning;
             warning.str("");
             warning << "      " << i << ":\t" << elements[i];
-            LogWarning(warning.str().c_str());
+            VRV_LOG_WARNING(warning.str().c_str());
         }
         return;
     }
@@ -23258,16 +23358,16 @@ void HumdrumInput::removeGBeam(std::vector<std::string> &elements, std::vector<v
 void HumdrumInput::removeTuplet(std::vector<std::string> &elements, std::vector<void *> &pointers)
 {
     if (elements.back() != "tuplet") {
-        LogWarning("In HumdrumInput::removeTuplet: Error removing tuplet");
+        VRV_LOG_WARNING("In HumdrumInput::removeTuplet: Error removing tuplet");
         std::stringstream warning;
         warning << "   Last element is: " << elements.back();
-        LogWarning(warning.str().c_str());
-        LogWarning("   Element stack: ");
+        VRV_LOG_WARNING(warning.str().c_str());
+        VRV_LOG_WARNING("   Element stack: ");
         for (int i = (int)elements.size() - 1; i >= 0; i--) {
             std::stringstream warning;
             warning.str("");
             warning << "      " << i << ":\t" << elements[i];
-            LogWarning(warning.str().c_str());
+            VRV_LOG_WARNING(warning.str().c_str());
         }
         return;
     }
@@ -24140,7 +24240,7 @@ void HumdrumInput::mergeTupletsCuttingBeam(std::vector<humaux::HumdrumBeamAndTup
                 scaleadj.at(j) = 2;
                 break;
             }
-            LogWarning("In HumdrumInput::mergeTupletsCuttingBeam: Something strange happened");
+            VRV_LOG_WARNING("In HumdrumInput::mergeTupletsCuttingBeam: Something strange happened");
         }
         target = newtg.at(i + 1)->tupletstart;
         scaleadj.at(i) = 2;
@@ -24157,7 +24257,7 @@ void HumdrumInput::mergeTupletsCuttingBeam(std::vector<humaux::HumdrumBeamAndTup
                 scaleadj.at(j) = 2;
                 break;
             }
-            LogWarning("In HumdrumInput::mergeTupletsCuttingBeam: Something strange happened (2)");
+            VRV_LOG_WARNING("In HumdrumInput::mergeTupletsCuttingBeam: Something strange happened (2)");
         }
 
         newtg.at(i)->tupletend = 0;
@@ -25614,7 +25714,7 @@ void HumdrumInput::setNoteMeiDur(Note *note, int meidur)
         case 12: note->SetDur(DURATION_1024); break;
         default:
             warning << "In HumdrumInput::setNoteMeiDur: Unknown MEI @dur: " << meidur;
-            LogWarning(warning.str().c_str());
+            VRV_LOG_WARNING(warning.str().c_str());
     }
 }
 
@@ -25799,7 +25899,7 @@ void HumdrumInput::appendElement(const std::vector<std::string> &name, const std
         std::stringstream warning;
         warning << "In HumdrumInput::appendElement: ";
         warning << "Cannot append to unknown element: " << name.back();
-        LogWarning(warning.str().c_str());
+        VRV_LOG_WARNING(warning.str().c_str());
     }
 }
 
@@ -26600,7 +26700,7 @@ void HumdrumInput::convertNote(Note *note, hum::HTp token, int staffadj, int sta
                         std::stringstream warning;
                         warning << "In HumdrumInput::convertNote: ";
                         warning << "Do not know how to convert accidental: " << accidCount;
-                        LogWarning(warning.str().c_str());
+                        VRV_LOG_WARNING(warning.str().c_str());
                     }
                 }
 
@@ -26653,7 +26753,7 @@ void HumdrumInput::convertNote(Note *note, hum::HTp token, int staffadj, int sta
                         std::stringstream warning;
                         warning << "In HumdrumInput::convertNote: ";
                         warning << "Do not know how to convert accidental: " << accidCount;
-                        LogWarning(warning.str().c_str());
+                        VRV_LOG_WARNING(warning.str().c_str());
                     }
                 }
             }
@@ -26705,7 +26805,7 @@ void HumdrumInput::convertNote(Note *note, hum::HTp token, int staffadj, int sta
                     std::stringstream warning;
                     warning << "In HumdrumInput::convertNote: ";
                     warning << "Unknown accidental type: " << loaccid;
-                    LogWarning(warning.str().c_str());
+                    VRV_LOG_WARNING(warning.str().c_str());
                 }
                 // add more accidentals here as necessary.  Mostly left are quarter tones
                 // which are not dealt with directly in **kern data: su, sd, fu, fd, nu,
@@ -28713,7 +28813,7 @@ void HumdrumInput::addTurn(hum::HTp token, const string &tok, int noteIndex)
         warning << "In HumdrumInput::addTurn: Single turn character ";
         warning << "on line " << token->getLineNumber() << ", ";
         warning << "field, " << token->getFieldNumber() << ".";
-        LogWarning(warning.str().c_str());
+        VRV_LOG_WARNING(warning.str().c_str());
         singleQ = true;
     }
 
@@ -29839,7 +29939,7 @@ template <class ELEMENT> hum::HumNum HumdrumInput::setDuration(ELEMENT element,
     std::stringstream warning;
     warning << "In HumdrumInput::setDuration: ";
     warning << "Unprintable duration" << duration << " quarter notes";
-    LogWarning(warning.str().c_str());
+    VRV_LOG_WARNING(warning.str().c_str());
     return duration;
 }
 
@@ -29907,7 +30007,7 @@ Tie *HumdrumInput::tieToPreviousItem(hum::HTp token, int subindex, hum::HumNum m
         tstamp += 1;
     }
     else {
-        LogWarning("In HumdrumInput::tieToPreviousItem: Strange case for tie insertion.");
+        VRV_LOG_WARNING("In HumdrumInput::tieToPreviousItem: Strange case for tie insertion.");
     }
 
     tie->SetTstamp(tstamp.getFloat()); // attach start to beginning of measure
@@ -30683,7 +30783,13 @@ static const EntityNameEntry StaticEntityNames[] = {
 
 typedef std::map<std::string, unsigned int> EntityNameMap;
 typedef std::pair<std::string, unsigned int> EntityNamePair;
-static EntityNameMap EntityNames;
+static const EntityNameMap EntityNames = []() {
+    EntityNameMap entityNames;
+    for (const EntityNameEntry *entry = StaticEntityNames; entry->Name != NULL; ++entry) {
+        entityNames.insert(EntityNamePair(std::string(entry->Name), entry->Value));
+    }
+    return entityNames;
+}();
 
 //////////////////////////////
 //
@@ -30769,16 +30875,6 @@ void HumdrumInput::UnquoteHTML(std::istream &In, std::ostream &Out)
                     ProcessedChar = true;
                 }
                 else if (ThisCh == ';') {
-                    if (EntityNames.empty()) {
-                        /* first use, load EntityNames from StaticEntityNames */
-                        const EntityNameEntry *ThisEntry;
-                        ThisEntry = StaticEntityNames;
-                        for (;;) {
-                            if (ThisEntry->Name == NULL) break;
-                            EntityNames.insert(EntityNamePair(std::string(ThisEntry->Name), ThisEntry->Value));
-                            ThisEntry++;
-                        }
-                    }
                     const EntityNameMap::const_iterator NameEntry = EntityNames.find(MatchingName);
                     if (NameEntry != EntityNames.end()) {
                         CharCode = NameEntry->second;
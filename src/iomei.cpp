@@ -172,6 +172,8 @@ MEIOutput::MEIOutput(Doc *doc) : Output(doc)
     m_basic = false;
     m_ignoreHeader = false;
     m_removeIds = false;
+    m_streamWriter = NULL;
+    m_streamFlags = 0;
 
     this->Reset();
     this->ResetFilter();
@@ -179,7 +181,31 @@ MEIOutput::MEIOutput(Doc *doc) : Output(doc)
 
 MEIOutput::~MEIOutput() {}
 
-bool MEIOutput::Export()
+//----------------------------------------------------------------------------
+// Writer for appending the serialized document to a string
+//----------------------------------------------------------------------------
+
+class MEIStringWriter : public pugi::xml_writer {
+public:
+    MEIStringWriter(std::string &output) : m_output(output) {}
+
+    void write(const void *data, size_t size) override { m_output.append(static_cast<const char *>(data), size); }
+
+private:
+    std::string &m_output;
+};
+
+bool MEIOutput::Export(std::ostream &output)
+{
+    pugi::xml_writer_stream writer(output);
+    const bool success = this->Export(writer);
+
+    this->Reset();
+
+    return success;
+}
+
+bool MEIOutput::Export(pugi::xml_writer &writer)
 {
 
     if (m_removeIds) {
@@ -195,20 +221,20 @@ bool MEIOutput::Export()
 
         if (this->HasFilter()) {
             if (!this->IsScoreBasedMEI()) {
-                LogError("MEI output with filter is not possible in page-based MEI");
+                VRV_LOG_ERROR("MEI output with filter is not possible in page-based MEI");
                 return false;
             }
             if (m_doc->IsMensuralMusicOnly()) {
-                LogError("MEI output with filter is not possible for mensural music");
+                VRV_LOG_ERROR("MEI output with filter is not possible for mensural music");
                 return false;
             }
             if (!this->HasValidFilter()) {
-                LogError("Invalid filter, please check the input");
+                VRV_LOG_ERROR("Invalid filter, please check the input");
                 return false;
             }
         }
         if (this->IsPageBasedMEI() && this->GetBasic()) {
-            LogError("MEI output in page-based MEI is not possible with MEI basic");
+            VRV_LOG_ERROR("MEI output in page-based MEI is not possible with MEI basic");
             return false;
         }
 
@@ -253,42 +279,140 @@ bool MEIOutput::Export()
         if (this->GetBasic()) meiVersion = meiVersion_MEIVERSION_5_0plusbasic;
         m_mei.append_attribute("meiversion") = (converter.MeiVersionMeiversionToStr(meiVersion)).c_str();
 
+        m_streamFlags = pugi::format_default;
+        if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
+            m_streamFlags |= pugi::format_no_escapes;
+        }
+        if (m_doc->GetOptions()->m_outputFormatRaw.GetValue()) {
+            m_streamFlags |= pugi::format_raw;
+        }
+        m_streamIndent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+        m_streamWriter = &writer;
+
         // If the document is mensural, we have to undo the mensural (segments) cast off
         m_doc->ConvertToCastOffMensuralDoc(false);
 
-        // this starts the call of all the functors
+        // this starts the call of all the functors, with the measures streamed as they are completed
         m_doc->SaveObject(this, this->GetBasic());
 
         // Redo the mensural segment cast of if necessary
         m_doc->ConvertToCastOffMensuralDoc(true);
-        unsigned int output_flags = pugi::format_default;
-        if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
-            output_flags |= pugi::format_no_escapes;
-        }
-        if (m_doc->GetOptions()->m_outputFormatRaw.GetValue()) {
-            output_flags |= pugi::format_raw;
-        }
 
-        if (this->GetBasic()) {
-            this->PruneAttributes(m_mei.child("music"));
-        }
-
-        std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
-        meiDoc.save(m_streamStringOutput, indent.c_str(), output_flags);
+        // Write what is left
+        this->StreamNodes({});
     }
     catch (char *str) {
-        LogError("%s", str);
+        VRV_LOG_ERROR("%s", str);
+        m_streamWriter = NULL;
+        m_streamedNodes.clear();
         return false;
     }
 
+    m_streamWriter = NULL;
+
     return true;
 }
 
-std::string MEIOutput::GetOutput()
+void MEIOutput::StreamNodes(const std::vector<pugi::xml_node> &path)
 {
-    this->Export();
+    assert(m_streamWriter);
 
-    std::string output = m_streamStringOutput.str();
+    pugi::xml_node root = m_mei.root();
+
+    // Close the elements that are not in the path anymore
+    size_t common = 0;
+    while ((common < m_streamedNodes.size()) && (common < path.size()) && (m_streamedNodes[common] == path[common])) {
+        ++common;
+    }
+    while (m_streamedNodes.size() > common) {
+        pugi::xml_node node = m_streamedNodes.back();
+        const int depth = (int)m_streamedNodes.size() - 1;
+        for (pugi::xml_node child : node.children()) {
+            this->StreamNode(child, depth + 1);
+        }
+        this->StreamEndTag(node, depth);
+        m_streamedNodes.pop_back();
+        node.parent().remove_child(node);
+        if (node == m_mei) m_mei = pugi::xml_node();
+    }
+
+    // Write the elements before the path and the start tags of the ones in the path
+    pugi::xml_node parent = root;
+    for (int depth = 0; depth <= (int)path.size(); ++depth) {
+        pugi::xml_node next = (depth < (int)path.size()) ? path.at(depth) : pugi::xml_node();
+        while (parent.first_child() != next) {
+            this->StreamNode(parent.first_child(), depth);
+            parent.remove_child(parent.first_child());
+        }
+        if (!next) break;
+        if (depth == (int)m_streamedNodes.size()) {
+            this->StreamStartTag(next, depth);
+            m_streamedNodes.push_back(next);
+        }
+        parent = next;
+    }
+}
+
+void MEIOutput::StreamNode(pugi::xml_node node, int depth)
+{
+    if (this->IsPrunedNode(node)) {
+        this->PruneAttributes(node);
+    }
+    else if (this->GetBasic() && (node == m_mei)) {
+        this->PruneAttributes(m_mei.child("music"));
+    }
+    node.print(*m_streamWriter, m_streamIndent.c_str(), m_streamFlags, pugi::encoding_auto, depth);
+}
+
+void MEIOutput::StreamStartTag(pugi::xml_node node, int depth)
+{
+    // Print a copy of the element without its children and turn its empty-element tag into a start tag
+    pugi::xml_document tagDoc;
+    pugi::xml_node tag = tagDoc.append_child(node.name());
+    for (pugi::xml_attribute attribute : node.attributes()) {
+        tag.append_copy(attribute);
+    }
+    if (this->IsPrunedNode(node)) this->PruneAttributes(tag);
+
+    std::string output;
+    MEIStringWriter writer(output);
+    tag.print(writer, m_streamIndent.c_str(), m_streamFlags, pugi::encoding_auto, depth);
+    const bool raw = (m_streamFlags & pugi::format_raw);
+    const std::string emptyEnd = (raw) ? "/>" : " />\n";
+    assert(output.size() > emptyEnd.size());
+    output.replace(output.size() - emptyEnd.size(), emptyEnd.size(), (raw) ? ">" : ">\n");
+    m_streamWriter->write(output.c_str(), output.size());
+}
+
+void MEIOutput::StreamEndTag(pugi::xml_node node, int depth)
+{
+    std::string output;
+    if (!(m_streamFlags & pugi::format_raw)) {
+        for (int i = 0; i < depth; ++i) output += m_streamIndent;
+    }
+    output += "</" + std::string(node.name()) + ">";
+    if (!(m_streamFlags & pugi::format_raw)) output += "\n";
+    m_streamWriter->write(output.c_str(), output.size());
+}
+
+bool MEIOutput::IsPrunedNode(pugi::xml_node node) const
+{
+    // In MEI basic, the attributes are pruned in the music element and in its descendants until an unsupported one
+    if (!this->GetBasic()) return false;
+    const pugi::xml_node music = m_mei.child("music");
+    for (pugi::xml_node ancestor = node; ancestor; ancestor = ancestor.parent()) {
+        if (ancestor == music) return true;
+        if ((ancestor != node) && !MEIBasic::map.count(ancestor.name())) return false;
+    }
+    return false;
+}
+
+std::string MEIOutput::GetOutput()
+{
+    std::string output;
+    MEIStringWriter writer(output);
+    // The output can be partially written on failure
+    if (!this->Export(writer)) output.clear();
 
     this->Reset();
 
@@ -928,7 +1052,7 @@ bool MEIOutput::WriteObjectInternal(Object *object, bool useCustomScoreDef)
 
     else {
         // Missing output method for the class
-        LogError("Output method missing for '%s'", object->GetClassName().c_str());
+        VRV_LOG_ERROR("Output method missing for '%s'", object->GetClassName().c_str());
         assert(false); // let's make it stop because this should not happen
     }
 
@@ -1013,6 +1137,15 @@ bool MEIOutput::WriteObjectInternalEnd(Object *object)
     m_nodeStack.pop_back();
     m_currentNode = m_nodeStack.back();
 
+    // Stream the output once a measure is completed
+    if (m_streamWriter && object->Is(MEASURE)) {
+        std::vector<pugi::xml_node> path;
+        for (pugi::xml_node node = m_currentNode; node.type() == pugi::node_element; node = node.parent()) {
+            path.insert(path.begin(), node);
+        }
+        this->StreamNodes(path);
+    }
+
     return true;
 }
 
@@ -1068,9 +1201,6 @@ void MEIOutput::Reset()
     m_currentPage = 0;
     m_measureFilterMatchLocation = RangeMatchLocation::BeforeStart;
     m_mdivFilterMatchLocation = MatchLocation::Before;
-
-    m_streamStringOutput.str("");
-    m_streamStringOutput.clear();
 }
 
 bool MEIOutput::IsTreeObject(Object *object) const
@@ -1271,7 +1401,7 @@ void MEIOutput::PruneAttributes(pugi::xml_node node)
 {
     if (node.text()) return;
     if (!MEIBasic::map.count(node.name())) {
-        LogWarning("Element '%s' is not supported but will be preserved", node.name());
+        VRV_LOG_WARNING("Element '%s' is not supported but will be preserved", node.name());
         return;
     }
     std::list<std::string> unsupported;
@@ -2909,7 +3039,7 @@ void MEIOutput::WriteFacsimile(pugi::xml_node currentNode, Facsimile *facsimile)
             this->WriteSurface(childNode, dynamic_cast<Surface *>(child));
         }
         else {
-            LogWarning("Unable to write child '%s' of facsimile", child->GetClassName().c_str());
+            VRV_LOG_WARNING("Unable to write child '%s' of facsimile", child->GetClassName().c_str());
         }
     }
 }
@@ -2942,7 +3072,7 @@ void MEIOutput::WriteSurface(pugi::xml_node currentNode, Surface *surface)
             this->WriteZone(childNode, dynamic_cast<Zone *>(child));
         }
         else {
-            LogWarning("Unable to write child '%s' of surface", child->GetClassName().c_str());
+            VRV_LOG_WARNING("Unable to write child '%s' of surface", child->GetClassName().c_str());
         }
     }
 }
@@ -3173,7 +3303,8 @@ void MEIOutput::WriteUnsupportedAttr(pugi::xml_node element, Object *object)
 {
     for (auto &pair : object->m_unsupported) {
         if (element.attribute(pair.first.c_str())) {
-            LogDebug("Attribute '%s' for '%s' is not supported", pair.first.c_str(), object->GetClassName().c_str());
+            VRV_LOG_DEBUG("Attribute '%s' for '%s' is not supported", pair.first.c_str(),
+                object->GetClassName().c_str());
         }
         else {
             element.append_attribute(pair.first.c_str()) = pair.second.c_str();
@@ -3389,7 +3520,7 @@ std::string MEIOutput::DocTypeToStr(DocType type)
         case Transcription: value = "transcription"; break;
         case Facs: value = "facsimile"; break;
         default:
-            LogWarning("Unknown document type '%d'", type);
+            VRV_LOG_WARNING("Unknown document type '%d'", type);
             value = "";
             break;
     }
@@ -3411,17 +3542,32 @@ MEIInput::MEIInput(Doc *doc) : Input(doc)
 MEIInput::~MEIInput() {}
 
 bool MEIInput::Import(const std::string &mei)
+{
+    pugi::xml_document doc;
+    doc.load_buffer(
+        mei.data(), mei.size(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol, pugi::encoding_utf8);
+    return this->ImportDocument(doc);
+}
+
+bool MEIInput::ImportInplace(std::string &mei)
+{
+    // The parsed document points into the buffer, which is not copied
+    pugi::xml_document doc;
+    doc.load_buffer_inplace(
+        mei.data(), mei.size(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol, pugi::encoding_utf8);
+    return this->ImportDocument(doc);
+}
+
+bool MEIInput::ImportDocument(pugi::xml_document &doc)
 {
     try {
         m_doc->Reset();
         m_doc->SetType(Raw);
-        pugi::xml_document doc;
-        doc.load_string(mei.c_str(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
         pugi::xml_node root = doc.first_child();
         return this->ReadDoc(root);
     }
     catch (char *str) {
-        LogError("%s", str);
+        VRV_LOG_ERROR("%s", str);
         return false;
     }
 }
@@ -3896,7 +4042,7 @@ bool MEIInput::IsAllowed(std::string element, Object *filterParent)
         }
     }
     else {
-        LogDebug("Unknown filter for '%s'", filterParent->GetClassName().c_str());
+        VRV_LOG_DEBUG("Unknown filter for '%s'", filterParent->GetClassName().c_str());
         return true;
     }
 }
@@ -3908,7 +4054,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
     m_readingScoreBased = true;
 
     if (root.empty()) {
-        LogError("The tree of the MEI data cannot be parsed (no root found)");
+        VRV_LOG_ERROR("The tree of the MEI data cannot be parsed (no root found)");
         return false;
     }
 
@@ -3919,7 +4065,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
     }
     // Default to MEI 5.0
     if (m_meiversion == meiVersion_MEIVERSION_NONE) {
-        LogWarning("MEI version found or not known, falling back to MEI 5.0");
+        VRV_LOG_WARNING("MEI version found or not known, falling back to MEI 5.0");
         m_meiversion = meiVersion_MEIVERSION_5_0;
     }
 
@@ -3927,7 +4073,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
     if (std::string(root.name()) == "mei") {
         current = root.child("meiHead");
         if (current.empty()) {
-            LogWarning("No header found in the MEI data, trying to proceed...");
+            VRV_LOG_WARNING("No header found in the MEI data, trying to proceed...");
         }
         else {
             m_doc->m_header.reset();
@@ -3955,7 +4101,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
         music = root.child("music");
     }
     if (music.empty()) {
-        LogError("No <music> element found in the MEI data");
+        VRV_LOG_ERROR("No <music> element found in the MEI data");
         return false;
     }
 
@@ -3973,7 +4119,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
             // Facsimile data eventually sync with Doc::SyncFromFacsimileDoc below
         }
         if (facsimile.next_sibling("facsimile")) {
-            LogWarning("Only first <facsimile> is processed");
+            VRV_LOG_WARNING("Only first <facsimile> is processed");
         }
     }
 
@@ -3993,7 +4139,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
 
     body = music.child("body");
     if (body.empty()) {
-        LogError("No <body> element found in the MEI data");
+        VRV_LOG_ERROR("No <body> element found in the MEI data");
         return false;
     }
 
@@ -4002,7 +4148,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
     m_selectedMdiv = body.child("mdiv");
 
     if (m_selectedMdiv.empty() && pages.empty()) {
-        LogError("No <mdiv> or no <pages> element found in the MEI data");
+        VRV_LOG_ERROR("No <mdiv> or no <pages> element found in the MEI data");
         return false;
     }
     else if (m_selectedMdiv.empty()) {
@@ -4026,7 +4172,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
                 m_selectedMdiv = selection.node();
             }
             else {
-                LogError("The <mdiv> requested with the xpath query '%s' could not be found", xPathQuery.c_str());
+                VRV_LOG_ERROR("The <mdiv> requested with the xpath query '%s' could not be found", xPathQuery.c_str());
                 return false;
             }
         }
@@ -4039,13 +4185,13 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
         }
 
         if (m_selectedMdiv.select_nodes(".//score").size() > 1) {
-            LogError("An <mdiv> with only one <score> descendant must be selected");
+            VRV_LOG_ERROR("An <mdiv> with only one <score> descendant must be selected");
             return false;
         }
 
         if ((m_selectedMdiv.select_nodes(".//score").size() > 0)
             && (m_selectedMdiv.select_nodes(".//pages").size() > 0)) {
-            LogError("An <mdiv> with only one <pages> or one <score> descendant must be selected");
+            VRV_LOG_ERROR("An <mdiv> with only one <pages> or one <score> descendant must be selected");
             return false;
         }
 
@@ -4062,7 +4208,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
         }
 
         if (success && !m_hasScoreDef) {
-            LogWarning("No scoreDef provided, trying to generate one...");
+            VRV_LOG_WARNING("No scoreDef provided, trying to generate one...");
             success = m_doc->GenerateDocumentScoreDef();
         }
     }
@@ -4071,7 +4217,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
         success = this->ReadPages(m_doc, pages);
 
         if (success && !m_hasScoreDef) {
-            LogWarning("No scoreDef provided, trying to generate one...");
+            VRV_LOG_WARNING("No scoreDef provided, trying to generate one...");
             success = m_doc->GenerateDocumentScoreDef();
         }
     }
@@ -4083,7 +4229,7 @@ bool MEIInput::ReadIncipits(pugi::xml_node root)
 {
     pugi::xpath_node_set incipSet = root.select_nodes(".//incip");
     if (incipSet.size() == 0) {
-        LogError("No <incip> element found in the MEI data");
+        VRV_LOG_ERROR("No <incip> element found in the MEI data");
         return false;
     }
 
@@ -4098,7 +4244,7 @@ bool MEIInput::ReadIncipits(pugi::xml_node root)
             std::string form = incipCode.attribute("form") ? incipCode.attribute("form").value() : "";
             if (form != "plaineAndEasie" && form != "pae") {
                 // We do not consider it an error if the format is not supported
-                LogWarning("Incipit format in <incipCode> is not a supported format and will be skipped.");
+                VRV_LOG_WARNING("Incipit format in <incipCode> is not a supported format and will be skipped.");
                 // The incipit will not be removed from the header
                 continue;
             }
@@ -4112,14 +4258,14 @@ bool MEIInput::ReadIncipits(pugi::xml_node root)
             Mdiv *mdiv = vrv_cast<Mdiv *>(incipitDoc.DetachChild(0));
             if (!mdiv) {
                 // We do consider it an error if reading the PAE failed
-                LogError("Reading the Plaine & Easie incipit failed.");
+                VRV_LOG_ERROR("Reading the Plaine & Easie incipit failed.");
                 success = false;
                 continue;
             }
             m_doc->AddChild(mdiv);
         }
         else if (std::string(incip.first_child().name()) != "score") {
-            LogWarning("Only <incip> with a <score> first child can be read.");
+            VRV_LOG_WARNING("Only <incip> with a <score> first child can be read.");
             // The incipit will not be removed from the header
             continue;
         }
@@ -4172,7 +4318,7 @@ bool MEIInput::ReadPages(Object *parent, pugi::xml_node pages)
     // We require to have s <scoreDef> as first child of <score>
     pugi::xml_node scoreDef = pages.first_child();
     if (!scoreDef || (std::string(scoreDef.name()) != "scoreDef")) {
-        LogWarning("No <scoreDef> provided, trying to proceed... ");
+        VRV_LOG_WARNING("No <scoreDef> provided, trying to proceed... ");
     }
     else {
         // This actually sets the Doc::m_scoreDef
@@ -4195,7 +4341,7 @@ bool MEIInput::ReadPages(Object *parent, pugi::xml_node pages)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <pages>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <pages>", current.name());
         }
     }
 
@@ -4289,7 +4435,7 @@ bool MEIInput::ReadPageChildren(Object *parent, pugi::xml_node parentNode)
             this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <page>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <page>", current.name());
         }
     }
 
@@ -4302,7 +4448,7 @@ bool MEIInput::ReadPageMilestoneEnd(Object *parent, pugi::xml_node milestoneEnd)
 
     // Check that we have a @startid
     if (!milestoneEnd.attribute("startid")) {
-        LogError("Missing @startid on  milestoneEnd");
+        VRV_LOG_ERROR("Missing @startid on  milestoneEnd");
         return false;
     }
 
@@ -4310,14 +4456,14 @@ bool MEIInput::ReadPageMilestoneEnd(Object *parent, pugi::xml_node milestoneEnd)
     std::string startID = milestoneEnd.attribute("startid").value();
     Object *start = m_doc->FindDescendantByID(ExtractIDFragment(startID));
     if (!start) {
-        LogError("Could not find start element '%s' for milestoneEnd", startID.c_str());
+        VRV_LOG_ERROR("Could not find start element '%s' for milestoneEnd", startID.c_str());
         return false;
     }
 
     // Check that it is a page milestone
     PageMilestoneInterface *interface = dynamic_cast<PageMilestoneInterface *>(start);
     if (!interface) {
-        LogError("The start element  '%s' is not a page milestone element", startID.c_str());
+        VRV_LOG_ERROR("The start element  '%s' is not a page milestone element", startID.c_str());
         return false;
     }
 
@@ -4353,7 +4499,7 @@ bool MEIInput::ReadMdivChildren(Object *parent, pugi::xml_node parentNode, bool
 
     if (!m_readingScoreBased) {
         if (parentNode.first_child()) {
-            LogWarning("Unexpected <mdiv> content in page-based MEI");
+            VRV_LOG_WARNING("Unexpected <mdiv> content in page-based MEI");
         }
         return true;
     }
@@ -4373,7 +4519,7 @@ bool MEIInput::ReadMdivChildren(Object *parent, pugi::xml_node parentNode, bool
             // Read only the first score
             success = this->ReadScore(parent, current);
             if (parentNode.last_child() != current) {
-                LogWarning("Skipping nodes after <score> element");
+                VRV_LOG_WARNING("Skipping nodes after <score> element");
             }
             break;
         }
@@ -4382,7 +4528,7 @@ bool MEIInput::ReadMdivChildren(Object *parent, pugi::xml_node parentNode, bool
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <mdiv>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <mdiv>", current.name());
         }
     }
 
@@ -4405,7 +4551,7 @@ bool MEIInput::ReadScore(Object *parent, pugi::xml_node score)
     // We require to have s <scoreDef> as first child of <score>
     pugi::xml_node scoreDef = score.first_child();
     if (!scoreDef || (std::string(scoreDef.name()) != "scoreDef")) {
-        LogError("A <scoreDef> is required as first child of <score>");
+        VRV_LOG_ERROR("A <scoreDef> is required as first child of <score>");
         return false;
     }
 
@@ -4441,7 +4587,7 @@ bool MEIInput::ReadScore(Object *parent, pugi::xml_node score)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Element <%s> within <score> is not supported and will be ignored ", elementName.c_str());
+            VRV_LOG_WARNING("Element <%s> within <score> is not supported and will be ignored ", elementName.c_str());
         }
     }
 
@@ -4469,7 +4615,7 @@ bool MEIInput::ReadSection(Object *parent, pugi::xml_node section)
         return this->ReadSectionChildren(vrvSection, section);
     }
     else if (section.first_child()) {
-        LogWarning("Unexpected <section> content in page-based MEI");
+        VRV_LOG_WARNING("Unexpected <section> content in page-based MEI");
     }
     return true;
 }
@@ -4528,7 +4674,7 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
                     parent->AddChild(unmeasured);
                 }
                 else {
-                    LogError("Unmeasured music within editorial markup is currently not supported");
+                    VRV_LOG_ERROR("Unmeasured music within editorial markup is currently not supported");
                     return false;
                 }
             }
@@ -4547,7 +4693,7 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <section>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <section>", current.name());
         }
     }
 
@@ -4711,7 +4857,7 @@ bool MEIInput::ReadSystemChildren(Object *parent, pugi::xml_node parentNode)
                     system->AddChild(unmeasured);
                 }
                 else {
-                    LogError("Unmeasured music within editorial markup is currently not supported");
+                    VRV_LOG_ERROR("Unmeasured music within editorial markup is currently not supported");
                     return false;
                 }
             }
@@ -4727,7 +4873,7 @@ bool MEIInput::ReadSystemChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <system>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <system>", current.name());
         }
     }
     return success;
@@ -4739,7 +4885,7 @@ bool MEIInput::ReadSystemMilestoneEnd(Object *parent, pugi::xml_node milestoneEn
 
     // Check that we have a @startid
     if (!milestoneEnd.attribute("startid")) {
-        LogError("Missing @startid on  milestoneEnd");
+        VRV_LOG_ERROR("Missing @startid on  milestoneEnd");
         return false;
     }
 
@@ -4747,14 +4893,14 @@ bool MEIInput::ReadSystemMilestoneEnd(Object *parent, pugi::xml_node milestoneEn
     std::string startID = milestoneEnd.attribute("startid").value();
     Object *start = m_doc->FindDescendantByID(ExtractIDFragment(startID));
     if (!start) {
-        LogError("Could not find start element '%s' for milestoneEnd", startID.c_str());
+        VRV_LOG_ERROR("Could not find start element '%s' for milestoneEnd", startID.c_str());
         return false;
     }
 
     // Check that it is a page milestone
     SystemMilestoneInterface *interface = dynamic_cast<SystemMilestoneInterface *>(start);
     if (!interface) {
-        LogError("The start element  '%s' is not a system milestone element", startID.c_str());
+        VRV_LOG_ERROR("The start element  '%s' is not a system milestone element", startID.c_str());
         return false;
     }
 
@@ -4974,7 +5120,7 @@ bool MEIInput::ReadScoreDefChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <scoreDef>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <scoreDef>", current.name());
         }
     }
     return success;
@@ -5051,13 +5197,13 @@ bool MEIInput::ReadStaffGrpChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <staffGrp>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <staffGrp>", current.name());
         }
     }
 
     // Missing staffDefs lead to crashes in the ScoreDefSetCurrent functor
     if (success && missingStaffDef) {
-        LogError("Each <staffGrp> must contain at least one <staffDef>.");
+        VRV_LOG_ERROR("Each <staffGrp> must contain at least one <staffDef>.");
         success = false;
     }
 
@@ -5093,7 +5239,8 @@ bool MEIInput::ReadGrpSym(Object *parent, pugi::xml_node grpSym)
 
     if (parent->Is(SCOREDEF)) {
         if (!vrvGrpSym->HasLevel() || !vrvGrpSym->HasStartid() || !vrvGrpSym->HasEndid()) {
-            LogWarning("<%s>' nested under <scoreDef> must have @level, @startId and @endId attributes", grpSym.name());
+            VRV_LOG_WARNING("<%s>' nested under <scoreDef> must have @level, @startId and @endId attributes",
+                grpSym.name());
             delete vrvGrpSym;
             return true;
         }
@@ -5148,7 +5295,7 @@ bool MEIInput::ReadRunningChildren(Object *parent, pugi::xml_node parentNode, Ob
         if (filter && !this->IsAllowed(elementName, filter)) {
             std::string meiElementName = filter->GetClassName();
             std::transform(meiElementName.begin(), meiElementName.begin() + 1, meiElementName.begin(), ::tolower);
-            LogWarning("Element <%s> within <%s> is not supported and will be ignored ", xmlElement.name(),
+            VRV_LOG_WARNING("Element <%s> within <%s> is not supported and will be ignored ", xmlElement.name(),
                 meiElementName.c_str());
             continue;
         }
@@ -5169,7 +5316,7 @@ bool MEIInput::ReadRunningChildren(Object *parent, pugi::xml_node parentNode, Ob
         }
         // unknown
         else {
-            LogWarning("Element <%s> is unknown and will be ignored", xmlElement.name());
+            VRV_LOG_WARNING("Element <%s> is unknown and will be ignored", xmlElement.name());
         }
     }
     return success;
@@ -5198,7 +5345,7 @@ bool MEIInput::ReadStaffDef(Object *parent, pugi::xml_node staffDef)
     vrvStaffDef->ReadTransposition(staffDef);
 
     if (!vrvStaffDef->HasN()) {
-        LogWarning("No @n on <staffDef> might yield unpredictable results");
+        VRV_LOG_WARNING("No @n on <staffDef> might yield unpredictable results");
     }
 
     this->ReadScoreDefInterface(staffDef, vrvStaffDef);
@@ -5255,7 +5402,7 @@ bool MEIInput::ReadStaffDefChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <staffGrp>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <staffGrp>", current.name());
         }
     }
     return success;
@@ -5288,7 +5435,7 @@ bool MEIInput::ReadTuningChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadCourse(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <staffGrp>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <staffGrp>", current.name());
         }
     }
     return success;
@@ -5333,7 +5480,7 @@ bool MEIInput::ReadSymbolTable(Object *parent, pugi::xml_node symbolTable)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <symbolTable>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <symbolTable>", current.name());
         }
     }
 
@@ -5419,7 +5566,7 @@ bool MEIInput::ReadLayerDefChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <layerDef>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <layerDef>", current.name());
         }
     }
     return success;
@@ -5429,7 +5576,7 @@ bool MEIInput::ReadMeasure(Object *parent, pugi::xml_node measure)
 {
     Measure *vrvMeasure = new Measure();
     if (m_doc->IsMensuralMusicOnly()) {
-        LogWarning("Mixing mensural and non mensural music is not supported. Trying to go ahead...");
+        VRV_LOG_WARNING("Mixing mensural and non mensural music is not supported. Trying to go ahead...");
         m_doc->SetMensuralMusicOnly(false);
     }
     this->SetMeiID(measure, vrvMeasure);
@@ -5562,7 +5709,7 @@ bool MEIInput::ReadMeasureChildren(Object *parent, pugi::xml_node parentNode)
         }
         else if (currentName == "tupletSpan") {
             if (!ReadTupletSpanAsTuplet(dynamic_cast<Measure *>(parent), current)) {
-                LogWarning("<tupletSpan> is not readable as <tuplet> and will be ignored");
+                VRV_LOG_WARNING("<tupletSpan> is not readable as <tuplet> and will be ignored");
             }
         }
         // xml comment
@@ -5570,7 +5717,7 @@ bool MEIInput::ReadMeasureChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <measure>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <measure>", current.name());
         }
     }
     return success;
@@ -5608,7 +5755,7 @@ bool MEIInput::ReadMeterSigGrpChildren(Object *parent, pugi::xml_node parentNode
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <meterSigGrp>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <meterSigGrp>", current.name());
         }
     }
     return success;
@@ -6120,7 +6267,7 @@ bool MEIInput::ReadFbChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <staff>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <staff>", current.name());
         }
     }
     return success;
@@ -6146,7 +6293,7 @@ bool MEIInput::ReadStaff(Object *parent, pugi::xml_node staff)
     }
 
     if (!vrvStaff->HasN() || (vrvStaff->GetN() == 0)) {
-        LogWarning("No @n on <staff> or a value of 0 might yield unpredictable results");
+        VRV_LOG_WARNING("No @n on <staff> or a value of 0 might yield unpredictable results");
     }
 
     parent->AddChild(vrvStaff);
@@ -6176,7 +6323,7 @@ bool MEIInput::ReadStaffChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <staff>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <staff>", current.name());
         }
     }
     return success;
@@ -6193,10 +6340,10 @@ bool MEIInput::ReadLayer(Object *parent, pugi::xml_node layer)
     vrvLayer->ReadVisibility(layer);
 
     if (!vrvLayer->HasN()) {
-        LogWarning("Missing @n on <layer>, filled by order");
+        VRV_LOG_WARNING("Missing @n on <layer>, filled by order");
     }
     else if (vrvLayer->GetN() == 0) {
-        LogWarning("Value @n='0' on <layer> might yield unpredictable results");
+        VRV_LOG_WARNING("Value @n='0' on <layer> might yield unpredictable results");
     }
 
     parent->AddChild(vrvLayer);
@@ -6218,7 +6365,7 @@ bool MEIInput::ReadLayerChildren(Object *parent, pugi::xml_node parentNode, Obje
         if (!this->IsAllowed(elementName, filter)) {
             std::string meiElementName = filter->GetClassName();
             std::transform(meiElementName.begin(), meiElementName.begin() + 1, meiElementName.begin(), ::tolower);
-            LogWarning("Element <%s> within <%s> is not supported and will be ignored ", xmlElement.name(),
+            VRV_LOG_WARNING("Element <%s> within <%s> is not supported and will be ignored ", xmlElement.name(),
                 meiElementName.c_str());
             continue;
         }
@@ -6374,7 +6521,7 @@ bool MEIInput::ReadLayerChildren(Object *parent, pugi::xml_node parentNode, Obje
         }
         // unknown
         else {
-            LogWarning("Element <%s> is unknown and will be ignored", xmlElement.name());
+            VRV_LOG_WARNING("Element <%s> is unknown and will be ignored", xmlElement.name());
         }
     }
     return success;
@@ -7186,7 +7333,7 @@ bool MEIInput::ReadTextChildren(Object *parent, pugi::xml_node parentNode, Objec
         if (filter && !this->IsAllowed(elementName, filter)) {
             std::string meiElementName = filter->GetClassName();
             std::transform(meiElementName.begin(), meiElementName.begin() + 1, meiElementName.begin(), ::tolower);
-            LogWarning("Element <%s> within <%s> is not supported and will be ignored ", xmlElement.name(),
+            VRV_LOG_WARNING("Element <%s> within <%s> is not supported and will be ignored ", xmlElement.name(),
                 meiElementName.c_str());
             continue;
         }
@@ -7228,7 +7375,7 @@ bool MEIInput::ReadTextChildren(Object *parent, pugi::xml_node parentNode, Objec
         }
         // unknown
         else {
-            LogWarning("Element <%s> is unknown and will be ignored", xmlElement.name());
+            VRV_LOG_WARNING("Element <%s> is unknown and will be ignored", xmlElement.name());
         }
         ++i;
     }
@@ -7249,7 +7396,7 @@ bool MEIInput::ReadSymbolDefChildren(Object *parent, pugi::xml_node parentNode,
         if (filter && !this->IsAllowed(elementName, filter)) {
             std::string meiElementName = filter->GetClassName();
             std::transform(meiElementName.begin(), meiElementName.begin() + 1, meiElementName.begin(), ::tolower);
-            LogWarning("Element <%s> within <%s> is not supported and will be ignored ", xmlElement.name(),
+            VRV_LOG_WARNING("Element <%s> within <%s> is not supported and will be ignored ", xmlElement.name(),
                 meiElementName.c_str());
             continue;
         }
@@ -7266,7 +7413,7 @@ bool MEIInput::ReadSymbolDefChildren(Object *parent, pugi::xml_node parentNode,
         }
         // unknown
         else {
-            LogWarning("Element <%s> is unknown and will be ignored", xmlElement.name());
+            VRV_LOG_WARNING("Element <%s> is unknown and will be ignored", xmlElement.name());
         }
     }
     return success;
@@ -7346,7 +7493,8 @@ bool MEIInput::ReadRend(Object *parent, pugi::xml_node rend)
     vrvRend->ReadWhitespace(rend);
 
     if (vrvRend->GetFirstAncestor(REND) && (vrvRend->HasHalign() || vrvRend->HasValign())) {
-        LogWarning("@halign or @valign in nested <rend> element <rend> %s will be ignored", vrvRend->GetID().c_str());
+        VRV_LOG_WARNING("@halign or @valign in nested <rend> element <rend> %s will be ignored",
+            vrvRend->GetID().c_str());
         // Eventually to be added to unsupported attributes?
         vrvRend->SetHalign(HORIZONTALALIGNMENT_NONE);
         vrvRend->SetValign(VERTICALALIGNMENT_NONE);
@@ -7354,7 +7502,8 @@ bool MEIInput::ReadRend(Object *parent, pugi::xml_node rend)
     // Previously we would use @fontame="VerovioText"
     // Now changeto @glyph.auth="smufl"
     if (vrvRend->HasFontname() && vrvRend->GetFontname() == "VerovioText") {
-        LogWarning("Using rend@fontname with 'VerovioText' is deprecated. Use 'rend@glyph.auth=\"smufl\"' instead");
+        VRV_LOG_WARNING(
+            "Using rend@fontname with 'VerovioText' is deprecated. Use 'rend@glyph.auth=\"smufl\"' instead");
         vrvRend->SetGlyphAuth("smufl");
         vrvRend->SetFontname("");
     }
@@ -7380,7 +7529,7 @@ bool MEIInput::ReadSvg(Object *parent, pugi::xml_node svg)
         vrvSvg->Set(svg);
     }
     else {
-        LogWarning("No svg content found for <fig> %s", parent->GetID().c_str());
+        VRV_LOG_WARNING("No svg content found for <fig> %s", parent->GetID().c_str());
     }
 
     parent->AddChild(vrvSvg);
@@ -7667,7 +7816,7 @@ bool MEIInput::ReadAnnot(Object *parent, pugi::xml_node annot)
 bool MEIInput::ReadApp(Object *parent, pugi::xml_node app, EditorialLevel level, Object *filter)
 {
     if (!m_hasScoreDef) {
-        LogError("<app> before any <scoreDef> is not supported");
+        VRV_LOG_ERROR("<app> before any <scoreDef> is not supported");
         return false;
     }
     App *vrvApp = new App(level);
@@ -7707,7 +7856,7 @@ bool MEIInput::ReadAppChildren(Object *parent, pugi::xml_node parentNode, Editor
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <app>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <app>", current.name());
         }
         // Now we check if the xpath selection (if any) matches the current node.
         // If yes, make it visible
@@ -7727,7 +7876,7 @@ bool MEIInput::ReadAppChildren(Object *parent, pugi::xml_node parentNode, Editor
             first->m_visibility = Visible;
         }
         else {
-            LogWarning("Could not make one <rdg> or <lem> visible");
+            VRV_LOG_WARNING("Could not make one <rdg> or <lem> visible");
         }
     }
     return success;
@@ -7736,7 +7885,7 @@ bool MEIInput::ReadAppChildren(Object *parent, pugi::xml_node parentNode, Editor
 bool MEIInput::ReadChoice(Object *parent, pugi::xml_node choice, EditorialLevel level, Object *filter)
 {
     if (!m_hasScoreDef) {
-        LogError("<choice> before any <scoreDef> is not supported");
+        VRV_LOG_ERROR("<choice> before any <scoreDef> is not supported");
         return false;
     }
     Choice *vrvChoice = new Choice(level);
@@ -7799,7 +7948,7 @@ bool MEIInput::ReadChoiceChildren(Object *parent, pugi::xml_node parentNode, Edi
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <choice>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <choice>", current.name());
         }
         // Now we check if the xpath selection (if any) matches the current node.
         // If yes, make it visible
@@ -7822,7 +7971,7 @@ bool MEIInput::ReadChoiceChildren(Object *parent, pugi::xml_node parentNode, Edi
             first->m_visibility = Visible;
         }
         else {
-            LogWarning("Could not make one child of <choice> visible");
+            VRV_LOG_WARNING("Could not make one child of <choice> visible");
         }
     }
     return success;
@@ -7969,7 +8118,7 @@ bool MEIInput::ReadSic(Object *parent, pugi::xml_node sic, EditorialLevel level,
 bool MEIInput::ReadSubst(Object *parent, pugi::xml_node subst, EditorialLevel level, Object *filter)
 {
     if (!m_hasScoreDef) {
-        LogError("<subst> before any <scoreDef> is not supported");
+        VRV_LOG_ERROR("<subst> before any <scoreDef> is not supported");
         return false;
     }
     Subst *vrvSubst = new Subst(level);
@@ -8014,7 +8163,7 @@ bool MEIInput::ReadSubstChildren(Object *parent, pugi::xml_node parentNode, Edit
             success = this->ReadXMLComment(parent, current);
         }
         else {
-            LogWarning("Unsupported '<%s>' within <subst>", current.name());
+            VRV_LOG_WARNING("Unsupported '<%s>' within <subst>", current.name());
         }
         // Now we check if the xpath selection (if any) matches the current node.
         // If yes, make it visible
@@ -8037,7 +8186,7 @@ bool MEIInput::ReadSubstChildren(Object *parent, pugi::xml_node parentNode, Edit
             first->m_visibility = Visible;
         }
         else {
-            LogWarning("Could not make one child of <subst> visible");
+            VRV_LOG_WARNING("Could not make one child of <subst> visible");
         }
     }
     return success;
@@ -8111,7 +8260,7 @@ bool MEIInput::ReadEditorialChildren(Object *parent, pugi::xml_node parentNode,
 bool MEIInput::ReadTupletSpanAsTuplet(Measure *measure, pugi::xml_node tupletSpan)
 {
     if (!measure) {
-        LogWarning("Cannot read <tupletSpan> within editorial markup");
+        VRV_LOG_WARNING("Cannot read <tupletSpan> within editorial markup");
         return false;
     }
 
@@ -8169,14 +8318,14 @@ bool MEIInput::ReadTupletSpanAsTuplet(Measure *measure, pugi::xml_node tupletSpa
         std::string refId = ExtractIDFragment(tupletSpan.attribute("startid").value());
         start = dynamic_cast<LayerElement *>(measure->FindDescendantByID(refId));
         if (!start) {
-            LogWarning("Element with @startid '%s' not found when trying to read the <tupletSpan>", refId.c_str());
+            VRV_LOG_WARNING("Element with @startid '%s' not found when trying to read the <tupletSpan>", refId.c_str());
         }
     }
     if (tupletSpan.attribute("endid")) {
         std::string refId = ExtractIDFragment(tupletSpan.attribute("endid").value());
         end = dynamic_cast<LayerElement *>(measure->FindDescendantByID(refId));
         if (!end) {
-            LogWarning("Element with @endid '%s' not found when trying to read the <tupletSpan>", refId.c_str());
+            VRV_LOG_WARNING("Element with @endid '%s' not found when trying to read the <tupletSpan>", refId.c_str());
         }
     }
     if (!start || !end) {
@@ -8188,7 +8337,7 @@ bool MEIInput::ReadTupletSpanAsTuplet(Measure *measure, pugi::xml_node tupletSpa
     LayerElement *endChild = dynamic_cast<LayerElement *>(end->GetLastAncestorNot(LAYER));
 
     if (!startChild || !endChild || (startChild->GetParent() != endChild->GetParent())) {
-        LogWarning("Start and end elements for <tupletSpan> '%s' not in the same layer", tuplet->GetID().c_str());
+        VRV_LOG_WARNING("Start and end elements for <tupletSpan> '%s' not in the same layer", tuplet->GetID().c_str());
         delete tuplet;
         return false;
     }
@@ -8229,7 +8378,7 @@ DocType MEIInput::StrToDocType(std::string type)
     if (type == "rendering") return Rendering;
     if (type == "transcription") return Transcription;
     if (type == "facsimile") return Facs;
-    LogWarning("Unknown layout type '%s'", type.c_str());
+    VRV_LOG_WARNING("Unknown layout type '%s'", type.c_str());
     return Raw;
 }
 
@@ -8463,7 +8612,7 @@ void MEIInput::UpgradeDurGesTo_4_0_0(pugi::xml_node element, DurationInterface *
                 interface->SetDurReal(std::stof(durGes));
             }
             catch (const std::invalid_argument &ia) {
-                LogError("Upgrading to 4.0.0: %s", ia.what());
+                VRV_LOG_ERROR("Upgrading to 4.0.0: %s", ia.what());
             }
         }
         element.remove_attribute("dur.ges");
@@ -8499,7 +8648,7 @@ void MEIInput::UpgradeMordentTo_4_0_0(pugi::xml_node mordent, Mordent *vrvMorden
             vrvMordent->SetForm(mordentLog_FORM_upper);
         }
         else {
-            LogWarning("Unsupported value '%s' for att.mordent.log@form (MEI 3.0)", form.c_str());
+            VRV_LOG_WARNING("Unsupported value '%s' for att.mordent.log@form (MEI 3.0)", form.c_str());
         }
         mordent.remove_attribute("form");
     }
@@ -8516,7 +8665,7 @@ void MEIInput::UpgradeScoreDefElementTo_4_0_0(pugi::xml_node scoreDefElement, Sc
             scoreDefElement.remove_attribute("key.sig.show");
         }
         else {
-            LogWarning("No keySig found when trying to upgrade '@key.sig.show'");
+            VRV_LOG_WARNING("No keySig found when trying to upgrade '@key.sig.show'");
         }
     }
     if (scoreDefElement.attribute("key.sig.showchange")) {
@@ -8531,7 +8680,7 @@ void MEIInput::UpgradeScoreDefElementTo_4_0_0(pugi::xml_node scoreDefElement, Sc
             scoreDefElement.remove_attribute("key.sig.showchange");
         }
         else {
-            LogWarning("No keySig found when trying to upgrade '@key.sig.showchange'");
+            VRV_LOG_WARNING("No keySig found when trying to upgrade '@key.sig.showchange'");
         }
     }
     if (scoreDefElement.attribute("meter.rend")) {
@@ -8598,7 +8747,7 @@ void MEIInput::UpgradeTurnTo_4_0_0(pugi::xml_node turn, Turn *vrvTurn)
             vrvTurn->SetForm(turnLog_FORM_lower);
         }
         else {
-            LogWarning("Unsupported value '%s' for att.turn.log@form (MEI 3.0)", form.c_str());
+            VRV_LOG_WARNING("Unsupported value '%s' for att.turn.log@form (MEI 3.0)", form.c_str());
         }
         turn.remove_attribute("form");
     }
@@ -8662,7 +8811,7 @@ bool MEIInput::ReadSurface(Facsimile *parent, pugi::xml_node surface)
             this->ReadZone(vrvSurface, child);
         }
         else {
-            LogWarning("Unsupported element <%s> in <surface>", child.name());
+            VRV_LOG_WARNING("Unsupported element <%s> in <surface>", child.name());
         }
     }
     parent->AddChild(vrvSurface);
@@ -8694,7 +8843,7 @@ bool MEIInput::ReadFacsimile(Doc *doc, pugi::xml_node facsimile)
             this->ReadSurface(vrvFacsimile, child);
         }
         else {
-            LogWarning("Unsupported element <%s> in <facsimile>", child.name());
+            VRV_LOG_WARNING("Unsupported element <%s> in <facsimile>", child.name());
         }
     }
     doc->SetFacsimile(vrvFacsimile);
@@ -120,17 +120,30 @@ MusicXmlInput::~MusicXmlInput()
 #ifndef NO_MUSICXML_SUPPORT
 
 bool MusicXmlInput::Import(const std::string &musicxml)
+{
+    pugi::xml_document xmlDoc;
+    xmlDoc.load_buffer(musicxml.data(), musicxml.size(), pugi::parse_default, pugi::encoding_utf8);
+    return this->ImportDocument(xmlDoc);
+}
+
+bool MusicXmlInput::ImportInplace(std::string &musicxml)
+{
+    // The parsed document points into the buffer, which is not copied
+    pugi::xml_document xmlDoc;
+    xmlDoc.load_buffer_inplace(musicxml.data(), musicxml.size(), pugi::parse_default, pugi::encoding_utf8);
+    return this->ImportDocument(xmlDoc);
+}
+
+bool MusicXmlInput::ImportDocument(pugi::xml_document &xmlDoc)
 {
     try {
         m_doc->Reset();
         m_doc->SetType(Raw);
-        pugi::xml_document xmlDoc;
-        xmlDoc.load_string(musicxml.c_str());
         pugi::xml_node root = xmlDoc.first_child();
         return ReadMusicXml(root);
     }
     catch (char *str) {
-        LogError("%s", str);
+        VRV_LOG_ERROR("%s", str);
         return false;
     }
 }
@@ -196,7 +209,7 @@ void MusicXmlInput::ProcessClefChangeQueue(Section *section)
         AttNNumberLikeComparison comparisonMeasure(MEASURE, clefChange.m_measureNum);
         Measure *currentMeasure = vrv_cast<Measure *>(section->FindDescendantByComparison(&comparisonMeasure));
         if (!currentMeasure) {
-            LogWarning("MusicXML import: Clef change at measure %s, staff %d, time %d not inserted",
+            VRV_LOG_WARNING("MusicXML import: Clef change at measure %s, staff %d, time %d not inserted",
                 clefChange.m_measureNum.c_str(), clefChange.m_staff->GetN(), clefChange.m_scoreOnset);
             delete clefChange.m_clef;
             continue;
@@ -388,7 +401,7 @@ void MusicXmlInput::AddMeasure(Section *section, Measure *measure, int i)
         }
         else {
             // The measure was not transferred and not added to the tree. Its entire content will be deleted at the end.
-            LogError("MusicXML import: Mismatching measure number %s", measure->GetN().c_str());
+            VRV_LOG_ERROR("MusicXML import: Mismatching measure number %s", measure->GetN().c_str());
         }
         contentMeasure = existingMeasure;
 
@@ -450,7 +463,7 @@ Layer *MusicXmlInput::SelectLayer(pugi::xml_node node, Measure *measure)
     // Find voice number of node
     short int layerNum = (node.child("voice")) ? node.child("voice").text().as_int() : 1;
     if (layerNum < 1) {
-        LogWarning("MusicXML import: Layer %d cannot be found", layerNum);
+        VRV_LOG_WARNING("MusicXML import: Layer %d cannot be found", layerNum);
         layerNum = 1;
     }
 
@@ -466,7 +479,7 @@ Layer *MusicXmlInput::SelectLayer(pugi::xml_node node, Measure *measure)
     // if not, take staff info of node element
     short int staffNum = (node.child("staff")) ? node.child("staff").text().as_int() : 1;
     if ((staffNum < 1) || (staffNum > measure->GetChildCount(STAFF))) {
-        LogWarning("MusicXML import: Staff %d cannot be found", staffNum);
+        VRV_LOG_WARNING("MusicXML import: Staff %d cannot be found", staffNum);
         staffNum = 1;
     }
     staffNum--;
@@ -824,7 +837,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
     // check for multimetric music
     bool multiMetric = root.select_node("/score-partwise/part/measure[@non-controlling='yes']");
     if (multiMetric) {
-        LogError("MusicXML import: Multimetric music detected. Import cancelled.");
+        VRV_LOG_ERROR("MusicXML import: Multimetric music detected. Import cancelled.");
         exit(1);
     }
 
@@ -984,7 +997,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
             std::string xpath = StringFormat("/score-partwise/part[@id='%s']/measure[1]", partId.c_str());
             pugi::xpath_node partFirstMeasure = root.select_node(xpath.c_str());
             if (!partFirstMeasure.node().child("attributes")) {
-                LogWarning("MusicXML import: Could not find the 'attributes' element in the first "
+                VRV_LOG_WARNING("MusicXML import: Could not find the 'attributes' element in the first "
                            "measure of part '%s'",
                     partId.c_str());
                 continue;
@@ -1077,7 +1090,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
             xpath = StringFormat("/score-partwise/part[@id='%s']", partId.c_str());
             pugi::xpath_node part = root.select_node(xpath.c_str());
             if (!part) {
-                LogWarning("MusicXML import: Could not find the part '%s'", partId.c_str());
+                VRV_LOG_WARNING("MusicXML import: Could not find the part '%s'", partId.c_str());
                 continue;
             }
             ReadMusicXmlPart(part.node(), section, nbStaves, staffOffset);
@@ -1099,7 +1112,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
             measure = vrv_cast<Measure *>(section->FindDescendantByComparison(&comparisonMeasure, 1));
         }
         if (!measure) {
-            LogWarning("MusicXML import: Element '%s' could not be added to measure %s",
+            VRV_LOG_WARNING("MusicXML import: Element '%s' could not be added to measure %s",
                 iter->second->GetClassName().c_str(), iter->first.c_str());
             delete iter->second;
             continue;
@@ -1141,7 +1154,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
                 ending->AddChild(*jter); // add <measure> to <ending>
                 logString = logString + ((*jter == measureList.back()) ? ")." : ", ");
             }
-            LogDebug(logString.c_str());
+            VRV_LOG_DEBUG(logString.c_str());
         }
         m_endingStack.clear();
     }
@@ -1150,24 +1163,24 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
 
     // clean up stacks
     if (!m_beamspanStack.empty()) {
-        LogWarning("MusicXML import: There are %d beamspans left without ending", m_beamspanStack.size());
+        VRV_LOG_WARNING("MusicXML import: There are %d beamspans left without ending", m_beamspanStack.size());
         m_beamspanStack.clear();
     }
 
     if (!m_tieStack.empty()) {
-        LogWarning("MusicXML import: There are %d ties left open", m_tieStack.size());
+        VRV_LOG_WARNING("MusicXML import: There are %d ties left open", m_tieStack.size());
         m_tieStack.clear();
     }
     if (!m_slurStack.empty()) { // There are slurs left open
         for (auto iter = m_slurStack.begin(); iter != m_slurStack.end(); ++iter) {
-            LogWarning("MusicXML import: slur %d from measure %s could not be ended", iter->second.m_number,
+            VRV_LOG_WARNING("MusicXML import: slur %d from measure %s could not be ended", iter->second.m_number,
                 iter->second.m_measureNum.c_str());
         }
         m_slurStack.clear();
     }
     if (!m_slurStopStack.empty()) { // There are slurs ends without opening
         for (auto iter = m_slurStopStack.begin(); iter != m_slurStopStack.end(); ++iter) {
-            LogWarning("MusicXML import: slur ending for element '%s' could not be "
+            VRV_LOG_WARNING("MusicXML import: slur ending for element '%s' could not be "
                        "matched to a start element",
                 iter->first->GetID().c_str());
         }
@@ -1175,13 +1188,14 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
     }
     if (!m_glissStack.empty()) {
         for (auto iter = m_glissStack.begin(); iter != m_glissStack.end(); ++iter) {
-            LogWarning("MusicXML import: gliss for '%s' could not be closed", (*iter)->GetID().c_str());
+            VRV_LOG_WARNING("MusicXML import: gliss for '%s' could not be closed", (*iter)->GetID().c_str());
         }
         m_glissStack.clear();
     }
     if (!m_trillStack.empty()) { // open trills without ending
         for (auto iter = m_trillStack.begin(); iter != m_trillStack.end(); ++iter) {
-            LogWarning("MusicXML import: trill extender for '%s' could not be ended", iter->first->GetID().c_str());
+            VRV_LOG_WARNING("MusicXML import: trill extender for '%s' could not be ended",
+                iter->first->GetID().c_str());
         }
         m_trillStack.clear();
     }
@@ -1558,7 +1572,7 @@ bool MusicXmlInput::ReadMusicXmlPart(pugi::xml_node node, Section *section, shor
 
     pugi::xpath_node_set measures = node.select_nodes("measure");
     if (measures.size() == 0) {
-        LogWarning("MusicXML import: No measure to load");
+        VRV_LOG_WARNING("MusicXML import: No measure to load");
         return false;
     }
 
@@ -1596,19 +1610,19 @@ bool MusicXmlInput::ReadMusicXmlPart(pugi::xml_node node, Section *section, shor
     // clean up part specific stacks
     if (!m_openDashesStack.empty()) { // open dashes without ending
         for (auto iter = m_openDashesStack.begin(); iter != m_openDashesStack.end(); ++iter) {
-            LogWarning(
+            VRV_LOG_WARNING(
                 "MusicXML import: dashes/extender lines for '%s' could not be closed", iter->first->GetID().c_str());
         }
         m_openDashesStack.clear();
     }
     if (!m_bracketStack.empty()) { // open brackets without ending
         for (auto iter = m_bracketStack.begin(); iter != m_bracketStack.end(); ++iter) {
-            LogWarning("MusicXML import: bracketSpan for '%s' could not be closed", iter->first->GetID().c_str());
+            VRV_LOG_WARNING("MusicXML import: bracketSpan for '%s' could not be closed", iter->first->GetID().c_str());
         }
         m_bracketStack.clear();
     }
     if (!m_hairpinStack.empty()) {
-        LogWarning("MusicXML import: There are %d hairpins left open", m_hairpinStack.size());
+        VRV_LOG_WARNING("MusicXML import: There are %d hairpins left open", m_hairpinStack.size());
         m_hairpinStack.clear();
     }
 
@@ -1900,7 +1914,7 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, c
             measure->SetLeft(BARRENDITION_rptstart);
         }
         else if (HasAttributeWithValue(node, "location", "middle")) {
-            LogWarning("MusicXML import: Unsupported barline location 'middle' in %s", measure->GetN().c_str());
+            VRV_LOG_WARNING("MusicXML import: Unsupported barline location 'middle' in %s", measure->GetN().c_str());
         }
         else {
             measure->SetRight(BARRENDITION_rptend);
@@ -1925,7 +1939,7 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, c
         }
         else if (endingType == "stop" || endingType == "discontinue") {
             if (m_endingStack.empty()) {
-                LogWarning("MusicXML import: Dangling ending tag skipped");
+                VRV_LOG_WARNING("MusicXML import: Dangling ending tag skipped");
             }
             else {
                 m_currentEndingStop = musicxml::EndingInfo(endingNumber, endingType, endingText);
@@ -1943,7 +1957,7 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, c
             fermata->SetTstamp(0);
         }
         else if (HasAttributeWithValue(node, "location", "middle")) {
-            LogWarning("MusicXML import: Unsupported barline location 'middle'");
+            VRV_LOG_WARNING("MusicXML import: Unsupported barline location 'middle'");
         }
         else {
             fermata->SetTstamp((double)(m_durTotal) * (double)m_meterUnit / (double)(4 * m_ppq) + 1.0);
@@ -2099,7 +2113,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
                 m_openDashesStack.push_back({ controlElement, openDashes });
             }
             else {
-                LogInfo("MusicXmlImport: dashes could not be matched to <dir> or <dynam> in measure %s.",
+                VRV_LOG_INFO("MusicXmlImport: dashes could not be matched to <dir> or <dynam> in measure %s.",
                     measureNum.c_str());
             }
         }
@@ -2344,7 +2358,8 @@ void MusicXmlInput::ReadMusicXmlDirection(
                         octave->SetEndid(m_ID);
                     }
                     else {
-                        LogWarning("MusicXML import: octave for '%s' could not be closed", octave->GetID().c_str());
+                        VRV_LOG_WARNING("MusicXML import: octave for '%s' could not be closed",
+                            octave->GetID().c_str());
                     }
                 }
             }
@@ -2517,7 +2532,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     // other cases
     if (!containsDynamics && !containsTempo && !containsWords && !xmlCoda && !bracket && !lead && !xmlSegno && !xmlShift
         && !xmlPedal && wedges.empty() && !dashes && !rehearsal) {
-        LogWarning("MusicXML import: Unsupported direction-type '%s'", typeNode.first_child().name());
+        VRV_LOG_WARNING("MusicXML import: Unsupported direction-type '%s'", typeNode.first_child().name());
     }
 }
 
@@ -2919,7 +2934,7 @@ void MusicXmlInput::ReadMusicXmlNote(
             if (noteHeadFill) note->SetHeadFill(noteHeadFill.as_bool() ? FILL_solid : FILL_void);
             if (!std::strncmp(notehead.text().as_string(), "none", 4)) note->SetHeadVisible(BOOLEAN_false);
         }
-        if (node.child("notehead-text")) LogWarning("MusicXML import: notehead-text is not supported");
+        if (node.child("notehead-text")) VRV_LOG_WARNING("MusicXML import: notehead-text is not supported");
 
         // look at the next note to see if we are starting or ending a chord
         pugi::xpath_node nextNote = node.select_node("./following-sibling::note");
@@ -2977,7 +2992,7 @@ void MusicXmlInput::ReadMusicXmlNote(
                 chord = vrv_cast<Chord *>(m_elementStackMap.at(layer).back());
             }
             if (!chord) {
-                LogError("MusicXML import: Chord starting point has not been found");
+                VRV_LOG_ERROR("MusicXML import: Chord starting point has not been found");
                 return;
             }
             // Mark a chord as cue=true if and only if all its child notes are cue.
@@ -3540,7 +3555,7 @@ void MusicXmlInput::ReadMusicXmlNote(
                 turn->SetAccidlower(ConvertAccidentalToAccid(xmlAccidMark.text().as_string()));
             }
             else {
-                LogWarning("MusicXML import: Cannot add an accidental to a turn without placement");
+                VRV_LOG_WARNING("MusicXML import: Cannot add an accidental to a turn without placement");
             }
         }
         if (xmlTurn.node().attribute("slash").as_bool()) {
@@ -3782,7 +3797,7 @@ bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Laye
             std::string measureName = (currentMeasure.node().attribute("id"))
                 ? currentMeasure.node().attribute("id").as_string()
                 : currentMeasure.node().attribute("number").as_string();
-            LogDebug("MusicXML import: Beam without end in measure %s treated as <beamSpan>", measureName.c_str());
+            VRV_LOG_DEBUG("MusicXML import: Beam without end in measure %s treated as <beamSpan>", measureName.c_str());
             return false;
         }
         // form vector of the beam nodes and find whether there are tuplets that start or end within the beam
@@ -3836,7 +3851,7 @@ void MusicXmlInput::ReadMusicXmlBeamStart(const pugi::xml_node &node, const pugi
 {
     if (!beamStart || (node.select_node("notations/ornaments/tremolo[@type='start']"))) return;
     if (m_elementStackMap.at(layer).size() > 0 && m_elementStackMap.at(layer).back()->Is(BEAM)) {
-        LogDebug("MusicXML import: Adding a beam to a beam");
+        VRV_LOG_DEBUG("MusicXML import: Adding a beam to a beam");
         if (!node.child("grace")) return;
     }
 
@@ -3998,7 +4013,7 @@ KeySig *MusicXmlInput::ConvertKey(const pugi::xml_node &key)
                     keyAccid->SetGlyphName(keyStep.next_sibling().next_sibling().attribute("smufl").as_string());
                 }
                 else if (!keyAccid->HasAccid()) {
-                    LogWarning("MusicXML import: Could not properly set keyAccid");
+                    VRV_LOG_WARNING("MusicXML import: Could not properly set keyAccid");
                 }
             }
             keySig->AddChild(keyAccid);
@@ -4094,7 +4109,7 @@ data_ACCIDENTAL_WRITTEN MusicXmlInput::ConvertAccidentalToAccid(const std::strin
         return result->second;
     }
 
-    LogWarning("MusicXML import: Unsupported accidental value '%s'", value.c_str());
+    VRV_LOG_WARNING("MusicXML import: Unsupported accidental value '%s'", value.c_str());
     return ACCIDENTAL_WRITTEN_NONE;
 }
 
@@ -4178,7 +4193,7 @@ data_BARRENDITION MusicXmlInput::ConvertStyleToRend(const std::string &value, co
     if (value == "regular") return BARRENDITION_single;
     if (value == "short") return BARRENDITION_single;
     if (value == "tick") return BARRENDITION_single;
-    LogWarning("MusicXML import: Unsupported bar-style '%s'", value.c_str());
+    VRV_LOG_WARNING("MusicXML import: Unsupported bar-style '%s'", value.c_str());
     return BARRENDITION_NONE;
 }
 
@@ -4214,7 +4229,7 @@ data_DURATION MusicXmlInput::ConvertTypeToDur(const std::string &value)
         return result->second;
     }
 
-    LogWarning("MusicXML import: Unsupported note-type-value '%s'", value.c_str());
+    VRV_LOG_WARNING("MusicXML import: Unsupported note-type-value '%s'", value.c_str());
     return DURATION_NONE;
 }
 
@@ -4261,7 +4276,7 @@ std::u32string MusicXmlInput::ConvertTypeToVerovioText(const std::string &value)
         return result->second;
     }
 
-    LogWarning("MusicXML import: Unsupported type '%s'", value.c_str());
+    VRV_LOG_WARNING("MusicXML import: Unsupported type '%s'", value.c_str());
     return std::u32string();
 }
 
@@ -4335,7 +4350,7 @@ data_PITCHNAME MusicXmlInput::ConvertStepToPitchName(const std::string &value)
         return result->second;
     }
 
-    LogWarning("MusicXML import: Unsupported step value '%s'", value.c_str());
+    VRV_LOG_WARNING("MusicXML import: Unsupported step value '%s'", value.c_str());
     return PITCHNAME_NONE;
 }
 
@@ -4384,7 +4399,7 @@ pedalLog_DIR MusicXmlInput::ConvertPedalTypeToDir(const std::string &value)
         return result->second;
     }
 
-    LogWarning("MusicXML import: Unsupported type '%s' for pedal", value.c_str());
+    VRV_LOG_WARNING("MusicXML import: Unsupported type '%s' for pedal", value.c_str());
     return pedalLog_DIR_NONE;
 }
 
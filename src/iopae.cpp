@@ -15,6 +15,7 @@
 #include <regex>
 #include <sstream>
 #include <string>
+#include <tuple>
 
 //----------------------------------------------------------------------------
 
@@ -538,7 +539,7 @@ void PAEOutput::WriteTuplet(Tuplet *tuplet)
         case (DUR_32): dur = "3"; break;
         case (DUR_64): dur = "5"; break;
         case (DUR_128): dur = "7"; break;
-        default: LogWarning("Unsupported tuplet duration"); dur = "4";
+        default: VRV_LOG_WARNING("Unsupported tuplet duration"); dur = "4";
     }
 
     // For duration to be written within the tuplet
@@ -575,7 +576,7 @@ std::string PAEOutput::GetPaeDur(data_DURATION ndur, int ndots)
         case (DURATION_semiminima): dur = "4"; break;
         case (DURATION_fusa): dur = "8"; break;
         case (DURATION_semifusa): dur = "6"; break;
-        default: LogWarning("Unsupported duration"); dur = "4";
+        default: VRV_LOG_WARNING("Unsupported duration"); dur = "4";
     }
 
     if (ndots > 0) {
@@ -772,7 +773,7 @@ void PAEInput::parsePlainAndEasy(std::istream &infile)
             strcpy(incipit, data_value);
         }
         else {
-            LogWarning("Unknown row '%s' in incipit data", data_line);
+            VRV_LOG_WARNING("Unknown row '%s' in incipit data", data_line);
         }
     }
 
@@ -1074,7 +1075,7 @@ void PAEInput::parsePlainAndEasy(std::istream &infile)
     score->GetScoreDef()->AddChild(staffGrp);
 
     if (m_tie != NULL) {
-        LogWarning("Open tie will not render because tstamp2 is missing");
+        VRV_LOG_WARNING("Open tie will not render because tstamp2 is missing");
     }
 
     m_doc->ConvertToPageBasedDoc();
@@ -1126,12 +1127,12 @@ int PAEInput::getDuration(const char *incipit, data_DURATION *duration, int *dot
             case '2': *duration = DURATION_minima; break;
             case '3':
                 *duration = DURATION_breve;
-                LogWarning("Duration '3' unsupported with mensural notation, using breve instead");
+                VRV_LOG_WARNING("Duration '3' unsupported with mensural notation, using breve instead");
                 break;
             case '4': *duration = DURATION_semiminima; break;
             case '5':
                 *duration = DURATION_breve;
-                LogWarning("Duration '5' unsupported with mensural notation, using breve instead");
+                VRV_LOG_WARNING("Duration '5' unsupported with mensural notation, using breve instead");
                 break;
             case '6': *duration = DURATION_semifusa; break;
             case '7': *duration = DURATION_breve; break;
@@ -1163,7 +1164,7 @@ int PAEInput::getDuration(const char *incipit, data_DURATION *duration, int *dot
         // neumatic notation
         *duration = DURATION_breve;
         *dot = 0;
-        LogWarning("Plaine & Easie import: neumatic notation is not supported, using breve instead");
+        VRV_LOG_WARNING("Plaine & Easie import: neumatic notation is not supported, using breve instead");
     }
 
     return i - index;
@@ -1290,7 +1291,7 @@ int PAEInput::getTupletFermata(const char *incipit, pae::Note *note, int index)
 
                 // If we have extraneous chars, exit here
                 if (!isdigit(incipit[t + t2])) {
-                    LogDebug("Plaine & Easie import: non-number in tuplet number found");
+                    VRV_LOG_DEBUG("Plaine & Easie import: non-number in tuplet number found");
                     free(buf);
                     return i - index;
                 }
@@ -1313,7 +1314,7 @@ int PAEInput::getTupletFermata(const char *incipit, pae::Note *note, int index)
     }
     else {
         if (note->tuplet_notes > 0) {
-            LogWarning("Plaine & Easie import: fermatas within tuplets won't be handled correctly");
+            VRV_LOG_WARNING("Plaine & Easie import: fermatas within tuplets won't be handled correctly");
         }
         note->fermata = true;
     }
@@ -1464,7 +1465,7 @@ int PAEInput::getTimeInfo(const char *incipit, MeterSig *meter, Mensur *mensur,
             meter->SetUnit(2);
         }
         else {
-            LogWarning("Plaine & Easie import: unsupported time signature: %s", timesig_str);
+            VRV_LOG_WARNING("Plaine & Easie import: unsupported time signature: %s", timesig_str);
         }
     }
     else {
@@ -1502,7 +1503,7 @@ int PAEInput::getTimeInfo(const char *incipit, MeterSig *meter, Mensur *mensur,
             }
         }
         else {
-            LogWarning("Plaine & Easie import: unsupported time signature: %s", timesig_str);
+            VRV_LOG_WARNING("Plaine & Easie import: unsupported time signature: %s", timesig_str);
         }
     }
 
@@ -1555,7 +1556,7 @@ int PAEInput::getClefInfo(const char *incipit, Clef *mclef, int index)
         mclef->SetDisPlace(STAFFREL_basic_below);
     }
     else {
-        LogDebug("Plaine & Easie import: undefined clef %c", clef);
+        VRV_LOG_DEBUG("Plaine & Easie import: undefined clef %c", clef);
     }
 
     // measure->clef = mclef;
@@ -1792,7 +1793,7 @@ int PAEInput::getNote(const char *incipit, pae::Note *note, pae::Measure *measur
         if (measure->durations.size() == 0) {
             note->duration = DURATION_4;
             note->dots = 0;
-            LogWarning("Plaine & Easie import: found note before duration was specified");
+            VRV_LOG_WARNING("Plaine & Easie import: found note before duration was specified");
         }
         else {
             note->duration = measure->durations.at(measure->durations_offset);
@@ -2127,7 +2128,7 @@ void PAEInput::popContainer()
 {
     // assert(m_nested_objects.size() > 0);
     if (m_nested_objects.size() == 0) {
-        LogError("Plaine & Easie import: tried to pop an object from empty stack. "
+        VRV_LOG_ERROR("Plaine & Easie import: tried to pop an object from empty stack. "
                  "Cross-measure objects (tuplets, beams) are not supported.");
     }
     else {
@@ -2497,11 +2498,12 @@ void PAEInput::ClearTokenObjects()
     // Normally, they should be none because they are passed to the doc.
     for (pae::Token &token : m_pae) {
         if (!token.m_object || token.IsContainerEnd()) continue;
-        LogDebug("Delete token %s", token.m_object->GetClassName().c_str());
+        VRV_LOG_DEBUG("Delete token %s", token.m_object->GetClassName().c_str());
         delete token.m_object;
         token.m_object = NULL;
     }
     m_pae.clear();
+    m_inputChars.reset();
 }
 
 jsonxx::Object PAEInput::GetValidationLog()
@@ -2574,10 +2576,10 @@ void PAEInput::LogPAE(int errCode, pae::Token &token, std::string value)
     std::string fullMsg = StringFormat("PAE: %s %s", msg.c_str(), posStr.c_str());
 
     if (m_pedanticMode) {
-        LogError(fullMsg.c_str());
+        VRV_LOG_ERROR(fullMsg.c_str());
     }
     else {
-        LogWarning(fullMsg.c_str());
+        VRV_LOG_WARNING(fullMsg.c_str());
     }
 }
 
@@ -2590,7 +2592,7 @@ void PAEInput::LogDebugTokens(bool vertical)
             char c2 = (token.m_inputChar) ? token.m_inputChar : ' ';
             std::string className = (token.m_object) ? token.m_object->GetClassName() : "";
             if (token.m_isError) className += " <";
-            LogDebug(" %c | %c | %s", c1, c2, className.c_str());
+            VRV_LOG_DEBUG(" %c | %c | %s", c1, c2, className.c_str());
         }
     }
     else {
@@ -2600,21 +2602,21 @@ void PAEInput::LogDebugTokens(bool vertical)
             row.push_back(c);
         }
         row = std::regex_replace(row, std::regex("%"), "%%");
-        LogDebug(row.c_str());
+        VRV_LOG_DEBUG(row.c_str());
         if (m_hasErrors) {
             row.clear();
             for (pae::Token &token : m_pae) {
                 char c = (token.m_isError) ? '^' : ' ';
                 row.push_back(c);
             }
-            LogDebug(row.c_str());
+            VRV_LOG_DEBUG(row.c_str());
         }
         row.clear();
         for (pae::Token &token : m_pae) {
             std::string className = (token.m_object) ? token.m_object->GetClassName() : " ";
             row.push_back(className.at(0));
         }
-        LogDebug(row.c_str());
+        VRV_LOG_DEBUG(row.c_str());
         row.clear();
         for (pae::Token &token : m_pae) {
             char c = (token.m_char) ? token.m_char : ' ';
@@ -2635,8 +2637,10 @@ bool PAEInput::Was(pae::Token &token, const std::string &map)
 
 bool PAEInput::HasInput(char inputChar)
 {
-    auto it = std::find_if(
-        m_pae.begin(), m_pae.end(), [inputChar](pae::Token token) { return (token.m_inputChar == inputChar); });
+    const unsigned char c = static_cast<unsigned char>(inputChar);
+    if (c < m_inputChars.size()) return m_inputChars.test(c);
+    auto it = std::find_if(m_pae.begin(), m_pae.end(),
+        [inputChar](const pae::Token &token) { return (token.m_inputChar == inputChar); });
     return (it != m_pae.end());
 }
 
@@ -2664,6 +2668,8 @@ void PAEInput::AddToken(char c, int &position)
         }
         m_pae.back().m_char = pae::VOID;
     }
+    const unsigned char inputChar = static_cast<unsigned char>(m_pae.back().m_inputChar);
+    if (inputChar < m_inputChars.size()) m_inputChars.set(inputChar);
 }
 
 void PAEInput::PrepareInsertion(int position, std::list<pae::Token> &insertion)
@@ -2916,9 +2922,19 @@ bool PAEInput::Import(const std::string &input)
         data.erase(std::remove(data.begin(), data.end(), c), data.end());
     }
 
-    data = std::regex_replace(data, std::regex("qq"), "Q");
-    data = std::regex_replace(data, std::regex("xx"), "X");
-    data = std::regex_replace(data, std::regex("bb"), "Y");
+    // Replace double letters (qq, xx, bb) with the internal characters in a single linear pass
+    std::string::size_type out = 0;
+    for (std::string::size_type in = 0; in < data.size(); ++in) {
+        char c = data.at(in);
+        if ((in + 1 < data.size()) && (data.at(in + 1) == c)) {
+            if (c == 'q') c = 'Q';
+            if (c == 'x') c = 'X';
+            if (c == 'b') c = 'Y';
+            if (c != data.at(in)) ++in;
+        }
+        data[out++] = c;
+    }
+    data.resize(out);
 
     int i = 0;
     for (char c : data) {
@@ -2940,11 +2956,7 @@ bool PAEInput::Parse()
 {
     bool success = true;
 
-    if (success) success = this->ConvertKeySig();
-
-    if (success) success = this->ConvertClef();
-
-    if (success) success = this->ConvertMeterSigOrMensur();
+    if (success) success = this->ConvertScoreDefElements();
 
     if (success) success = this->ConvertMeasure();
 
@@ -2954,15 +2966,7 @@ bool PAEInput::Parse()
 
     if (success) success = this->ConvertMRestOrMultiRest();
 
-    if (success) success = this->ConvertRest();
-
-    if (success) success = this->ConvertPitch();
-
-    if (success) success = this->ConvertOctave();
-
-    if (success) success = this->ConvertTrill();
-
-    if (success) success = this->ConvertFermata();
+    if (success) success = this->ConvertNotes();
 
     if (success) success = this->ConvertAccidental();
 
@@ -3051,14 +3055,14 @@ bool PAEInput::Parse()
         // Double check that we don't have more than the layer on the layerStack
         if (token.IsEnd()) {
             if (layerElementContainers.size() > 1) {
-                LogDebug("The layer element container stack should not have more than one element");
+                VRV_LOG_DEBUG("The layer element container stack should not have more than one element");
             }
             continue;
         }
 
         // No object to add to the doc - we whould also have no char left
         if (!token.m_object) {
-            if (token.m_char != 0) LogDebug("Remaining unprocessed char '%c'", token.m_char);
+            if (token.m_char != 0) VRV_LOG_DEBUG("Remaining unprocessed char '%c'", token.m_char);
             continue;
         }
 
@@ -3076,7 +3080,7 @@ bool PAEInput::Parse()
             staff->AddChild(layer);
             // Clear the layer element container stack (only max 1 should be left) and the new layer
             if (layerElementContainers.size() > 1) {
-                LogDebug("The layer element container stack should not have more than one element");
+                VRV_LOG_DEBUG("The layer element container stack should not have more than one element");
             }
             layerElementContainers.clear();
             layerElementContainers.push_back(layer);
@@ -3126,12 +3130,12 @@ bool PAEInput::Parse()
             if (token.m_char == pae::CONTAINER_END) {
                 // Do check that we still have more than the layer before poping it from the stack
                 if (layerElementContainers.size() < 2) {
-                    LogDebug("The layer element container stack should have at least two elements");
+                    VRV_LOG_DEBUG("The layer element container stack should have at least two elements");
                     continue;
                 }
                 // Also double check that the open / close element is actually the same
                 if (layerElementContainers.back() != element) {
-                    LogDebug("The layer element container stack top and the container end should match");
+                    VRV_LOG_DEBUG("The layer element container stack top and the container end should match");
                 }
                 // Simply pop it and continue
                 layerElementContainers.pop_back();
@@ -3140,7 +3144,7 @@ bool PAEInput::Parse()
 
             // Something went really wrong... Still delete the element to avoid a memory leak
             if (layerElementContainers.empty()) {
-                LogDebug("The layer element container stack should have at least one element");
+                VRV_LOG_DEBUG("The layer element container stack should have at least one element");
                 delete element;
                 continue;
             }
@@ -3180,21 +3184,35 @@ bool PAEInput::Parse()
     return success;
 }
 
-bool PAEInput::ConvertKeySig()
+bool PAEInput::ConvertScoreDefElements()
 {
+    // The objects are created once all the tokens have been scanned, kind after kind, so that their ids are generated
+    // in the order of the former separate passes (keySigs, clefs and meterSigs or mensurs)
+    std::vector<std::pair<pae::Token *, std::string>> keySigTokens;
+    std::vector<std::pair<pae::Token *, std::string>> clefTokens;
+    std::vector<std::pair<pae::Token *, std::string>> meterSigOrMensurTokens;
+
     pae::Token *keySigToken = NULL;
-    std::string paeStr;
+    std::string keySigStr;
+    pae::Token *clefToken = NULL;
+    std::string clefStr;
+    pae::Token *meterSigOrMensurToken = NULL;
+    std::string meterSigOrMensurStr;
 
     for (pae::Token &token : m_pae) {
         if (token.IsVoid()) continue;
 
+        // Each token is given to the keySig, the clef and then the meterSig or mensur conversion, each of them
+        // seeing what the previous one left, as if they were done in successive passes
+
+        // KeySig
         if (token.m_char == pae::KEYSIG_START) {
             keySigToken = &token;
-            paeStr.clear();
+            keySigStr.clear();
         }
         else if (keySigToken) {
             if (this->Is(token, pae::KEYSIG)) {
-                paeStr.push_back(token.m_char);
+                keySigStr.push_back(token.m_char);
                 token.m_char = 0;
                 continue;
             }
@@ -3206,13 +3224,85 @@ bool PAEInput::ConvertKeySig()
                 token.m_char = 0;
             }
             keySigToken->m_char = 0;
-            // LogDebug("Keysig %s", paeStr.c_str());
-            KeySig *keySig = new KeySig();
-            keySigToken->m_object = keySig;
-            // Will fail in pedantic mode
-            if (!this->ParseKeySig(keySig, paeStr, *keySigToken)) return false;
+            // LogDebug("Keysig %s", keySigStr.c_str());
+            keySigTokens.push_back({ keySigToken, keySigStr });
             keySigToken = NULL;
         }
+
+        // Clef
+        if (token.m_char == pae::CLEF_START) {
+            clefToken = &token;
+            clefStr.clear();
+        }
+        else if (clefToken) {
+            if (this->Is(token, pae::CLEF)) {
+                clefStr.push_back(token.m_char);
+                token.m_char = 0;
+                continue;
+            }
+            if (!token.IsEnd() && !token.IsSpace()) {
+                LogPAE(ERR_005_CLEF_SPACE, token);
+                if (m_pedanticMode) return false;
+            }
+            else {
+                token.m_char = 0;
+            }
+            clefToken->m_char = 0;
+            // LogDebug("Clef %s", clefStr.c_str());
+            clefTokens.push_back({ clefToken, clefStr });
+            clefToken = NULL;
+        }
+
+        // MeterSig or mensur
+        if (token.m_char == pae::METERSIG_START) {
+            meterSigOrMensurToken = &token;
+            meterSigOrMensurStr.clear();
+        }
+        else if (meterSigOrMensurToken) {
+            if (this->Is(token, pae::METERSIG)) {
+                meterSigOrMensurStr.push_back(token.m_char);
+                token.m_char = 0;
+                continue;
+            }
+            if (!token.IsEnd() && !token.IsSpace()) {
+                LogPAE(ERR_006_TIMESIG_SPACE, token);
+                if (m_pedanticMode) return false;
+            }
+            else {
+                token.m_char = 0;
+            }
+            meterSigOrMensurToken->m_char = 0;
+            // LogDebug("MeterSig %s", meterSigOrMensurStr.c_str());
+            meterSigOrMensurTokens.push_back({ meterSigOrMensurToken, meterSigOrMensurStr });
+            meterSigOrMensurToken = NULL;
+        }
+    }
+
+    for (auto &[token, paeStr] : keySigTokens) {
+        KeySig *keySig = new KeySig();
+        token->m_object = keySig;
+        // Will fail in pedantic mode
+        if (!this->ParseKeySig(keySig, paeStr, *token)) return false;
+    }
+    for (auto &[token, paeStr] : clefTokens) {
+        Clef *clef = new Clef();
+        token->m_object = clef;
+        // Will fail in pedantic mode
+        if (!this->ParseClef(clef, paeStr, *token)) return false;
+    }
+    for (auto &[token, paeStr] : meterSigOrMensurTokens) {
+        if (m_isMensural) {
+            Mensur *mensur = new Mensur();
+            token->m_object = mensur;
+            // Will fail in pedantic mode
+            if (!this->ParseMensur(mensur, paeStr, *token)) return false;
+        }
+        else {
+            MeterSig *meterSig = new MeterSig();
+            token->m_object = meterSig;
+            // Will fail in pedantic mode
+            if (!this->ParseMeterSig(meterSig, paeStr, *token)) return false;
+        }
     }
 
     return true;
@@ -3312,90 +3402,6 @@ void PAEInput::ParseHeader(jsonxx::Object &header)
     }
 }
 
-bool PAEInput::ConvertClef()
-{
-    pae::Token *clefToken = NULL;
-    std::string paeStr;
-
-    for (pae::Token &token : m_pae) {
-        if (token.IsVoid()) continue;
-
-        if (token.m_char == pae::CLEF_START) {
-            clefToken = &token;
-            paeStr.clear();
-        }
-        else if (clefToken) {
-            if (this->Is(token, pae::CLEF)) {
-                paeStr.push_back(token.m_char);
-                token.m_char = 0;
-                continue;
-            }
-            if (!token.IsEnd() && !token.IsSpace()) {
-                LogPAE(ERR_005_CLEF_SPACE, token);
-                if (m_pedanticMode) return false;
-            }
-            else {
-                token.m_char = 0;
-            }
-            clefToken->m_char = 0;
-            // LogDebug("Clef %s", paeStr.c_str());
-            Clef *clef = new Clef();
-            clefToken->m_object = clef;
-            // Will fail in pedantic mode
-            if (!this->ParseClef(clef, paeStr, *clefToken)) return false;
-            clefToken = NULL;
-        }
-    }
-
-    return true;
-}
-
-bool PAEInput::ConvertMeterSigOrMensur()
-{
-    pae::Token *meterSigOrMensurToken = NULL;
-    std::string paeStr;
-
-    for (pae::Token &token : m_pae) {
-        if (token.IsVoid()) continue;
-
-        if (token.m_char == pae::METERSIG_START) {
-            meterSigOrMensurToken = &token;
-            paeStr.clear();
-        }
-        else if (meterSigOrMensurToken) {
-            if (this->Is(token, pae::METERSIG)) {
-                paeStr.push_back(token.m_char);
-                token.m_char = 0;
-                continue;
-            }
-            if (!token.IsEnd() && !token.IsSpace()) {
-                LogPAE(ERR_006_TIMESIG_SPACE, token);
-                if (m_pedanticMode) return false;
-            }
-            else {
-                token.m_char = 0;
-            }
-            meterSigOrMensurToken->m_char = 0;
-            // LogDebug("MeterSig %s", paeStr.c_str());
-            if (m_isMensural) {
-                Mensur *mensur = new Mensur();
-                meterSigOrMensurToken->m_object = mensur;
-                // Will fail in pedantic mode
-                if (!this->ParseMensur(mensur, paeStr, *meterSigOrMensurToken)) return false;
-            }
-            else {
-                MeterSig *meterSig = new MeterSig();
-                meterSigOrMensurToken->m_object = meterSig;
-                // Will fail in pedantic mode
-                if (!this->ParseMeterSig(meterSig, paeStr, *meterSigOrMensurToken)) return false;
-            }
-            meterSigOrMensurToken = NULL;
-        }
-    }
-
-    return true;
-}
-
 bool PAEInput::ConvertMeasure()
 {
     Measure *currentMeasure = NULL;
@@ -3638,13 +3644,37 @@ bool PAEInput::ConvertMRestOrMultiRest()
     return true;
 }
 
-bool PAEInput::ConvertPitch()
+bool PAEInput::ConvertNotes()
 {
+    // Octave state
+    int oct = 4;
+    char readingOct = 0;
+    // Trill target
+    pae::Token *trillNoteToken = NULL;
+    // Fermata state
+    pae::Token *fermataToken = NULL;
+    pae::Token *fermataTargetToken = NULL;
+    ClassId fermataTargetClassId = UNSPECIFIED;
+    // The objects are created once all the tokens have been scanned, kind after kind, so that their ids are generated
+    // in the order of the former separate passes (rests, notes, trills and fermatas)
+    std::vector<pae::Token *> restTokens;
+    std::vector<std::tuple<pae::Token *, data_PITCHNAME, int>> noteTokens;
+    std::vector<std::pair<pae::Token *, pae::Token *>> trillTokens;
+    std::vector<std::pair<pae::Token *, pae::Token *>> fermataTokens;
+
     for (pae::Token &token : m_pae) {
         if (token.IsVoid()) continue;
 
-        if (this->Is(token, pae::NOTENAME)) {
-            Note *note = new Note();
+        // The class of the object of the token, including the ones still to be created
+        ClassId classId = (token.m_object) ? token.m_object->GetClassId() : UNSPECIFIED;
+
+        // Rests and pitches
+        if (token.m_char == '-') {
+            token.m_char = 0;
+            restTokens.push_back(&token);
+            classId = REST;
+        }
+        else if (this->Is(token, pae::NOTENAME)) {
             data_PITCHNAME pitch = PITCHNAME_c;
             switch (token.m_char) {
                 case 'A': pitch = PITCHNAME_a; break;
@@ -3656,23 +3686,12 @@ bool PAEInput::ConvertPitch()
                 case 'G': pitch = PITCHNAME_g; break;
                 default: break;
             }
-            note->SetPname(pitch);
-            token.m_object = note;
             token.m_char = 0;
+            noteTokens.push_back({ &token, pitch, oct });
+            classId = NOTE;
         }
-    }
-
-    return true;
-}
-
-bool PAEInput::ConvertOctave()
-{
-    int oct = 4;
-    char readingOct = 0;
-
-    for (pae::Token &token : m_pae) {
-        if (token.IsVoid()) continue;
 
+        // Octaves
         if (token.m_char == pae::OCTAVEUP) {
             // Init to 4 when starting to read octave '
             if (readingOct != pae::OCTAVEUP) {
@@ -3699,65 +3718,35 @@ bool PAEInput::ConvertOctave()
             // We are not reading octave signs anymore
             readingOct = 0;
         }
-
         // Simply set is to the notes
-        if (token.Is(NOTE)) {
-            Note *note = vrv_cast<Note *>(token.m_object);
-            assert(note);
-            note->SetOct(oct);
+        if (classId == NOTE) {
+            std::get<2>(noteTokens.back()) = oct;
         }
-    }
-
-    return true;
-}
-
-bool PAEInput::ConvertTrill()
-{
-    Object *note = NULL;
-
-    for (pae::Token &token : m_pae) {
-        if (token.IsVoid()) continue;
 
-        // Keep a pointer and simply continue
-        if (token.Is(NOTE)) {
-            note = token.m_object;
-            continue;
+        // Trills
+        if (classId == NOTE) {
+            // Keep a pointer
+            trillNoteToken = &token;
         }
-        if (token.m_char == 't') {
+        else if (token.m_char == 't') {
             token.m_char = 0;
-            if (note) {
-                Trill *trill = new Trill();
-                trill->SetStartid("#" + note->GetID());
-                token.m_object = trill;
+            if (trillNoteToken) {
+                trillTokens.push_back({ &token, trillNoteToken });
+                classId = TRILL;
             }
             else {
                 LogPAE(ERR_017_TRILL_INVALID, token);
                 if (m_pedanticMode) return false;
             }
-            note = NULL;
-            continue;
+            trillNoteToken = NULL;
         }
         // A trill can be placed after the closing fermata ) or after a tie +
-        if (note && (token.m_char == ')' || token.m_char == '+')) {
-            continue;
-        }
         // Anything else that is not a fermata or tie means that a previous note is no longer a target
-        else {
-            note = NULL;
+        else if (!trillNoteToken || ((token.m_char != ')') && (token.m_char != '+'))) {
+            trillNoteToken = NULL;
         }
-    }
-
-    return true;
-}
-
-bool PAEInput::ConvertFermata()
-{
-    pae::Token *fermataToken = NULL;
-    Object *fermataTarget = NULL;
-
-    for (pae::Token &token : m_pae) {
-        if (token.IsVoid()) continue;
 
+        // Fermatas - needs to come last since it looks at trills
         if (token.m_char == '(') {
             // Weird case - could be a
             if (fermataToken) {
@@ -3768,9 +3757,10 @@ bool PAEInput::ConvertFermata()
         }
         else if (fermataToken) {
             // We have an open fermata sign but have not reached a fermata target
-            if (!fermataTarget) {
-                if (token.m_object && token.m_object->Is({ MREST, NOTE, REST })) {
-                    fermataTarget = token.m_object;
+            if (!fermataTargetToken) {
+                if ((classId == MREST) || (classId == NOTE) || (classId == REST)) {
+                    fermataTargetToken = &token;
+                    fermataTargetClassId = classId;
                     continue;
                 }
                 // We still allow duration, accidental or octave markers within a fermata ()
@@ -3783,21 +3773,19 @@ bool PAEInput::ConvertFermata()
             }
             else {
                 if (token.m_char == ')') {
-                    Fermata *fermata = new Fermata();
-                    fermataToken->m_object = fermata;
-                    fermata->SetStartid("#" + fermataTarget->GetID());
+                    fermataTokens.push_back({ fermataToken, fermataTargetToken });
                     fermataToken->m_char = 0;
                     token.m_char = 0;
                     fermataToken = NULL;
-                    fermataTarget = NULL;
+                    fermataTargetToken = NULL;
                 }
                 // A trill before the closing fermata ) is valid
-                else if (fermataTarget->Is(NOTE) && token.Is(TRILL)) {
+                else if ((fermataTargetClassId == NOTE) && (classId == TRILL)) {
                     continue;
                 }
                 // PAE guidelines are ambiguous because they say fermata should contain only a single rest sign (=)
                 // but at the same time allow =1 for a mrest - in non pendantic mode we want to support (=1)
-                else if (fermataTarget->Is(MREST) && isdigit(token.m_inputChar)) {
+                else if ((fermataTargetClassId == MREST) && isdigit(token.m_inputChar)) {
                     LogPAE(ERR_058_FERMATA_MREST, token, StringFormat("%c", token.m_inputChar));
                     if (m_pedanticMode) return false;
                     continue;
@@ -3805,12 +3793,32 @@ bool PAEInput::ConvertFermata()
                 else {
                     // Leave everything as is - the ( could be a tuplet start
                     fermataToken = NULL;
-                    fermataTarget = NULL;
+                    fermataTargetToken = NULL;
                 }
             }
         }
     }
 
+    for (pae::Token *token : restTokens) {
+        token->m_object = new Rest();
+    }
+    for (auto &[token, pitch, octave] : noteTokens) {
+        Note *note = new Note();
+        note->SetPname(pitch);
+        note->SetOct(octave);
+        token->m_object = note;
+    }
+    for (auto &[token, noteToken] : trillTokens) {
+        Trill *trill = new Trill();
+        trill->SetStartid("#" + noteToken->m_object->GetID());
+        token->m_object = trill;
+    }
+    for (auto &[token, targetToken] : fermataTokens) {
+        Fermata *fermata = new Fermata();
+        fermata->SetStartid("#" + targetToken->m_object->GetID());
+        token->m_object = fermata;
+    }
+
     return true;
 }
 
@@ -3855,20 +3863,6 @@ bool PAEInput::ConvertAccidental()
     return true;
 }
 
-bool PAEInput::ConvertRest()
-{
-    for (pae::Token &token : m_pae) {
-        if (token.IsVoid()) continue;
-
-        if (token.m_char == '-') {
-            token.m_object = new Rest();
-            token.m_char = 0;
-        }
-    }
-
-    return true;
-}
-
 bool PAEInput::ConvertChord()
 {
     if (!this->HasInput('^')) return true;
@@ -4778,7 +4772,7 @@ void PAEInput::RemoveContainerToken(Object *object)
         if (token.m_object == object) {
             if (!token.IsContainerEnd()) {
                 // Make sure we delete it only once - even though it should never be there more than once
-                LogDebug("Deleting %s", object->GetClassName().c_str());
+                VRV_LOG_DEBUG("Deleting %s", object->GetClassName().c_str());
                 if (!deleted) delete token.m_object;
                 deleted = true;
             }
@@ -4978,12 +4972,15 @@ bool PAEInput::ParseMeterSig(MeterSig *meterSig, const std::string &paeStr, pae:
         return true;
     }
 
+    // The expressions are compiled once since building a std::regex is costly
+    static const std::regex countUnitRe("(\\d+)/(\\d+)");
+    static const std::regex countRe("\\d+");
     std::cmatch matches;
-    if (regex_match(paeStr.c_str(), matches, std::regex("(\\d+)/(\\d+)"))) {
+    if (regex_match(paeStr.c_str(), matches, countUnitRe)) {
         meterSig->SetCount({ { std::stoi(matches[1]) }, MeterCountSign::None });
         meterSig->SetUnit(std::stoi(matches[2]));
     }
-    else if (regex_match(paeStr.c_str(), matches, std::regex("\\d+"))) {
+    else if (regex_match(paeStr.c_str(), matches, countRe)) {
         meterSig->SetCount({ { std::stoi(paeStr) }, MeterCountSign::None });
         meterSig->SetUnit(1);
         meterSig->SetForm(METERFORM_num);
@@ -5033,15 +5030,18 @@ bool PAEInput::ParseMensur(Mensur *mensur, const std::string &paeStr, pae::Token
         return true;
     }
 
+    static const std::regex countUnitRe("(\\d+)/(\\d+)");
+    static const std::regex countRe("\\d+");
+    static const std::regex signRe("([co])([\\./]?)([\\./]?)(\\d*)/?(\\d*)");
     std::cmatch matches;
-    if (regex_match(paeStr.c_str(), matches, std::regex("(\\d+)/(\\d+)"))) {
+    if (regex_match(paeStr.c_str(), matches, countUnitRe)) {
         mensur->SetNum(std::stoi(matches[1]));
         mensur->SetNumbase(std::stoi(matches[2]));
     }
-    else if (regex_match(paeStr.c_str(), matches, std::regex("\\d+"))) {
+    else if (regex_match(paeStr.c_str(), matches, countRe)) {
         mensur->SetNum(std::stoi(paeStr.c_str()));
     }
-    else if (regex_match(paeStr.c_str(), matches, std::regex("([co])([\\./]?)([\\./]?)(\\d*)/?(\\d*)"))) {
+    else if (regex_match(paeStr.c_str(), matches, signRe)) {
         // C
         if (matches[1] == "c") {
             mensur->SetSign(MENSURATIONSIGN_C);
@@ -5166,7 +5166,7 @@ bool PAEInput::ParseDuration(
 
     // just in case not to screw up iterators in ConvertDuration
     if (durations.empty()) {
-        LogDebug("Something went wrong with the parsing of durations");
+        VRV_LOG_DEBUG("Something went wrong with the parsing of durations");
         durations.push_back({ DURATION_4, 0 });
     }
 
@@ -0,0 +1,479 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        jsonstream.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "jsonstream.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+// The maximum nesting depth accepted by the JsonReader
+#define JSON_MAX_DEPTH 512
+
+//----------------------------------------------------------------------------
+// JsonWriter
+//----------------------------------------------------------------------------
+
+JsonWriter::JsonWriter(std::string &output) : m_output(output)
+{
+    m_output.clear();
+    m_depth = 0;
+    m_afterKey = false;
+}
+
+void JsonWriter::StartObject()
+{
+    this->Indent();
+    m_output += "{\n";
+    ++m_depth;
+    m_keys.push_back("");
+}
+
+void JsonWriter::StartArray()
+{
+    this->Indent();
+    m_output += "[\n";
+    ++m_depth;
+}
+
+void JsonWriter::End(char closing)
+{
+    assert(m_depth > 0);
+    assert(!m_afterKey);
+
+    --m_depth;
+    if (closing == '}') {
+        assert(!m_keys.empty());
+        m_keys.pop_back();
+    }
+    this->RemoveLastComma();
+    m_output.append(m_depth, '\t');
+    m_output += closing;
+    m_output += ",\n";
+    // The top-level value has no comma
+    if (m_depth == 0) this->RemoveLastComma();
+}
+
+void JsonWriter::Key(std::string_view key)
+{
+    assert(m_depth > 0);
+    assert(!m_afterKey);
+    // The keys have to be written in alphabetical order, as jsonxx does
+    assert(!m_keys.empty());
+    assert(m_keys.back().empty() || (m_keys.back() < key));
+    m_keys.back() = key;
+
+    m_output.append(m_depth, '\t');
+    m_output += '"';
+    this->Escape(key);
+    m_output += "\": ";
+    m_afterKey = true;
+}
+
+void JsonWriter::String(std::string_view value)
+{
+    this->Indent();
+    m_output += '"';
+    this->Escape(value);
+    m_output += "\",\n";
+}
+
+void JsonWriter::Number(double value, int precision)
+{
+    // The precision used by jsonxx
+    static const int digits = std::numeric_limits<long double>::digits10 + 1;
+
+    this->Indent();
+    char buffer[64];
+    if (precision != -1) {
+        snprintf(buffer, sizeof(buffer), "%.*Lf", precision, (long double)value);
+        m_output += buffer;
+    }
+    // Integer values are written as they would be with the jsonxx precision (-0 excepted)
+    else if ((value == std::trunc(value)) && (std::fabs(value) < 1e15) && !(value == 0.0 && std::signbit(value))) {
+        std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), (long long)value);
+        m_output.append(buffer, result.ptr);
+    }
+    else {
+        snprintf(buffer, sizeof(buffer), "%.*Lg", digits, (long double)value);
+        m_output += buffer;
+    }
+    m_output += ",\n";
+}
+
+void JsonWriter::Bool(bool value)
+{
+    this->Indent();
+    m_output += (value) ? "true,\n" : "false,\n";
+}
+
+void JsonWriter::Null()
+{
+    this->Indent();
+    m_output += "null,\n";
+}
+
+void JsonWriter::StringArray(const std::vector<std::string> &values)
+{
+    this->StartArray();
+    for (const std::string &value : values) this->String(value);
+    this->EndArray();
+}
+
+void JsonWriter::Indent()
+{
+    if (m_afterKey) {
+        m_afterKey = false;
+        return;
+    }
+    m_output.append(m_depth, '\t');
+}
+
+void JsonWriter::RemoveLastComma()
+{
+    const size_t size = m_output.size();
+    if ((size > 2) && (m_output[size - 2] == ',')) m_output[size - 2] = ' ';
+}
+
+void JsonWriter::Escape(std::string_view value)
+{
+    static const char *hex = "0123456789abcdef";
+
+    size_t start = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+        const unsigned char c = value[i];
+        if ((c >= 0x20) && (c != '"') && (c != '\\') && (c != '/')) continue;
+        m_output.append(value.data() + start, i - start);
+        start = i + 1;
+        switch (c) {
+            case '"': m_output += "\\\""; break;
+            case '\\': m_output += "\\\\"; break;
+            case '/': m_output += "\\/"; break;
+            case '\b': m_output += "\\b"; break;
+            case '\f': m_output += "\\f"; break;
+            case '\n': m_output += "\\n"; break;
+            case '\r': m_output += "\\r"; break;
+            case '\t': m_output += "\\t"; break;
+            default:
+                m_output += "\\u00";
+                m_output += hex[c >> 4];
+                m_output += hex[c & 0xf];
+        }
+    }
+    m_output.append(value.data() + start, value.size() - start);
+}
+
+//----------------------------------------------------------------------------
+// JsonReader
+//----------------------------------------------------------------------------
+
+bool JsonReader::Parse(std::string_view input)
+{
+    m_input = input;
+    m_pos = 0;
+    m_nodes.clear();
+
+    this->SkipWhitespace();
+    if ((m_pos >= m_input.size()) || (m_input[m_pos] != '{')) return false;
+    return this->ParseContainer(true, 0);
+}
+
+std::string JsonReader::GetString(int node) const
+{
+    const JsonNode &string = m_nodes.at(node);
+    if (!string.m_escaped) return std::string(string.m_text);
+
+    // The text starts after the opening quote
+    const char delimiter = *(string.m_text.data() - 1);
+    const std::string_view text = string.m_text;
+
+    auto readHex = [&text](size_t pos, int &value) {
+        if (pos + 4 > text.size()) return false;
+        std::from_chars_result result = std::from_chars(text.data() + pos, text.data() + pos + 4, value, 16);
+        return (result.ec == std::errc() && result.ptr == text.data() + pos + 4);
+    };
+
+    std::string value;
+    value.reserve(text.size());
+    for (size_t i = 0; i < text.size(); ++i) {
+        char c = text[i];
+        if (c != '\\' || i + 1 >= text.size()) {
+            value.push_back(c);
+            continue;
+        }
+        c = text[++i];
+        switch (c) {
+            case '\\':
+            case '/': value.push_back(c); break;
+            case 'b': value.push_back('\b'); break;
+            case 'f': value.push_back('\f'); break;
+            case 'n': value.push_back('\n'); break;
+            case 'r': value.push_back('\r'); break;
+            case 't': value.push_back('\t'); break;
+            case 'u': {
+                int codepoint;
+                if (!readHex(i + 1, codepoint)) break;
+                i += 4;
+                // Decode UTF-16 surrogate pair
+                if (codepoint >= 0xd800 && codepoint <= 0xdbff) {
+                    int low;
+                    if ((i + 2 >= text.size()) || (text[i + 1] != '\\') || (text[i + 2] != 'u')) break;
+                    if (!readHex(i + 3, low)) break;
+                    i += 6;
+                    codepoint = (codepoint << 10) + low - 0x35fdc00;
+                }
+                // Encode codepoint via UTF-8
+                if (codepoint < 0x80) {
+                    value.push_back(static_cast<char>(codepoint));
+                }
+                else if (codepoint < 0x800) {
+                    value.push_back(static_cast<char>((codepoint >> 6) | 0xc0));
+                    value.push_back(static_cast<char>((codepoint & 0x3f) | 0x80));
+                }
+                else if (codepoint < 0x10000) {
+                    value.push_back(static_cast<char>((codepoint >> 12) | 0xe0));
+                    value.push_back(static_cast<char>(((codepoint >> 6) & 0x3f) | 0x80));
+                    value.push_back(static_cast<char>((codepoint & 0x3f) | 0x80));
+                }
+                else {
+                    value.push_back(static_cast<char>((codepoint >> 18) | 0xf0));
+                    value.push_back(static_cast<char>(((codepoint >> 12) & 0x3f) | 0x80));
+                    value.push_back(static_cast<char>(((codepoint >> 6) & 0x3f) | 0x80));
+                    value.push_back(static_cast<char>((codepoint & 0x3f) | 0x80));
+                }
+                break;
+            }
+            default:
+                // Unknown escape sequences are kept as they are
+                if (c != delimiter) value.push_back('\\');
+                value.push_back(c);
+        }
+    }
+    return value;
+}
+
+int JsonReader::GetNext(int parent, int node) const
+{
+    // For an object, skip the value of the key
+    const int next = (this->Is(parent, JsonType::Object)) ? m_nodes.at(node + 1).m_next : m_nodes.at(node).m_next;
+    return (next < m_nodes.at(parent).m_next) ? next : -1;
+}
+
+int JsonReader::Find(int object, std::string_view key) const
+{
+    if (!this->Is(object, JsonType::Object)) return -1;
+
+    int value = -1;
+    for (int member = this->GetFirst(object); member != -1; member = this->GetNext(object, member)) {
+        const JsonNode &node = m_nodes.at(member);
+        if (node.m_escaped ? (this->GetString(member) == key) : (node.m_text == key)) value = member + 1;
+    }
+    return value;
+}
+
+std::vector<std::pair<std::string, int>> JsonReader::GetMembers(int object) const
+{
+    std::vector<std::pair<std::string, int>> members;
+    if (!this->Is(object, JsonType::Object)) return members;
+
+    members.reserve(this->GetSize(object));
+    for (int key = this->GetFirst(object); key != -1; key = this->GetNext(object, key)) {
+        members.push_back({ this->GetString(key), key + 1 });
+    }
+    std::stable_sort(members.begin(), members.end(),
+        [](const std::pair<std::string, int> &a, const std::pair<std::string, int> &b) { return a.first < b.first; });
+    // Keep the last member of each run of duplicated keys
+    auto last = std::unique(members.rbegin(), members.rend(),
+        [](const std::pair<std::string, int> &a, const std::pair<std::string, int> &b) { return a.first == b.first; });
+    members.erase(members.begin(), last.base());
+    return members;
+}
+
+bool JsonReader::Get(int object, std::string_view key, bool &value) const
+{
+    const int node = this->Find(object, key);
+    if (!this->Is(node, JsonType::Bool)) return false;
+    value = this->GetBool(node);
+    return true;
+}
+
+bool JsonReader::Get(int object, std::string_view key, int &value) const
+{
+    const int node = this->Find(object, key);
+    if (!this->Is(node, JsonType::Number)) return false;
+    value = this->GetNumber(node);
+    return true;
+}
+
+bool JsonReader::Get(int object, std::string_view key, double &value) const
+{
+    const int node = this->Find(object, key);
+    if (!this->Is(node, JsonType::Number)) return false;
+    value = this->GetNumber(node);
+    return true;
+}
+
+bool JsonReader::Get(int object, std::string_view key, std::string &value) const
+{
+    const int node = this->Find(object, key);
+    if (!this->Is(node, JsonType::String)) return false;
+    value = this->GetString(node);
+    return true;
+}
+
+bool JsonReader::ParseValue(int depth)
+{
+    if (depth > JSON_MAX_DEPTH) return false;
+
+    this->SkipWhitespace();
+    if (m_pos >= m_input.size()) return false;
+
+    const char c = m_input[m_pos];
+    if (c == '"' || c == '\'') {
+        return this->ParseString();
+    }
+    if (c == '[' || c == '{') {
+        return this->ParseContainer(c == '{', depth);
+    }
+    if (c == 't' || c == 'f') {
+        if (!this->Match((c == 't') ? "true" : "false")) return false;
+        m_nodes.push_back({ JsonType::Bool, 0, (int)m_nodes.size() + 1, (c == 't') ? 1.0 : 0.0, {}, false });
+        return true;
+    }
+    // A missing value before a comma is read as null
+    if (c == 'n' || c == ',') {
+        if (c == 'n' && !this->Match("null")) return false;
+        m_nodes.push_back({ JsonType::Null, 0, (int)m_nodes.size() + 1, 0.0, {}, false });
+        return true;
+    }
+
+    // Numbers
+    size_t end = m_pos;
+    while (end < m_input.size() && std::string_view("+-0123456789.eE").find(m_input[end]) != std::string_view::npos) {
+        ++end;
+    }
+    if (end == m_pos) return false;
+    // strtod requires a null-terminated string
+    char buffer[64];
+    std::string longNumber;
+    const char *start = buffer;
+    if (end - m_pos < sizeof(buffer)) {
+        m_input.copy(buffer, end - m_pos, m_pos);
+        buffer[end - m_pos] = '\0';
+    }
+    else {
+        longNumber = m_input.substr(m_pos, end - m_pos);
+        start = longNumber.c_str();
+    }
+    char *numberEnd = NULL;
+    const double number = strtod(start, &numberEnd);
+    if (numberEnd == start) return false;
+    m_pos += numberEnd - start;
+    m_nodes.push_back({ JsonType::Number, 0, (int)m_nodes.size() + 1, number, {}, false });
+    return true;
+}
+
+bool JsonReader::ParseString()
+{
+    const char delimiter = m_input[m_pos];
+    const size_t start = ++m_pos;
+    bool escaped = false;
+    while (m_pos < m_input.size() && m_input[m_pos] != delimiter) {
+        if (m_input[m_pos] == '\\') {
+            escaped = true;
+            ++m_pos;
+        }
+        ++m_pos;
+    }
+    if (m_pos >= m_input.size()) return false;
+    m_nodes.push_back(
+        { JsonType::String, 0, (int)m_nodes.size() + 1, 0.0, m_input.substr(start, m_pos - start), escaped });
+    ++m_pos;
+    return true;
+}
+
+bool JsonReader::ParseContainer(bool isObject, int depth)
+{
+    const int index = (int)m_nodes.size();
+    const size_t start = m_pos;
+    m_nodes.push_back({ isObject ? JsonType::Object : JsonType::Array, 0, 0, 0.0, {}, false });
+    ++m_pos;
+
+    const char closing = isObject ? '}' : ']';
+    int size = 0;
+    if (!this->Match(closing)) {
+        do {
+            const size_t pos = m_pos;
+            const size_t count = m_nodes.size();
+            if (isObject) {
+                this->SkipWhitespace();
+                // A trailing comma is accepted
+                if ((m_pos >= m_input.size()) || (m_input[m_pos] != '"' && m_input[m_pos] != '\'')) break;
+                if (!this->ParseString()) return false;
+                if (!this->Match(':')) return false;
+            }
+            // A value that cannot be read ends the container
+            if (!this->ParseValue(depth + 1)) {
+                m_pos = pos;
+                m_nodes.resize(count);
+                break;
+            }
+            ++size;
+        } while (this->Match(','));
+        if (!this->Match(closing)) return false;
+    }
+
+    JsonNode &node = m_nodes.at(index);
+    node.m_size = size;
+    node.m_next = (int)m_nodes.size();
+    node.m_text = m_input.substr(start, m_pos - start);
+    return true;
+}
+
+bool JsonReader::Match(char c)
+{
+    this->SkipWhitespace();
+    if ((m_pos >= m_input.size()) || (m_input[m_pos] != c)) return false;
+    ++m_pos;
+    return true;
+}
+
+bool JsonReader::Match(std::string_view literal)
+{
+    this->SkipWhitespace();
+    if (m_input.substr(m_pos, literal.size()) != literal) return false;
+    m_pos += literal.size();
+    return true;
+}
+
+void JsonReader::SkipWhitespace()
+{
+    while (m_pos < m_input.size()) {
+        const char c = m_input[m_pos];
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v') {
+            ++m_pos;
+        }
+        // Comments until the end of the line
+        else if (c == '/' && m_pos + 1 < m_input.size() && m_input[m_pos + 1] == '/') {
+            while (m_pos < m_input.size() && m_input[m_pos] != '\n' && m_input[m_pos] != '\r') ++m_pos;
+        }
+        else {
+            break;
+        }
+    }
+}
+
+} // namespace vrv
@@ -128,7 +128,7 @@ void KeySig::FilterList(ListOfConstObjects &childList) const
 bool KeySig::IsSupportedChild(Object *child)
 {
     if (this->IsAttribute() && !child->IsAttribute()) {
-        LogError("Adding a non-attribute child to an attribute is not allowed");
+        VRV_LOG_ERROR("Adding a non-attribute child to an attribute is not allowed");
         assert(false);
     }
     else if (child->Is(KEYACCID)) {
@@ -187,7 +187,7 @@ void KeySig::GenerateKeyAccidAttribChildren()
         }
     }
     else if (this->HasSig()) {
-        LogWarning(
+        VRV_LOG_WARNING(
             "Attribute key signature is ignored, since KeySig '%s' contains KeyAccid children.", this->GetID().c_str());
     }
 }
@@ -269,8 +269,9 @@ data_KEYSIGNATURE KeySig::ConvertToSig() const
                 }
             }
             if (accidType != curType) {
-                LogWarning("All the keySig content cannot be converted to @sig because the accidental type is not a "
-                           "flat or a sharp, or mixes them");
+                VRV_LOG_WARNING(
+                    "All the keySig content cannot be converted to @sig because the accidental type is not a "
+                    "flat or a sharp, or mixes them");
                 break;
             }
             if (accidType == ACCIDENTAL_WRITTEN_f && s_pnameForFlats[pos] != keyAccid->GetPname()) {
@@ -284,7 +285,7 @@ data_KEYSIGNATURE KeySig::ConvertToSig() const
             pos++;
         }
         if (!isCommon) {
-            LogWarning("KeySig content cannot be converted to @sig because the accidental series is not standard");
+            VRV_LOG_WARNING("KeySig content cannot be converted to @sig because the accidental series is not standard");
             return sig;
         }
         sig = std::make_pair(pos, accidType);
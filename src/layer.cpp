@@ -541,10 +541,44 @@ const MeterSig *Layer::GetCurrentMeterSig() const
     return staff->m_drawingStaffDef->GetCurrentMeterSig();
 }
 
+Layer::StaffDefObjects Layer::DetachStaffDefObjects()
+{
+    StaffDefObjects staffDefObjects;
+    std::swap(staffDefObjects.m_clef, m_staffDefClef);
+    std::swap(staffDefObjects.m_keySig, m_staffDefKeySig);
+    std::swap(staffDefObjects.m_mensur, m_staffDefMensur);
+    std::swap(staffDefObjects.m_meterSig, m_staffDefMeterSig);
+    std::swap(staffDefObjects.m_meterSigGrp, m_staffDefMeterSigGrp);
+    std::swap(staffDefObjects.m_drawKeySigCancellation, m_drawKeySigCancellation);
+    std::swap(staffDefObjects.m_cautionClef, m_cautionStaffDefClef);
+    std::swap(staffDefObjects.m_cautionKeySig, m_cautionStaffDefKeySig);
+    std::swap(staffDefObjects.m_cautionMensur, m_cautionStaffDefMensur);
+    std::swap(staffDefObjects.m_cautionMeterSig, m_cautionStaffDefMeterSig);
+    std::swap(staffDefObjects.m_drawCautionKeySigCancel, m_drawCautionKeySigCancel);
+    return staffDefObjects;
+}
+
+void Layer::AttachStaffDefObjects(const StaffDefObjects &staffDefObjects)
+{
+    assert(!this->HasStaffDef() && !this->HasCautionStaffDef());
+
+    m_staffDefClef = staffDefObjects.m_clef;
+    m_staffDefKeySig = staffDefObjects.m_keySig;
+    m_staffDefMensur = staffDefObjects.m_mensur;
+    m_staffDefMeterSig = staffDefObjects.m_meterSig;
+    m_staffDefMeterSigGrp = staffDefObjects.m_meterSigGrp;
+    m_drawKeySigCancellation = staffDefObjects.m_drawKeySigCancellation;
+    m_cautionStaffDefClef = staffDefObjects.m_cautionClef;
+    m_cautionStaffDefKeySig = staffDefObjects.m_cautionKeySig;
+    m_cautionStaffDefMensur = staffDefObjects.m_cautionMensur;
+    m_cautionStaffDefMeterSig = staffDefObjects.m_cautionMeterSig;
+    m_drawCautionKeySigCancel = staffDefObjects.m_drawCautionKeySigCancel;
+}
+
 void Layer::SetDrawingStaffDefValues(StaffDef *currentStaffDef)
 {
     if (!currentStaffDef) {
-        LogDebug("staffDef not found");
+        VRV_LOG_DEBUG("staffDef not found");
         return;
     }
 
@@ -583,7 +617,7 @@ void Layer::SetDrawingStaffDefValues(StaffDef *currentStaffDef)
 void Layer::SetDrawingCautionValues(StaffDef *currentStaffDef)
 {
     if (!currentStaffDef) {
-        LogDebug("staffDef not found");
+        VRV_LOG_DEBUG("staffDef not found");
         return;
     }
 
@@ -41,7 +41,7 @@ bool Lv::CalculatePosition(const Doc *doc, const Staff *staff, int x1, int x2, i
 {
     if (spanningType != SPANNING_START_END) {
         //  this makes no sense
-        LogWarning("Lv across systems is not supported. Use <tie> instead.");
+        VRV_LOG_WARNING("Lv across systems is not supported. Use <tie> instead.");
         return false;
     }
 
@@ -49,7 +49,7 @@ bool Lv::CalculatePosition(const Doc *doc, const Staff *staff, int x1, int x2, i
     LayerElement *end = this->GetEnd();
     if (start->GetFirstAncestor(MEASURE) != end->GetFirstAncestor(MEASURE)) {
         //  this makes no sense
-        LogWarning("Lv across measures is not supported. Use <tie> instead.");
+        VRV_LOG_WARNING("Lv across measures is not supported. Use <tie> instead.");
         return false;
     }
 
@@ -186,7 +186,7 @@ bool Measure::IsSupportedChild(Object *child)
 void Measure::AddChildBack(Object *child)
 {
     if (!this->IsSupportedChild(child)) {
-        LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
+        VRV_LOG_ERROR("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
         return;
     }
 
@@ -402,6 +402,20 @@ void Measure::ResetDrawingScoreDef()
     }
 }
 
+ScoreDef *Measure::DetachDrawingScoreDef()
+{
+    ScoreDef *drawingScoreDef = m_drawingScoreDef;
+    m_drawingScoreDef = NULL;
+    return drawingScoreDef;
+}
+
+void Measure::AttachDrawingScoreDef(ScoreDef *drawingScoreDef)
+{
+    assert(!m_drawingScoreDef); // We should always call ResetDrawingScoreDef before
+
+    m_drawingScoreDef = drawingScoreDef;
+}
+
 std::vector<Staff *> Measure::GetFirstStaffGrpStaves(ScoreDef *scoreDef)
 {
     assert(scoreDef);
@@ -428,7 +442,7 @@ std::vector<Staff *> Measure::GetFirstStaffGrpStaves(ScoreDef *scoreDef)
         }
         staves.push_back(staff);
     }
-    if (staves.empty()) LogDebug("Empty @staff array");
+    if (staves.empty()) VRV_LOG_DEBUG("Empty @staff array");
     return staves;
 }
 
@@ -114,7 +114,7 @@ MeterSig *MeterSigGrp::GetSimplifiedMeterSig() const
             int currentCount = 0;
             for (const auto object : childList) {
                 if (!object->Is(METERSIG)) {
-                    LogWarning("Skipping over non-meterSig child of <MeterSigGrp>");
+                    VRV_LOG_WARNING("Skipping over non-meterSig child of <MeterSigGrp>");
                     continue;
                 }
                 const MeterSig *meterSig = vrv_cast<const MeterSig *>(object);
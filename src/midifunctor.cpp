@@ -43,11 +43,9 @@ namespace vrv {
 InitOnsetOffsetFunctor::InitOnsetOffsetFunctor() : Functor()
 {
     m_currentScoreTime = 0.0;
-    m_currentRealTimeSeconds = 0.0;
     m_meterParams.mensur = NULL;
     m_meterParams.meterSig = NULL;
     m_notationType = NOTATIONTYPE_cmn;
-    m_currentTempo = MIDI_TEMPO;
 }
 
 FunctorCode InitOnsetOffsetFunctor::VisitChordEnd(Chord *chord)
@@ -56,10 +54,8 @@ FunctorCode InitOnsetOffsetFunctor::VisitChordEnd(Chord *chord)
 
     double incrementScoreTime = element->GetAlignmentDuration(m_meterParams, true, m_notationType);
     incrementScoreTime = incrementScoreTime / (DUR_MAX / DURATION_4);
-    double realTimeIncrementSeconds = incrementScoreTime * 60.0 / m_currentTempo;
 
     m_currentScoreTime += incrementScoreTime;
-    m_currentRealTimeSeconds += realTimeIncrementSeconds;
 
     return FUNCTOR_CONTINUE;
 }
@@ -67,7 +63,6 @@ FunctorCode InitOnsetOffsetFunctor::VisitChordEnd(Chord *chord)
 FunctorCode InitOnsetOffsetFunctor::VisitLayer(Layer *layer)
 {
     m_currentScoreTime = 0.0;
-    m_currentRealTimeSeconds = 0.0;
 
     m_meterParams.mensur = layer->GetCurrentMensur();
     m_meterParams.meterSig = layer->GetCurrentMeterSig();
@@ -89,14 +84,10 @@ FunctorCode InitOnsetOffsetFunctor::VisitLayerElement(LayerElement *layerElement
         // For rests to be possibly added to the timemap
         if (element->Is(REST)) {
             Rest *rest = vrv_cast<Rest *>(element);
-            double realTimeIncrementSeconds = incrementScoreTime * 60.0 / m_currentTempo;
             rest->SetScoreTimeOnset(m_currentScoreTime);
-            rest->SetRealTimeOnsetSeconds(m_currentRealTimeSeconds);
             rest->SetScoreTimeOffset(m_currentScoreTime + incrementScoreTime);
-            rest->SetRealTimeOffsetSeconds(m_currentRealTimeSeconds + realTimeIncrementSeconds);
         }
         m_currentScoreTime += incrementScoreTime;
-        m_currentRealTimeSeconds += incrementScoreTime * 60.0 / m_currentTempo;
     }
     else if (element->Is(NOTE)) {
         Note *note = vrv_cast<Note *>(element);
@@ -120,7 +111,6 @@ FunctorCode InitOnsetOffsetFunctor::VisitLayerElement(LayerElement *layerElement
             incrementScoreTime = note->GetAlignmentDuration(m_meterParams, true, m_notationType);
         }
         incrementScoreTime = incrementScoreTime / (DUR_MAX / DURATION_4);
-        double realTimeIncrementSeconds = incrementScoreTime * 60.0 / m_currentTempo;
 
         // LogDebug("Note Alignment Duration %f - Dur %d - Diatonic Pitch %d - Track %d", GetAlignmentDuration(),
         // note->GetNoteOrChordDur(element), note->GetDiatonicPitch(), *midiTrack);
@@ -130,15 +120,12 @@ FunctorCode InitOnsetOffsetFunctor::VisitLayerElement(LayerElement *layerElement
         Note *storeNote = (layerElement == element) ? note : dynamic_cast<Note *>(layerElement);
         if (storeNote) {
             storeNote->SetScoreTimeOnset(m_currentScoreTime);
-            storeNote->SetRealTimeOnsetSeconds(m_currentRealTimeSeconds);
             storeNote->SetScoreTimeOffset(m_currentScoreTime + incrementScoreTime);
-            storeNote->SetRealTimeOffsetSeconds(m_currentRealTimeSeconds + realTimeIncrementSeconds);
         }
 
         // increase the currentTime accordingly, but only if not in a chord or tabGrp
         if (!note->IsChordTone() && !note->IsTabGrpNote()) {
             m_currentScoreTime += incrementScoreTime;
-            m_currentRealTimeSeconds += realTimeIncrementSeconds;
         }
     }
     else if (element->Is(BEATRPT)) {
@@ -149,13 +136,11 @@ FunctorCode InitOnsetOffsetFunctor::VisitLayerElement(LayerElement *layerElement
         incrementScoreTime = incrementScoreTime / (DUR_MAX / DURATION_4);
         rpt->SetScoreTimeOnset(m_currentScoreTime);
         m_currentScoreTime += incrementScoreTime;
-        m_currentRealTimeSeconds += incrementScoreTime * 60.0 / m_currentTempo;
     }
     else if (layerElement->Is({ BEAM, LIGATURE, FTREM, TUPLET }) && layerElement->HasSameasLink()) {
         incrementScoreTime = layerElement->GetSameAsContentAlignmentDuration(m_meterParams, true, m_notationType);
         incrementScoreTime = incrementScoreTime / (DUR_MAX / DURATION_4);
         m_currentScoreTime += incrementScoreTime;
-        m_currentRealTimeSeconds += incrementScoreTime * 60.0 / m_currentTempo;
     }
     else if (layerElement->Is(MENSUR)) {
         this->m_meterParams.mensur = vrv_cast<Mensur *>(layerElement);
@@ -167,13 +152,6 @@ FunctorCode InitOnsetOffsetFunctor::VisitLayerElement(LayerElement *layerElement
     return FUNCTOR_CONTINUE;
 }
 
-FunctorCode InitOnsetOffsetFunctor::VisitMeasure(Measure *measure)
-{
-    m_currentTempo = measure->GetCurrentTempo();
-
-    return FUNCTOR_CONTINUE;
-}
-
 FunctorCode InitOnsetOffsetFunctor::VisitStaff(Staff *staff)
 {
     StaffDef *drawingStaffDef = staff->m_drawingStaffDef;
@@ -190,10 +168,45 @@ FunctorCode InitOnsetOffsetFunctor::VisitTabGrpEnd(TabGrp *tabGrp)
 
     double incrementScoreTime = element->GetAlignmentDuration(m_meterParams, true, m_notationType);
     incrementScoreTime = incrementScoreTime / (DUR_MAX / DURATION_4);
-    double realTimeIncrementSeconds = incrementScoreTime * 60.0 / m_currentTempo;
 
     m_currentScoreTime += incrementScoreTime;
-    m_currentRealTimeSeconds += realTimeIncrementSeconds;
+
+    return FUNCTOR_CONTINUE;
+}
+
+//----------------------------------------------------------------------------
+// InitRealTimeFunctor
+//----------------------------------------------------------------------------
+
+InitRealTimeFunctor::InitRealTimeFunctor() : Functor()
+{
+    m_currentTempo = MIDI_TEMPO;
+
+    this->SetVisitedClassIds({ MEASURE, NOTE, REST });
+}
+
+FunctorCode InitRealTimeFunctor::VisitMeasure(Measure *measure)
+{
+    m_currentTempo = measure->GetCurrentTempo();
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitRealTimeFunctor::VisitNote(Note *note)
+{
+    // Grace notes are ignored in InitOnsetOffsetFunctor
+    if (note->IsGraceNote()) return FUNCTOR_CONTINUE;
+
+    note->SetRealTimeOnsetSeconds(note->GetScoreTimeOnset() * 60.0 / m_currentTempo);
+    note->SetRealTimeOffsetSeconds(note->GetScoreTimeOffset() * 60.0 / m_currentTempo);
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitRealTimeFunctor::VisitRest(Rest *rest)
+{
+    rest->SetRealTimeOnsetSeconds(rest->GetScoreTimeOnset() * 60.0 / m_currentTempo);
+    rest->SetRealTimeOffsetSeconds(rest->GetScoreTimeOffset() * 60.0 / m_currentTempo);
 
     return FUNCTOR_CONTINUE;
 }
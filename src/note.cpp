@@ -134,12 +134,12 @@ bool Note::IsSupportedChild(Object *child)
     if (child->Is(ACCID)) {
         IsAttributeComparison isAttributeComparison(ACCID);
         if (this->FindDescendantByComparison(&isAttributeComparison))
-            LogWarning("Having both @accid or @accid.ges and <accid> child will cause problems");
+            VRV_LOG_WARNING("Having both @accid or @accid.ges and <accid> child will cause problems");
     }
     else if (child->Is(ARTIC)) {
         IsAttributeComparison isAttributeComparison(ARTIC);
         if (this->FindDescendantByComparison(&isAttributeComparison))
-            LogWarning("Having both @artic and <artic> child will cause problems");
+            VRV_LOG_WARNING("Having both @artic and <artic> child will cause problems");
     }
 
     if (child->Is(ACCID)) {
@@ -175,7 +175,7 @@ bool Note::IsSupportedChild(Object *child)
 void Note::AddChild(Object *child)
 {
     if (!this->IsSupportedChild(child)) {
-        LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
+        VRV_LOG_ERROR("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
         return;
     }
 
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <climits>
 #include <iostream>
@@ -110,6 +111,7 @@ Object::Object(const Object &object) : BoundingBox(object)
     // Flags
     m_isAttribute = object.m_isAttribute;
     m_isModified = true;
+    m_subtreeClassIdsValid = false;
     m_isReferenceObject = object.m_isReferenceObject;
 
     // Also copy attribute classes
@@ -156,6 +158,7 @@ Object &Object::operator=(const Object &object)
         // Flags
         m_isAttribute = object.m_isAttribute;
         m_isModified = true;
+        m_subtreeClassIdsValid = false;
         m_isReferenceObject = object.m_isReferenceObject;
 
         // Also copy attribute classes
@@ -186,6 +189,8 @@ Object &Object::operator=(const Object &object)
 
 Object::~Object()
 {
+    // Do not propagate the invalidation of the ClassId cache to ancestors being deleted
+    m_subtreeClassIdsValid = false;
     ClearChildren();
 }
 
@@ -199,6 +204,7 @@ void Object::Init(ClassId classId, const std::string &classIdStr)
     // Flags
     m_isAttribute = false;
     m_isModified = true;
+    m_subtreeClassIdsValid = false;
     m_isReferenceObject = false;
     // Comments
     m_comment = "";
@@ -232,7 +238,7 @@ const Resources *Object::GetDocResources() const
         return &doc->GetResources();
     }
     else {
-        LogWarning("Requested resources unavailable.");
+        VRV_LOG_WARNING("Requested resources unavailable.");
         return NULL;
     }
 }
@@ -361,6 +367,8 @@ void Object::SwapID(Object *other)
 
 void Object::ClearChildren()
 {
+    this->ResetSubtreeClassIds();
+
     if (m_isReferenceObject) {
         m_children.clear();
         return;
@@ -522,6 +530,7 @@ void Object::InsertChild(Object *element, int idx)
     // With this method we require the parent to be NULL
     assert(!element->GetParent());
     element->SetParent(this);
+    this->ResetSubtreeClassIds();
 
     if (idx >= (int)m_children.size()) {
         m_children.push_back(element);
@@ -540,6 +549,7 @@ Object *Object::DetachChild(int idx)
     child->ResetParent();
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.erase(iter + (idx));
+    this->ResetSubtreeClassIds();
     return child;
 }
 
@@ -571,6 +581,8 @@ Object *Object::Relinquish(int idx)
 
 void Object::ClearRelinquishedChildren()
 {
+    this->ResetSubtreeClassIds();
+
     ArrayOfObjects::iterator iter;
     for (iter = m_children.begin(); iter != m_children.end();) {
         if ((*iter)->GetParent() != this) {
@@ -788,7 +800,7 @@ void Object::SetParent(Object *parent)
 bool Object::IsSupportedChild(Object *child)
 {
     // This should never happen because the method should be overridden
-    LogDebug(
+    VRV_LOG_DEBUG(
         "Method for adding %s to %s should be overridden", child->GetClassName().c_str(), this->GetClassName().c_str());
     // assert(false);
     return false;
@@ -799,7 +811,7 @@ void Object::AddChild(Object *child)
     if (!((child->GetClassName() == "Staff") && (this->GetClassName() == "Section"))) {
         // temporarily allowing staff in section for issue https://github.com/MeasuringPolyphony/mp_editor/issues/62
         if (!this->IsSupportedChild(child)) {
-            LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
+            VRV_LOG_ERROR("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
             return;
         }
     }
@@ -892,6 +904,52 @@ void Object::Modify(bool modified) const
         m_parent->Modify();
     }
     m_isModified = modified;
+    if (modified) m_subtreeClassIdsValid = false;
+}
+
+bool Object::HasClassIdInSubtree(const ClassIdSet &classIds) const
+{
+    if (classIds[m_classId]) return true;
+
+    return (this->GetSubtreeClassIds() & classIds).any();
+}
+
+void Object::CacheSubtreeClassIds() const
+{
+    // Filling the cache of the object fills the one of all its descendants
+    this->GetSubtreeClassIds();
+}
+
+const ClassIdSet &Object::GetSubtreeClassIds() const
+{
+    // Once filled, the cache is only read when processing in parallel. The flag is atomic because the invalidation
+    // of the descendants of a parallel job is propagated to the ancestors shared with the other jobs.
+    if (m_subtreeClassIdsValid) return m_subtreeClassIds;
+
+    m_subtreeClassIds.reset();
+    if (m_isReferenceObject) {
+        // Children are not owned and their modifications are not propagated - we cannot cache anything
+        m_subtreeClassIds.set();
+    }
+    else {
+        for (const Object *child : m_children) {
+            m_subtreeClassIds[child->m_classId] = true;
+            m_subtreeClassIds |= child->GetSubtreeClassIds();
+        }
+    }
+    m_subtreeClassIdsValid = true;
+
+    return m_subtreeClassIds;
+}
+
+void Object::ResetSubtreeClassIds() const
+{
+    // An invalid cache means that the cache of all the ancestors is invalid too
+    const Object *object = this;
+    while (object && object->m_subtreeClassIdsValid) {
+        object->m_subtreeClassIdsValid = false;
+        object = object->m_parent;
+    }
 }
 
 void Object::FillFlatList(ListOfConstObjects &flatList) const
@@ -1042,10 +1100,11 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
         // We need a pointer to the array for the option to work on a reversed copy
         ArrayOfObjects *children = &m_children;
         Filters *filters = functor.GetFilters();
+        const ClassIdSet &visitedClassIds = functor.GetVisitedClassIds();
         if (functor.GetDirection() == BACKWARD) {
             for (ArrayOfObjects::reverse_iterator iter = children->rbegin(); iter != children->rend(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (this->FiltersApply(filters, *iter)) {
+                if (this->FiltersApply(filters, *iter) && this->VisitedClassIdsApply(visitedClassIds, *iter)) {
                     (*iter)->Process(functor, deepness);
                 }
             }
@@ -1053,7 +1112,7 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
         else {
             for (ArrayOfObjects::iterator iter = children->begin(); iter != children->end(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (this->FiltersApply(filters, *iter)) {
+                if (this->FiltersApply(filters, *iter) && this->VisitedClassIdsApply(visitedClassIds, *iter)) {
                     (*iter)->Process(functor, deepness);
                 }
             }
@@ -1096,10 +1155,11 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
         // We need a pointer to the array for the option to work on a reversed copy
         const ArrayOfObjects *children = &m_children;
         Filters *filters = functor.GetFilters();
+        const ClassIdSet &visitedClassIds = functor.GetVisitedClassIds();
         if (functor.GetDirection() == BACKWARD) {
             for (ArrayOfObjects::const_reverse_iterator iter = children->rbegin(); iter != children->rend(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (this->FiltersApply(filters, *iter)) {
+                if (this->FiltersApply(filters, *iter) && this->VisitedClassIdsApply(visitedClassIds, *iter)) {
                     (*iter)->Process(functor, deepness);
                 }
             }
@@ -1107,7 +1167,7 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
         else {
             for (ArrayOfObjects::const_iterator iter = children->begin(); iter != children->end(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (this->FiltersApply(filters, *iter)) {
+                if (this->FiltersApply(filters, *iter) && this->VisitedClassIdsApply(visitedClassIds, *iter)) {
                     (*iter)->Process(functor, deepness);
                 }
             }
@@ -1120,6 +1180,93 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
     }
 }
 
+void Object::Process(const std::vector<Functor *> &functors, int deepness, bool skipFirst)
+{
+    // The active functors are tracked with a bit mask
+    assert(functors.size() <= 32);
+    if (functors.empty()) return;
+
+    uint32_t active = 0;
+    for (int i = 0; i < (int)functors.size(); ++i) {
+        assert(functors.at(i));
+        assert(functors.at(i)->GetDirection() == functors.front()->GetDirection());
+        active |= (1u << i);
+    }
+
+    this->ProcessFunctors(functors, active, deepness, skipFirst);
+}
+
+void Object::ProcessFunctors(const std::vector<Functor *> &functors, uint32_t active, int deepness, bool skipFirst)
+{
+    const int count = (int)functors.size();
+
+    for (int i = 0; i < count; ++i) {
+        if ((active & (1u << i)) && (functors.at(i)->GetCode() == FUNCTOR_STOP)) active &= ~(1u << i);
+    }
+    if (!active) return;
+
+    if (!skipFirst) {
+        for (int i = 0; i < count; ++i) {
+            if (!(active & (1u << i))) continue;
+            FunctorCode code = this->Accept(*functors.at(i));
+            functors.at(i)->SetCode(code);
+        }
+    }
+
+    // do not go any deeper for the functors returning FUNCTOR_SIBLINGS
+    for (int i = 0; i < count; ++i) {
+        if ((active & (1u << i)) && (functors.at(i)->GetCode() == FUNCTOR_SIBLINGS)) {
+            functors.at(i)->SetCode(FUNCTOR_CONTINUE);
+            active &= ~(1u << i);
+        }
+    }
+    if (!active) return;
+
+    if (this->IsEditorialElement()) {
+        // since editorial object doesn't count, we increase the deepness limit
+        ++deepness;
+    }
+    if (deepness == 0) {
+        return;
+    }
+    --deepness;
+
+    uint32_t descending = 0;
+    for (int i = 0; i < count; ++i) {
+        if ((active & (1u << i)) && !this->SkipChildren(functors.at(i)->VisibleOnly())) descending |= (1u << i);
+    }
+
+    if (descending) {
+        auto processChild = [this, &functors, count, descending, deepness](Object *child) {
+            uint32_t childActive = 0;
+            for (int i = 0; i < count; ++i) {
+                if (!(descending & (1u << i))) continue;
+                // we will end here if there is no filter at all or for the current child type
+                if (this->FiltersApply(functors.at(i)->GetFilters(), child)
+                    && this->VisitedClassIdsApply(functors.at(i)->GetVisitedClassIds(), child)) {
+                    childActive |= (1u << i);
+                }
+            }
+            if (childActive) child->ProcessFunctors(functors, childActive, deepness, false);
+        };
+        if (functors.front()->GetDirection() == BACKWARD) {
+            std::for_each(m_children.rbegin(), m_children.rend(), processChild);
+        }
+        else {
+            std::for_each(m_children.begin(), m_children.end(), processChild);
+        }
+    }
+
+    if (skipFirst) return;
+
+    for (int i = 0; i < count; ++i) {
+        if ((active & (1u << i)) && functors.at(i)->ImplementsEndInterface()) {
+            FunctorCode code = this->AcceptEnd(*functors.at(i));
+            functors.at(i)->SetCode(code);
+        }
+    }
+}
+
 FunctorCode Object::Accept(Functor &functor)
 {
     return functor.VisitObject(this);
@@ -1173,6 +1320,12 @@ bool Object::FiltersApply(const Filters *filters, Object *object) const
     return filters ? filters->Apply(object) : true;
 }
 
+bool Object::VisitedClassIdsApply(const ClassIdSet &classIds, const Object *object) const
+{
+    // An empty set means that the functor visits all objects
+    return classIds.none() ? true : object->HasClassIdInSubtree(classIds);
+}
+
 void Object::SaveObject(Output *output, bool basic)
 {
     SaveFunctor save(output, basic);
@@ -1204,7 +1357,7 @@ Object *Object::FindPreviousChild(Comparison *comp, Object *start)
 void Object::LogDebugTree(int maxDepth, int level)
 {
     std::string indent(level, '\t');
-    LogDebug("%s%s", indent.c_str(), this->LogDebugTreeMsg().c_str());
+    VRV_LOG_DEBUG("%s%s", indent.c_str(), this->LogDebugTreeMsg().c_str());
 
     if (maxDepth == level) return;
 
@@ -1301,10 +1454,10 @@ bool Object::sortByUlx(Object *a, Object *b)
 
     if (fa == NULL || fb == NULL) {
         if (fa == NULL) {
-            LogInfo("No available facsimile interface for %s", a->GetID().c_str());
+            VRV_LOG_INFO("No available facsimile interface for %s", a->GetID().c_str());
         }
         if (fb == NULL) {
-            LogInfo("No available facsimile interface for %s", b->GetID().c_str());
+            VRV_LOG_INFO("No available facsimile interface for %s", b->GetID().c_str());
         }
         return false;
     }
@@ -1589,7 +1742,7 @@ Object *ObjectFactory::Create(std::string name)
         return object;
     }
     else {
-        LogError("Factory for '%s' not found", name.c_str());
+        VRV_LOG_ERROR("Factory for '%s' not found", name.c_str());
         return NULL;
     }
 }
@@ -1603,7 +1756,7 @@ ClassId ObjectFactory::GetClassId(std::string name)
         classId = it->second;
     }
     else {
-        LogError("ClassId for '%s' not found", name.c_str());
+        VRV_LOG_ERROR("ClassId for '%s' not found", name.c_str());
     }
 
     return classId;
@@ -1616,7 +1769,7 @@ void ObjectFactory::GetClassIds(const std::vector<std::string> &classStrings, st
             classIds.push_back(s_classIdsRegistry.at(str));
         }
         else {
-            LogDebug("Class name '%s' could not be matched", str.c_str());
+            VRV_LOG_DEBUG("Class name '%s' could not be matched", str.c_str());
         }
     }
 }
@@ -72,31 +72,36 @@ void Option::SetShortOption(char shortOption, bool isCmdOnly)
 bool Option::SetValueBool(bool value)
 {
     // If not overriden
-    LogError("Unsupported type bool for %s", m_key.c_str());
+    VRV_LOG_ERROR("Unsupported type bool for %s", m_key.c_str());
     return false;
 }
 
 bool Option::SetValueDbl(double value)
 {
     // If not overriden
-    LogError("Unsupported type double for %s", m_key.c_str());
+    VRV_LOG_ERROR("Unsupported type double for %s", m_key.c_str());
     return false;
 }
 
 bool Option::SetValueArray(const std::vector<std::string> &values)
 {
     // If not overriden
-    LogError("Unsupported type array for %s", m_key.c_str());
+    VRV_LOG_ERROR("Unsupported type array for %s", m_key.c_str());
     return false;
 }
 
 bool Option::SetValue(const std::string &value)
 {
     // If not overriden
-    LogError("Unsupported type string for %s", m_key.c_str());
+    VRV_LOG_ERROR("Unsupported type string for %s", m_key.c_str());
     return false;
 }
 
+bool Option::HasSameValue(const Option *option) const
+{
+    return (this->GetStrValue() == option->GetStrValue());
+}
+
 jsonxx::Object Option::ToJson() const
 {
     jsonxx::Object opt;
@@ -221,6 +226,13 @@ bool OptionBool::IsSet() const
     return (m_value != m_defaultValue);
 }
 
+bool OptionBool::HasSameValue(const Option *option) const
+{
+    const OptionBool *other = dynamic_cast<const OptionBool *>(option);
+    assert(other);
+    return (m_value == other->m_value);
+}
+
 bool OptionBool::SetValue(bool value)
 {
     m_value = value;
@@ -250,7 +262,7 @@ void OptionDbl::Init(double defaultValue, double minValue, double maxValue, bool
 bool OptionDbl::SetValue(const std::string &value)
 {
     if (!IsValidDouble(value)) {
-        LogError("Unable to set parameter value %s for '%s'; conversion to double failed", value.c_str(),
+        VRV_LOG_ERROR("Unable to set parameter value %s for '%s'; conversion to double failed", value.c_str(),
             this->GetKey().c_str());
         return false;
     }
@@ -289,7 +301,7 @@ double OptionDbl::GetUnfactoredValue() const
 bool OptionDbl::SetValue(double value)
 {
     if ((value < m_minValue) || (value > m_maxValue)) {
-        LogError("Parameter value %f for '%s' out of bounds; default is %f, minimum %f, and maximum %f", value,
+        VRV_LOG_ERROR("Parameter value %f for '%s' out of bounds; default is %f, minimum %f, and maximum %f", value,
             this->GetKey().c_str(), m_defaultValue, m_minValue, m_maxValue);
         return false;
     }
@@ -307,6 +319,13 @@ bool OptionDbl::IsSet() const
     return (m_value != m_defaultValue);
 }
 
+bool OptionDbl::HasSameValue(const Option *option) const
+{
+    const OptionDbl *other = dynamic_cast<const OptionDbl *>(option);
+    assert(other);
+    return (m_value == other->m_value);
+}
+
 //----------------------------------------------------------------------------
 // OptionInt
 //----------------------------------------------------------------------------
@@ -335,7 +354,7 @@ bool OptionInt::SetValueDbl(double value)
 bool OptionInt::SetValue(const std::string &value)
 {
     if (!IsValidInteger(value)) {
-        LogError("Unable to set parameter value %s for '%s'; conversion to integer failed", value.c_str(),
+        VRV_LOG_ERROR("Unable to set parameter value %s for '%s'; conversion to integer failed", value.c_str(),
             this->GetKey().c_str());
         return false;
     }
@@ -369,7 +388,7 @@ int OptionInt::GetUnfactoredValue() const
 bool OptionInt::SetValue(int value)
 {
     if ((value < m_minValue) || (value > m_maxValue)) {
-        LogError("Parameter value %d for '%s' out of bounds; default is %d, minimum %d, and maximum %d", value,
+        VRV_LOG_ERROR("Parameter value %d for '%s' out of bounds; default is %d, minimum %d, and maximum %d", value,
             this->GetKey().c_str(), m_defaultValue, m_minValue, m_maxValue);
         return false;
     }
@@ -387,6 +406,13 @@ bool OptionInt::IsSet() const
     return (m_value != m_defaultValue);
 }
 
+bool OptionInt::HasSameValue(const Option *option) const
+{
+    const OptionInt *other = dynamic_cast<const OptionInt *>(option);
+    assert(other);
+    return (m_value == other->m_value);
+}
+
 //----------------------------------------------------------------------------
 // OptionString
 //----------------------------------------------------------------------------
@@ -420,6 +446,13 @@ bool OptionString::IsSet() const
     return (m_value != m_defaultValue);
 }
 
+bool OptionString::HasSameValue(const Option *option) const
+{
+    const OptionString *other = dynamic_cast<const OptionString *>(option);
+    assert(other);
+    return (m_value == other->m_value);
+}
+
 //----------------------------------------------------------------------------
 // OptionArray
 //----------------------------------------------------------------------------
@@ -480,6 +513,13 @@ bool OptionArray::IsSet() const
     return !m_values.empty();
 }
 
+bool OptionArray::HasSameValue(const Option *option) const
+{
+    const OptionArray *other = dynamic_cast<const OptionArray *>(option);
+    assert(other);
+    return (m_values == other->m_values);
+}
+
 std::string OptionArray::GetStr(const std::vector<std::string> &values) const
 {
     std::stringstream ss;
@@ -531,7 +571,7 @@ bool OptionIntMap::SetValue(const std::string &value)
             m_value = it->first;
             return true;
         }
-    LogError("Parameter '%s' not valid for '%s'", value.c_str(), this->GetKey().c_str());
+    VRV_LOG_ERROR("Parameter '%s' not valid for '%s'", value.c_str(), this->GetKey().c_str());
     return false;
 }
 
@@ -601,6 +641,13 @@ bool OptionIntMap::IsSet() const
     return (m_value != m_defaultValue);
 }
 
+bool OptionIntMap::HasSameValue(const Option *option) const
+{
+    const OptionIntMap *other = dynamic_cast<const OptionIntMap *>(option);
+    assert(other);
+    return (m_value == other->m_value);
+}
+
 //----------------------------------------------------------------------------
 // OptionStaffrel
 //----------------------------------------------------------------------------
@@ -623,7 +670,7 @@ bool OptionStaffrel::SetValue(const std::string &value)
     AttConverter converter;
     data_STAFFREL staffrel = converter.StrToStaffrel(value);
     if (staffrel == STAFFREL_NONE) {
-        LogError("Parameter '%s' not valid", value.c_str());
+        VRV_LOG_ERROR("Parameter '%s' not valid", value.c_str());
         return false;
     }
     m_value = staffrel;
@@ -684,7 +731,7 @@ bool OptionJson::SetValue(const std::string &value)
     bool ok = this->ReadJson(m_values, value);
     if (!ok) {
         if (m_source == JsonSource::String) {
-            LogError("Input json is not valid or contains errors");
+            VRV_LOG_ERROR("Input json is not valid or contains errors");
         }
         else {
             // Input is file path
@@ -692,7 +739,7 @@ bool OptionJson::SetValue(const std::string &value)
                 ok = true;
             }
             else {
-                LogError("Input file '%s' is not valid or contains errors", value.c_str());
+                VRV_LOG_ERROR("Input file '%s' is not valid or contains errors", value.c_str());
             }
         }
     }
@@ -901,6 +948,28 @@ Options::Options()
     m_standardOutput.SetShortOption(' ', true);
     m_baseOptions.AddOption(&m_standardOutput);
 
+    m_serve.SetInfo("Server mode",
+        "Process newline-delimited JSON jobs from the standard input (\"-\") or from a Unix domain socket path and "
+        "write one JSON response per job");
+    m_serve.Init("");
+    m_serve.SetKey("serve");
+    m_serve.SetShortOption(' ', true);
+    m_baseOptions.AddOption(&m_serve);
+
+    m_corpus.SetInfo("Corpus feature extraction",
+        "Extract the descriptive features of the files listed in a file (or \"-\" for the standard input), one "
+        "per line, and write them to the binary output file given with -o");
+    m_corpus.Init("");
+    m_corpus.SetKey("corpus");
+    m_corpus.SetShortOption(' ', true);
+    m_baseOptions.AddOption(&m_corpus);
+
+    m_corpusThreads.SetInfo("Corpus threads", "The number of threads for the corpus feature extraction (0 for all)");
+    m_corpusThreads.Init(0, 0, 64);
+    m_corpusThreads.SetKey("corpusThreads");
+    m_corpusThreads.SetShortOption(' ', true);
+    m_baseOptions.AddOption(&m_corpusThreads);
+
     m_help.SetInfo("Help", "Display this message");
     m_help.Init("");
     m_help.SetKey("help");
@@ -1045,6 +1114,11 @@ Options::Options()
     m_landscape.Init(false);
     this->Register(&m_landscape, "landscape", &m_general);
 
+    m_layoutThreads.SetInfo(
+        "Layout threads", "The number of threads used for laying out the measures and the systems of a page");
+    m_layoutThreads.Init(1, 1, 64);
+    this->Register(&m_layoutThreads, "layoutThreads", &m_general);
+
     m_minLastJustification.SetInfo("Minimum last-system-justification width",
         "The last system is only justified if the unjustified width is greater than this percent");
     m_minLastJustification.Init(0.8, 0.0, 1.0);
@@ -1121,6 +1195,11 @@ Options::Options()
     m_preserveAnalyticalMarkup.Init(false);
     this->Register(&m_preserveAnalyticalMarkup, "preserveAnalyticalMarkup", &m_general);
 
+    m_progressiveLayout.SetInfo("Progressive layout",
+        "Cast off the pages progressively when they are requested - the page count is an estimate until completed");
+    m_progressiveLayout.Init(false);
+    this->Register(&m_progressiveLayout, "progressiveLayout", &m_general);
+
     m_removeIds.SetInfo("Remove IDs in MEI", "Remove XML IDs in the MEI output that are not referenced");
     m_removeIds.Init(false);
     this->Register(&m_removeIds, "removeIds", &m_general);
@@ -1178,6 +1257,17 @@ Options::Options()
     m_svgRemoveXlink.Init(false);
     this->Register(&m_svgRemoveXlink, "svgRemoveXlink", &m_general);
 
+    m_svgGlyphSheet.SetInfo("Shared glyph sheet for SVG",
+        "Refer to the music font glyphs in a sheet shared by all the pages instead of including them in each page");
+    m_svgGlyphSheet.Init(false);
+    this->Register(&m_svgGlyphSheet, "svgGlyphSheet", &m_general);
+
+    m_svgGlyphSheetUrl.SetInfo("Shared glyph sheet URL for SVG",
+        "The URL of the shared glyph sheet referred to by the pages; leave it empty when the sheet is included in "
+        "the same document (e.g., HTML)");
+    m_svgGlyphSheetUrl.Init("");
+    this->Register(&m_svgGlyphSheetUrl, "svgGlyphSheetUrl", &m_general);
+
     m_svgAdditionalAttribute.SetInfo("Add additional attribute in SVG",
         "Add additional attribute for graphical elements in SVG as \"data-*\", for "
         "example, \"note@pname\" would add a \"data-pname\" to all note elements");
@@ -1826,6 +1916,17 @@ Options::Options()
     m_mensuralToMeasure.Init(false);
     this->Register(&m_mensuralToMeasure, "mensuralToMeasure", &m_mensural);
 
+    /********* Options with no effect on the layout *********/
+
+    const std::vector<Option *> layoutIndependent = { &m_logLevel, &m_scale, &m_xmlIdSeed, &m_humType,
+        &m_layoutThreads, &m_mmOutput, &m_outputFormatRaw, &m_outputIndent, &m_outputIndentTab,
+        &m_outputSmuflXmlEntities, &m_removeIds, &m_setLocale, &m_showRuntime, &m_svgAdditionalAttribute,
+        &m_svgBoundingBoxes, &m_svgCss, &m_svgFormatRaw, &m_svgGlyphSheet, &m_svgGlyphSheetUrl, &m_svgHtml5,
+        &m_svgRemoveXlink, &m_svgViewBox, &m_xmlIdChecksum, &m_midiNoCue, &m_midiTempoAdjustment };
+    for (Option *option : layoutIndependent) {
+        option->SetLayoutIndependent();
+    }
+
     /********* Deprecated options *********/
 
     /*
@@ -1850,7 +1951,7 @@ Options::Options()
 
 Options::Options(const Options &options)
 {
-    LogDebug("Copy constructor not implemented for Options");
+    VRV_LOG_DEBUG("Copy constructor not implemented for Options");
     assert(false);
 }
 
@@ -1934,7 +2035,7 @@ void Options::Sync()
             pair.second->SetValueDbl(jsonValue * 2.0); // convert from staff spaces to MEI units
         }
         else if (jsonValue * 2.0 != pair.second->GetValue()) {
-            LogWarning(
+            VRV_LOG_WARNING(
                 "The engraving default '%s' is skipped because the corresponding option '%s' was set before to %f.",
                 pair.first.c_str(), pair.second->GetKey().c_str(), pair.second->GetValue());
         }
@@ -1942,7 +2043,7 @@ void Options::Sync()
     }
 
     std::for_each(unmatchedKeys.cbegin(), unmatchedKeys.cend(),
-        [](const std::string &key) { LogError("Unsupported engraving default '%s'", key.c_str()); });
+        [](const std::string &key) { VRV_LOG_ERROR("Unsupported engraving default '%s'", key.c_str()); });
 }
 
 void Options::Register(Option *option, const std::string &key, OptionGrp *grp)
@@ -1976,4 +2077,17 @@ const std::vector<Option *> *Options::GetBaseOptions() const
     return m_baseOptions.GetOptions();
 }
 
+//----------------------------------------------------------------------------
+// OptionProfile
+//----------------------------------------------------------------------------
+
+void OptionProfile::Apply(std::vector<Option *> &changed) const
+{
+    for (auto &[value, option] : m_entries) {
+        if (option->HasSameValue(value)) continue;
+        value->CopyTo(option);
+        changed.push_back(option);
+    }
+}
+
 } // namespace vrv
@@ -9,7 +9,10 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
+#include <type_traits>
 
 //----------------------------------------------------------------------------
 
@@ -51,9 +54,11 @@
 #include "calcstemfunctor.h"
 #include "comparison.h"
 #include "doc.h"
+#include "floatingobject.h"
 #include "functor.h"
 #include "justifyfunctor.h"
 #include "libmei.h"
+#include "measure.h"
 #include "miscfunctor.h"
 #include "pageelement.h"
 #include "pages.h"
@@ -63,11 +68,43 @@
 #include "score.h"
 #include "staff.h"
 #include "system.h"
+#include "verticalaligner.h"
 #include "view.h"
 #include "vrv.h"
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// MeasureDeferringFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class wraps a functor for skipping the measures and keeping a copy of the functor for each of them.
+ * The measures can then be processed with their copy independently from each other.
+ */
+template <class FUNCTOR> class MeasureDeferringFunctor : public FUNCTOR {
+public:
+    explicit MeasureDeferringFunctor(const FUNCTOR &functor) : FUNCTOR(functor) {}
+
+    /*
+     * Getter for the measures and their copy of the functor
+     */
+    std::vector<std::pair<Measure *, FUNCTOR>> &GetMeasureFunctors() { return m_measureFunctors; }
+
+    /*
+     * Functor interface
+     */
+    FunctorCode VisitMeasure(Measure *measure) override
+    {
+        m_measureFunctors.emplace_back(measure, static_cast<const FUNCTOR &>(*this));
+        return FUNCTOR_SIBLINGS;
+    }
+
+private:
+    // The measures in processing order with the functor state when reaching them
+    std::vector<std::pair<Measure *, FUNCTOR>> m_measureFunctors;
+};
+
 //----------------------------------------------------------------------------
 // Page
 //----------------------------------------------------------------------------
@@ -235,19 +272,21 @@ void Page::LayOutTranscription(bool force)
 
     // Reset the vertical alignment
     ResetVerticalAlignmentFunctor resetVerticalAlignment;
-    this->Process(resetVerticalAlignment);
 
     // Align the content of the page using measure aligners
     // After this:
     // - each LayerElement object will have its Alignment pointer initialized
     AlignHorizontallyFunctor alignHorizontally(doc);
-    this->Process(alignHorizontally);
 
     // Align the content of the page using system aligners
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
     AlignVerticallyFunctor alignVertically(doc);
-    this->Process(alignVertically);
+
+    // The three functors only reset or align the object being visited (or its aligners) and can be run in a single
+    // traversal. The horizontal alignment reset cannot be included because the floating positioners of the objects
+    // have to be reset before the system aligner is reset.
+    this->Process({ &resetVerticalAlignment, &alignHorizontally, &alignVertically });
 
     // Set the pitch / pos alignment
     CalcAlignmentPitchPosFunctor calcAlignmentPitchPos(doc);
@@ -301,19 +340,19 @@ void Page::ResetAligners()
 
     // Reset the vertical alignment
     ResetVerticalAlignmentFunctor resetVerticalAlignment;
-    this->Process(resetVerticalAlignment);
 
     // Align the content of the page using measure aligners
     // After this:
     // - each LayerElement object will have its Alignment pointer initialized
     AlignHorizontallyFunctor alignHorizontally(doc);
-    this->Process(alignHorizontally);
 
     // Align the content of the page using system aligners
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
     AlignVerticallyFunctor alignVertically(doc);
-    this->Process(alignVertically);
+
+    // See Page::LayOutTranscription
+    this->Process({ &resetVerticalAlignment, &alignHorizontally, &alignVertically });
 
     // Unless duration-based spacing is disabled, set the X position of each Alignment.
     // Does non-linear spacing based on the duration space between two Alignment objects.
@@ -376,10 +415,14 @@ void Page::LayOutHorizontally()
 
     this->ResetAligners();
 
+    // The staves of the measures and the measure-level functors can be processed in parallel
+    const int threadCount = doc->GetOptions()->m_layoutThreads.GetValue();
+
     // Render it for filling the bounding box
     View view;
     view.SetDoc(doc);
     view.SetSlurHandling(SlurHandling::Ignore);
+    view.SetThreadCount(threadCount);
     BBoxDeviceContext bBoxDC(&view, 0, 0, BBOX_HORIZONTAL_ONLY);
     // Do not do the layout in this view - otherwise we will loop...
     view.SetPage(this->GetIdx(), false);
@@ -390,53 +433,53 @@ void Page::LayOutHorizontally()
 
     // Adjust the position of outside articulations
     AdjustArticFunctor adjustArtic(doc);
-    this->Process(adjustArtic);
+    this->ProcessMeasures(adjustArtic, threadCount);
 
     // Adjust the x position of the LayerElement where multiple layers collide
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
     // For the first iteration align elements without taking dots into consideration
     AdjustLayersFunctor adjustLayers(doc, scoreDef->GetStaffNs());
-    this->Process(adjustLayers);
+    this->ProcessMeasures(adjustLayers, threadCount);
 
     // Adjust dots for the multiple layers. Try to align dots that can be grouped together when layers collide,
     // otherwise keep their relative positioning
     AdjustDotsFunctor adjustDots(doc, scoreDef->GetStaffNs());
-    this->Process(adjustDots);
+    this->ProcessMeasures(adjustDots, threadCount);
 
     // Adjust the X position of the neume and syllables
     AdjustNeumeXFunctor adjustNeumeX(doc);
-    this->Process(adjustNeumeX);
+    this->ProcessMeasures(adjustNeumeX, threadCount);
 
     // Adjust layers again, this time including dots positioning
     AdjustLayersFunctor adjustLayersWithDots(doc, scoreDef->GetStaffNs());
     adjustLayersWithDots.IgnoreDots(false);
-    this->Process(adjustLayersWithDots);
+    this->ProcessMeasures(adjustLayersWithDots, threadCount);
 
     // Adjust the X position of the accidentals, including in chords
     AdjustAccidXFunctor adjustAccidX(doc);
-    this->Process(adjustAccidX);
+    this->ProcessMeasures(adjustAccidX, threadCount);
 
     // Adjust the X shift of the Alignment looking at the bounding boxes
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
     AdjustXPosFunctor adjustXPos(doc, scoreDef->GetStaffNs());
     adjustXPos.SetExcluded({ TABDURSYM });
-    this->Process(adjustXPos);
+    this->ProcessMeasures(adjustXPos, threadCount);
 
     // Adjust tabRhythm separately
     adjustXPos.ClearExcluded();
     adjustXPos.SetIncluded({ BARLINE, KEYSIG, METERSIG, TABDURSYM });
     adjustXPos.SetRightBarLinesOnly(true);
-    this->Process(adjustXPos);
+    this->ProcessMeasures(adjustXPos, threadCount);
 
     // Adjust the X shift of the Alignment looking at the bounding boxes
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
     AdjustGraceXPosFunctor adjustGraceXPos(doc, scoreDef->GetStaffNs());
-    this->Process(adjustGraceXPos);
+    this->ProcessMeasures(adjustGraceXPos, threadCount);
 
     // Adjust the spacing of clef changes since they are skipped in AdjustXPos
     // Look at each clef change and  move them to the left and add space if necessary
     AdjustClefChangesFunctor adjustClefChanges(doc);
-    this->Process(adjustClefChanges);
+    this->ProcessMeasures(adjustClefChanges, threadCount);
 
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
     // by Verse (for matching syllable connectors)
@@ -458,7 +501,7 @@ void Page::LayOutHorizontally()
 
     // Adjust the position of the tuplets
     AdjustTupletsXFunctor adjustTupletsX(doc);
-    this->Process(adjustTupletsX);
+    this->ProcessMeasures(adjustTupletsX, threadCount);
 
     // Prevent a margin overflow
     AdjustXOverflowFunctor adjustXOverflow(doc->GetDrawingUnit(100));
@@ -479,6 +522,103 @@ void Page::LayOutHorizontallyWithCache(bool restore)
     this->Process(cacheHorizontalLayout);
 }
 
+template <class FUNCTOR> std::vector<FUNCTOR> Page::ProcessSystems(FUNCTOR &functor, int threadCount)
+{
+    std::vector<FUNCTOR> systemFunctors;
+
+    if (threadCount <= 1) {
+        this->Process(functor);
+        return systemFunctors;
+    }
+
+    ArrayOfObjects systems;
+    std::copy_if(this->GetChildren().begin(), this->GetChildren().end(), std::back_inserter(systems),
+        [](const Object *child) { return child->Is(SYSTEM); });
+
+    // The subtree ClassId caches are filled lazily - make sure they are up-to-date before processing in parallel
+    this->CacheSubtreeClassIds();
+
+    // Visit the page as Object::Process does, before the copies are made for the systems
+    if (functor.GetCode() == FUNCTOR_STOP) return systemFunctors;
+    functor.SetCode(this->Accept(functor));
+    if (functor.GetCode() == FUNCTOR_SIBLINGS) {
+        functor.SetCode(FUNCTOR_CONTINUE);
+        return systemFunctors;
+    }
+
+    systemFunctors.resize(systems.size(), functor);
+    RunParallelJobs((int)systems.size(), threadCount,
+        [&systems, &systemFunctors](int i) { systems.at(i)->Process(systemFunctors.at(i)); });
+
+    for (Object *child : this->GetChildren()) {
+        if (!child->Is(SYSTEM)) child->Process(functor);
+    }
+
+    if (functor.ImplementsEndInterface()) {
+        functor.SetCode(this->AcceptEnd(functor));
+    }
+
+    return systemFunctors;
+}
+
+template <class FUNCTOR> void Page::ProcessMeasures(FUNCTOR &functor, int threadCount)
+{
+    // The end of the ancestors of the measures is reached before the measures are processed
+    static_assert(std::is_same_v<decltype(&FUNCTOR::VisitObjectEnd), FunctorCode (FunctorInterface::*)(Object *)>);
+    static_assert(std::is_same_v<decltype(&FUNCTOR::VisitPageEnd), FunctorCode (FunctorInterface::*)(Page *)>);
+    static_assert(std::is_same_v<decltype(&FUNCTOR::VisitSystemEnd), FunctorCode (FunctorInterface::*)(System *)>);
+
+    if (threadCount <= 1) {
+        this->Process(functor);
+        return;
+    }
+
+    // The subtree ClassId caches and the system positions are filled lazily - make sure they are up-to-date
+    // before processing in parallel
+    this->CacheSubtreeClassIds();
+    for (Object *child : this->GetChildren()) {
+        if (!child->Is(SYSTEM)) continue;
+        child->GetDrawingX();
+        child->GetDrawingY();
+    }
+
+    MeasureDeferringFunctor<FUNCTOR> deferringFunctor(functor);
+    this->Process(deferringFunctor);
+
+    std::vector<std::pair<Measure *, FUNCTOR>> &measureFunctors = deferringFunctor.GetMeasureFunctors();
+    RunParallelJobs((int)measureFunctors.size(), threadCount,
+        [&measureFunctors](int i) { measureFunctors.at(i).first->Process(measureFunctors.at(i).second); });
+
+    // Keep the state reached outside the measures, as when processing the page at once
+    functor = deferringFunctor;
+}
+
+bool Page::HasCrossSystemExtenders()
+{
+    std::map<const FloatingObject *, const System *> extenderSystems;
+    for (Object *child : this->GetChildren()) {
+        if (!child->Is(SYSTEM)) continue;
+        System *system = vrv_cast<System *>(child);
+        assert(system);
+        for (Object *alignment : system->m_systemAligner.GetChildren()) {
+            StaffAlignment *staffAlignment = vrv_cast<StaffAlignment *>(alignment);
+            assert(staffAlignment);
+            for (const FloatingPositioner *positioner : staffAlignment->GetFloatingPositioners()) {
+                const FloatingObject *object = positioner->GetObject();
+                if (!object->IsExtenderElement()) continue;
+                auto iter = extenderSystems.find(object);
+                if (iter == extenderSystems.end()) {
+                    extenderSystems[object] = system;
+                }
+                else if (iter->second != system) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
 void Page::LayOutVertically()
 {
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
@@ -488,12 +628,15 @@ void Page::LayOutVertically()
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    // The system-level functors can be run on each system in parallel
+    const int threadCount = doc->GetOptions()->m_layoutThreads.GetValue();
+
     // Reset the vertical alignment
     ResetVerticalAlignmentFunctor resetVerticalAlignment;
     this->Process(resetVerticalAlignment);
 
     CalcLedgerLinesFunctor calcLedgerLines(doc);
-    this->Process(calcLedgerLines);
+    this->ProcessSystems(calcLedgerLines, threadCount);
 
     // Align the content of the page using system aligners
     // After this:
@@ -511,19 +654,22 @@ void Page::LayOutVertically()
 
     // Adjust the position of outside articulations with slurs end and start positions
     AdjustArticWithSlursFunctor adjustArticWithSlurs(doc);
-    this->Process(adjustArticWithSlurs);
+    this->ProcessSystems(adjustArticWithSlurs, threadCount);
 
     // Adjust the position of the beams in regards of layer elements
     AdjustBeamsFunctor adjustBeams(doc);
-    this->Process(adjustBeams);
+    this->ProcessSystems(adjustBeams, threadCount);
 
     // Adjust the position of the tuplets
     AdjustTupletsYFunctor adjustTupletsY(doc);
-    this->Process(adjustTupletsY);
+    this->ProcessSystems(adjustTupletsY, threadCount);
 
     // Adjust the position of the slurs
     AdjustSlursFunctor adjustSlurs(doc);
-    this->Process(adjustSlurs);
+    const std::vector<AdjustSlursFunctor> systemAdjustSlurs = this->ProcessSystems(adjustSlurs, threadCount);
+    const bool hasCrossStaffSlurs = adjustSlurs.HasCrossStaffSlurs()
+        || std::any_of(systemAdjustSlurs.begin(), systemAdjustSlurs.end(),
+            [](const AdjustSlursFunctor &functor) { return functor.HasCrossStaffSlurs(); });
 
     // At this point slurs must not be reinitialized, otherwise the adjustment we just did was in vain
     view.SetSlurHandling(SlurHandling::Drawing);
@@ -532,19 +678,20 @@ void Page::LayOutVertically()
 
     // Adjust the position of tuplets by slurs
     AdjustTupletWithSlursFunctor adjustTupletWithSlurs(doc);
-    this->Process(adjustTupletWithSlurs);
+    this->ProcessSystems(adjustTupletWithSlurs, threadCount);
 
     // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
     CalcBBoxOverflowsFunctor calcBBoxOverflows(doc);
-    this->Process(calcBBoxOverflows);
+    this->ProcessSystems(calcBBoxOverflows, threadCount);
 
     // Adjust the positioners of floating elements (slurs, hairpin, dynam, etc)
+    // Extenders spanning over systems are aligned across them and require the systems to be processed in order
     AdjustFloatingPositionersFunctor adjustFloatingPositioners(doc);
-    this->Process(adjustFloatingPositioners);
+    this->ProcessSystems(adjustFloatingPositioners, this->HasCrossSystemExtenders() ? 1 : threadCount);
 
     // Adjust the overlap of the staff alignments by looking at the overflow bounding boxes
     AdjustStaffOverlapFunctor adjustStaffOverlap(doc);
-    this->Process(adjustStaffOverlap);
+    this->ProcessSystems(adjustStaffOverlap, threadCount);
 
     // Set the Y position of each StaffAlignment
     // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
@@ -553,17 +700,17 @@ void Page::LayOutVertically()
 
     // Adjust the positioners of floating elements placed between staves
     AdjustFloatingPositionersBetweenFunctor adjustFloatingPositionersBetween(doc);
-    this->Process(adjustFloatingPositionersBetween);
+    this->ProcessSystems(adjustFloatingPositionersBetween, threadCount);
 
     AdjustCrossStaffYPosFunctor adjustCrossStaffYPos(doc);
-    this->Process(adjustCrossStaffYPos);
+    this->ProcessSystems(adjustCrossStaffYPos, threadCount);
 
     // Redraw are re-adjust the position of the slurs when we have cross-staff ones
-    if (adjustSlurs.HasCrossStaffSlurs()) {
+    if (hasCrossStaffSlurs) {
         view.SetSlurHandling(SlurHandling::Initialize);
         view.SetPage(this->GetIdx(), false);
         view.DrawCurrentPage(&bBoxDC, false);
-        this->Process(adjustSlurs);
+        this->ProcessSystems(adjustSlurs, threadCount);
     }
 
     if (this->GetHeader()) {
@@ -52,7 +52,7 @@ void PitchInterface::Reset()
 bool PitchInterface::HasIdenticalPitchInterface(const PitchInterface *otherPitchInterface) const
 {
     // This should never happen because it is fully implemented
-    LogError("PitchInterface::HasIdenticalPitchInterface missing");
+    VRV_LOG_ERROR("PitchInterface::HasIdenticalPitchInterface missing");
     assert(false);
     return false;
     /*
@@ -71,7 +71,8 @@ FunctorCode PrepareDataInitializationFunctor::VisitDiv(Div *div)
 FunctorCode PrepareDataInitializationFunctor::VisitChord(Chord *chord)
 {
     if (chord->HasEmptyList()) {
-        LogWarning("Chord '%s' has no child note - a default note is added", chord->GetID().c_str());
+        VRV_LOG_ELEMENT_WARNING(
+            chord->GetID(), "Chord '%s' has no child note - a default note is added", chord->GetID().c_str());
         Note *rescueNote = new Note();
         chord->AddChild(rescueNote);
     }
@@ -238,15 +239,16 @@ FunctorCode PrepareCrossStaffFunctor::VisitLayerElement(LayerElement *layerEleme
     AttNIntegerComparison comparisonFirst(STAFF, crossElement->GetStaff().at(0));
     layerElement->m_crossStaff = vrv_cast<Staff *>(m_currentMeasure->FindDescendantByComparison(&comparisonFirst, 1));
     if (!layerElement->m_crossStaff) {
-        LogWarning("Could not get the cross staff reference '%d' for element '%s'", crossElement->GetStaff().at(0),
-            layerElement->GetID().c_str());
+        VRV_LOG_ELEMENT_WARNING(layerElement->GetID(), "Could not get the cross staff reference '%d' for element '%s'",
+            crossElement->GetStaff().at(0), layerElement->GetID().c_str());
         return FUNCTOR_CONTINUE;
     }
 
     Staff *parentStaff = layerElement->GetAncestorStaff();
     // Check if we have a cross-staff to itself...
     if (layerElement->m_crossStaff == parentStaff) {
-        LogWarning("The cross staff reference '%d' for element '%s' seems to be identical to the parent staff",
+        VRV_LOG_ELEMENT_WARNING(layerElement->GetID(),
+            "The cross staff reference '%d' for element '%s' seems to be identical to the parent staff",
             crossElement->GetStaff().at(0), layerElement->GetID().c_str());
         layerElement->m_crossStaff = NULL;
         return FUNCTOR_CONTINUE;
@@ -269,8 +271,9 @@ FunctorCode PrepareCrossStaffFunctor::VisitLayerElement(LayerElement *layerEleme
     }
     if (!layerElement->m_crossLayer) {
         // Nothing we can do
-        LogWarning("Could not get the layer with cross-staff reference '%d' for element '%s'",
-            crossElement->GetStaff().at(0), layerElement->GetID().c_str());
+        VRV_LOG_ELEMENT_WARNING(layerElement->GetID(),
+            "Could not get the layer with cross-staff reference '%d' for element '%s'", crossElement->GetStaff().at(0),
+            layerElement->GetID().c_str());
         layerElement->m_crossStaff = NULL;
     }
     else {
@@ -440,8 +443,8 @@ FunctorCode PrepareLinkingFunctor::VisitObject(Object *object)
             // Issue a warning if classes of object and sameas do not match
             Object *owner = dynamic_cast<Object *>(j->second);
             if (owner && (owner->GetClassId() != object->GetClassId())) {
-                LogWarning("%s with @xml:id %s has @sameas to an element of class %s.", owner->GetClassName().c_str(),
-                    owner->GetID().c_str(), object->GetClassName().c_str());
+                VRV_LOG_ELEMENT_WARNING(owner->GetID(), "%s with @xml:id %s has @sameas to an element of class %s.",
+                    owner->GetClassName().c_str(), owner->GetID().c_str(), object->GetClassName().c_str());
             }
         }
         m_sameasIDPairs.erase(r2.first, r2.second);
@@ -476,7 +479,7 @@ void PrepareLinkingFunctor::ResolveStemSameas(Note *note)
                     // This is one thing that can go wrong. We can have many others here...
                     // E.g., not the same number of notes, conflicting durations, not all notes sharing stems, ...
                     // Not sure everything could be checked here.
-                    LogError("Notes with @stem.sameas in a beam should refer only to a note also in beam.");
+                    VRV_LOG_ERROR("Notes with @stem.sameas in a beam should refer only to a note also in beam.");
                 }
                 else {
                     beam->SetStemSameasBeam(beamStemSameas);
@@ -496,7 +499,7 @@ PreparePlistFunctor::PreparePlistFunctor() : Functor(), CollectAndProcess() {}
 
 void PreparePlistFunctor::InsertInterfaceIDPair(const std::string &elementID, PlistInterface *interface)
 {
-    m_interfaceIDPairs.push_back(std::make_pair(interface, elementID));
+    m_interfaceIDPairs.insert({ elementID, interface });
 }
 
 FunctorCode PreparePlistFunctor::VisitObject(Object *object)
@@ -512,14 +515,12 @@ FunctorCode PreparePlistFunctor::VisitObject(Object *object)
     else {
         if (!object->IsLayerElement()) return FUNCTOR_CONTINUE;
 
-        const std::string &id = object->GetID();
-        auto iter = std::find_if(m_interfaceIDPairs.begin(), m_interfaceIDPairs.end(),
-            [&id](const std::pair<PlistInterface *, std::string> &pair) { return (pair.second == id); });
-        if (iter != m_interfaceIDPairs.end()) {
-            // Set reference for matched pair and erase it from the list
-            iter->first->SetRef(object);
-            m_interfaceIDPairs.erase(iter);
+        // Set reference for the matched pairs and erase them from the map
+        auto range = m_interfaceIDPairs.equal_range(object->GetID());
+        for (auto iter = range.first; iter != range.second; ++iter) {
+            iter->second->SetRef(object);
         }
+        m_interfaceIDPairs.erase(range.first, range.second);
     }
 
     return FUNCTOR_CONTINUE;
@@ -636,8 +637,8 @@ FunctorCode PrepareTimePointingFunctor::VisitLayerElement(LayerElement *layerEle
 FunctorCode PrepareTimePointingFunctor::VisitMeasureEnd(Measure *measure)
 {
     if (!m_timePointingInterfaces.empty()) {
-        LogWarning("%d time pointing element(s) could not be matched in measure %s", m_timePointingInterfaces.size(),
-            measure->GetID().c_str());
+        VRV_LOG_ELEMENT_WARNING(measure->GetID(), "%d time pointing element(s) could not be matched in measure %s",
+            m_timePointingInterfaces.size(), measure->GetID().c_str());
     }
 
     ListOfPointingInterClassIdPairs::iterator iter = m_timePointingInterfaces.begin();
@@ -659,7 +660,27 @@ PrepareTimeSpanningFunctor::PrepareTimeSpanningFunctor() : Functor(), CollectAnd
 
 void PrepareTimeSpanningFunctor::InsertInterfaceOwnerPair(Object *owner, TimeSpanningInterface *interface)
 {
-    m_timeSpanningInterfaces.push_back({ interface, owner });
+    auto iter = m_timeSpanningInterfaces.insert(m_timeSpanningInterfaces.end(), { interface, owner });
+    // Index the pair by the ids it waits for so that each layer element needs only one lookup
+    const std::string &startID = interface->GetStartIDStr();
+    const std::string &endID = interface->GetEndIDStr();
+    if (!startID.empty()) m_timeSpanningIDs[startID].push_back(iter);
+    if (!endID.empty() && (endID != startID)) m_timeSpanningIDs[endID].push_back(iter);
+}
+
+ListOfSpanningInterOwnerPairs::iterator PrepareTimeSpanningFunctor::EraseInterfaceOwnerPair(
+    ListOfSpanningInterOwnerPairs::iterator iter, const std::string &skipID)
+{
+    const TimeSpanningInterface *interface = iter->first;
+    for (const std::string *id : { &interface->GetStartIDStr(), &interface->GetEndIDStr() }) {
+        if (id->empty() || (*id == skipID)) continue;
+        auto ids = m_timeSpanningIDs.find(*id);
+        if (ids == m_timeSpanningIDs.end()) continue;
+        std::vector<ListOfSpanningInterOwnerPairs::iterator> &pairs = ids->second;
+        pairs.erase(std::remove(pairs.begin(), pairs.end(), iter), pairs.end());
+        if (pairs.empty()) m_timeSpanningIDs.erase(ids);
+    }
+    return m_timeSpanningInterfaces.erase(iter);
 }
 
 FunctorCode PrepareTimeSpanningFunctor::VisitF(F *f)
@@ -685,18 +706,25 @@ FunctorCode PrepareTimeSpanningFunctor::VisitLayerElement(LayerElement *layerEle
     // Do not look for tstamp pointing to these
     if (layerElement->Is({ ARTIC, BEAM, FLAG, TUPLET, STEM, VERSE })) return FUNCTOR_CONTINUE;
 
-    ListOfSpanningInterOwnerPairs::iterator iter = m_timeSpanningInterfaces.begin();
-    while (iter != m_timeSpanningInterfaces.end()) {
-        if (iter->first->SetStartAndEnd(layerElement)) {
+    auto ids = m_timeSpanningIDs.find(layerElement->GetID());
+    if (ids == m_timeSpanningIDs.end()) return FUNCTOR_CONTINUE;
+
+    std::vector<ListOfSpanningInterOwnerPairs::iterator> &pairs = ids->second;
+    auto iter = pairs.begin();
+    while (iter != pairs.end()) {
+        TimeSpanningInterface *interface = (*iter)->first;
+        if (interface->SetStartAndEnd(layerElement)) {
             // Verify that the interface owner is encoded in the measure of its start
-            iter->first->VerifyMeasure(iter->second);
+            interface->VerifyMeasure((*iter)->second);
             // We have both the start and the end that are matched
-            iter = m_timeSpanningInterfaces.erase(iter);
+            this->EraseInterfaceOwnerPair(*iter, ids->first);
+            iter = pairs.erase(iter);
         }
         else {
             ++iter;
         }
     }
+    if (pairs.empty()) m_timeSpanningIDs.erase(ids);
 
     return FUNCTOR_CONTINUE;
 }
@@ -725,7 +753,7 @@ FunctorCode PrepareTimeSpanningFunctor::VisitMeasureEnd(Measure *measure)
             // Eventually, we could consider them, for example if we want to display their spanning or for
             // improved midi output
             if (iter->second->GetClassId() == HARM) {
-                iter = m_timeSpanningInterfaces.erase(iter);
+                iter = this->EraseInterfaceOwnerPair(iter);
             }
             else {
                 ++iter;
@@ -1060,7 +1088,8 @@ FunctorCode PrepareLyricsFunctor::VisitSyl(Syl *syl)
         // The previous syl was a underscore -> the previous but one was the end
         else if (m_currentSyl->GetCon() == sylLog_CON_u) {
             if (m_currentSyl->GetStart() == m_penultimateNoteOrChord) {
-                LogWarning("Syllable with underline extender under one single note '%s'",
+                VRV_LOG_ELEMENT_WARNING(m_currentSyl->GetStart()->GetID(),
+                    "Syllable with underline extender under one single note '%s'",
                     m_currentSyl->GetStart()->GetID().c_str());
             }
             else {
@@ -1169,7 +1198,8 @@ FunctorCode PrepareLayerElementPartsFunctor::VisitNote(Note *note)
 
     const bool shouldHaveDots = (note->GetDots() > 0);
     if (shouldHaveDots && chord && (chord->GetDots() == note->GetDots())) {
-        LogWarning("Note '%s' with a @dots attribute with the same value as its chord parent", note->GetID().c_str());
+        VRV_LOG_ELEMENT_WARNING(note->GetID(),
+            "Note '%s' with a @dots attribute with the same value as its chord parent", note->GetID().c_str());
     }
     currentDots = this->ProcessDots(currentDots, note, shouldHaveDots);
 
@@ -1586,7 +1616,7 @@ FunctorCode PrepareFloatingGrpsFunctor::VisitEnding(Ending *ending)
     if (m_previousEnding) {
         // We need to group the previous and this ending - the previous one should have a grpId
         if (m_previousEnding->GetDrawingGrpId() == 0) {
-            LogDebug("Something went wrong with the grouping of the endings");
+            VRV_LOG_DEBUG("Something went wrong with the grouping of the endings");
         }
         ending->SetDrawingGrpId(m_previousEnding->GetDrawingGrpId());
         // Also set the previous ending to NULL
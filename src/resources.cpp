@@ -14,6 +14,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <utility>
 
 //----------------------------------------------------------------------------
 
@@ -37,6 +38,7 @@ namespace vrv {
 thread_local std::string Resources::s_defaultPath = VRV_RESOURCE_DIR;
 const Resources::StyleAttributes Resources::k_defaultStyle{ data_FONTWEIGHT::FONTWEIGHT_normal,
     data_FONTSTYLE::FONTSTYLE_normal };
+thread_local Resources::ThreadCurrentFonts Resources::s_threadCurrentFonts;
 
 //----------------------------------------------------------------------------
 // Function defined in toolkitdef.h
@@ -62,9 +64,9 @@ bool Resources::InitFonts()
     m_loadedFonts.clear();
 
     // Font Bravura first. As it is expected to have always all symbols we build the code -> name table from it
-    if (!LoadFont(BRAVURA)) LogError("Bravura font could not be loaded.");
+    if (!LoadFont(BRAVURA)) VRV_LOG_ERROR("Bravura font could not be loaded.");
     // Leipzig is our initial default font
-    if (!LoadFont(LEIPZIG)) LogError("Leipzig font could not be loaded.");
+    if (!LoadFont(LEIPZIG)) VRV_LOG_ERROR("Leipzig font could not be loaded.");
 
     m_defaultFontName = LEIPZIG;
     m_currentFontName = m_defaultFontName;
@@ -83,7 +85,7 @@ bool Resources::InitFonts()
 
     for (const auto &textFontInfo : textFontInfos) {
         if (!InitTextFont(textFontInfo.m_fileName, textFontInfo.m_style) && textFontInfo.m_isMandatory) {
-            LogError("Text font could not be initialized.");
+            VRV_LOG_ERROR("Text font could not be initialized.");
             return false;
         }
     }
@@ -98,7 +100,7 @@ bool Resources::SetFont(const std::string &fontName)
     // and the default font provided in options, if it is not one of the previous
     if (!fontName.empty() && !IsFontLoaded(fontName)) {
         if (!LoadFont(fontName)) {
-            LogError("%s font could not be loaded.", fontName.c_str());
+            VRV_LOG_ERROR("%s font could not be loaded.", fontName.c_str());
             return false;
         }
     }
@@ -124,7 +126,7 @@ bool Resources::AddCustom(const std::vector<std::string> &extraFonts)
         }
         success = success && LoadFont(fontName, &zipFile);
         if (!success) {
-            LogError("Option supplied font %s could not be loaded.", fontName.c_str());
+            VRV_LOG_ERROR("Option supplied font %s could not be loaded.", fontName.c_str());
         }
     }
     return success;
@@ -154,12 +156,13 @@ bool Resources::SetFallback(const std::string &fontName)
 
 bool Resources::SetCurrentFont(const std::string &fontName, bool allowLoading)
 {
+    std::string &currentFontName = this->GetCurrentFontName();
     if (IsFontLoaded(fontName)) {
-        m_currentFontName = fontName;
+        currentFontName = fontName;
         return true;
     }
     else if (allowLoading && LoadFont(fontName)) {
-        m_currentFontName = fontName;
+        currentFontName = fontName;
         return true;
     }
     else {
@@ -193,7 +196,7 @@ char32_t Resources::GetGlyphCode(const std::string &smuflName) const
 
 bool Resources::IsSmuflFallbackNeeded(const std::u32string &text) const
 {
-    if (m_loadedFonts.at(m_currentFontName).isFallback()) {
+    if (m_loadedFonts.at(this->GetCurrentFontName()).isFallback()) {
         return false;
     }
     for (char32_t c : text) {
@@ -204,7 +207,7 @@ bool Resources::IsSmuflFallbackNeeded(const std::u32string &text) const
 
 bool Resources::IsCurrentFontFallback() const
 {
-    return (m_currentFontName == m_fallbackFontName);
+    return (this->GetCurrentFontName() == m_fallbackFontName);
 }
 
 bool Resources::FontHasGlyphAvailable(const std::string &fontName, char32_t smuflCode) const
@@ -222,6 +225,33 @@ bool Resources::FontHasGlyphAvailable(const std::string &fontName, char32_t smuf
     }
 }
 
+void Resources::SetThreadCurrentFonts() const
+{
+    s_threadCurrentFonts.m_currentFontName = m_currentFontName;
+    s_threadCurrentFonts.m_currentStyle = m_currentStyle;
+    s_threadCurrentFonts.m_resources = this;
+}
+
+void Resources::ResetThreadCurrentFonts() const
+{
+    s_threadCurrentFonts.m_resources = NULL;
+}
+
+std::string &Resources::GetCurrentFontName()
+{
+    return const_cast<std::string &>(std::as_const(*this).GetCurrentFontName());
+}
+
+const std::string &Resources::GetCurrentFontName() const
+{
+    return (s_threadCurrentFonts.m_resources == this) ? s_threadCurrentFonts.m_currentFontName : m_currentFontName;
+}
+
+Resources::StyleAttributes &Resources::GetCurrentStyle() const
+{
+    return (s_threadCurrentFonts.m_resources == this) ? s_threadCurrentFonts.m_currentStyle : m_currentStyle;
+}
+
 std::string Resources::GetCSSFontFor(const std::string &fontName) const
 {
     if (!IsFontLoaded(fontName)) {
@@ -241,7 +271,7 @@ std::string Resources::GetCustomFontname(const std::string &filename, const ZipF
             return path.stem();
         }
     }
-    LogWarning("The font name could not be extracted from the archive");
+    VRV_LOG_WARNING("The font name could not be extracted from the archive");
     return "";
 #else
     std::filesystem::path path(filename);
@@ -259,16 +289,18 @@ void Resources::SelectTextFont(data_FONTWEIGHT fontWeight, data_FONTSTYLE fontSt
         fontStyle = FONTSTYLE_normal;
     }
 
-    m_currentStyle = { fontWeight, fontStyle };
-    if (m_textFont.count(m_currentStyle) == 0) {
-        LogWarning("Text font for style (%d, %d) is not loaded. Use default", fontWeight, fontStyle);
-        m_currentStyle = k_defaultStyle;
+    StyleAttributes &currentStyle = this->GetCurrentStyle();
+    currentStyle = { fontWeight, fontStyle };
+    if (m_textFont.count(currentStyle) == 0) {
+        VRV_LOG_WARNING("Text font for style (%d, %d) is not loaded. Use default", fontWeight, fontStyle);
+        currentStyle = k_defaultStyle;
     }
 }
 
 const Glyph *Resources::GetTextGlyph(char32_t code) const
 {
-    const StyleAttributes style = (m_textFont.count(m_currentStyle) != 0) ? m_currentStyle : k_defaultStyle;
+    const StyleAttributes &currentStyle = this->GetCurrentStyle();
+    const StyleAttributes style = (m_textFont.count(currentStyle) != 0) ? currentStyle : k_defaultStyle;
     if (m_textFont.count(style) == 0) return NULL;
 
     const GlyphTable &currentTable = m_textFont.at(style);
@@ -300,13 +332,13 @@ bool Resources::LoadFont(const std::string &fontName, ZipFileReader *zipFile)
         const std::string filename = fontName + ".xml";
         if (!zipFile->HasFile(filename)) {
             // File not found, default bounding boxes will be used
-            LogError("Failed to load font and glyph bounding boxes");
+            VRV_LOG_ERROR("Failed to load font and glyph bounding boxes");
             return false;
         }
         pugi::xml_parse_result parseResult = doc.load_string(zipFile->ReadTextFile(filename).c_str());
         if (!parseResult) {
             // File not found, default bounding boxes will be used
-            LogError("Failed to load font and glyph bounding boxes");
+            VRV_LOG_ERROR("Failed to load font and glyph bounding boxes");
             return false;
         }
     }
@@ -316,13 +348,13 @@ bool Resources::LoadFont(const std::string &fontName, ZipFileReader *zipFile)
         pugi::xml_parse_result parseResult = doc.load_file(filename.c_str());
         if (!parseResult) {
             // File not found, default bounding boxes will be used
-            LogError("Failed to load font and glyph bounding boxes");
+            VRV_LOG_ERROR("Failed to load font and glyph bounding boxes");
             return false;
         }
     }
     pugi::xml_node root = doc.first_child();
     if (!root.attribute("units-per-em")) {
-        LogError("No units-per-em attribute in bounding box file");
+        VRV_LOG_ERROR("No units-per-em attribute in bounding box file");
         return false;
     }
 
@@ -387,7 +419,7 @@ bool Resources::LoadFont(const std::string &fontName, ZipFileReader *zipFile)
     }
 
     if (isFallback && glyphTable.size() < SMUFL_COUNT) {
-        LogError("Expected %d default SMuFL glyphs but could load only %d.", SMUFL_COUNT, glyphTable.size());
+        VRV_LOG_ERROR("Expected %d default SMuFL glyphs but could load only %d.", SMUFL_COUNT, glyphTable.size());
         return false;
     }
 
@@ -404,12 +436,12 @@ bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
-        LogInfo("Cannot load bounding boxes for text font '%s'", filename.c_str());
+        VRV_LOG_INFO("Cannot load bounding boxes for text font '%s'", filename.c_str());
         return false;
     }
     pugi::xml_node root = doc.first_child();
     if (!root.attribute("units-per-em")) {
-        LogWarning("No units-per-em attribute in bouding box file");
+        VRV_LOG_WARNING("No units-per-em attribute in bouding box file");
         return false;
     }
     const int unitsPerEm = root.attribute("units-per-em").as_int();
@@ -434,7 +466,7 @@ bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes
 
             if (current.attribute("h-a-x")) glyph.SetHorizAdvX(current.attribute("h-a-x").as_float());
             if (currentTable.count(code) > 0) {
-                LogDebug("Redefining %d with %s", code, fontName.c_str());
+                VRV_LOG_DEBUG("Redefining %d with %s", code, fontName.c_str());
             }
             currentTable[code] = glyph;
         }
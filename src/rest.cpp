@@ -202,7 +202,7 @@ bool Rest::IsSupportedChild(Object *child)
 void Rest::AddChild(Object *child)
 {
     if (!this->IsSupportedChild(child)) {
-        LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
+        VRV_LOG_ERROR("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
         return;
     }
 
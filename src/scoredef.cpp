@@ -417,7 +417,7 @@ void ScoreDef::ReplaceDrawingValues(const StaffDef *newStaffDef)
         if (newStaffDef->HasLabel()) staffDef->SetLabel(newStaffDef->GetLabel());
     }
     else {
-        LogWarning("StaffDef with xml:id '%s' could not be found", newStaffDef->GetID().c_str());
+        VRV_LOG_WARNING("StaffDef with xml:id '%s' could not be found", newStaffDef->GetID().c_str());
     }
 }
 
@@ -363,7 +363,7 @@ FunctorCode ScoreDefOptimizeFunctor::VisitStaff(Staff *staff)
     StaffDef *staffDef = m_currentScoreDef->GetStaffDef(staff->GetN());
 
     if (!staffDef) {
-        LogDebug("Could not find staffDef for staff (%d) when optimizing scoreDef", staff->GetN());
+        VRV_LOG_DEBUG("Could not find staffDef for staff (%d) when optimizing scoreDef", staff->GetN());
         return FUNCTOR_SIBLINGS;
     }
 
@@ -539,13 +539,13 @@ FunctorCode ScoreDefSetGrpSymFunctor::VisitGrpSym(GrpSym *grpSym)
         StaffDef *end = vrv_cast<StaffDef *>(scoreDef->FindDescendantByComparison(&compare, level));
 
         if (!start || !end) {
-            LogWarning("Could not find startid/endid on level %d for <'%s'>", level, grpSym->GetID().c_str());
+            VRV_LOG_WARNING("Could not find startid/endid on level %d for <'%s'>", level, grpSym->GetID().c_str());
             return FUNCTOR_CONTINUE;
         }
 
         if (start->GetParent() != end->GetParent()) {
-            LogWarning("<'%s'> has mismatching parents for startid:<'%s'> and endid:<'%s'>", grpSym->GetID().c_str(),
-                startId.c_str(), endId.c_str());
+            VRV_LOG_WARNING("<'%s'> has mismatching parents for startid:<'%s'> and endid:<'%s'>",
+                grpSym->GetID().c_str(), startId.c_str(), endId.c_str());
             return FUNCTOR_CONTINUE;
         }
 
@@ -264,7 +264,10 @@ void Staff::SetFromFacsimile(Doc *doc)
     if (!this->HasFacs()) return;
     if (this->GetZone() == NULL) {
         assert(doc);
-        Zone *zone = doc->GetFacsimile()->FindZoneByID(this->GetFacs());
+        Facsimile *facsimile = doc->GetFacsimile();
+        // The index is cleared at the end of the drawing of the page (see View::DrawCurrentPage)
+        if (!facsimile->IsIndexed()) facsimile->IndexDescendants();
+        Zone *zone = facsimile->FindZoneByID(this->GetFacs());
         assert(zone);
         this->AttachZone(zone);
     }
@@ -53,7 +53,7 @@ bool Surface::IsSupportedChild(Object *object)
         assert(dynamic_cast<Zone *>(object));
     }
     else {
-        LogError("Unsupported child '%s' of surface", object->GetClassName().c_str());
+        VRV_LOG_ERROR("Unsupported child '%s' of surface", object->GetClassName().c_str());
         return false;
     }
     return true;
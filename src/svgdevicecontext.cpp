@@ -9,7 +9,10 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
+#include <charconv>
+#include <cstdio>
 
 //----------------------------------------------------------------------------
 
@@ -29,11 +32,115 @@ namespace vrv {
 #define space " "
 #define semicolon ";"
 
+//----------------------------------------------------------------------------
+// SvgGlyphSheet
+//----------------------------------------------------------------------------
+
+SvgGlyphSheet::SvgGlyphSheet(const std::string &postfix)
+{
+    m_glyphPostfixId = postfix;
+}
+
+void SvgGlyphSheet::Reset()
+{
+    m_smuflGlyphs.clear();
+    m_glyphCodeFontCounter.clear();
+}
+
+SvgGlyphSheet::GlyphRef::GlyphRef(const Glyph *glyph, int count, const std::string &postfix) : m_glyph(glyph)
+{
+    // Add the counter only when necessary (more than one font for that glyph)
+    if (count == 0) {
+        m_refId = glyph->GetCodeStr();
+    }
+    else {
+        m_refId = StringFormat("%s-%d", glyph->GetCodeStr().c_str(), count);
+    }
+    if (!postfix.empty()) {
+        m_refId += "-" + postfix;
+    }
+};
+
+const std::string &SvgGlyphSheet::InsertGlyphRef(const Glyph *glyph)
+{
+    // We have already used this glyph
+    auto it = m_smuflGlyphs.find(glyph);
+    if (it != m_smuflGlyphs.end()) {
+        return it->second.GetRefId();
+    }
+
+    const std::string code = glyph->GetCodeStr();
+
+    int count;
+    // This is the first time we have a glyph with this code
+    if (m_glyphCodeFontCounter.find(code) == m_glyphCodeFontCounter.end()) {
+        count = 0;
+    }
+    // We used it but with another font
+    else {
+        count = m_glyphCodeFontCounter[(code)];
+    }
+    GlyphRef ref(glyph, count, m_glyphPostfixId);
+    it = m_smuflGlyphs.insert(std::pair<const Glyph *, GlyphRef>(glyph, ref)).first;
+    m_glyphCodeFontCounter[code] = count + 1;
+
+    return it->second.GetRefId();
+}
+
+void SvgGlyphSheet::AppendDefs(pugi::xml_node defs) const
+{
+    pugi::xml_document sourceDoc;
+
+    // for each needed glyph
+    for (const std::pair<const Glyph *, const GlyphRef &> entry : m_smuflGlyphs) {
+        // load the XML as a pugi::xml_document
+        sourceDoc.load_string(entry.first->GetXML().c_str());
+
+        // copy all the nodes inside into the master document
+        for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
+            child.attribute("id").set_value(entry.second.GetRefId().c_str());
+            defs.append_copy(child);
+        }
+    }
+}
+
+std::string SvgGlyphSheet::GetStringSVG(bool xmlDeclaration, int indent, bool formatRaw) const
+{
+    pugi::xml_document svgDoc;
+    pugi::xml_node svgNode = svgDoc.append_child("svg");
+    svgNode.append_attribute("version") = "1.1";
+    svgNode.append_attribute("xmlns") = "http://www.w3.org/2000/svg";
+    // Hide the sheet when it is included in the same document as the pages
+    svgNode.append_attribute("width") = "0";
+    svgNode.append_attribute("height") = "0";
+    svgNode.append_attribute("style") = "position: absolute";
+    pugi::xml_node desc = svgNode.append_child("desc");
+    desc.text().set(StringFormat("Engraved by Verovio %s", GetVersion().c_str()).c_str());
+    this->AppendDefs(svgNode.append_child("defs"));
+
+    unsigned int outputFlags = pugi::format_default | pugi::format_no_declaration;
+    if (xmlDeclaration) {
+        outputFlags = pugi::format_default;
+        pugi::xml_node decl = svgDoc.prepend_child(pugi::node_declaration);
+        decl.append_attribute("version") = "1.0";
+        decl.append_attribute("encoding") = "UTF-8";
+        decl.append_attribute("standalone") = "no";
+    }
+    if (formatRaw) {
+        outputFlags |= pugi::format_raw;
+    }
+
+    std::ostringstream output;
+    std::string indentStr = (indent == -1) ? "\t" : std::string(indent, ' ');
+    svgDoc.save(output, indentStr.c_str(), outputFlags);
+    return output.str();
+}
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
 
-SvgDeviceContext::SvgDeviceContext() : DeviceContext(SVG_DEVICE_CONTEXT)
+SvgDeviceContext::SvgDeviceContext() : DeviceContext(SVG_DEVICE_CONTEXT), m_glyphs(Object::GenerateHashID())
 {
     m_originX = 0;
     m_originY = 0;
@@ -41,7 +148,7 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext(SVG_DEVICE_CONTEXT)
     this->SetBrush(AxNONE, AxSOLID);
     this->SetPen(AxNONE, 1, AxSOLID);
 
-    m_smuflGlyphs.clear();
+    m_glyphSheet = NULL;
 
     m_committed = false;
     m_vrvTextFont = false;
@@ -70,8 +177,6 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext(SVG_DEVICE_CONTEXT)
     m_currentNode = m_svgNode;
 
     m_outdata.clear();
-
-    m_glyphPostfixId = Object::GenerateHashID();
 }
 
 SvgDeviceContext::~SvgDeviceContext() {}
@@ -84,43 +189,6 @@ bool SvgDeviceContext::CopyFileToStream(const std::string &filename, std::ostrea
     return true;
 }
 
-SvgDeviceContext::GlyphRef::GlyphRef(const Glyph *glyph, int count, const std::string &postfix) : m_glyph(glyph)
-{
-    // Add the counter only when necessary (more than one font for that glyph)
-    if (count == 0) {
-        m_refId = StringFormat("%s-%s", glyph->GetCodeStr().c_str(), postfix.c_str());
-    }
-    else {
-        m_refId = StringFormat("%s-%d-%s", glyph->GetCodeStr().c_str(), count, postfix.c_str());
-    }
-};
-
-const std::string SvgDeviceContext::InsertGlyphRef(const Glyph *glyph)
-{
-    const std::string code = glyph->GetCodeStr();
-
-    // We have already used this glyph
-    if (m_smuflGlyphs.find(glyph) != m_smuflGlyphs.end()) {
-        return m_smuflGlyphs.at(glyph).GetRefId();
-    }
-
-    int count;
-    // This is the first time we have a glyph with this code
-    if (m_glyphCodeFontCounter.find(code) == m_glyphCodeFontCounter.end()) {
-        count = 0;
-    }
-    // We used it but with another font
-    else {
-        count = m_glyphCodeFontCounter[(code)];
-    }
-    GlyphRef ref(glyph, count, m_glyphPostfixId);
-    const std::string id = ref.GetRefId();
-    m_smuflGlyphs.insert(std::pair<const Glyph *, GlyphRef>(glyph, ref));
-    m_glyphCodeFontCounter[code] = count + 1;
-
-    return id;
-}
-
 void SvgDeviceContext::IncludeTextFont(const std::string &fontname, const Resources *resources)
 {
     assert(resources);
@@ -192,22 +260,9 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     }
 
     // header
-    if (m_smuflGlyphs.size() > 0) {
-
+    if (!m_glyphs.IsEmpty()) {
         pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
-
-        // for each needed glyph
-        for (const std::pair<const Glyph *, const SvgDeviceContext::GlyphRef &> entry : m_smuflGlyphs) {
-            // load the XML as a pugi::xml_document
-            sourceDoc.load_string(entry.first->GetXML().c_str());
-
-            // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
-                child.attribute("id").set_value(entry.second.GetRefId().c_str());
-                defs.append_copy(child);
-            }
-        }
+        m_glyphs.AppendDefs(defs);
     }
 
     unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
@@ -457,7 +512,8 @@ void SvgDeviceContext::RotateGraphic(Point const &orig, double angle)
         return;
     }
 
-    m_currentNode.append_attribute("transform") = StringFormat("rotate(%f %d,%d)", angle, orig.x, orig.y).c_str();
+    m_currentNode.append_attribute("transform")
+        = this->FormatToBuffer("rotate(", angle, ' ', orig.x, ',', orig.y, ')');
 }
 
 void SvgDeviceContext::StartPage()
@@ -569,7 +625,7 @@ Point SvgDeviceContext::GetLogicalOrigin()
     return Point(m_originX, m_originY);
 }
 
-pugi::xml_node SvgDeviceContext::AddChild(std::string name)
+pugi::xml_node SvgDeviceContext::AddChild(const std::string &name)
 {
     pugi::xml_node g = m_currentNode.child("g");
     if (g) {
@@ -607,18 +663,31 @@ void SvgDeviceContext::AppendStrokeDashArray(pugi::xml_node node, const Pen &pen
     if (pen.GetDashLength() > 0) {
         const int dashLength = pen.GetDashLength();
         const int gapLength = (pen.GetGapLength() > 0) ? pen.GetGapLength() : dashLength;
-        node.append_attribute("stroke-dasharray") = StringFormat("%d %d", dashLength, gapLength).c_str();
+        node.append_attribute("stroke-dasharray") = this->FormatToBuffer(dashLength, ' ', gapLength);
     }
 }
 
+void SvgDeviceContext::AppendToBuffer(int value)
+{
+    char buffer[16];
+    const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    m_formatBuffer.append(buffer, result.ptr);
+}
+
+void SvgDeviceContext::AppendToBuffer(double value)
+{
+    // Same output as "%f" but written in place
+    char buffer[64];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%f", value);
+    if (length > 0) m_formatBuffer.append(buffer, std::min(length, int(sizeof(buffer)) - 1));
+}
+
 // Drawing methods
 void SvgDeviceContext::DrawQuadBezierPath(Point bezier[3])
 {
     pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d,%d Q%d,%d %d,%d", // Base string
-        bezier[0].x, bezier[0].y, // M Command
-        bezier[1].x, bezier[1].y, bezier[2].x, bezier[2].y)
-                                          .c_str();
+    pathChild.append_attribute("d") = this->FormatToBuffer('M', bezier[0].x, ',', bezier[0].y, // M Command
+        " Q", bezier[1].x, ',', bezier[1].y, ' ', bezier[2].x, ',', bezier[2].y);
     pathChild.append_attribute("fill") = "none";
     pathChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
     pathChild.append_attribute("stroke-linecap") = "round";
@@ -630,11 +699,10 @@ void SvgDeviceContext::DrawQuadBezierPath(Point bezier[3])
 void SvgDeviceContext::DrawCubicBezierPath(Point bezier[4])
 {
     pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d,%d C%d,%d %d,%d %d,%d", // Base string
-        bezier[0].x, bezier[0].y, // M Command
-        bezier[1].x, bezier[1].y, bezier[2].x, bezier[2].y, bezier[3].x, bezier[3].y // Remaining bezier points.
-        )
-                                          .c_str();
+    pathChild.append_attribute("d") = this->FormatToBuffer('M', bezier[0].x, ',', bezier[0].y, // M Command
+        " C", bezier[1].x, ',', bezier[1].y, ' ', bezier[2].x, ',', bezier[2].y, ' ', bezier[3].x, ',',
+        bezier[3].y // Remaining bezier points.
+    );
     pathChild.append_attribute("fill") = "none";
     pathChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
     pathChild.append_attribute("stroke-linecap") = "round";
@@ -646,12 +714,12 @@ void SvgDeviceContext::DrawCubicBezierPath(Point bezier[4])
 void SvgDeviceContext::DrawCubicBezierPathFilled(Point bezier1[4], Point bezier2[4])
 {
     pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d")
-        = StringFormat("M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d", bezier1[0].x, bezier1[0].y, // M command
-            bezier1[1].x, bezier1[1].y, bezier1[2].x, bezier1[2].y, bezier1[3].x, bezier1[3].y, // First bezier
-            bezier2[2].x, bezier2[2].y, bezier2[1].x, bezier2[1].y, bezier2[0].x, bezier2[0].y // Second Bezier
-            )
-              .c_str();
+    pathChild.append_attribute("d") = this->FormatToBuffer('M', bezier1[0].x, ',', bezier1[0].y, // M command
+        " C", bezier1[1].x, ',', bezier1[1].y, ' ', bezier1[2].x, ',', bezier1[2].y, ' ', bezier1[3].x, ',',
+        bezier1[3].y, // First bezier
+        " C", bezier2[2].x, ',', bezier2[2].y, ' ', bezier2[1].x, ',', bezier2[1].y, ' ', bezier2[0].x, ',',
+        bezier2[0].y // Second Bezier
+    );
     // pathChild.append_attribute("fill") = "currentColor";
     // pathChild.append_attribute("fill-opacity") = "1";
     pathChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
@@ -741,9 +809,8 @@ void SvgDeviceContext::DrawEllipticArc(int x, int y, int width, int height, doub
     int fSweep = (fabs(theta2 - theta1) > M_PI) ? 1 : 0;
 
     pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d") = StringFormat(
-        "M%d %d A%d %d 0.0 %d %d %d %d", int(xs), int(ys), abs(int(rx)), abs(int(ry)), fArc, fSweep, int(xe), int(ye))
-                                          .c_str();
+    pathChild.append_attribute("d") = this->FormatToBuffer('M', int(xs), ' ', int(ys), " A", abs(int(rx)), ' ',
+        abs(int(ry)), " 0.0 ", fArc, ' ', fSweep, ' ', int(xe), ' ', int(ye));
     // pathChild.append_attribute("fill") = "currentColor";
     if (currentBrush.GetOpacity() != 1.0) pathChild.append_attribute("fill-opacity") = currentBrush.GetOpacity();
     if (currentPen.GetOpacity() != 1.0) pathChild.append_attribute("stroke-opacity") = currentPen.GetOpacity();
@@ -756,7 +823,7 @@ void SvgDeviceContext::DrawEllipticArc(int x, int y, int width, int height, doub
 void SvgDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
 {
     pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d %d L%d %d", x1, y1, x2, y2).c_str();
+    pathChild.append_attribute("d") = this->FormatToBuffer('M', x1, ' ', y1, " L", x2, ' ', y2);
     pathChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
     if (m_penStack.top().GetWidth() > 1) pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
     this->AppendStrokeLineCap(pathChild, m_penStack.top());
@@ -774,10 +841,10 @@ void SvgDeviceContext::DrawPolyline(int n, Point points[], int xOffset, int yOff
         polylineChild.append_attribute("stroke") = this->GetColor(currentPen.GetColor()).c_str();
     }
     if (currentPen.GetWidth() > 1) {
-        polylineChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+        polylineChild.append_attribute("stroke-width") = currentPen.GetWidth();
     }
     if (currentPen.GetOpacity() != 1.0) {
-        polylineChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+        polylineChild.append_attribute("stroke-opacity") = this->FormatToBuffer(currentPen.GetOpacity());
     }
 
     this->AppendStrokeLineCap(polylineChild, currentPen);
@@ -786,11 +853,14 @@ void SvgDeviceContext::DrawPolyline(int n, Point points[], int xOffset, int yOff
 
     if (n > 2) polylineChild.append_attribute("fill") = "none";
 
-    std::string pointsString;
+    m_formatBuffer.clear();
     for (int i = 0; i < n; ++i) {
-        pointsString += StringFormat("%d,%d ", points[i].x + xOffset, points[i].y + yOffset);
+        this->AppendToBuffer(points[i].x + xOffset);
+        this->AppendToBuffer(',');
+        this->AppendToBuffer(points[i].y + yOffset);
+        this->AppendToBuffer(' ');
     }
-    polylineChild.append_attribute("points") = pointsString.c_str();
+    polylineChild.append_attribute("points") = m_formatBuffer.c_str();
 }
 
 void SvgDeviceContext::DrawPolygon(int n, Point points[], int xOffset, int yOffset)
@@ -807,10 +877,10 @@ void SvgDeviceContext::DrawPolygon(int n, Point points[], int xOffset, int yOffs
         polygonChild.append_attribute("stroke") = this->GetColor(currentPen.GetColor()).c_str();
     }
     if (currentPen.GetWidth() > 1) {
-        polygonChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+        polygonChild.append_attribute("stroke-width") = currentPen.GetWidth();
     }
     if (currentPen.GetOpacity() != 1.0) {
-        polygonChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+        polygonChild.append_attribute("stroke-opacity") = this->FormatToBuffer(currentPen.GetOpacity());
     }
 
     this->AppendStrokeLineJoin(polygonChild, currentPen);
@@ -819,13 +889,16 @@ void SvgDeviceContext::DrawPolygon(int n, Point points[], int xOffset, int yOffs
     if (currentBrush.GetColor() != AxNONE)
         polygonChild.append_attribute("fill") = this->GetColor(currentBrush.GetColor()).c_str();
     if (currentBrush.GetOpacity() != 1.0)
-        polygonChild.append_attribute("fill-opacity") = StringFormat("%f", currentBrush.GetOpacity()).c_str();
+        polygonChild.append_attribute("fill-opacity") = this->FormatToBuffer(currentBrush.GetOpacity());
 
-    std::string pointsString = StringFormat("%d,%d", points[0].x + xOffset, points[0].y + yOffset);
-    for (int i = 1; i < n; ++i) {
-        pointsString += " " + StringFormat("%d,%d", points[i].x + xOffset, points[i].y + yOffset);
+    m_formatBuffer.clear();
+    for (int i = 0; i < n; ++i) {
+        if (i > 0) this->AppendToBuffer(' ');
+        this->AppendToBuffer(points[i].x + xOffset);
+        this->AppendToBuffer(',');
+        this->AppendToBuffer(points[i].y + yOffset);
     }
-    polygonChild.append_attribute("points") = pointsString.c_str();
+    polygonChild.append_attribute("points") = m_formatBuffer.c_str();
 }
 
 void SvgDeviceContext::DrawRectangle(int x, int y, int width, int height)
@@ -842,9 +915,9 @@ void SvgDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height,
         if (currentPen.GetWidth() > 0)
             rectChild.append_attribute("stroke") = this->GetColor(currentPen.GetColor()).c_str();
         if (currentPen.GetWidth() > 1)
-            rectChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+            rectChild.append_attribute("stroke-width") = currentPen.GetWidth();
         if (currentPen.GetOpacity() != 1.0)
-            rectChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+            rectChild.append_attribute("stroke-opacity") = this->FormatToBuffer(currentPen.GetOpacity());
     }
 
     if (m_brushStack.size()) {
@@ -852,7 +925,7 @@ void SvgDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height,
         if (currentBrush.GetColor() != AxNONE)
             rectChild.append_attribute("fill") = this->GetColor(currentBrush.GetColor()).c_str();
         if (currentBrush.GetOpacity() != 1.0)
-            rectChild.append_attribute("fill-opacity") = StringFormat("%f", currentBrush.GetOpacity()).c_str();
+            rectChild.append_attribute("fill-opacity") = this->FormatToBuffer(currentBrush.GetOpacity());
     }
 
     // negative heights or widths are not allowed in SVG
@@ -992,11 +1065,11 @@ void SvgDeviceContext::DrawText(
         }
     }
     if (m_fontStack.top()->GetPointSize() != 0) {
-        textChild.append_attribute("font-size") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        textChild.append_attribute("font-size") = this->FormatToBuffer(m_fontStack.top()->GetPointSize(), "px");
     }
     if (m_fontStack.top()->GetLetterSpacing() != 0.0) {
         textChild.append_attribute("letter-spacing")
-            = StringFormat("%dpx", m_fontStack.top()->GetLetterSpacing()).c_str();
+            = this->FormatToBuffer(m_fontStack.top()->GetLetterSpacing(), "px");
     }
     textChild.text().set(svgText.c_str());
 
@@ -1005,15 +1078,15 @@ void SvgDeviceContext::DrawText(
         pugi::xml_node g = m_currentNode.parent().parent();
         pugi::xml_node rectChild = g.append_child("rect");
         rectChild.append_attribute("class") = "sylTextRect";
-        rectChild.append_attribute("x") = StringFormat("%d", x).c_str();
-        rectChild.append_attribute("y") = StringFormat("%d", y).c_str();
-        rectChild.append_attribute("width") = StringFormat("%d", width).c_str();
-        rectChild.append_attribute("height") = StringFormat("%d", height).c_str();
+        rectChild.append_attribute("x") = x;
+        rectChild.append_attribute("y") = y;
+        rectChild.append_attribute("width") = width;
+        rectChild.append_attribute("height") = height;
         rectChild.append_attribute("opacity") = "0.0";
     }
     else if ((x != 0) && (y != 0) && (x != VRV_UNSET) && (y != VRV_UNSET)) {
-        textChild.append_attribute("x") = StringFormat("%d", x).c_str();
-        textChild.append_attribute("y") = StringFormat("%d", y).c_str();
+        textChild.append_attribute("x") = x;
+        textChild.append_attribute("y") = y;
     }
 }
 
@@ -1044,20 +1117,21 @@ void SvgDeviceContext::DrawMusicText(const std::u32string &text, int x, int y, b
             continue;
         }
 
-        // Add the glyph to the array for the <defs>
-        const std::string id = InsertGlyphRef(glyph);
+        // Add the glyph to the array for the <defs>, or to the shared sheet
+        const std::string &id
+            = (m_glyphSheet) ? m_glyphSheet->InsertGlyphRef(glyph) : m_glyphs.InsertGlyphRef(glyph);
 
         // Write the char in the SVG
         pugi::xml_node useChild = AddChild("use");
-        useChild.append_attribute(hrefAttrib.c_str()) = StringFormat("#%s", id.c_str()).c_str();
+        useChild.append_attribute(hrefAttrib.c_str()) = this->FormatToBuffer(m_glyphSheetUrl, '#', id);
         useChild.append_attribute("x") = x;
         useChild.append_attribute("y") = y;
-        useChild.append_attribute("height") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
-        useChild.append_attribute("width") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        useChild.append_attribute("height") = this->FormatToBuffer(m_fontStack.top()->GetPointSize(), "px");
+        useChild.append_attribute("width") = this->FormatToBuffer(m_fontStack.top()->GetPointSize(), "px");
         if (m_fontStack.top()->GetWidthToHeightRatio() != 1.0f) {
-            useChild.append_attribute("transform") = StringFormat("matrix(%f,0,0,1,%f,0)",
-                m_fontStack.top()->GetWidthToHeightRatio(), x * (1. - m_fontStack.top()->GetWidthToHeightRatio()))
-                                                         .c_str();
+            useChild.append_attribute("transform") = this->FormatToBuffer("matrix(",
+                m_fontStack.top()->GetWidthToHeightRatio(), ",0,0,1,",
+                x * (1. - m_fontStack.top()->GetWidthToHeightRatio()), ",0)");
         }
 
         // Get the bounds of the char
@@ -1076,17 +1150,16 @@ void SvgDeviceContext::DrawGraphicUri(int x, int y, int width, int height, const
 {
     pugi::xml_node image = m_currentNode.append_child("image");
     image.append_attribute("xlink:href") = uri.c_str();
-    image.append_attribute("x") = StringFormat("%d", x).c_str();
-    image.append_attribute("y") = StringFormat("%d", y).c_str();
-    image.append_attribute("width") = StringFormat("%d", width).c_str();
-    image.append_attribute("height") = StringFormat("%d", height).c_str();
+    image.append_attribute("x") = x;
+    image.append_attribute("y") = y;
+    image.append_attribute("width") = width;
+    image.append_attribute("height") = height;
 }
 
 void SvgDeviceContext::DrawSvgShape(int x, int y, int width, int height, double scale, pugi::xml_node svg)
 {
-    m_currentNode.append_attribute("transform")
-        = StringFormat("translate(%d, %d) scale(%f, %f)", x, y, scale * DEFINITION_FACTOR, scale * DEFINITION_FACTOR)
-              .c_str();
+    m_currentNode.append_attribute("transform") = this->FormatToBuffer(
+        "translate(", x, ", ", y, ") scale(", scale * DEFINITION_FACTOR, ", ", scale * DEFINITION_FACTOR, ')');
 
     // Remove the ID in the SVG because it might be duplicated and that will not be valid
     m_currentNode.remove_attribute("id");
@@ -1151,10 +1224,6 @@ void SvgDeviceContext::AppendAdditionalAttributes(Object *object)
 
 std::string SvgDeviceContext::GetColor(int color)
 {
-    std::ostringstream ss;
-    ss << "#";
-    ss << std::hex;
-
     switch (color) {
         case (AxNONE): return "currentColor";
         case (AxBLACK): return "#000000";
@@ -1165,6 +1234,9 @@ std::string SvgDeviceContext::GetColor(int color)
         case (AxCYAN): return "#00FFFF";
         case (AxLIGHT_GREY): return "#777777";
         default:
+            std::ostringstream ss;
+            ss << "#";
+            ss << std::hex;
             int blue = (color & 255);
             int green = (color >> 8) & 255;
             int red = (color >> 16) & 255;
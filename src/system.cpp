@@ -71,6 +71,7 @@ void System::Reset()
     this->ResetTyped();
 
     this->ResetDrawingScoreDef();
+    this->ResetDrawingMeasures();
 
     m_systemLeftMar = 0;
     m_systemRightMar = 0;
@@ -113,7 +114,8 @@ int System::GetDrawingX() const
 {
     if (m_drawingFacsX != VRV_UNSET) return m_drawingFacsX;
 
-    m_cachedDrawingX = 0;
+    // Only set the cached value once for making concurrent reads possible
+    if (m_cachedDrawingX == VRV_UNSET) m_cachedDrawingX = 0;
     return m_drawingXRel;
 }
 
@@ -121,7 +123,7 @@ int System::GetDrawingY() const
 {
     if (m_drawingFacsY != VRV_UNSET) return m_drawingFacsY;
 
-    m_cachedDrawingY = 0;
+    if (m_cachedDrawingY == VRV_UNSET) m_cachedDrawingY = 0;
     return m_drawingYRel;
 }
 
@@ -190,8 +192,8 @@ bool System::SetCurrentFloatingPositioner(
     if (m_systemAligner.GetChildCount() == 1) return false;
     StaffAlignment *alignment = m_systemAligner.GetStaffAlignmentForStaffN(staffN);
     if (!alignment) {
-        LogError("Staff @n='%d' for rendering control event %s %s not found", staffN, object->GetClassName().c_str(),
-            object->GetID().c_str());
+        VRV_LOG_ERROR("Staff @n='%d' for rendering control event %s %s not found", staffN,
+            object->GetClassName().c_str(), object->GetID().c_str());
         return false;
     }
     alignment->SetCurrentFloatingPositioner(object, objectX, objectY, spanningType);
@@ -215,6 +217,35 @@ void System::ResetDrawingScoreDef()
     }
 }
 
+Measure *System::GetDrawingFirstMeasure()
+{
+    if (m_drawingMeasuresCached) return m_drawingFirstMeasure;
+
+    return vrv_cast<Measure *>(this->FindDescendantByType(MEASURE, 1, FORWARD));
+}
+
+Measure *System::GetDrawingLastMeasure()
+{
+    if (m_drawingMeasuresCached) return m_drawingLastMeasure;
+
+    return vrv_cast<Measure *>(this->FindDescendantByType(MEASURE, 1, BACKWARD));
+}
+
+void System::CacheDrawingMeasures()
+{
+    m_drawingMeasuresCached = false;
+    m_drawingFirstMeasure = this->GetDrawingFirstMeasure();
+    m_drawingLastMeasure = this->GetDrawingLastMeasure();
+    m_drawingMeasuresCached = true;
+}
+
+void System::ResetDrawingMeasures()
+{
+    m_drawingMeasuresCached = false;
+    m_drawingFirstMeasure = NULL;
+    m_drawingLastMeasure = NULL;
+}
+
 bool System::HasMixedDrawingStemDir(const LayerElement *start, const LayerElement *end) const
 {
     assert(start);
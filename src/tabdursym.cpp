@@ -61,7 +61,7 @@ bool TabDurSym::IsSupportedChild(Object *child)
 void TabDurSym::AddChild(Object *child)
 {
     if (!this->IsSupportedChild(child)) {
-        LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
+        VRV_LOG_ERROR("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
         return;
     }
 
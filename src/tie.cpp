@@ -150,7 +150,7 @@ bool Tie::CalculatePosition(const Doc *doc, const Staff *staff, int x1, int x2,
 
     if ((spanningType != SPANNING_START_END) && (spanningType != SPANNING_START) && (spanningType != SPANNING_END)) {
         //  this make no sense
-        LogDebug("Tie across an entire system is not supported");
+        VRV_LOG_DEBUG("Tie across an entire system is not supported");
         return false;
     }
 
@@ -10,10 +10,13 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------
 
-#include "jsonxx.h"
+#include "jsonstream.h"
 #include "measure.h"
 #include "note.h"
 #include "rest.h"
@@ -40,58 +43,136 @@ void Timemap::Reset()
 void Timemap::ToJson(std::string &output, bool includeRests, bool includeMeasures)
 {
     double currentTempo = -1000.0;
-    double newTempo;
-
-    jsonxx::Array timemap;
 
+    // The keys of each entry are written in alphabetical order
+    JsonWriter writer(output);
+    writer.StartArray();
     for (auto &[tstamp, entry] : m_map) {
-        jsonxx::Object o;
-        o << "tstamp" << tstamp;
-        o << "qstamp" << entry.qstamp;
+        writer.StartObject();
 
-        // on / off
-        if (!entry.notesOn.empty()) {
-            jsonxx::Array notesOn;
-            for (auto note : entry.notesOn) notesOn << note;
-            o << "on" << notesOn;
+        // measureOn
+        if (includeMeasures && !entry.measureOn.empty()) {
+            writer.Key("measureOn");
+            writer.String(entry.measureOn);
         }
+
+        // on / off
         if (!entry.notesOff.empty()) {
-            jsonxx::Array notesOff;
-            for (auto note : entry.notesOff) notesOff << note;
-            o << "off" << notesOff;
+            writer.Key("off");
+            writer.StringArray(entry.notesOff);
         }
+        if (!entry.notesOn.empty()) {
+            writer.Key("on");
+            writer.StringArray(entry.notesOn);
+        }
+
+        writer.Key("qstamp");
+        writer.Number(entry.qstamp);
 
         // restsOn / restsOff
         if (includeRests) {
-            if (!entry.restsOn.empty()) {
-                jsonxx::Array restsOn;
-                for (auto rest : entry.restsOn) restsOn << rest;
-                o << "restsOn" << restsOn;
-            }
             if (!entry.restsOff.empty()) {
-                jsonxx::Array restsOff;
-                for (auto rest : entry.restsOff) restsOff << rest;
-                o << "restsOff" << restsOff;
+                writer.Key("restsOff");
+                writer.StringArray(entry.restsOff);
+            }
+            if (!entry.restsOn.empty()) {
+                writer.Key("restsOn");
+                writer.StringArray(entry.restsOn);
             }
         }
 
         // tempo
-        if (entry.tempo != -1000.0) {
-            newTempo = entry.tempo;
-            if (newTempo != currentTempo) {
-                currentTempo = newTempo;
-                o << "tempo" << std::to_string(currentTempo);
+        if ((entry.tempo != -1000.0) && (entry.tempo != currentTempo)) {
+            currentTempo = entry.tempo;
+            writer.Key("tempo");
+            writer.String(std::to_string(currentTempo));
+        }
+
+        writer.Key("tstamp");
+        writer.Number(tstamp);
+
+        writer.EndObject();
+    }
+    writer.EndArray();
+}
+
+void Timemap::ToBinary(std::string &output, bool includeRests, bool includeMeasures)
+{
+    const uint32_t entryCount = (uint32_t)m_map.size();
+
+    std::vector<double> tstamps;
+    std::vector<double> qstamps;
+    std::vector<double> tempos;
+    tstamps.reserve(entryCount);
+    qstamps.reserve(entryCount);
+    tempos.reserve(entryCount);
+
+    std::vector<uint32_t> lists = { 0 };
+    lists.reserve(5 * entryCount + 1);
+    std::vector<uint32_t> refs;
+
+    // The ID table, with each ID stored once
+    std::unordered_map<std::string, uint32_t> idIndexes;
+    std::vector<uint32_t> ids = { 0 };
+    std::string strings;
+
+    auto addList = [&](const std::vector<std::string> &list) {
+        for (const std::string &id : list) {
+            auto [iter, inserted] = idIndexes.try_emplace(id, (uint32_t)idIndexes.size());
+            if (inserted) {
+                strings += id;
+                ids.push_back((uint32_t)strings.size());
             }
+            refs.push_back(iter->second);
         }
+        lists.push_back((uint32_t)refs.size());
+    };
 
-        // measureOn
+    const std::vector<std::string> none;
+    double currentTempo = 0.0;
+    for (auto &[tstamp, entry] : m_map) {
+        if (entry.tempo != -1000.0) currentTempo = entry.tempo;
+        tstamps.push_back(tstamp);
+        qstamps.push_back(entry.qstamp);
+        tempos.push_back(currentTempo);
+
+        addList(entry.notesOn);
+        addList(entry.notesOff);
+        addList(includeRests ? entry.restsOn : none);
+        addList(includeRests ? entry.restsOff : none);
         if (includeMeasures && !entry.measureOn.empty()) {
-            o << "measureOn" << entry.measureOn;
+            addList({ entry.measureOn });
+        }
+        else {
+            addList(none);
         }
-
-        timemap << o;
     }
-    output = timemap.json();
+
+    // The magic number is "VRVT" as little-endian bytes
+    const uint32_t header[8] = { 0x54565256, 1, entryCount, (uint32_t)idIndexes.size(), (uint32_t)refs.size(),
+        (uint32_t)strings.size(), (uint32_t)((includeRests ? 1 : 0) | (includeMeasures ? 2 : 0)), 0 };
+
+    output.clear();
+    output.reserve(sizeof(header) + 3 * entryCount * sizeof(double)
+        + (lists.size() + refs.size() + ids.size()) * sizeof(uint32_t) + strings.size());
+
+    auto writeUInt32 = [&output](uint32_t value) {
+        for (int i = 0; i < 4; ++i) output.push_back((char)((value >> (8 * i)) & 0xFF));
+    };
+    auto writeDouble = [&output](double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 8; ++i) output.push_back((char)((bits >> (8 * i)) & 0xFF));
+    };
+
+    for (uint32_t value : header) writeUInt32(value);
+    for (double value : tstamps) writeDouble(value);
+    for (double value : qstamps) writeDouble(value);
+    for (double value : tempos) writeDouble(value);
+    for (uint32_t value : lists) writeUInt32(value);
+    for (uint32_t value : refs) writeUInt32(value);
+    for (uint32_t value : ids) writeUInt32(value);
+    output += strings;
 }
 
 } // namespace vrv
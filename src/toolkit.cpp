@@ -10,8 +10,12 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
 #include <locale>
 #include <regex>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
@@ -20,6 +24,7 @@
 #include "editortoolkit_cmn.h"
 #include "editortoolkit_mensural.h"
 #include "editortoolkit_neume.h"
+#include "featureextractor.h"
 #include "filereader.h"
 #include "findfunctor.h"
 #include "ioabc.h"
@@ -29,6 +34,7 @@
 #include "iomusxml.h"
 #include "iopae.h"
 #include "iovolpiano.h"
+#include "jsonstream.h"
 #include "layer.h"
 #include "measure.h"
 #include "nc.h"
@@ -59,7 +65,7 @@ const char *ZIP_SIGNATURE = "\x50\x4B\x03\x04";
 // Toolkit
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
+std::mutex Toolkit::s_cerrMutex;
 
 Toolkit::Toolkit(bool initFont)
 {
@@ -70,6 +76,7 @@ Toolkit::Toolkit(bool initFont)
     m_cString = NULL;
 
     m_cerrOriginalBuf = NULL;
+    m_redirectCerr = true;
 
     if (initFont) {
         Resources &resources = m_doc.GetResourcesForModification();
@@ -80,6 +87,11 @@ Toolkit::Toolkit(bool initFont)
 
     m_editorToolkit = NULL;
 
+    m_svgGlyphSheet = new SvgGlyphSheet();
+
+    m_logSink = std::make_shared<LogSink>();
+    SetLogSink(m_logSink);
+
 #ifndef NO_RUNTIME
     m_runtimeClock = NULL;
 #endif
@@ -101,6 +113,13 @@ Toolkit::~Toolkit()
         delete m_editorToolkit;
         m_editorToolkit = NULL;
     }
+    if (m_svgGlyphSheet) {
+        delete m_svgGlyphSheet;
+        m_svgGlyphSheet = NULL;
+    }
+    for (OptionProfile *profile : m_optionProfiles) {
+        delete profile;
+    }
 #ifndef NO_RUNTIME
     if (m_runtimeClock) {
         delete m_runtimeClock;
@@ -118,6 +137,8 @@ bool Toolkit::SetResourcePath(const std::string &path)
 {
     Resources &resources = m_doc.GetResourcesForModification();
     resources.SetPath(path);
+    // The glyphs in the sheet will not be valid anymore
+    m_svgGlyphSheet->Reset();
     bool success = resources.InitFonts();
     if (m_options->m_fontAddCustom.IsSet()) {
         success = success && resources.AddCustom(m_options->m_fontAddCustom.GetValue());
@@ -138,7 +159,7 @@ bool Toolkit::SetFont(const std::string &fontName)
 {
     Resources &resources = m_doc.GetResourcesForModification();
     const bool ok = resources.SetCurrentFont(fontName, true);
-    if (!ok) LogWarning("Font '%s' could not be loaded", fontName.c_str());
+    if (!ok) VRV_LOG_WARNING("Font '%s' could not be loaded", fontName.c_str());
     return ok;
 }
 
@@ -184,8 +205,11 @@ bool Toolkit::SetOutputTo(std::string const &outputTo)
     else if (outputTo == "pae") {
         m_outputTo = PAE;
     }
-    else if (outputTo != "svg") {
-        LogError("Output format '%s' is not supported", outputTo.c_str());
+    else if (outputTo == "svg") {
+        m_outputTo = UNKNOWN;
+    }
+    else {
+        VRV_LOG_ERROR("Output format '%s' is not supported", outputTo.c_str());
         return false;
     }
     return true;
@@ -236,7 +260,7 @@ bool Toolkit::SetInputFrom(std::string const &inputFrom)
         m_inputFrom = AUTO;
     }
     else {
-        LogError("Input format '%s' is not supported", inputFrom.c_str());
+        VRV_LOG_ERROR("Input format '%s' is not supported", inputFrom.c_str());
         return false;
     }
     return true;
@@ -295,7 +319,7 @@ FileFormat Toolkit::IdentifyInputFrom(const std::string &data)
         if (std::regex_search(initial, std::regex("<(!DOCTYPE )?(score-partwise|opus|score-timewise)[\\s\\n>]"))) {
             return musicxmlDefault;
         }
-        LogWarning("Warning: Trying to load unknown XML data which cannot be identified.");
+        VRV_LOG_WARNING("Warning: Trying to load unknown XML data which cannot be identified.");
         return UNKNOWN;
     }
     if (initial.find("\n!!") != std::string::npos) {
@@ -320,14 +344,8 @@ bool Toolkit::LoadFile(const std::string &filename)
 {
     this->ResetLogBuffer();
 
-    if (this->IsUTF16(filename)) {
-        return this->LoadUTF16File(filename);
-    }
-    if (this->IsZip(filename)) {
-        return this->LoadZipFile(filename);
-    }
-
-    std::ifstream in(filename.c_str());
+    // Read the file only once - the content is then checked for UTF-16 or zip
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
     if (!in.is_open()) {
         return false;
     }
@@ -336,56 +354,62 @@ bool Toolkit::LoadFile(const std::string &filename)
     std::streamsize fileSize = (std::streamsize)in.tellg();
     in.clear();
     in.seekg(0, std::ios::beg);
+    if (fileSize < 0) {
+        return false;
+    }
 
     // read the file into the std::string:
     std::string content(fileSize, 0);
     in.read(&content[0], fileSize);
+    in.close();
 
-    return this->LoadData(content, false);
-}
-
-bool Toolkit::IsUTF16(const std::string &filename)
-{
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
+    if (this->IsUTF16(content)) {
+        return this->LoadUTF16Data(content);
+    }
+    if (this->IsZip(content)) {
+        std::vector<unsigned char> bytes(content.begin(), content.end());
+        content.clear();
+        content.shrink_to_fit();
+        return this->LoadZipData(bytes);
     }
 
-    char data[2];
-    memset(data, 0, 2);
-    fin.read(data, 2);
-    fin.close();
-
-    if (memcmp(data, UTF_16_LE_BOM, 2) == 0) return true;
-    if (memcmp(data, UTF_16_BE_BOM, 2) == 0) return true;
+#ifdef _WIN32
+    // The file is read in binary mode, so normalize the line endings as reading it in text mode does
+    size_t length = 0;
+    for (size_t i = 0; i < content.size(); ++i) {
+        if ((content[i] == '\r') && (i + 1 < content.size()) && (content[i + 1] == '\n')) continue;
+        content[length++] = content[i];
+    }
+    content.resize(length);
+#endif
 
-    return false;
+    // The content is not used anymore and can be imported in place
+    return this->LoadData(content, false, &content);
 }
 
-bool Toolkit::LoadUTF16File(const std::string &filename)
+bool Toolkit::IsUTF16(const std::string &content)
 {
-    /// Loading a UTF-16 file with basic conversion ot UTF-8
-    /// This is called after checking if the file has a UTF-16 BOM
+    if (content.size() < 2) return false;
 
-    LogWarning("The file seems to be UTF-16 - trying to convert to UTF-8");
+    if (memcmp(content.data(), UTF_16_LE_BOM, 2) == 0) return true;
+    if (memcmp(content.data(), UTF_16_BE_BOM, 2) == 0) return true;
 
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
+    return false;
+}
 
-    fin.seekg(0, std::ios::end);
-    std::streamsize wfileSize = (std::streamsize)fin.tellg();
-    fin.clear();
+bool Toolkit::LoadUTF16Data(const std::string &content)
+{
+    /// Loading UTF-16 content with basic conversion ot UTF-8
+    /// This is called after checking if the content has a UTF-16 BOM
 
-    fin.seekg(0, std::wios::beg);
+    VRV_LOG_WARNING("The file seems to be UTF-16 - trying to convert to UTF-8");
 
-    std::u16string u16data((wfileSize / 2) + 1, '\0');
-    fin.read((char *)&u16data[0], wfileSize);
+    std::u16string u16data((content.size() / 2) + 1, '\0');
+    memcpy(&u16data[0], content.data(), content.size());
 
     // order of the bytes has to be flipped
     if (u16data.at(0) == u'\uFFFE') {
-        LogWarning("The file seems to have been loaded as little endian - trying to convert to big endian");
+        VRV_LOG_WARNING("The file seems to have been loaded as little endian - trying to convert to big endian");
         // convert to big endian (swap bytes)
         std::transform(std::begin(u16data), std::end(u16data), std::begin(u16data), [](char16_t c) {
             auto p = reinterpret_cast<char *>(&c);
@@ -402,7 +426,7 @@ bool Toolkit::LoadUTF16File(const std::string &filename)
     // std::wstring_convert<std::codecvt_utf8<char16_t>, char16_t> convert;
     std::string utf8line = vrv::UTF16to8(u16data); // convert.to_bytes(u16data);
 
-    return this->LoadData(utf8line, false);
+    return this->LoadData(utf8line, false, &utf8line);
 }
 
 std::string UTF16toUTF8(const std::u16string &input)
@@ -421,46 +445,15 @@ std::string UTF16toUTF8(const std::u16string &input)
     return output;
 }
 
-bool Toolkit::IsZip(const std::string &filename)
+bool Toolkit::IsZip(const std::string &content)
 {
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
-
-    char data[4];
-    memset(data, 0, 4);
-    fin.read(data, 4);
-    fin.close();
+    if (content.size() < 4) return false;
 
-    if (memcmp(data, ZIP_SIGNATURE, 4) == 0) return true;
+    if (memcmp(content.data(), ZIP_SIGNATURE, 4) == 0) return true;
 
     return false;
 }
 
-bool Toolkit::LoadZipFile(const std::string &filename)
-{
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
-
-    fin.seekg(0, std::ios::end);
-    std::streamsize fileSize = (std::streamsize)fin.tellg();
-    fin.clear();
-    fin.seekg(0, std::wios::beg);
-
-    std::vector<unsigned char> bytes;
-    bytes.reserve(fileSize + 1);
-
-    unsigned char buffer;
-    while (fin.read((char *)&buffer, sizeof(unsigned char))) {
-        bytes.push_back(buffer);
-    }
-
-    return this->LoadZipData(bytes);
-}
-
 bool Toolkit::LoadZipData(const std::vector<unsigned char> &bytes)
 {
     this->ResetLogBuffer();
@@ -470,7 +463,7 @@ bool Toolkit::LoadZipData(const std::vector<unsigned char> &bytes)
 
     const std::string metaInf = "META-INF/container.xml";
     if (!zipFileReader.HasFile(metaInf)) {
-        LogError("No '%s' file to load found in the archive", metaInf.c_str());
+        VRV_LOG_ERROR("No '%s' file to load found in the archive", metaInf.c_str());
         return false;
     }
     std::string containerXml = zipFileReader.ReadTextFile("META-INF/container.xml");
@@ -481,15 +474,16 @@ bool Toolkit::LoadZipData(const std::vector<unsigned char> &bytes)
     std::string filename = rootfile.attribute("full-path").value();
 
     if (!filename.empty()) {
-        LogInfo("Loading file '%s' in the archive", filename.c_str());
-        return this->LoadData(zipFileReader.ReadTextFile(filename), false);
+        VRV_LOG_INFO("Loading file '%s' in the archive", filename.c_str());
+        std::string content = zipFileReader.ReadTextFile(filename);
+        return this->LoadData(content, false, &content);
     }
     else {
-        LogError("No file to load found in the archive");
+        VRV_LOG_ERROR("No file to load found in the archive");
         return false;
     }
 #else
-    LogError("MXL import is not supported in this build.");
+    VRV_LOG_ERROR("MXL import is not supported in this build.");
     return false;
 #endif
 }
@@ -513,6 +507,13 @@ bool Toolkit::LoadData(const std::string &data)
 
 bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
 {
+    return this->LoadData(data, resetLogBuffer, NULL);
+}
+
+bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer, std::string *inplaceData)
+{
+    assert(!inplaceData || (inplaceData == &data));
+
     std::string newData;
     Input *input = NULL;
 
@@ -522,6 +523,9 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
 
     m_doc.m_expansionMap.Reset();
 
+    // The sheet only holds the glyphs of the pages of the document loaded
+    m_svgGlyphSheet->Reset();
+
     if (m_options->m_xmlIdChecksum.GetValue()) {
         crcInit();
         unsigned int cr = crcFast((unsigned char *)data.c_str(), (int)data.size());
@@ -540,7 +544,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
 #ifndef NO_ABC_SUPPORT
         input = new ABCInput(&m_doc);
 #else
-        LogError("ABC import is not supported in this build.");
+        VRV_LOG_ERROR("ABC import is not supported in this build.");
         return false;
 #endif
     }
@@ -548,7 +552,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
 #ifndef NO_PAE_SUPPORT
         input = new PAEInput(&m_doc);
 #else
-        LogError("Plaine & Easie import is not supported in this build.");
+        VRV_LOG_ERROR("Plaine & Easie import is not supported in this build.");
         return false;
 #endif
     }
@@ -556,7 +560,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
 #ifndef NO_DARMS_SUPPORT
         input = new DarmsInput(&m_doc);
 #else
-        LogError("DARMS import is not supported in this build.");
+        VRV_LOG_ERROR("DARMS import is not supported in this build.");
         return false;
 #endif
     }
@@ -574,7 +578,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         }
 
         if (!input->Import(data)) {
-            LogError("Error importing Humdrum data (1)");
+            VRV_LOG_ERROR("Error importing Humdrum data (1)");
             delete input;
             return false;
         }
@@ -601,7 +605,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         }
 
         if (!tempinput->Import(data)) {
-            LogError("Error importing Humdrum data (1)");
+            VRV_LOG_ERROR("Error importing Humdrum data (1)");
             delete tempinput;
             return false;
         }
@@ -643,11 +647,11 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         bool status = converter.convert(conversion, xmlfile);
         LogRedirectStop();
         if (!status) {
-            LogWarning("Problem converting MusicXML to Humdrum (see warning above this line for possible reasons");
+            VRV_LOG_WARNING("Problem converting MusicXML to Humdrum (see warning above this line for possible reasons");
         }
 
         if (!status) {
-            LogError("Error converting MusicXML data");
+            VRV_LOG_ERROR("Error converting MusicXML data");
             return false;
         }
         std::string buffer = conversion.str();
@@ -658,7 +662,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         tempdoc.SetOptions(m_doc.GetOptions());
         Input *tempinput = new HumdrumInput(&tempdoc);
         if (!tempinput->Import(conversion.str())) {
-            LogError("Error importing Humdrum data (2)");
+            VRV_LOG_ERROR("Error importing Humdrum data (2)");
             delete tempinput;
             return false;
         }
@@ -678,7 +682,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         tempdoc.SetOptions(m_doc.GetOptions());
         Input *tempinput = new HumdrumInput(&tempdoc);
         if (!tempinput->Import(conversion)) {
-            LogError("Error importing Humdrum data (3)");
+            VRV_LOG_ERROR("Error importing Humdrum data (3)");
             delete tempinput;
             return false;
         }
@@ -698,11 +702,11 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         bool status = converter.convertString(conversion, data);
         LogRedirectStop();
         if (!status) {
-            LogWarning("Problem converting MuseData to Humdrum (see warning above this line for possible reasons");
+            VRV_LOG_WARNING("Problem converting MuseData to Humdrum (see warning above this line for possible reasons");
         }
 
         if (!status) {
-            LogError("Error converting MuseData data");
+            VRV_LOG_ERROR("Error converting MuseData data");
             return false;
         }
         std::string buffer = conversion.str();
@@ -713,7 +717,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         tempdoc.SetOptions(m_doc.GetOptions());
         Input *tempinput = new HumdrumInput(&tempdoc);
         if (!tempinput->Import(conversion.str())) {
-            LogError("Error importing Humdrum data (4)");
+            VRV_LOG_ERROR("Error importing Humdrum data (4)");
             delete tempinput;
             return false;
         }
@@ -733,11 +737,11 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         bool status = converter.convert(conversion, data);
         LogRedirectStop();
         if (!status) {
-            LogWarning("Problem converting EsAC to Humdrum (see warning above this line for possible reasons");
+            VRV_LOG_WARNING("Problem converting EsAC to Humdrum (see warning above this line for possible reasons");
         }
 
         if (!status) {
-            LogError("Error converting EsAC data");
+            VRV_LOG_ERROR("Error converting EsAC data");
             return false;
         }
         std::string buffer = conversion.str();
@@ -748,7 +752,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         tempdoc.SetOptions(m_doc.GetOptions());
         Input *tempinput = new HumdrumInput(&tempdoc);
         if (!tempinput->Import(conversion.str())) {
-            LogError("Error importing Humdrum data (5)");
+            VRV_LOG_ERROR("Error importing Humdrum data (5)");
             delete tempinput;
             return false;
         }
@@ -760,20 +764,28 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
     }
 #endif
     else {
-        LogInfo("Unsupported format");
+        VRV_LOG_INFO("Unsupported format");
         return false;
     }
 
     // something went wrong
     if (!input) {
-        LogError("Unknown error");
+        VRV_LOG_ERROR("Unknown error");
         return false;
     }
 
     // load the file
     if (inputFormat != HUMDRUM) {
-        if (!input->Import(newData.size() ? newData : data)) {
-            LogError("Error importing data");
+        // Converted data is local and can always be imported in place
+        bool success = false;
+        if (!newData.empty()) {
+            success = input->ImportInplace(newData);
+        }
+        else {
+            success = (inplaceData) ? input->ImportInplace(*inplaceData) : input->Import(data);
+        }
+        if (!success) {
+            VRV_LOG_ERROR("Error importing data");
             delete input;
             return false;
         }
@@ -819,7 +831,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
     // In this case, we do not cast-off the document (breaks is expected to be not set)
     if (input->GetLayoutInformation() == LAYOUT_DONE) {
         if (breaks != BREAKS_auto) {
-            LogWarning("Requesting layout with specific breaks but the layout is already done");
+            VRV_LOG_WARNING("Requesting layout with specific breaks but the layout is already done");
         }
         // We set it to 'none' for no cast-off process to be triggered
         breaks = BREAKS_none;
@@ -851,13 +863,13 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         }
         else {
             if (breaks == BREAKS_encoded) {
-                LogWarning("Requesting layout with encoded breaks but nothing provided in the data");
+                VRV_LOG_WARNING("Requesting layout with encoded breaks but nothing provided in the data");
             }
             else if (breaks == BREAKS_line) {
-                LogWarning("Requesting layout with line breaks but nothing provided in the data");
+                VRV_LOG_WARNING("Requesting layout with line breaks but nothing provided in the data");
             }
             else if (breaks == BREAKS_smart) {
-                LogWarning("Requesting layout with smart breaks but nothing provided in the data");
+                VRV_LOG_WARNING("Requesting layout with smart breaks but nothing provided in the data");
             }
             // LogElapsedTimeStart();
             m_doc.CastOffDoc();
@@ -891,6 +903,13 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
 }
 
 std::string Toolkit::GetMEI(const std::string &jsonOptions)
+{
+    std::string output;
+    this->WriteMEI(jsonOptions, NULL, output);
+    return output;
+}
+
+bool Toolkit::WriteMEI(const std::string &jsonOptions, std::ostream *stream, std::string &output)
 {
     bool scoreBased = true;
     bool basic = false;
@@ -903,43 +922,43 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
     std::string mdiv;
     bool generateFacs = false;
 
-    jsonxx::Object json;
+    JsonReader json;
 
     // Read JSON options if not empty
     if (!jsonOptions.empty()) {
-        if (!json.parse(jsonOptions)) {
-            LogWarning("Cannot parse JSON std::string. Using default options.");
+        if (!json.Parse(jsonOptions)) {
+            VRV_LOG_WARNING("Cannot parse JSON std::string. Using default options.");
         }
         else {
-            if (json.has<jsonxx::Boolean>("scoreBased")) scoreBased = json.get<jsonxx::Boolean>("scoreBased");
-            if (json.has<jsonxx::Boolean>("basic")) basic = json.get<jsonxx::Boolean>("basic");
-            if (json.has<jsonxx::Boolean>("ignoreHeader")) ignoreHeader = json.get<jsonxx::Boolean>("ignoreHeader");
-            if (json.has<jsonxx::Boolean>("removeIds")) removeIds = json.get<jsonxx::Boolean>("removeIds");
-            if (json.has<jsonxx::Number>("firstPage")) firstPage = json.get<jsonxx::Number>("firstPage");
-            if (json.has<jsonxx::Number>("lastPage")) lastPage = json.get<jsonxx::Number>("lastPage");
-            if (json.has<jsonxx::Number>("pageNo")) {
-                firstPage = json.get<jsonxx::Number>("pageNo");
-                lastPage = firstPage;
-            }
-            if (json.has<jsonxx::String>("firstMeasure")) firstMeasure = json.get<jsonxx::String>("firstMeasure");
-            if (json.has<jsonxx::String>("lastMeasure")) lastMeasure = json.get<jsonxx::String>("lastMeasure");
-            if (json.has<jsonxx::String>("mdiv")) mdiv = json.get<jsonxx::String>("mdiv");
-            if (json.has<jsonxx::Boolean>("generateFacs")) generateFacs = json.get<jsonxx::Boolean>("generateFacs");
+            json.Get(0, "scoreBased", scoreBased);
+            json.Get(0, "basic", basic);
+            json.Get(0, "ignoreHeader", ignoreHeader);
+            json.Get(0, "removeIds", removeIds);
+            json.Get(0, "firstPage", firstPage);
+            json.Get(0, "lastPage", lastPage);
+            if (json.Get(0, "pageNo", firstPage)) lastPage = firstPage;
+            json.Get(0, "firstMeasure", firstMeasure);
+            json.Get(0, "lastMeasure", lastMeasure);
+            json.Get(0, "mdiv", mdiv);
+            json.Get(0, "generateFacs", generateFacs);
         }
     }
 
     if (this->GetPageCount() == 0) {
-        LogWarning("No data loaded");
-        return "";
+        VRV_LOG_WARNING("No data loaded");
+        return false;
     }
 
+    // Page-based output requires the document to be fully cast off
+    m_doc.CastOffPendingPages();
+
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
 
     bool hadSelection = false;
     if (m_doc.HasSelection()) {
         if (!scoreBased) {
-            LogError("Page-based MEI output is not possible when a selection is set.");
-            return "";
+            VRV_LOG_ERROR("Page-based MEI output is not possible when a selection is set.");
+            return false;
         }
         hadSelection = true;
         m_doc.DeactiveateSelection();
@@ -963,19 +982,27 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
     if (generateFacs) {
         if (meioutput.HasFilter() || !scoreBased || (m_options->m_breaks.GetValue() != BREAKS_encoded)
             || m_doc.HasSelection()) {
-            LogError("Generating facsimile is only possible with all pages, encoded breaks, score-based output and "
-                     "without selection.");
-            return "";
+            VRV_LOG_ERROR(
+                "Generating facsimile is only possible with all pages, encoded breaks, score-based output and "
+                "without selection.");
+            return false;
         }
         m_doc.SyncToFacsimileDoc();
     }
 
-    std::string output = meioutput.GetOutput();
+    bool success = true;
+    if (stream) {
+        success = meioutput.Export(*stream);
+    }
+    else {
+        output = meioutput.GetOutput();
+        success = !output.empty();
+    }
 
     if (hadSelection) m_doc.ReactivateSelection(false);
 
     if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
-    return output;
+    return success;
 }
 
 std::string Toolkit::ValidatePAEFile(const std::string &filename)
@@ -998,22 +1025,31 @@ std::string Toolkit::ValidatePAE(const std::string &data)
 
 bool Toolkit::SaveFile(const std::string &filename, const std::string &jsonOptions)
 {
-    std::string output = this->GetMEI(jsonOptions);
-    if (output.empty()) {
-        return false;
-    }
+    // Write to a temporary file in the same directory and replace the file only once it is complete
+    std::filesystem::path tmpPath(filename);
+    tmpPath += ".tmp";
 
     std::ofstream outfile;
-    outfile.open(filename.c_str());
+    outfile.open(tmpPath);
 
     if (!outfile.is_open()) {
-        LogError("Unable to write MEI to %s", filename.c_str());
+        VRV_LOG_ERROR("Unable to write MEI to %s", filename.c_str());
         return false;
     }
 
-    outfile << output;
+    // Serialize the MEI directly to the file
+    std::string output;
+    bool success = this->WriteMEI(jsonOptions, &outfile, output);
     outfile.close();
-    return true;
+
+    std::error_code error;
+    if (success && !outfile.fail()) {
+        std::filesystem::rename(tmpPath, filename, error);
+        if (!error) return true;
+        VRV_LOG_ERROR("Unable to write MEI to %s: %s", filename.c_str(), error.message().c_str());
+    }
+    std::filesystem::remove(tmpPath, error);
+    return false;
 }
 
 std::string Toolkit::GetOptions() const
@@ -1122,106 +1158,256 @@ std::string Toolkit::GetAvailableOptions() const
 
 bool Toolkit::SetOptions(const std::string &jsonOptions)
 {
-    jsonxx::Object json;
+    JsonReader json;
 
     // Read JSON options
-    if (!json.parse(jsonOptions)) {
-        LogError("Cannot parse JSON std::string.");
+    if (!json.Parse(jsonOptions)) {
+        VRV_LOG_ERROR("Cannot parse JSON std::string.");
         return false;
     }
 
-    std::map<std::string, jsonxx::Value *> jsonMap = json.kv_map();
-    std::map<std::string, jsonxx::Value *>::const_iterator iter;
-    for (iter = jsonMap.begin(); iter != jsonMap.end(); ++iter) {
-        if (m_options->GetItems()->count(iter->first) == 0) {
+    // Options are set by key order, the last one being kept with duplicated keys
+    for (const auto &[key, value] : json.GetMembers(0)) {
+        if (m_options->GetItems()->count(key) == 0) {
             // Base options
-            if (iter->first == "inputFrom") {
-                if (json.has<jsonxx::String>("inputFrom")) {
-                    this->SetInputFrom(json.get<jsonxx::String>("inputFrom"));
+            if (key == "inputFrom") {
+                if (json.Is(value, JsonType::String)) {
+                    this->SetInputFrom(json.GetString(value));
                 }
             }
-            else if (iter->first == "outputTo") {
-                if (json.has<jsonxx::String>("outputTo")) {
-                    this->SetOutputTo(json.get<jsonxx::String>("outputTo"));
+            else if (key == "outputTo") {
+                if (json.Is(value, JsonType::String)) {
+                    this->SetOutputTo(json.GetString(value));
                 }
             }
-            else if (iter->first == "scale") {
-                if (json.has<jsonxx::Number>("scale")) {
-                    this->SetScale(json.get<jsonxx::Number>("scale"));
+            else if (key == "scale") {
+                if (json.Is(value, JsonType::Number)) {
+                    this->SetScale(json.GetNumber(value));
                 }
             }
-            else if (iter->first == "xmlIdSeed") {
-                if (json.has<jsonxx::Number>("xmlIdSeed")) {
-                    m_options->m_xmlIdSeed.SetValue(json.get<jsonxx::Number>("xmlIdSeed"));
+            else if (key == "xmlIdSeed") {
+                if (json.Is(value, JsonType::Number)) {
+                    m_options->m_xmlIdSeed.SetValue(json.GetNumber(value));
                     Object::SeedID(m_options->m_xmlIdSeed.GetValue());
                 }
             }
             else {
-                LogError("Unsupported option '%s'", iter->first.c_str());
+                VRV_LOG_ERROR("Unsupported option '%s'", key.c_str());
             }
             continue;
         }
 
         // Mapped options
 
-        Option *opt = m_options->GetItems()->at(iter->first);
+        Option *opt = m_options->GetItems()->at(key);
         assert(opt);
 
-        if (json.has<jsonxx::Number>(iter->first)) {
-            opt->SetValueDbl(json.get<jsonxx::Number>(iter->first));
-            // LogInfo("Double: %f", json.get<jsonxx::Number>(iter->first));
+        if (json.Is(value, JsonType::Null)) {
+            VRV_LOG_ERROR("Unsupported type for option '%s'", key.c_str());
+        }
+        else {
+            this->SetOptionValue(opt, json, value);
         }
-        else if (json.has<jsonxx::Boolean>(iter->first)) {
-            opt->SetValueBool(json.get<jsonxx::Boolean>(iter->first));
-            // LogInfo("Bool: %d", json.get<jsonxx::Boolean>(iter->first));
+    }
+
+    m_options->Sync();
+
+    this->SetLocale();
+
+    // Forcing font resource to be reset if the font is given in the options
+    if (json.Is(json.Find(0, "fontAddCustom"), JsonType::Array)) {
+        Resources &resources = m_doc.GetResourcesForModification();
+        resources.AddCustom(m_options->m_fontAddCustom.GetValue());
+    }
+    if (json.Is(json.Find(0, "font"), JsonType::String)) {
+        this->SetFont(m_options->m_font.GetValue());
+    }
+    if (json.Is(json.Find(0, "fontFallback"), JsonType::String)) {
+        Resources &resources = m_doc.GetResourcesForModification();
+        resources.SetFallback(m_options->m_fontFallback.GetStrValue());
+    }
+    if (json.Is(json.Find(0, "fontLoadAll"), JsonType::Bool)) {
+        Resources &resources = m_doc.GetResourcesForModification();
+        resources.LoadAll();
+    }
+
+    return true;
+}
+
+bool Toolkit::SetOptionValue(Option *option, const JsonReader &json, int value) const
+{
+    if (json.Is(value, JsonType::Number)) {
+        return option->SetValueDbl(json.GetNumber(value));
+    }
+    else if (json.Is(value, JsonType::Bool)) {
+        return option->SetValueBool(json.GetBool(value));
+    }
+    else if (json.Is(value, JsonType::String)) {
+        return option->SetValue(json.GetString(value));
+    }
+    else if (json.Is(value, JsonType::Array)) {
+        std::vector<std::string> strValues;
+        for (int item = json.GetFirst(value); item != -1; item = json.GetNext(value, item)) {
+            if (json.Is(item, JsonType::String)) strValues.push_back(json.GetString(item));
         }
-        else if (json.has<jsonxx::String>(iter->first)) {
-            opt->SetValue(json.get<jsonxx::String>(iter->first));
-            // LogInfo("String: %s", json.get<jsonxx::String>(iter->first).c_str());
+        return option->SetValueArray(strValues);
+    }
+    else if (json.Is(value, JsonType::Object)) {
+        const OptionJson *optJson = dynamic_cast<OptionJson *>(option);
+        if (optJson && (optJson->GetSource() == JsonSource::String)) {
+            return option->SetValue(std::string(json.GetText(value)));
         }
-        else if (json.has<jsonxx::Array>(iter->first)) {
-            jsonxx::Array values = json.get<jsonxx::Array>(iter->first);
-            std::vector<std::string> strValues;
-            for (int i = 0; i < (int)values.size(); ++i) {
-                if (values.has<jsonxx::String>(i)) strValues.push_back(values.get<jsonxx::String>(i));
-                // LogDebug("String: %s", values.get<jsonxx::String>(i).c_str());
+    }
+    return false;
+}
+
+int Toolkit::RegisterOptionProfile(const std::string &name, const std::string &jsonOptions)
+{
+    JsonReader json;
+
+    if (!json.Parse(jsonOptions)) {
+        VRV_LOG_ERROR("Cannot parse JSON std::string.");
+        return -1;
+    }
+
+    OptionProfile *profile = new OptionProfile(name);
+    Options *values = profile->GetValues();
+
+    // Validate all the values before registering the profile
+    bool valid = true;
+    for (const auto &[key, value] : json.GetMembers(0)) {
+        if ((key == "inputFrom") || (key == "outputTo")) {
+            const bool isInput = (key == "inputFrom");
+            const FileFormat previous = (isInput) ? m_inputFrom : m_outputTo;
+            std::string format;
+            if (json.Is(value, JsonType::String)) format = json.GetString(value);
+            valid = (isInput) ? this->SetInputFrom(format) : this->SetOutputTo(format);
+            if (isInput) {
+                m_inputFrom = previous;
+                profile->m_inputFrom = format;
             }
-            opt->SetValueArray(strValues);
-        }
-        else if (json.has<jsonxx::Object>(iter->first)) {
-            const OptionJson *optJson = dynamic_cast<OptionJson *>(opt);
-            if (optJson && (optJson->GetSource() == JsonSource::String)) {
-                const jsonxx::Object value = json.get<jsonxx::Object>(iter->first);
-                opt->SetValue(value.json());
+            else {
+                m_outputTo = previous;
+                profile->m_outputTo = format;
             }
         }
+        else if (key == "scale") {
+            valid = this->SetOptionValue(&values->m_scale, json, value);
+            profile->AddEntry(&values->m_scale, &m_options->m_scale);
+        }
+        else if (key == "xmlIdSeed") {
+            valid = this->SetOptionValue(&values->m_xmlIdSeed, json, value);
+            profile->AddEntry(&values->m_xmlIdSeed, &m_options->m_xmlIdSeed);
+        }
+        else if (values->GetItems()->count(key) == 1) {
+            valid = this->SetOptionValue(values->GetItems()->at(key), json, value);
+            profile->AddEntry(values->GetItems()->at(key), m_options->GetItems()->at(key));
+        }
         else {
-            LogError("Unsupported type for option '%s'", iter->first.c_str());
+            VRV_LOG_ERROR("Unsupported option '%s'", key.c_str());
+            valid = false;
+        }
+        if (!valid) {
+            VRV_LOG_ERROR("Option profile '%s' not registered because of the value of option '%s'", name.c_str(),
+                key.c_str());
+            delete profile;
+            return -1;
         }
     }
 
-    m_options->Sync();
+    // A profile with the same name is replaced
+    const int handle = this->GetOptionProfile(name);
+    if (handle != -1) {
+        delete m_optionProfiles.at(handle);
+        m_optionProfiles.at(handle) = profile;
+        return handle;
+    }
+    m_optionProfiles.push_back(profile);
+    return (int)m_optionProfiles.size() - 1;
+}
 
-    this->SetLocale();
+int Toolkit::GetOptionProfile(const std::string &name) const
+{
+    for (int i = 0; i < (int)m_optionProfiles.size(); ++i) {
+        if (m_optionProfiles.at(i)->GetName() == name) return i;
+    }
+    return -1;
+}
 
-    // Forcing font resource to be reset if the font is given in the options
-    if (json.has<jsonxx::Array>("fontAddCustom")) {
+std::string Toolkit::ActivateOptionProfile(int handle)
+{
+    if ((handle < 0) || (handle >= (int)m_optionProfiles.size())) {
+        VRV_LOG_ERROR("Option profile %d does not exist", handle);
+        return "{}";
+    }
+    const OptionProfile *profile = m_optionProfiles.at(handle);
+
+    std::vector<Option *> changed;
+    profile->Apply(changed);
+
+    auto isChanged
+        = [&changed](const Option *option) { return std::find(changed.begin(), changed.end(), option) != changed.end(); };
+
+    // Syncing the engraving defaults is expensive and needed only when they or the values they override changed
+    const bool sync = std::any_of(changed.begin(), changed.end(), [](const Option *option) {
+        return (dynamic_cast<const OptionJson *>(option) || dynamic_cast<const OptionDbl *>(option));
+    });
+    if (sync) m_options->Sync();
+    if (isChanged(&m_options->m_setLocale)) this->SetLocale();
+
+    if (isChanged(&m_options->m_xmlIdSeed)) {
+        Object::SeedID(m_options->m_xmlIdSeed.GetValue());
+    }
+    // Same order as in SetOptions, since the custom fonts have to be added before being selected
+    if (isChanged(&m_options->m_fontAddCustom)) {
         Resources &resources = m_doc.GetResourcesForModification();
         resources.AddCustom(m_options->m_fontAddCustom.GetValue());
     }
-    if (json.has<jsonxx::String>("font")) {
+    if (isChanged(&m_options->m_font)) {
         this->SetFont(m_options->m_font.GetValue());
     }
-    if (json.has<jsonxx::String>("fontFallback")) {
+    if (isChanged(&m_options->m_fontFallback)) {
         Resources &resources = m_doc.GetResourcesForModification();
         resources.SetFallback(m_options->m_fontFallback.GetStrValue());
     }
-    if (json.has<jsonxx::Boolean>("fontLoadAll")) {
+    if (isChanged(&m_options->m_fontLoadAll) && m_options->m_fontLoadAll.GetValue()) {
         Resources &resources = m_doc.GetResourcesForModification();
         resources.LoadAll();
     }
 
-    return true;
+    // The scale changes the layout only when it is applied to the page size
+    bool layout = false;
+    for (const Option *option : changed) {
+        if (!option->IsLayoutIndependent()) layout = true;
+        if ((option == &m_options->m_scale) && m_options->m_scaleToPageSize.GetValue()) layout = true;
+    }
+
+    std::vector<std::string> keys;
+    for (const Option *option : changed) {
+        keys.push_back(option->GetKey());
+    }
+    if (!profile->m_inputFrom.empty()) {
+        const FileFormat previous = m_inputFrom;
+        this->SetInputFrom(profile->m_inputFrom);
+        if (m_inputFrom != previous) keys.push_back("inputFrom");
+    }
+    if (!profile->m_outputTo.empty()) {
+        const FileFormat previous = m_outputTo;
+        this->SetOutputTo(profile->m_outputTo);
+        if (m_outputTo != previous) keys.push_back("outputTo");
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::string output;
+    JsonWriter writer(output);
+    writer.StartObject();
+    writer.Key("changed");
+    writer.StringArray(keys);
+    writer.Key("layout");
+    writer.Bool(layout);
+    writer.EndObject();
+
+    return output;
 }
 
 void Toolkit::ResetOptions()
@@ -1375,7 +1561,9 @@ std::string Toolkit::GetOptionUsageString() const
 
 std::string Toolkit::GetElementAttr(const std::string &xmlId)
 {
-    jsonxx::Object o;
+    std::string output;
+    JsonWriter writer(output);
+    writer.StartObject();
 
     const Object *element = NULL;
 
@@ -1421,21 +1609,28 @@ std::string Toolkit::GetElementAttr(const std::string &xmlId)
     }
     // If not found at all
     if (!element) {
-        LogWarning("Element '%s' not found", xmlId.c_str());
-        return o.json();
+        VRV_LOG_WARNING("Element '%s' not found", xmlId.c_str());
+        writer.EndObject();
+        return output;
     }
 
     // Fill the attribute array (pair of std::string) by looking at attributes for all available MEI modules
     ArrayOfStrAttr attributes;
     element->GetAttributes(&attributes);
 
-    // Fill the JSON object
+    // Fill the JSON object with the attributes sorted by name, the last one being kept with duplicated names
+    std::stable_sort(attributes.begin(), attributes.end(),
+        [](const std::pair<std::string, std::string> &a, const std::pair<std::string, std::string> &b) {
+            return a.first < b.first;
+        });
     ArrayOfStrAttr::iterator iter;
     for (iter = attributes.begin(); iter != attributes.end(); ++iter) {
-        o << (*iter).first << (*iter).second;
-        // LogInfo("Element %s - %s", (*iter).first.c_str(), (*iter).second.c_str());
+        if ((std::next(iter) != attributes.end()) && (std::next(iter)->first == iter->first)) continue;
+        writer.Key((*iter).first);
+        writer.String((*iter).second);
     }
-    return o.json();
+    writer.EndObject();
+    return output;
 }
 
 std::string Toolkit::GetNotatedIdForElement(const std::string &xmlId)
@@ -1450,23 +1645,28 @@ std::string Toolkit::GetNotatedIdForElement(const std::string &xmlId)
 
 std::string Toolkit::GetExpansionIdsForElement(const std::string &xmlId)
 {
-    jsonxx::Array a;
+    std::string output;
+    JsonWriter writer(output);
     if (m_doc.m_expansionMap.HasExpansionMap()) {
-        for (std::string id : m_doc.m_expansionMap.GetExpansionIDsForElement(xmlId)) {
-            a << id;
-        }
+        writer.StringArray(m_doc.m_expansionMap.GetExpansionIDsForElement(xmlId));
     }
     else {
-        a << "";
+        writer.StringArray({ "" });
     }
-    return a.json();
+    return output;
 }
 
 bool Toolkit::Edit(const std::string &editorAction)
 {
     this->ResetLogBuffer();
 
-    return m_editorToolkit->ParseEditorAction(editorAction);
+    m_doc.CastOffPendingPages();
+
+    const bool success = m_editorToolkit->ParseEditorAction(editorAction);
+    // The editor can change the coordinates of the zones directly
+    if (m_doc.HasFacsimile()) m_doc.GetFacsimile()->ResetCachedExtents();
+
+    return success;
 }
 
 std::string Toolkit::EditInfo()
@@ -1476,14 +1676,41 @@ std::string Toolkit::EditInfo()
 
 std::string Toolkit::GetLog()
 {
-    std::string str;
-    for (const std::string &logStr : logBuffer) {
-        str += logStr;
-    }
+    std::string str = m_logSink->GetString();
     this->ResetLogBuffer();
     return str;
 }
 
+std::string Toolkit::GetLogEntries()
+{
+    std::string output;
+    JsonWriter writer(output);
+    writer.StartObject();
+    writer.Key("dropped");
+    writer.Number(m_logSink->GetDropped());
+    writer.Key("entries");
+    writer.StartArray();
+    for (const LogEntry &entry : m_logSink->GetEntries()) {
+        writer.StartObject();
+        writer.Key("code");
+        writer.Number(entry.m_code);
+        if (!entry.m_id.empty()) {
+            writer.Key("id");
+            writer.String(entry.m_id);
+        }
+        writer.Key("level");
+        writer.String(LogLevelToStr(entry.m_level));
+        writer.Key("message");
+        writer.String(entry.m_message);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    this->ResetLogBuffer();
+    return output;
+}
+
 std::string Toolkit::GetVersion() const
 {
     return vrv::GetVersion();
@@ -1497,35 +1724,40 @@ void Toolkit::ResetXmlIdSeed(int seed)
 
 void Toolkit::ResetLogBuffer()
 {
-    logBuffer.clear();
+    m_logSink->Clear();
+    SetLogSink(m_logSink);
 }
 
 void Toolkit::LogRedirectStart()
 {
+    if (!m_redirectCerr) return;
     if (m_cerrOriginalBuf) {
-        vrv::LogError("In Toolkit::LogRedirectStart: Only one log redirect can be active at a time.");
+        VRV_LOG_ERROR("In Toolkit::LogRedirectStart: Only one log redirect can be active at a time.");
         return;
     }
     if (!m_cerrCaptured.str().empty()) {
-        vrv::LogWarning("In Toolkit::LogRedirectStart: Log capture buffer not empty, sending current contents to "
+        VRV_LOG_WARNING("In Toolkit::LogRedirectStart: Log capture buffer not empty, sending current contents to "
                         "LogWarning and resetting.");
-        vrv::LogWarning(m_cerrCaptured.str().c_str());
+        VRV_LOG_WARNING("%s", m_cerrCaptured.str().c_str());
         m_cerrCaptured.str("");
     }
+    s_cerrMutex.lock();
     m_cerrOriginalBuf = std::cerr.rdbuf();
     std::cerr.rdbuf(m_cerrCaptured.rdbuf());
 }
 
 void Toolkit::LogRedirectStop()
 {
+    if (!m_redirectCerr) return;
     if (!m_cerrCaptured.str().empty()) {
-        vrv::LogWarning(m_cerrCaptured.str().c_str());
+        VRV_LOG_WARNING("%s", m_cerrCaptured.str().c_str());
         m_cerrCaptured.str("");
     }
 
     if (m_cerrOriginalBuf) {
         std::cerr.rdbuf(m_cerrOriginalBuf);
         m_cerrOriginalBuf = NULL;
+        s_cerrMutex.unlock();
     }
 }
 
@@ -1533,22 +1765,22 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
 {
     bool resetCache = true;
 
-    jsonxx::Object json;
+    JsonReader json;
 
     // Read JSON options if not empty
     if (!jsonOptions.empty()) {
-        if (!json.parse(jsonOptions)) {
-            LogWarning("Cannot parse JSON std::string. Using default options.");
+        if (!json.Parse(jsonOptions)) {
+            VRV_LOG_WARNING("Cannot parse JSON std::string. Using default options.");
         }
         else {
-            if (json.has<jsonxx::Boolean>("resetCache")) resetCache = json.get<jsonxx::Boolean>("resetCache");
+            json.Get(0, "resetCache", resetCache);
         }
     }
 
     this->ResetLogBuffer();
 
     if ((this->GetPageCount() == 0) || m_doc.IsTranscription() || m_doc.IsFacs()) {
-        LogWarning("No data to re-layout");
+        VRV_LOG_WARNING("No data to re-layout");
         return;
     }
 
@@ -1580,7 +1812,7 @@ void Toolkit::RedoPagePitchPosLayout()
     Page *page = m_doc.GetDrawingPage();
 
     if (!page) {
-        LogWarning("No page to re-layout");
+        VRV_LOG_WARNING("No page to re-layout");
         return;
     }
 
@@ -1589,8 +1821,11 @@ void Toolkit::RedoPagePitchPosLayout()
 
 bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
 {
+    // With progressive layout, make sure the page has been cast off
+    if (m_doc.HasPendingCastOff() && !m_doc.HasMeasureWindow()) m_doc.CastOffPendingPages(pageNo);
+
     if (pageNo > this->GetPageCount()) {
-        LogWarning("Page %d does not exist", pageNo);
+        VRV_LOG_WARNING("Page %d does not exist", pageNo);
         return false;
     }
 
@@ -1598,7 +1833,8 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
     pageNo--;
 
     // Get the current system for the SVG clipping size
-    m_view.SetPage(pageNo);
+    // The measure window page is already laid out and must not trigger the layout of the document
+    m_view.SetPage(pageNo, !m_doc.HasMeasureWindow());
 
     // Adjusting page width and height according to the options
     int width = m_options->m_pageWidth.GetUnfactoredValue();
@@ -1693,6 +1929,9 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
     svg.SetRemoveXlink(m_options->m_svgRemoveXlink.GetValue());
     svg.SetAdditionalAttributes(m_options->m_svgAdditionalAttribute.GetValue());
     svg.SetSmuflTextFont((option_SMUFLTEXTFONT)m_options->m_smuflTextFont.GetValue());
+    if (m_options->m_svgGlyphSheet.GetValue()) {
+        svg.SetGlyphSheet(m_svgGlyphSheet, m_options->m_svgGlyphSheetUrl.GetValue());
+    }
 
     // render the page
     this->RenderToDeviceContext(pageNo, &svg);
@@ -1702,6 +1941,25 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
     return out_str;
 }
 
+std::string Toolkit::RenderMeasureWindowToSVG(const std::string &startId, const std::string &endId, bool xmlDeclaration)
+{
+    this->ResetLogBuffer();
+
+    Page *windowPage = m_doc.InitMeasureWindow(startId, endId);
+    if (!windowPage) return "";
+
+    std::string output = this->RenderToSVG(windowPage->GetIdx() + 1, xmlDeclaration);
+    m_doc.ResetMeasureWindow();
+
+    return output;
+}
+
+std::string Toolkit::RenderToSVGGlyphSheet(bool xmlDeclaration)
+{
+    int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
+    return m_svgGlyphSheet->GetStringSVG(xmlDeclaration, indent, m_options->m_svgFormatRaw.GetValue());
+}
+
 bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
 {
     this->ResetLogBuffer();
@@ -1768,14 +2026,14 @@ std::string Toolkit::RenderToPAE()
     this->ResetLogBuffer();
 
     if (this->GetPageCount() == 0) {
-        LogWarning("No data loaded");
+        VRV_LOG_WARNING("No data loaded");
         return "";
     }
 
     std::string output;
     PAEOutput paeOutput(&m_doc);
     if (!paeOutput.Export(output)) {
-        LogError("Export to PAE failed");
+        VRV_LOG_ERROR("Export to PAE failed");
     }
     return output;
 }
@@ -1796,29 +2054,48 @@ bool Toolkit::RenderToPAEFile(const std::string &filename)
 }
 
 std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
+{
+    std::string output;
+    bool binary = false;
+    this->WriteTimemap(jsonOptions, output, binary);
+
+    // The binary timemap is returned as base64, as for MIDI
+    if (binary) {
+        return Base64Encode(reinterpret_cast<const unsigned char *>(output.c_str()), (unsigned int)output.length());
+    }
+    return output;
+}
+
+void Toolkit::WriteTimemap(const std::string &jsonOptions, std::string &output, bool &binary)
 {
     bool includeMeasures = false;
     bool includeRests = false;
 
-    jsonxx::Object json;
+    JsonReader json;
 
     // Read JSON options if not empty
     if (!jsonOptions.empty()) {
-        if (!json.parse(jsonOptions)) {
-            LogWarning("Cannot parse JSON std::string. Using default options.");
+        if (!json.Parse(jsonOptions)) {
+            VRV_LOG_WARNING("Cannot parse JSON std::string. Using default options.");
         }
         else {
-            if (json.has<jsonxx::Boolean>("includeMeasures"))
-                includeMeasures = json.get<jsonxx::Boolean>("includeMeasures");
-            if (json.has<jsonxx::Boolean>("includeRests")) includeRests = json.get<jsonxx::Boolean>("includeRests");
+            json.Get(0, "includeMeasures", includeMeasures);
+            json.Get(0, "includeRests", includeRests);
+            std::string format;
+            if (json.Get(0, "format", format)) {
+                if (format == "binary") {
+                    binary = true;
+                }
+                else if (format != "json") {
+                    VRV_LOG_WARNING("Unsupported timemap format '%s'. Using JSON.", format.c_str());
+                }
+            }
         }
     }
 
     this->ResetLogBuffer();
 
-    std::string output;
-    m_doc.ExportTimemap(output, includeRests, includeMeasures);
-    return output;
+    m_doc.ExportTimemap(output, includeRests, includeMeasures, binary);
 }
 
 std::string Toolkit::RenderToExpansionMap()
@@ -1834,10 +2111,12 @@ std::string Toolkit::GetElementsAtTime(int millisec)
 {
     this->ResetLogBuffer();
 
-    jsonxx::Object o;
-    jsonxx::Array noteArray;
-    jsonxx::Array chordArray;
-    jsonxx::Array restArray;
+    // The page number is only final once all pages have been cast off
+    m_doc.CastOffPendingPages();
+
+    std::string output;
+    JsonWriter writer(output);
+    writer.StartObject();
 
     // Here we need to check that the midi timemap is done
     if (!m_doc.HasTimemap()) {
@@ -1849,7 +2128,8 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     Measure *measure = dynamic_cast<Measure *>(m_doc.FindDescendantByComparison(&matchMeasureTime));
 
     if (!measure) {
-        return o.json();
+        writer.EndObject();
+        return output;
     }
 
     int repeat = measure->EnclosesTime(millisec);
@@ -1866,31 +2146,40 @@ std::string Toolkit::GetElementsAtTime(int millisec)
 
     measure->FindAllDescendantsByComparison(&notesOrRests, &matchTime);
 
-    // Fill the JSON object
+    std::vector<std::string> noteIds;
+    std::vector<std::string> restIds;
     for (Object *object : notesOrRests) {
         if (object->Is(NOTE)) {
-            noteArray << object->GetID();
+            noteIds.push_back(object->GetID());
             Note *note = vrv_cast<Note *>(object);
             assert(note);
             Chord *chord = note->IsChordTone();
             if (chord) chords.push_back(chord);
         }
         else if (object->Is(REST)) {
-            restArray << object->GetID();
+            restIds.push_back(object->GetID());
         }
     }
     chords.unique();
-    for (Object *object : chords) {
-        chordArray << object->GetID();
-    }
 
-    o << "notes" << noteArray;
-    o << "chords" << chordArray;
-    o << "rests" << restArray;
-    o << "page" << pageNo;
-    o << "measure" << measure->GetID();
+    // Fill the JSON object with the keys in alphabetical order
+    writer.Key("chords");
+    writer.StartArray();
+    for (Object *object : chords) {
+        writer.String(object->GetID());
+    }
+    writer.EndArray();
+    writer.Key("measure");
+    writer.String(measure->GetID());
+    writer.Key("notes");
+    writer.StringArray(noteIds);
+    writer.Key("page");
+    writer.Number(pageNo);
+    writer.Key("rests");
+    writer.StringArray(restIds);
+    writer.EndObject();
 
-    return o.json();
+    return output;
 }
 
 bool Toolkit::RenderToMIDIFile(const std::string &filename)
@@ -1908,9 +2197,11 @@ bool Toolkit::RenderToMIDIFile(const std::string &filename)
 
 bool Toolkit::RenderToTimemapFile(const std::string &filename, const std::string &jsonOptions)
 {
-    std::string outputString = this->RenderToTimemap(jsonOptions);
+    std::string outputString;
+    bool binary = false;
+    this->WriteTimemap(jsonOptions, outputString, binary);
 
-    std::ofstream output(filename.c_str());
+    std::ofstream output(filename.c_str(), binary ? std::ios::out | std::ios::binary : std::ios::out);
     if (!output.is_open()) {
         return false;
     }
@@ -1934,7 +2225,7 @@ bool Toolkit::RenderToExpansionMapFile(const std::string &filename)
 
 int Toolkit::GetPageCount()
 {
-    return m_doc.GetPageCount();
+    return m_doc.GetEstimatedPageCount();
 }
 
 std::string Toolkit::GetDescriptiveFeatures(const std::string &options)
@@ -1945,11 +2236,148 @@ std::string Toolkit::GetDescriptiveFeatures(const std::string &options)
     return output;
 }
 
+std::string Toolkit::ExtractCorpusFeatures(const std::string &jsonOptions)
+{
+    std::vector<std::string> inputs;
+    std::string outputFilename;
+    int threadCount = std::max(1, (int)std::thread::hardware_concurrency());
+    int ngramLength = 4;
+
+    JsonReader json;
+    if (!json.Parse(jsonOptions) || !json.Is(0, JsonType::Object)) {
+        VRV_LOG_ERROR("Cannot parse JSON std::string.");
+        return "{}";
+    }
+    const int inputsNode = json.Find(0, "inputs");
+    if (json.Is(inputsNode, JsonType::Array)) {
+        for (int node = json.GetFirst(inputsNode); node != -1; node = json.GetNext(inputsNode, node)) {
+            if (json.Is(node, JsonType::String)) inputs.push_back(json.GetString(node));
+        }
+    }
+    json.Get(0, "output", outputFilename);
+    json.Get(0, "threads", threadCount);
+    json.Get(0, "ngramLength", ngramLength);
+    threadCount = std::clamp(threadCount, 1, 64);
+    ngramLength = std::clamp(ngramLength, 1, 16);
+
+    this->ResetLogBuffer();
+
+    if (outputFilename.empty()) {
+        VRV_LOG_ERROR("No output file given for the corpus features.");
+        return "{}";
+    }
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // The pool of toolkits, with one toolkit for each thread - the layout is not needed for the features
+    threadCount = std::max(1, std::min(threadCount, (int)inputs.size()));
+    std::vector<std::unique_ptr<Toolkit>> toolkits;
+    std::vector<Toolkit *> available;
+    const std::string resourcePath = this->GetResourcePath();
+    for (int i = 0; i < threadCount; ++i) {
+        std::unique_ptr<Toolkit> toolkit = std::make_unique<Toolkit>(false);
+        if (!toolkit->SetResourcePath(resourcePath)) break;
+        *toolkit->m_options = *m_options;
+        toolkit->m_options->m_breaks.SetValue(BREAKS_none);
+        toolkit->m_inputFrom = m_inputFrom;
+        // The messages written to std::cerr by the converters go to stderr
+        toolkit->m_redirectCerr = false;
+        available.push_back(toolkit.get());
+        toolkits.push_back(std::move(toolkit));
+    }
+    // Creating a toolkit sets its sink for the thread
+    SetLogSink(m_logSink);
+    if (toolkits.empty()) {
+        VRV_LOG_ERROR("The resource path %s could not be loaded.", resourcePath.c_str());
+        return "{}";
+    }
+
+    FeatureCorpus corpus((int)inputs.size(), ngramLength);
+    std::vector<double> times(inputs.size(), 0.0);
+    std::vector<char> loaded(inputs.size(), false);
+    std::mutex mutex;
+
+    RunParallelJobs((int)inputs.size(), (int)toolkits.size(), [&](int i) {
+        Toolkit *toolkit = NULL;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            toolkit = available.back();
+            available.pop_back();
+        }
+        const std::chrono::steady_clock::time_point documentStart = std::chrono::steady_clock::now();
+        FeatureExtractor extractor("");
+        extractor.SetNumericOnly(true);
+        loaded.at(i) = toolkit->LoadFile(inputs.at(i)) && toolkit->m_doc.ExtractFeatures(extractor);
+        corpus.SetDocument(i, inputs.at(i), loaded.at(i) ? &extractor : NULL);
+#ifndef NO_HUMDRUM_SUPPORT
+        toolkit->ClearHumdrumBuffer();
+#endif
+        const std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - documentStart;
+        times.at(i) = time.count();
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            available.push_back(toolkit);
+        }
+    });
+    // The jobs run by this thread set the sink of the pooled toolkits
+    SetLogSink(m_logSink);
+
+    std::string binary;
+    corpus.ToBinary(binary);
+    std::ofstream outputFile(outputFilename.c_str(), std::ios::out | std::ios::binary);
+    if (!outputFile.is_open()) {
+        VRV_LOG_ERROR("The output file %s could not be written.", outputFilename.c_str());
+        return "{}";
+    }
+    outputFile << binary;
+    outputFile.close();
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double maxTime = 0.0;
+    double totalTime = 0.0;
+    std::vector<std::string> failed;
+    for (int i = 0; i < (int)inputs.size(); ++i) {
+        maxTime = std::max(maxTime, times.at(i));
+        totalTime += times.at(i);
+        if (!loaded.at(i)) failed.push_back(inputs.at(i));
+    }
+
+    // Keys in alphabetical order
+    std::string output;
+    JsonWriter writer(output);
+    writer.StartObject();
+    writer.Key("documents");
+    writer.Number(corpus.GetDocumentCount());
+    writer.Key("documentsPerSecond");
+    writer.Number((seconds > 0.0) ? inputs.size() / seconds : 0.0, 1);
+    writer.Key("failed");
+    writer.StringArray(failed);
+    writer.Key("intervals");
+    writer.Number(corpus.GetIntervalCount());
+    writer.Key("maxDocumentMs");
+    writer.Number(maxTime, 3);
+    writer.Key("meanDocumentMs");
+    writer.Number(inputs.empty() ? 0.0 : totalTime / inputs.size(), 3);
+    writer.Key("ngrams");
+    writer.Number(corpus.GetNgramCount());
+    writer.Key("notes");
+    writer.Number(corpus.GetNoteCount());
+    writer.Key("seconds");
+    writer.Number(seconds, 3);
+    writer.Key("threads");
+    writer.Number(toolkits.size());
+    writer.EndObject();
+
+    return output;
+}
+
 int Toolkit::GetPageWithElement(const std::string &xmlId)
 {
+    m_doc.CastOffPendingPages();
+
     Object *element = m_doc.FindDescendantByID(xmlId);
     if (!element) {
-        LogWarning("Element '%s' not found", xmlId.c_str());
+        VRV_LOG_WARNING("Element '%s' not found", xmlId.c_str());
         return 0;
     }
     Page *page = vrv_cast<Page *>(element->GetFirstAncestor(PAGE));
@@ -1966,7 +2394,7 @@ int Toolkit::GetTimeForElement(const std::string &xmlId)
     Object *element = m_doc.FindDescendantByID(xmlId);
 
     if (!element) {
-        LogWarning("Element '%s' not found", xmlId.c_str());
+        VRV_LOG_WARNING("Element '%s' not found", xmlId.c_str());
         return 0;
     }
 
@@ -1976,7 +2404,7 @@ int Toolkit::GetTimeForElement(const std::string &xmlId)
         m_doc.CalculateTimemap();
     }
     if (!m_doc.HasTimemap()) {
-        LogWarning("Calculation of MIDI timemap failed, time value is invalid.");
+        VRV_LOG_WARNING("Calculation of MIDI timemap failed, time value is invalid.");
     }
     if (element->Is(NOTE)) {
         Note *note = vrv_cast<Note *>(element);
@@ -2012,27 +2440,24 @@ std::string Toolkit::GetTimesForElement(const std::string &xmlId)
     this->ResetLogBuffer();
 
     Object *element = m_doc.FindDescendantByID(xmlId);
-    jsonxx::Object o;
+    std::string output;
+    JsonWriter writer(output);
+    writer.StartObject();
 
     if (!element) {
-        LogWarning("Element '%s' not found", xmlId.c_str());
-        return o.json();
+        VRV_LOG_WARNING("Element '%s' not found", xmlId.c_str());
+        writer.EndObject();
+        return output;
     }
 
-    jsonxx::Array scoreTimeOnset;
-    jsonxx::Array scoreTimeOffset;
-    jsonxx::Array scoreTimeDuration;
-    jsonxx::Array scoreTimeTiedDuration;
-    jsonxx::Array realTimeOnsetMilliseconds;
-    jsonxx::Array realTimeOffsetMilliseconds;
-
     if (!m_doc.HasTimemap()) {
         // generate MIDI timemap before progressing
         m_doc.CalculateTimemap();
     }
     if (!m_doc.HasTimemap()) {
-        LogWarning("Calculation of MIDI timemap failed, time value is invalid.");
-        return o.json();
+        VRV_LOG_WARNING("Calculation of MIDI timemap failed, time value is invalid.");
+        writer.EndObject();
+        return output;
     }
     if (element->Is(NOTE)) {
 
@@ -2041,24 +2466,26 @@ std::string Toolkit::GetTimesForElement(const std::string &xmlId)
         Measure *measure = vrv_cast<Measure *>(note->GetFirstAncestor(MEASURE));
         assert(measure);
 
+        auto writeValue = [&writer](const std::string &key, double value) {
+            writer.Key(key);
+            writer.StartArray();
+            writer.Number(value);
+            writer.EndArray();
+        };
+
         // For now ignore repeats and access always the first
         double offset = measure->GetRealTimeOffsetMilliseconds(1);
-        realTimeOffsetMilliseconds << offset + note->GetRealTimeOffsetMilliseconds();
-        realTimeOnsetMilliseconds << offset + note->GetRealTimeOnsetMilliseconds();
-
-        scoreTimeOnset << note->GetScoreTimeOnset();
-        scoreTimeOffset << note->GetScoreTimeOffset();
-        scoreTimeDuration << note->GetScoreTimeDuration();
-        scoreTimeTiedDuration << note->GetScoreTimeTiedDuration();
 
-        o << "scoreTimeOnset" << scoreTimeOnset;
-        o << "scoreTimeOffset" << scoreTimeOffset;
-        o << "scoreTimeDuration" << scoreTimeDuration;
-        o << "scoreTimeTiedDuration" << scoreTimeTiedDuration;
-        o << "realTimeOnsetMilliseconds" << realTimeOnsetMilliseconds;
-        o << "realTimeOffsetMilliseconds" << realTimeOffsetMilliseconds;
+        // Keys in alphabetical order
+        writeValue("realTimeOffsetMilliseconds", offset + note->GetRealTimeOffsetMilliseconds());
+        writeValue("realTimeOnsetMilliseconds", offset + note->GetRealTimeOnsetMilliseconds());
+        writeValue("scoreTimeDuration", note->GetScoreTimeDuration());
+        writeValue("scoreTimeOffset", note->GetScoreTimeOffset());
+        writeValue("scoreTimeOnset", note->GetScoreTimeOnset());
+        writeValue("scoreTimeTiedDuration", note->GetScoreTimeTiedDuration());
     }
-    return o.json();
+    writer.EndObject();
+    return output;
 }
 
 std::string Toolkit::GetMIDIValuesForElement(const std::string &xmlId)
@@ -2066,11 +2493,14 @@ std::string Toolkit::GetMIDIValuesForElement(const std::string &xmlId)
     this->ResetLogBuffer();
 
     Object *element = m_doc.FindDescendantByID(xmlId);
-    jsonxx::Object o;
+    std::string output;
+    JsonWriter writer(output);
+    writer.StartObject();
 
     if (!element) {
-        LogWarning("Element '%s' not found", xmlId.c_str());
-        return o.json();
+        VRV_LOG_WARNING("Element '%s' not found", xmlId.c_str());
+        writer.EndObject();
+        return output;
     }
 
     if (element->Is(NOTE)) {
@@ -2079,19 +2509,25 @@ std::string Toolkit::GetMIDIValuesForElement(const std::string &xmlId)
             m_doc.CalculateTimemap();
         }
         if (!m_doc.HasTimemap()) {
-            LogWarning("Calculation of MIDI timemap failed, time value is invalid.");
-            return o.json();
+            VRV_LOG_WARNING("Calculation of MIDI timemap failed, time value is invalid.");
+            writer.EndObject();
+            return output;
         }
         Note *note = vrv_cast<Note *>(element);
         assert(note);
         const int timeOfElement = this->GetTimeForElement(xmlId);
         const int pitchOfElement = note->GetMIDIPitch();
         const int durationOfElement = note->GetRealTimeOffsetMilliseconds() - note->GetRealTimeOnsetMilliseconds();
-        o << "time" << timeOfElement;
-        o << "pitch" << pitchOfElement;
-        o << "duration" << durationOfElement;
-    }
-    return o.json();
+        // Keys in alphabetical order
+        writer.Key("duration");
+        writer.Number(durationOfElement);
+        writer.Key("pitch");
+        writer.Number(pitchOfElement);
+        writer.Key("time");
+        writer.Number(timeOfElement);
+    }
+    writer.EndObject();
+    return output;
 }
 
 void Toolkit::SetHumdrumBuffer(const char *data)
@@ -2126,7 +2562,7 @@ const char *Toolkit::GetHumdrumBuffer()
         bool status = converter.convert(out, infile);
         LogRedirectStop();
         if (!status) {
-            LogWarning("Problem converting MEI to Humdrum (see warning above this line for possible reasons");
+            VRV_LOG_WARNING("Problem converting MEI to Humdrum (see warning above this line for possible reasons");
         }
 
         this->SetHumdrumBuffer(out.str().c_str());
@@ -2178,7 +2614,7 @@ void Toolkit::ClearHumdrumBuffer()
 
 void Toolkit::SetInputFrom(FileFormat format)
 {
-    LogWarning("This method is deprecated. Use SetInputFormat(std::string) instead.");
+    VRV_LOG_WARNING("This method is deprecated. Use SetInputFormat(std::string) instead.");
     m_inputFrom = format;
 }
 
@@ -2195,7 +2631,7 @@ std::string Toolkit::ConvertMEIToHumdrum(const std::string &meiData)
     LogRedirectStop();
 
     if (!status) {
-        LogError("Error converting MEI data to Humdrum: %s", conversion.str().c_str());
+        VRV_LOG_ERROR("Error converting MEI data to Humdrum: %s", conversion.str().c_str());
     }
     this->SetHumdrumBuffer(conversion.str().c_str());
     return conversion.str();
@@ -2284,7 +2720,7 @@ void Toolkit::InitClock()
         m_runtimeClock = new RuntimeClock();
     }
 #else
-    LogError("Runtime clock is not supported in this build.");
+    VRV_LOG_ERROR("Runtime clock is not supported in this build.");
 #endif
 }
 
@@ -2295,10 +2731,10 @@ void Toolkit::ResetClock()
         m_runtimeClock->Reset();
     }
     else {
-        LogWarning("No clock available. Please call 'InitClock' to create one.");
+        VRV_LOG_WARNING("No clock available. Please call 'InitClock' to create one.");
     }
 #else
-    LogError("Runtime clock is not supported in this build.");
+    VRV_LOG_ERROR("Runtime clock is not supported in this build.");
 #endif
 }
 
@@ -2309,11 +2745,11 @@ double Toolkit::GetRuntimeInSeconds() const
         return m_runtimeClock->GetSeconds();
     }
     else {
-        LogWarning("No clock available. Please call 'InitClock' to create one.");
+        VRV_LOG_WARNING("No clock available. Please call 'InitClock' to create one.");
         return 0.0;
     }
 #else
-    LogError("Runtime clock is not supported in this build.");
+    VRV_LOG_ERROR("Runtime clock is not supported in this build.");
     return 0.0;
 #endif
 }
@@ -2326,17 +2762,17 @@ void Toolkit::LogRuntime() const
         const int minutes = seconds / 60.0;
         if (minutes > 0) {
             seconds -= 60.0 * minutes;
-            LogInfo("Total runtime is %d min %.3f s.", minutes, seconds);
+            VRV_LOG_INFO("Total runtime is %d min %.3f s.", minutes, seconds);
         }
         else {
-            LogInfo("Total runtime is %.3f s.", seconds);
+            VRV_LOG_INFO("Total runtime is %.3f s.", seconds);
         }
     }
     else {
-        LogWarning("No clock available. Please call 'InitClock' to create one.");
+        VRV_LOG_WARNING("No clock available. Please call 'InitClock' to create one.");
     }
 #else
-    LogError("Runtime clock is not supported in this build.");
+    VRV_LOG_ERROR("Runtime clock is not supported in this build.");
 #endif
 }
 
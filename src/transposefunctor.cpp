@@ -214,13 +214,13 @@ FunctorCode TransposeFunctor::VisitScore(Score *score)
             fifths = keySig->GetFifthsInt();
         }
         else {
-            LogWarning("No key signature in data, assuming no key signature with no sharps/flats.");
+            VRV_LOG_WARNING("No key signature in data, assuming no key signature with no sharps/flats.");
             // need to add a dummy "0" key signature in score (staffDefs of staffDef).
         }
         m_transposer->SetTransposition(fifths, m_transposition);
     }
     else {
-        LogWarning("Transposition is invalid: %s", m_transposition.c_str());
+        VRV_LOG_WARNING("Transposition is invalid: %s", m_transposition.c_str());
         // there is no transposition that can be done so do not try
         // to transpose any further (if continuing in this function,
         // there will not be an error, just that the transposition
@@ -345,7 +345,7 @@ FunctorCode TransposeToSoundingPitchFunctor::VisitScoreDefEnd(ScoreDef *scoreDef
         }
         // Display warning
         if (showWarning) {
-            LogWarning("Transpose to sounding pitch cannot handle different transpositions for ScoreDef key "
+            VRV_LOG_WARNING("Transpose to sounding pitch cannot handle different transpositions for ScoreDef key "
                        "signatures. Please encode KeySig as StaffDef attribute or child.");
         }
     }
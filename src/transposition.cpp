@@ -147,7 +147,7 @@ data_ACCIDENTAL_GESTURAL TransPitch::GetAccidG() const
         case 3: return ACCIDENTAL_GESTURAL_ts;
         default: break;
     }
-    LogWarning("Transposition: Could not get Gestural Accidental for %i", m_accid);
+    VRV_LOG_WARNING("Transposition: Could not get Gestural Accidental for %i", m_accid);
     return ACCIDENTAL_GESTURAL_NONE;
 }
 
@@ -163,7 +163,7 @@ data_ACCIDENTAL_WRITTEN TransPitch::GetAccidW() const
         case 3: return ACCIDENTAL_WRITTEN_xs;
         default: break;
     }
-    LogWarning("Transposition: Could not get Written Accidental for %i", m_accid);
+    VRV_LOG_WARNING("Transposition: Could not get Written Accidental for %i", m_accid);
     return ACCIDENTAL_WRITTEN_NONE;
 }
 
@@ -181,7 +181,7 @@ std::u32string TransPitch::GetPitchString() const
         case 0: return std::u32string({ pitchLetter });
         case 1: return std::u32string({ pitchLetter, UNICODE_SHARP });
         case 2: return std::u32string({ pitchLetter, UNICODE_DOUBLE_SHARP });
-        default: LogError("Transposition: Could not get Accidental for %i", m_accid);
+        default: VRV_LOG_ERROR("Transposition: Could not get Accidental for %i", m_accid);
     }
     return U"";
 }
@@ -197,7 +197,7 @@ std::string TransPitch::GetSimplePitchString() const
         case 0: return letter;
         case 1: return letter + "-sharp";
         case 2: return letter + "-double-sharp";
-        default: LogError("Transposition: Could not get Accidental for %i", m_accid);
+        default: VRV_LOG_ERROR("Transposition: Could not get Accidental for %i", m_accid);
     }
     return "";
 }
@@ -742,7 +742,7 @@ bool Transposer::GetKeyTonic(const std::string &keyTonic, TransPitch &tonic)
                     case 'a': pitch = 5; break;
                     case 'B':
                     case 'b': pitch = 6; break;
-                    default: LogWarning("Invalid keytonic pitch character: %c", keyTonic[i]); return false;
+                    default: VRV_LOG_WARNING("Invalid keytonic pitch character: %c", keyTonic[i]); return false;
                 }
                 break;
             case 2:
@@ -753,7 +753,7 @@ bool Transposer::GetKeyTonic(const std::string &keyTonic, TransPitch &tonic)
                     case 'S':
                     case 's':
                     case '#': accid++; break;
-                    default: LogWarning("Invalid keytonic accid character: %c", keyTonic[i]); return false;
+                    default: VRV_LOG_WARNING("Invalid keytonic accid character: %c", keyTonic[i]); return false;
                 }
                 break;
         }
@@ -832,18 +832,18 @@ int Transposer::GetInterval(const std::string &intervalName)
     }
 
     if (quality.empty()) {
-        LogError("Interval name requires a chromatic quality: %s", intervalName.c_str());
+        VRV_LOG_ERROR("Interval name requires a chromatic quality: %s", intervalName.c_str());
         return INVALID_INTERVAL_CLASS;
     }
 
     if (number.empty()) {
-        LogError("Interval name requires a diatonic interval number: %s", intervalName.c_str());
+        VRV_LOG_ERROR("Interval name requires a diatonic interval number: %s", intervalName.c_str());
         return INVALID_INTERVAL_CLASS;
     }
 
     int dnum = stoi(number);
     if (dnum == 0) {
-        LogError("Integer interval number cannot be zero: %s", intervalName.c_str());
+        VRV_LOG_ERROR("Integer interval number cannot be zero: %s", intervalName.c_str());
         return INVALID_INTERVAL_CLASS;
     }
     dnum--;
@@ -863,7 +863,7 @@ int Transposer::GetInterval(const std::string &intervalName)
                 adjust = -(int)quality.size();
             }
             else if (quality != "P") {
-                LogError("Error in interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in interval quality: %s", intervalName.c_str());
                 return INVALID_INTERVAL_CLASS;
             }
             break;
@@ -883,7 +883,7 @@ int Transposer::GetInterval(const std::string &intervalName)
                 adjust = -(int)quality.size();
             }
             else {
-                LogError("Error in interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in interval quality: %s", intervalName.c_str());
                 return INVALID_INTERVAL_CLASS;
             }
             break;
@@ -903,7 +903,7 @@ int Transposer::GetInterval(const std::string &intervalName)
                 adjust = -(int)quality.size();
             }
             else {
-                LogError("Error in interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in interval quality: %s", intervalName.c_str());
                 return INVALID_INTERVAL_CLASS;
             }
             break;
@@ -916,7 +916,7 @@ int Transposer::GetInterval(const std::string &intervalName)
                 adjust = -(int)quality.size();
             }
             else if (quality != "P") {
-                LogError("Error in interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in interval quality: %s", intervalName.c_str());
                 return INVALID_INTERVAL_CLASS;
             }
             break;
@@ -929,7 +929,7 @@ int Transposer::GetInterval(const std::string &intervalName)
                 adjust = -(int)quality.size();
             }
             else if (quality != "P") {
-                LogError("Error in interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in interval quality: %s", intervalName.c_str());
                 return INVALID_INTERVAL_CLASS;
             }
             break;
@@ -949,7 +949,7 @@ int Transposer::GetInterval(const std::string &intervalName)
                 adjust = -(int)quality.size();
             }
             else {
-                LogError("Error in interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in interval quality: %s", intervalName.c_str());
                 return INVALID_INTERVAL_CLASS;
             }
             break;
@@ -969,7 +969,7 @@ int Transposer::GetInterval(const std::string &intervalName)
                 adjust = -(int)quality.size();
             }
             else {
-                LogError("Error in interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in interval quality: %s", intervalName.c_str());
                 return INVALID_INTERVAL_CLASS;
             }
             break;
@@ -1791,14 +1791,14 @@ void Transposer::IntervalToDiatonicChromatic(int &diatonic, int &chromatic, cons
     }
 
     if (quality.empty()) {
-        LogError("Interval requires a chromatic quality: %s", intervalName.c_str());
+        VRV_LOG_ERROR("Interval requires a chromatic quality: %s", intervalName.c_str());
         chromatic = INVALID_INTERVAL_CLASS;
         diatonic = INVALID_INTERVAL_CLASS;
         return;
     }
 
     if (number.empty()) {
-        LogError("Interval requires a diatonic interval number: %s", intervalName.c_str());
+        VRV_LOG_ERROR("Interval requires a diatonic interval number: %s", intervalName.c_str());
         chromatic = INVALID_INTERVAL_CLASS;
         diatonic = INVALID_INTERVAL_CLASS;
         return;
@@ -1806,7 +1806,7 @@ void Transposer::IntervalToDiatonicChromatic(int &diatonic, int &chromatic, cons
 
     int dnum = stoi(number);
     if (dnum == 0) {
-        LogError("Integer interval number cannot be zero: %s", intervalName.c_str());
+        VRV_LOG_ERROR("Integer interval number cannot be zero: %s", intervalName.c_str());
         chromatic = INVALID_INTERVAL_CLASS;
         diatonic = INVALID_INTERVAL_CLASS;
         return;
@@ -1830,7 +1830,7 @@ void Transposer::IntervalToDiatonicChromatic(int &diatonic, int &chromatic, cons
                 chromatic = 0;
             }
             else {
-                LogError("Error in Interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in Interval quality: %s", intervalName.c_str());
                 chromatic = INVALID_INTERVAL_CLASS;
                 diatonic = INVALID_INTERVAL_CLASS;
                 return;
@@ -1850,7 +1850,7 @@ void Transposer::IntervalToDiatonicChromatic(int &diatonic, int &chromatic, cons
                 chromatic = 1 - (int)quality.size();
             }
             else {
-                LogError("Error in Interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in Interval quality: %s", intervalName.c_str());
                 chromatic = INVALID_INTERVAL_CLASS;
                 diatonic = INVALID_INTERVAL_CLASS;
                 return;
@@ -1870,7 +1870,7 @@ void Transposer::IntervalToDiatonicChromatic(int &diatonic, int &chromatic, cons
                 chromatic = 3 - (int)quality.size();
             }
             else {
-                LogError("Error in Interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in Interval quality: %s", intervalName.c_str());
                 chromatic = INVALID_INTERVAL_CLASS;
                 diatonic = INVALID_INTERVAL_CLASS;
                 return;
@@ -1887,7 +1887,7 @@ void Transposer::IntervalToDiatonicChromatic(int &diatonic, int &chromatic, cons
                 chromatic = 5;
             }
             else {
-                LogError("Error in Interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in Interval quality: %s", intervalName.c_str());
                 chromatic = INVALID_INTERVAL_CLASS;
                 diatonic = INVALID_INTERVAL_CLASS;
                 return;
@@ -1904,7 +1904,7 @@ void Transposer::IntervalToDiatonicChromatic(int &diatonic, int &chromatic, cons
                 chromatic = 7;
             }
             else {
-                LogError("Error in Interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in Interval quality: %s", intervalName.c_str());
                 chromatic = INVALID_INTERVAL_CLASS;
                 diatonic = INVALID_INTERVAL_CLASS;
                 return;
@@ -1924,7 +1924,7 @@ void Transposer::IntervalToDiatonicChromatic(int &diatonic, int &chromatic, cons
                 chromatic = 8 - (int)quality.size();
             }
             else {
-                LogError("Error in Interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in Interval quality: %s", intervalName.c_str());
                 chromatic = INVALID_INTERVAL_CLASS;
                 diatonic = INVALID_INTERVAL_CLASS;
                 return;
@@ -1944,7 +1944,7 @@ void Transposer::IntervalToDiatonicChromatic(int &diatonic, int &chromatic, cons
                 chromatic = 10 - (int)quality.size();
             }
             else {
-                LogError("Error in Interval quality: %s", intervalName.c_str());
+                VRV_LOG_ERROR("Error in Interval quality: %s", intervalName.c_str());
                 chromatic = INVALID_INTERVAL_CLASS;
                 diatonic = INVALID_INTERVAL_CLASS;
                 return;
@@ -135,7 +135,7 @@ const StaffAlignment *SystemAligner::GetStaffAlignmentForStaffN(int staffN) cons
 
         if ((alignment->GetStaff()) && (alignment->GetStaff()->GetN() == staffN)) return alignment;
     }
-    LogDebug("Staff alignment for staff %d not found", staffN);
+    VRV_LOG_DEBUG("Staff alignment for staff %d not found", staffN);
     return NULL;
 }
 
@@ -236,7 +236,7 @@ SystemAligner::SpacingType SystemAligner::GetAboveSpacingType(const Staff *staff
 
     auto iter = m_spacingTypes.find(staff->GetN());
     if (iter == m_spacingTypes.end()) {
-        LogWarning("No spacing type found matching @n=%d for '<%s>'", staff->GetN(), staff->GetID().c_str());
+        VRV_LOG_WARNING("No spacing type found matching @n=%d for '<%s>'", staff->GetN(), staff->GetID().c_str());
         return SpacingType::None;
     }
 
@@ -30,6 +30,8 @@ View::View()
     m_options = NULL;
     m_pageIdx = 0;
     m_slurHandling = SlurHandling::Initialize;
+    m_threadCount = 1;
+    m_postponedSystemObjects = NULL;
 
     m_currentColor = AxNONE;
     m_currentElement = NULL;
@@ -109,7 +109,7 @@ void View::DrawFTrem(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     const ArrayOfBeamElementCoords *beamElementCoords = fTrem->GetElementCoords();
 
     if (beamElementCoords->size() != 2) {
-        LogError("View draw: <fTrem> element has invalid number of descendants.");
+        VRV_LOG_ERROR("View draw: <fTrem> element has invalid number of descendants.");
         return;
     }
 
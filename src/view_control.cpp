@@ -231,7 +231,7 @@ void View::DrawTimeSpanningElement(DeviceContext *dc, Object *element, System *s
     // Only the first parent is the same, this means that the element is "open" at the end of the system
     else if (system == parentSystem1) {
         // We need the last measure of the system for x2 - we also use it for getting the staves later
-        measure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, BACKWARD));
+        measure = system->GetDrawingLastMeasure();
         if (!measure) return;
         x1 = start->GetDrawingX();
         objectX = start;
@@ -242,7 +242,7 @@ void View::DrawTimeSpanningElement(DeviceContext *dc, Object *element, System *s
     // We are in the system of the last note - draw the element from the beginning of the system
     else if (system == parentSystem2) {
         // We need the first measure of the system for x1 - we also use it for getting the staves later
-        measure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, FORWARD));
+        measure = system->GetDrawingFirstMeasure();
         if (!measure) return;
         // We need the position of the first default in the first measure for x1
         x1 = measure->GetDrawingX() + measure->GetLeftBarLineXRel();
@@ -254,13 +254,13 @@ void View::DrawTimeSpanningElement(DeviceContext *dc, Object *element, System *s
     // throughout the system => recheck that the systems are in correct order
     else if (Object::IsPreOrdered(parentSystem1, system) && Object::IsPreOrdered(system, parentSystem2)) {
         // We need the first measure of the system for x1 - we also use it for getting the staves later
-        measure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, FORWARD));
+        measure = system->GetDrawingFirstMeasure();
         if (!measure) return;
         // We need the position of the first default in the first measure for x1
         x1 = measure->GetDrawingX() + measure->GetLeftBarLineXRel();
         objectX = measure->GetLeftBarLine();
         // We need the last measure of the system for x2
-        Measure *last = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, BACKWARD));
+        Measure *last = system->GetDrawingLastMeasure();
         if (!last) return;
         x2 = last->GetDrawingX() + last->GetRightBarLineXRel();
         spanningType = SPANNING_MIDDLE;
@@ -428,7 +428,7 @@ bool View::HasValidTimeSpanningOrder(DeviceContext *dc, Object *element, LayerEl
         }
         // To avoid showing the same warning multiple times, display a warning only during actual drawing
         if (!dc->Is(BBOX_DEVICE_CONTEXT) && (m_currentPage == vrv_cast<Page *>(start->GetFirstAncestor(PAGE)))) {
-            LogWarning("%s '%s' is ignored, since start '%s' does not occur temporally before end '%s'.",
+            VRV_LOG_WARNING("%s '%s' is ignored, since start '%s' does not occur temporally before end '%s'.",
                 element->GetClassName().c_str(), element->GetID().c_str(), start->GetID().c_str(),
                 end->GetID().c_str());
         }
@@ -1340,7 +1340,7 @@ void View::DrawSylConnectorLines(DeviceContext *dc, int x1, int x2, int y, Syl *
         int margin = dist / 2;
         // no dash if the distance is smaller than a dash length
         if (dist < dashLength) {
-            LogDebug("Hyphen space under the limit");
+            VRV_LOG_DEBUG("Hyphen space under the limit");
             nbDashes = 0;
         }
         else if (nbDashes < 2) {
@@ -1481,7 +1481,7 @@ void View::DrawArpegEnclosing(DeviceContext *dc, Arpeg *arpeg, Staff *staff, cha
         dc->EndGraphic(arpeg, this);
     }
     else if (arpeg->HasEnclose() && (arpeg->GetEnclose() != ENCLOSURE_none)) {
-        LogWarning("Only drawing of enclosing brackets and boxes is supported for arpeggio.");
+        VRV_LOG_WARNING("Only drawing of enclosing brackets and boxes is supported for arpeggio.");
     }
 }
 
@@ -2409,7 +2409,7 @@ void View::DrawReh(DeviceContext *dc, Reh *reh, Measure *measure, System *system
     const bool adjustPosition = ((reh->HasTstamp() && (reh->GetTstamp() == 0.0))
         || (reh->GetStart()->Is(BARLINE)
             && vrv_cast<BarLine *>(reh->GetStart())->GetPosition() == BarLinePosition::Left));
-    if ((system->GetFirst(MEASURE) == measure) && adjustPosition) {
+    if ((system->GetDrawingFirstMeasure() == measure) && adjustPosition) {
         // StaffDef information is always in the first layer
         Layer *layer = vrv_cast<Layer *>(measure->FindDescendantByType(LAYER));
         assert(layer);
@@ -2443,7 +2443,7 @@ void View::DrawReh(DeviceContext *dc, Reh *reh, Measure *measure, System *system
         }
         const int staffSize = staff->m_drawingStaffSize;
 
-        if ((system->GetFirst(MEASURE) != measure) && adjustPosition) {
+        if ((system->GetDrawingFirstMeasure() != measure) && adjustPosition) {
             params.m_x = staff->GetDrawingX();
         }
 
@@ -2848,26 +2848,26 @@ void View::DrawEnding(DeviceContext *dc, Ending *ending, System *system)
         endingMeasure = endingEndMilestone->GetMeasure();
         objectX = measure;
         // if it is the first measure of the system use the left barline position
-        if (system->GetFirst(MEASURE) == measure) x1 += measure->GetLeftBarLineXRel();
+        if (system->GetDrawingFirstMeasure() == measure) x1 += measure->GetLeftBarLineXRel();
         x2 = endingEndMilestone->GetMeasure()->GetDrawingX() + endingEndMilestone->GetMeasure()->GetRightBarLineXRel();
     }
     // Only the first parent is the same, this means that the ending is "open" at the end of the system
     else if (system == parentSystem1) {
         // We need the last measure of the system for x2 - we also use it for getting the staves later
-        measure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, BACKWARD));
+        measure = system->GetDrawingLastMeasure();
         if (!measure) return;
         x1 = ending->GetMeasure()->GetDrawingX();
         objectX = measure;
         endingMeasure = measure;
         // if it is the first measure of the system use the left barline position
-        if (system->GetFirst(MEASURE) == ending->GetMeasure()) x1 += ending->GetMeasure()->GetLeftBarLineXRel();
+        if (system->GetDrawingFirstMeasure() == ending->GetMeasure()) x1 += ending->GetMeasure()->GetLeftBarLineXRel();
         x2 = measure->GetDrawingX() + measure->GetRightBarLineXRel();
         spanningType = SPANNING_START;
     }
     // We are in the system where the ending ends - draw it from the beginning of the system
     else if (system == parentSystem2) {
         // We need the last measure of the system for x2
-        measure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, FORWARD));
+        measure = system->GetDrawingFirstMeasure();
         if (!measure) return;
         x1 = measure->GetDrawingX() + measure->GetLeftBarLineXRel();
         objectX = measure->GetLeftBarLine();
@@ -2879,13 +2879,13 @@ void View::DrawEnding(DeviceContext *dc, Ending *ending, System *system)
     // throughout the system
     else {
         // We need the first measure of the system for x1 - we also use it for getting the staves later
-        measure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, FORWARD));
+        measure = system->GetDrawingFirstMeasure();
         if (!measure) return;
         x1 = measure->GetDrawingX() + measure->GetLeftBarLineXRel();
         objectX = measure->GetLeftBarLine();
         endingMeasure = measure;
         // We need the last measure of the system for x2
-        measure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, BACKWARD));
+        measure = system->GetDrawingLastMeasure();
         if (!measure) return;
         x2 = measure->GetDrawingX() + measure->GetRightBarLineXRel();
         spanningType = SPANNING_MIDDLE;
@@ -2973,7 +2973,7 @@ void View::DrawEnding(DeviceContext *dc, Ending *ending, System *system)
         const int rightBarLineWidth = endingMeasure->CalculateRightBarLineWidth(m_doc, staffSize);
         int endX = x2;
         if ((spanningType == SPANNING_START) || (spanningType == SPANNING_MIDDLE)
-            || (endingMeasure == system->FindDescendantByType(MEASURE, 1, BACKWARD))) {
+            || (endingMeasure == system->GetDrawingLastMeasure())) {
             // Right align the ending in the last measure of the system
             endX += rightBarLineWidth - lineWidth / 2 - staffLineWidth;
         }
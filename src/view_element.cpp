@@ -229,7 +229,7 @@ void View::DrawLayerElement(DeviceContext *dc, LayerElement *element, Layer *lay
     }
     else {
         // This should never happen
-        LogError("Element '%s' cannot be drawn", element->GetClassName().c_str());
+        VRV_LOG_ERROR("Element '%s' cannot be drawn", element->GetClassName().c_str());
     }
 
     m_currentColor = previousColor;
@@ -729,7 +729,7 @@ void View::DrawClefEnclosing(DeviceContext *dc, Clef *clef, Staff *staff, char32
             dc, x, y, height, width, offset, bracketWidth, horizontalThickness, verticalThickness);
     }
     else if (clef->HasEnclose() && (clef->GetEnclose() != ENCLOSURE_none)) {
-        LogWarning("Only drawing of enclosing brackets and boxes is supported for clef.");
+        VRV_LOG_WARNING("Only drawing of enclosing brackets and boxes is supported for clef.");
     }
 }
 
@@ -1003,7 +1003,8 @@ void View::DrawKeySig(DeviceContext *dc, LayerElement *element, Layer *layer, St
         && ((keySig->HasCancelaccid() && (keySig->GetCancelaccid() != CANCELACCID_none))
             || (keySig->GetAccidCount() == 0))) {
         if (keySig->m_skipCancellation) {
-            LogWarning("Cautionary accidentals are skipped if the new or previous KeySig contains KeyAccid children.");
+            VRV_LOG_WARNING(
+                "Cautionary accidentals are skipped if the new or previous KeySig contains KeyAccid children.");
         }
         // For French style (after)
         else if ((keySig->GetCancelaccid() == CANCELACCID_after)
@@ -1457,7 +1458,7 @@ void View::DrawNote(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
         int drawingDur = note->GetDrawingDur();
         if (drawingDur == DUR_NONE) {
             if (note->IsInBeam() && !dc->Is(BBOX_DEVICE_CONTEXT)) {
-                LogWarning("Missing duration for note '%s' in beam", note->GetID().c_str());
+                VRV_LOG_WARNING("Missing duration for note '%s' in beam", note->GetID().c_str());
             }
             drawingDur = DUR_4;
         }
@@ -1542,7 +1543,7 @@ void View::DrawRest(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     int drawingDur = rest->GetActualDur();
     if (drawingDur == DUR_NONE) {
         if (!dc->Is(BBOX_DEVICE_CONTEXT)) {
-            LogWarning("Missing duration for rest '%s'", rest->GetID().c_str());
+            VRV_LOG_WARNING("Missing duration for rest '%s'", rest->GetID().c_str());
         }
         drawingDur = DUR_4;
     }
@@ -1677,7 +1678,7 @@ void View::DrawStemMod(DeviceContext *dc, LayerElement *element, Staff *staff)
     }
     else {
         // should not happen, draw nothing
-        LogWarning("Drawing stem mod supported only for elements of <stem> or <bTrem> type.");
+        VRV_LOG_WARNING("Drawing stem mod supported only for elements of <stem> or <bTrem> type.");
         return;
     }
     // If we have no element at this point - exit without drawing anything
@@ -1743,7 +1744,7 @@ void View::DrawSyl(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
     assert(syl);
 
     if (!syl->GetStart() && !(staff->m_drawingNotationType == NOTATIONTYPE_neume)) {
-        LogWarning("Parent note for <syl> was not found");
+        VRV_LOG_WARNING("Parent note for <syl> was not found");
         return;
     }
 
@@ -1819,7 +1820,7 @@ void View::DrawSyl(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
         // Postpone the drawing of the syl to the end of the system; this will call DrawSylConnector
         // that will look if the last note is in the same system (or not) and draw the connectors accordingly
         if (currentSystem) {
-            currentSystem->AddToDrawingList(syl);
+            this->AddToSystemDrawingList(currentSystem, syl);
         }
     }
 
@@ -9,13 +9,17 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <math.h>
+#include <memory>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
 #include "annot.h"
 #include "app.h"
+#include "bboxdevicecontext.h"
 #include "beam.h"
 #include "beamspan.h"
 #include "choice.h"
@@ -108,6 +112,9 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
 
     this->DrawRunningElements(dc, m_currentPage);
 
+    // Close the ID index built for looking up the zones of the staves (see Staff::SetFromFacsimile)
+    if (m_doc->IsFacs()) m_doc->GetFacsimile()->ClearIndex();
+
     dc->EndPage();
 
     if (!dcHasResources) dc->ResetResources();
@@ -193,7 +200,9 @@ void View::DrawSystem(DeviceContext *dc, System *system)
 
     dc->StartGraphic(system, "", system->GetID());
 
-    Measure *firstMeasure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1));
+    // The children of the system do not change while drawing it
+    system->CacheDrawingMeasures();
+    Measure *firstMeasure = system->GetDrawingFirstMeasure();
 
     this->DrawSystemDivider(dc, system, firstMeasure);
 
@@ -206,25 +215,14 @@ void View::DrawSystem(DeviceContext *dc, System *system)
 
     this->DrawSystemChildren(dc, system, system);
 
-    this->DrawSystemList(dc, system, SYL);
-    this->DrawSystemList(dc, system, BEAMSPAN);
-    this->DrawSystemList(dc, system, BRACKETSPAN);
-    this->DrawSystemList(dc, system, DYNAM);
-    this->DrawSystemList(dc, system, DIR);
-    this->DrawSystemList(dc, system, GLISS);
-    this->DrawSystemList(dc, system, HAIRPIN);
-    this->DrawSystemList(dc, system, TRILL);
-    this->DrawSystemList(dc, system, FIGURE);
-    this->DrawSystemList(dc, system, LV);
-    this->DrawSystemList(dc, system, PHRASE);
-    this->DrawSystemList(dc, system, OCTAVE);
-    this->DrawSystemList(dc, system, ORNAM);
-    this->DrawSystemList(dc, system, PEDAL);
-    this->DrawSystemList(dc, system, PITCHINFLECTION);
-    this->DrawSystemList(dc, system, TEMPO);
-    this->DrawSystemList(dc, system, TIE);
-    this->DrawSystemList(dc, system, SLUR);
-    this->DrawSystemList(dc, system, ENDING);
+    // The postponed elements are drawn type by type in this order
+    static const std::vector<ClassId> drawingListOrder = { SYL, BEAMSPAN, BRACKETSPAN, DYNAM, DIR, GLISS, HAIRPIN,
+        TRILL, FIGURE, LV, PHRASE, OCTAVE, ORNAM, PEDAL, PITCHINFLECTION, TEMPO, TIE, SLUR, ENDING };
+    for (const ClassId classId : drawingListOrder) {
+        this->DrawSystemList(dc, system, classId);
+    }
+
+    system->ResetDrawingMeasures();
 
     dc->EndGraphic(system, this);
 }
@@ -234,67 +232,16 @@ void View::DrawSystemList(DeviceContext *dc, System *system, const ClassId class
     assert(dc);
     assert(system);
 
-    ArrayOfObjects *drawingList = system->GetDrawingList();
+    const ArrayOfObjects &drawingList = system->GetDrawingListByClassId(classId);
 
-    for (Object *object : *drawingList) {
-        if (object->Is(classId) && (classId == BEAMSPAN)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == BRACKETSPAN)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == DIR)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == DYNAM)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == FIGURE)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == GLISS)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == HAIRPIN)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == LV)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == PHRASE)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == OCTAVE)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == ORNAM)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == PEDAL)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == PITCHINFLECTION)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == SYL)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == TEMPO)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == TIE)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == TRILL)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == SLUR)) {
-            this->DrawTimeSpanningElement(dc, object, system);
-        }
-        if (object->Is(classId) && (classId == ENDING)) {
+    for (Object *object : drawingList) {
+        if (classId == ENDING) {
             // cast to Ending check in DrawEnding
             this->DrawEnding(dc, dynamic_cast<Ending *>(object), system);
         }
+        else {
+            this->DrawTimeSpanningElement(dc, object, system);
+        }
     }
 }
 
@@ -340,7 +287,7 @@ void View::DrawStaffGrp(
 
     // Get the first and last staffDef of the staffGrp
     if (!firstDef || !lastDef) {
-        LogDebug("Could not get staffDef while drawing staffGrp - DrawStaffGrp");
+        VRV_LOG_DEBUG("Could not get staffDef while drawing staffGrp - DrawStaffGrp");
         return;
     }
 
@@ -351,7 +298,7 @@ void View::DrawStaffGrp(
     Staff *last = vrv_cast<Staff *>(measure->FindDescendantByComparison(&comparisonLast, 1));
 
     if (!first || !last) {
-        LogDebug(
+        VRV_LOG_DEBUG(
             "Could not get staff (%d; %d) while drawing staffGrp - DrawStaffGrp", firstDef->GetN(), lastDef->GetN());
         return;
     }
@@ -416,7 +363,7 @@ void View::DrawStaffDefLabels(DeviceContext *dc, Measure *measure, StaffGrp *sta
         ScoreDef *scoreDef = vrv_cast<ScoreDef *>(staffGrp->GetFirstAncestor(SCOREDEF));
 
         if (!staff || !scoreDef) {
-            LogDebug("Staff or ScoreDef missing in View::DrawStaffDefLabels");
+            VRV_LOG_DEBUG("Staff or ScoreDef missing in View::DrawStaffDefLabels");
             continue;
         }
 
@@ -452,7 +399,7 @@ void View::DrawGrpSym(DeviceContext *dc, Measure *measure, StaffGrp *staffGrp, i
     Staff *last = vrv_cast<Staff *>(measure->FindDescendantByComparison(&comparisonLast, 1));
 
     if (!first || !last) {
-        LogDebug("Could not get staff (%d; %d) while drawing staffGrp - DrawStaffGrp",
+        VRV_LOG_DEBUG("Could not get staff (%d; %d) while drawing staffGrp - DrawStaffGrp",
             groupSymbol->GetStartDef()->GetN(), groupSymbol->GetEndDef()->GetN());
         return;
     }
@@ -521,7 +468,7 @@ void View::DrawLayerDefLabels(
         AttNIntegerComparison comparison(LAYER, layerDef->GetN());
         Layer *layer = vrv_cast<Layer *>(staff->FindDescendantByComparison(&comparison, 1));
         if (!layer) {
-            LogDebug("Layer or LayerDef missing in View::DrawLayerDefLabels");
+            VRV_LOG_DEBUG("Layer or LayerDef missing in View::DrawLayerDefLabels");
             continue;
         }
 
@@ -780,7 +727,7 @@ void View::DrawBarLines(DeviceContext *dc, Measure *measure, StaffGrp *staffGrp,
         AttNIntegerComparison comparison(STAFF, staffDef->GetN());
         Staff *staff = vrv_cast<Staff *>(measure->FindDescendantByComparison(&comparison, 1));
         if (!staff) {
-            LogDebug("Could not get staff (%d) while drawing staffGrp - DrawBarLines", staffDef->GetN());
+            VRV_LOG_DEBUG("Could not get staff (%d) while drawing staffGrp - DrawBarLines", staffDef->GetN());
             yBottomPrevious = VRV_UNSET;
             continue;
         }
@@ -987,7 +934,7 @@ void View::DrawBarLine(DeviceContext *dc, int yTop, int yBottom, BarLine *barLin
             break;
         default:
             // Use solid barline as fallback
-            LogWarning(
+            VRV_LOG_WARNING(
                 "%s bar lines not supported", barLine->AttBarLineLog::BarrenditionToStr(barLine->GetForm()).c_str());
             this->DrawVerticalSegmentedLine(dc, x, line, barLineWidth);
             break;
@@ -1052,52 +999,13 @@ void View::DrawMeasure(DeviceContext *dc, Measure *measure, System *system)
         dc->StartGraphic(measure, "", measure->GetID());
     }
 
-    if (m_drawingScoreDef.GetMnumVisible() != BOOLEAN_false) {
-        MNum *mnum = vrv_cast<MNum *>(measure->FindDescendantByType(MNUM));
-        Reh *reh = vrv_cast<Reh *>(measure->FindDescendantByType(REH));
-        const bool hasRehearsal = reh
-            && ((reh->HasTstamp() && (reh->GetTstamp() == 0.0))
-                || (reh->GetStart()->Is(BARLINE)
-                    && vrv_cast<BarLine *>(reh->GetStart())->GetPosition() == BarLinePosition::Left));
-        if (mnum && !hasRehearsal) {
-            // this should be an option
-            Measure *systemStart = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE));
-
-            // Draw non-generated measure numbers
-            // If mnumInterval is 0, draw system starting measure numbers > 1,
-            // otherwise, draw every (mnumInterval)th measure number.
-            int mnumInterval = m_options->m_mnumInterval.GetValue();
-            if ((mnumInterval == 0 && measure == systemStart && measure->GetN() != "0" && measure->GetN() != "1")
-                || !mnum->IsGenerated()
-                || (mnumInterval >= 1 && (std::atoi(measure->GetN().c_str()) % mnumInterval == 0))) {
-                int symbolOffset = m_doc->GetDrawingUnit(100);
-                ScoreDef *scoreDef = system->GetDrawingScoreDef();
-                GrpSym *groupSymbol = vrv_cast<GrpSym *>(scoreDef->FindDescendantByType(GRPSYM));
-                if (groupSymbol && (groupSymbol->GetSymbol() == staffGroupingSym_SYMBOL_bracket)) {
-                    symbolOffset
-                        += m_doc->GetGlyphHeight(SMUFL_E003_bracketTop, 100, false) + m_doc->GetDrawingUnit(100) / 6;
-                }
-                // hardcoded offset for the mNum based on the lyric font size
-                const int yOffset = m_doc->GetDrawingLyricFont(60)->GetPointSize();
-                this->DrawMNum(dc, mnum, measure, system, std::max(symbolOffset, yOffset));
-            }
-        }
-    }
+    this->DrawMeasureNumber(dc, measure, system);
 
     this->DrawMeasureChildren(dc, measure, measure, system);
 
     // Draw the barlines only with measured music
     if (measure->IsMeasuredMusic()) {
-        System *system = vrv_cast<System *>(measure->GetFirstAncestor(SYSTEM));
-        assert(system);
-        if ((measure->GetDrawingLeftBarLine() != BARRENDITION_NONE) || measure->HasInvisibleStaffBarlines()) {
-            this->DrawScoreDef(dc, system->GetDrawingScoreDef(), measure, measure->GetLeftBarLine()->GetDrawingX(),
-                measure->GetLeftBarLine());
-        }
-        if ((measure->GetDrawingRightBarLine() != BARRENDITION_NONE) || measure->HasInvisibleStaffBarlines()) {
-            this->DrawScoreDef(dc, system->GetDrawingScoreDef(), measure, measure->GetRightBarLine()->GetDrawingX(),
-                measure->GetRightBarLine(), measure->IsLastInSystem(), system->IsLastOfMdiv());
-        }
+        this->DrawMeasureBarLines(dc, measure, system);
     }
 
     if (measure->IsMeasuredMusic()) {
@@ -1119,6 +1027,203 @@ void View::DrawMeasure(DeviceContext *dc, Measure *measure, System *system)
     */
 }
 
+void View::DrawMeasures(DeviceContext *dc, const std::vector<Measure *> &measures, System *system)
+{
+    assert(dc);
+    assert(system);
+
+    const bool inParallel = (m_threadCount > 1) && dc->Is(BBOX_DEVICE_CONTEXT)
+        && !vrv_cast<BBoxDeviceContext *>(dc)->UpdateVerticalValues() && !m_doc->IsFacs();
+
+    // The staves of a measure can be drawn on their own when they come first and are followed by control elements
+    auto hasStavesFirst = [](const Measure *measure) {
+        if (!measure->IsMeasuredMusic()) return false;
+        bool inStaves = true;
+        for (const Object *child : measure->GetChildren()) {
+            if (child->Is(STAFF)) {
+                if (!inStaves) return false;
+            }
+            else if (child->IsControlElement()) {
+                inStaves = false;
+            }
+            else {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Runs of such measures are drawn in parallel, and the other measures in order in between
+    auto begin = measures.begin();
+    while (begin != measures.end()) {
+        auto end = (inParallel) ? std::find_if_not(begin, measures.end(), hasStavesFirst) : begin;
+        if (std::distance(begin, end) > 1) {
+            this->DrawMeasuresInParallel(dc, std::vector<Measure *>(begin, end), system);
+            begin = end;
+        }
+        else {
+            this->DrawMeasure(dc, *begin, system);
+            ++begin;
+        }
+    }
+}
+
+void View::DrawMeasuresInParallel(DeviceContext *dc, const std::vector<Measure *> &measures, System *system)
+{
+    assert(dc);
+    assert(system);
+
+    // The caches filled lazily while drawing the staves are filled beforehand
+    system->CacheSubtreeClassIds();
+    system->GetDrawingX();
+    system->GetDrawingY();
+    ScoreDef *scoreDef = system->GetDrawingScoreDef();
+    assert(scoreDef);
+    scoreDef->CacheSubtreeClassIds();
+    scoreDef->GetList();
+
+    // The beamSpan segments are calculated before the staves are drawn, as in DrawMeasureChildren
+    for (Measure *measure : measures) {
+        this->CalcBeamSpanSegments(measure, system);
+    }
+
+    // The staves are drawn by chunks of measures, each with its own device context and its own drawing fonts.
+    // Since objects created on the calling thread change the IDs generated next, the view is reused on it.
+    const int count = (int)measures.size();
+    const int chunkCount = std::min(count, m_threadCount * 4);
+    std::vector<ArrayOfObjects> postponedSystemObjects(count);
+    const std::thread::id callingThreadId = std::this_thread::get_id();
+    RunParallelJobs(chunkCount, m_threadCount, [&](int chunk) {
+        std::unique_ptr<View> threadView;
+        View *view = this;
+        if (std::this_thread::get_id() != callingThreadId) {
+            threadView = std::make_unique<View>();
+            threadView->SetDoc(m_doc);
+            threadView->m_pageIdx = m_pageIdx;
+            threadView->m_currentPage = m_currentPage;
+            threadView->m_slurHandling = m_slurHandling;
+            view = threadView.get();
+        }
+        BBoxDeviceContext bBoxDC(view, 0, 0, BBOX_HORIZONTAL_ONLY);
+        bBoxDC.SetResources(&m_doc->GetResources());
+        bBoxDC.SetContentHeight(dc->GetContentHeight());
+        m_doc->SetThreadDrawingFonts();
+        for (int i = chunk * count / chunkCount; i < (chunk + 1) * count / chunkCount; ++i) {
+            view->m_postponedSystemObjects = &postponedSystemObjects.at(i);
+            view->DrawMeasureStaves(&bBoxDC, measures.at(i), system);
+        }
+        view->m_postponedSystemObjects = NULL;
+        m_doc->ResetThreadDrawingFonts();
+    });
+
+    // The rest of the measures is drawn in order, as in DrawMeasure
+    for (int i = 0; i < count; ++i) {
+        Measure *measure = measures.at(i);
+
+        // The system was not in the device contexts of the staves
+        if (measure->HasContentHorizontalBB()) {
+            system->UpdateContentBBoxX(measure->GetContentLeft(), measure->GetContentRight());
+        }
+        if (measure->HasContentVerticalBB()) {
+            system->UpdateContentBBoxY(measure->GetContentBottom(), measure->GetContentTop());
+        }
+        for (Object *object : postponedSystemObjects.at(i)) {
+            system->AddToDrawingListIfNecessary(object);
+        }
+
+        dc->ResumeGraphic(measure, measure->GetID());
+
+        this->DrawMeasureNumber(dc, measure, system);
+
+        for (Object *current : measure->GetChildren()) {
+            if (current->Is(STAFF)) continue;
+            // cast to ControlElement check in DrawControlElement
+            this->DrawControlElement(dc, dynamic_cast<ControlElement *>(current), measure, system);
+        }
+
+        this->DrawMeasureBarLines(dc, measure, system);
+
+        dc->EndResumedGraphic(measure, this);
+
+        if (measure->GetDrawingEnding()) {
+            system->AddToDrawingList(measure->GetDrawingEnding());
+        }
+    }
+}
+
+void View::DrawMeasureNumber(DeviceContext *dc, Measure *measure, System *system)
+{
+    assert(dc);
+    assert(measure);
+    assert(system);
+
+    if (m_drawingScoreDef.GetMnumVisible() == BOOLEAN_false) return;
+
+    MNum *mnum = vrv_cast<MNum *>(measure->FindDescendantByType(MNUM));
+    Reh *reh = vrv_cast<Reh *>(measure->FindDescendantByType(REH));
+    const bool hasRehearsal = reh
+        && ((reh->HasTstamp() && (reh->GetTstamp() == 0.0))
+            || (reh->GetStart()->Is(BARLINE)
+                && vrv_cast<BarLine *>(reh->GetStart())->GetPosition() == BarLinePosition::Left));
+    if (mnum && !hasRehearsal) {
+        // this should be an option
+        Measure *systemStart = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE));
+
+        // Draw non-generated measure numbers
+        // If mnumInterval is 0, draw system starting measure numbers > 1,
+        // otherwise, draw every (mnumInterval)th measure number.
+        int mnumInterval = m_options->m_mnumInterval.GetValue();
+        if ((mnumInterval == 0 && measure == systemStart && measure->GetN() != "0" && measure->GetN() != "1")
+            || !mnum->IsGenerated()
+            || (mnumInterval >= 1 && (std::atoi(measure->GetN().c_str()) % mnumInterval == 0))) {
+            int symbolOffset = m_doc->GetDrawingUnit(100);
+            ScoreDef *scoreDef = system->GetDrawingScoreDef();
+            GrpSym *groupSymbol = vrv_cast<GrpSym *>(scoreDef->FindDescendantByType(GRPSYM));
+            if (groupSymbol && (groupSymbol->GetSymbol() == staffGroupingSym_SYMBOL_bracket)) {
+                symbolOffset
+                    += m_doc->GetGlyphHeight(SMUFL_E003_bracketTop, 100, false) + m_doc->GetDrawingUnit(100) / 6;
+            }
+            // hardcoded offset for the mNum based on the lyric font size
+            const int yOffset = m_doc->GetDrawingLyricFont(60)->GetPointSize();
+            this->DrawMNum(dc, mnum, measure, system, std::max(symbolOffset, yOffset));
+        }
+    }
+}
+
+void View::DrawMeasureStaves(DeviceContext *dc, Measure *measure, System *system)
+{
+    assert(dc);
+    assert(measure);
+    assert(system);
+
+    dc->StartGraphic(measure, "", measure->GetID());
+
+    for (Object *current : measure->GetChildren()) {
+        // The staves come first (see DrawMeasures)
+        if (!current->Is(STAFF)) break;
+        // cast to Staff check in DrawStaff
+        this->DrawStaff(dc, vrv_cast<Staff *>(current), measure, system);
+    }
+
+    dc->EndGraphic(measure, this);
+}
+
+void View::DrawMeasureBarLines(DeviceContext *dc, Measure *measure, System *system)
+{
+    assert(dc);
+    assert(measure);
+    assert(system);
+
+    if ((measure->GetDrawingLeftBarLine() != BARRENDITION_NONE) || measure->HasInvisibleStaffBarlines()) {
+        this->DrawScoreDef(dc, system->GetDrawingScoreDef(), measure, measure->GetLeftBarLine()->GetDrawingX(),
+            measure->GetLeftBarLine());
+    }
+    if ((measure->GetDrawingRightBarLine() != BARRENDITION_NONE) || measure->HasInvisibleStaffBarlines()) {
+        this->DrawScoreDef(dc, system->GetDrawingScoreDef(), measure, measure->GetRightBarLine()->GetDrawingX(),
+            measure->GetRightBarLine(), measure->IsLastInSystem(), system->IsLastOfMdiv());
+    }
+}
+
 void View::DrawMeterSigGrp(DeviceContext *dc, Layer *layer, Staff *staff)
 {
     assert(dc);
@@ -1278,7 +1383,7 @@ void View::DrawStaff(DeviceContext *dc, Staff *staff, Measure *measure, System *
     this->DrawStaffDefCautionary(dc, staff, measure);
 
     for (Object *spanningElement : staff->m_timeSpanningElements) {
-        system->AddToDrawingListIfNecessary(spanningElement);
+        this->AddToSystemDrawingList(system, spanningElement);
     }
 
     dc->EndGraphic(staff, this);
@@ -1535,13 +1640,13 @@ void View::DrawLayerList(DeviceContext *dc, Layer *layer, Staff *staff, Measure
     assert(staff);
     assert(measure);
 
-    ArrayOfObjects *drawingList = layer->GetDrawingList();
+    const ArrayOfObjects &drawingList = layer->GetDrawingListByClassId(classId);
 
-    for (Object *object : *drawingList) {
-        if (object->Is(classId) && (classId == TUPLET_BRACKET)) {
+    for (Object *object : drawingList) {
+        if (classId == TUPLET_BRACKET) {
             this->DrawTupletBracket(dc, dynamic_cast<LayerElement *>(object), layer, staff, measure);
         }
-        if (object->Is(classId) && (classId == TUPLET_NUM)) {
+        if (classId == TUPLET_NUM) {
             this->DrawTupletNum(dc, dynamic_cast<LayerElement *>(object), layer, staff, measure);
         }
     }
@@ -1612,6 +1717,35 @@ void View::DrawSystemDivider(DeviceContext *dc, System *system, Measure *firstMe
     }
 }
 
+void View::CalcBeamSpanSegments(Object *parent, System *system)
+{
+    assert(parent);
+    assert(system);
+
+    ListOfObjects objects = parent->FindAllDescendantsByType(BEAMSPAN, false);
+    for (Object *element : objects) {
+        BeamSpan *beamSpan = vrv_cast<BeamSpan *>(element);
+        BeamSpanSegment *segment = beamSpan->GetSegmentForSystem(system);
+        if (segment) {
+            segment->CalcBeam(segment->GetLayer(), segment->GetStaff(), m_doc, beamSpan, beamSpan->m_drawingPlace);
+        }
+    }
+}
+
+void View::AddToSystemDrawingList(System *system, Object *object)
+{
+    assert(system);
+    assert(object);
+
+    // The drawing list of the system is shared by the measures drawn in parallel
+    if (m_postponedSystemObjects) {
+        m_postponedSystemObjects->push_back(object);
+        return;
+    }
+
+    system->AddToDrawingListIfNecessary(object);
+}
+
 //----------------------------------------------------------------------------
 // View - Children
 //----------------------------------------------------------------------------
@@ -1622,13 +1756,19 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
     assert(parent);
     assert(system);
 
+    // Consecutive measures are drawn together, so that their staves can be drawn in parallel
+    std::vector<Measure *> measures;
     for (Object *current : parent->GetChildren()) {
         if (current->Is(MEASURE)) {
-            // cast to Measure check in DrawMeasure
-            this->DrawMeasure(dc, vrv_cast<Measure *>(current), system);
+            // cast to Measure check in DrawMeasures
+            measures.push_back(vrv_cast<Measure *>(current));
+            continue;
         }
+        this->DrawMeasures(dc, measures, system);
+        measures.clear();
+
         // scoreDef are not drawn directly, but anything else should not be possible
-        else if (current->Is(SCOREDEF)) {
+        if (current->Is(SCOREDEF)) {
             // nothing to do, then
             ScoreDef *scoreDef = vrv_cast<ScoreDef *>(current);
             assert(scoreDef);
@@ -1656,6 +1796,7 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
             assert(false);
         }
     }
+    this->DrawMeasures(dc, measures, system);
 }
 
 void View::DrawMeasureChildren(DeviceContext *dc, Object *parent, Measure *measure, System *system)
@@ -1665,14 +1806,7 @@ void View::DrawMeasureChildren(DeviceContext *dc, Object *parent, Measure *measu
     assert(measure);
     assert(system);
 
-    ListOfObjects objects = parent->FindAllDescendantsByType(BEAMSPAN, false);
-    for (Object *element : objects) {
-        BeamSpan *beamSpan = vrv_cast<BeamSpan *>(element);
-        BeamSpanSegment *segment = beamSpan->GetSegmentForSystem(system);
-        if (segment) {
-            segment->CalcBeam(segment->GetLayer(), segment->GetStaff(), m_doc, beamSpan, beamSpan->m_drawingPlace);
-        }
-    }
+    this->CalcBeamSpanSegments(parent, system);
 
     for (Object *current : parent->GetChildren()) {
         if (current->Is(STAFF)) {
@@ -1688,7 +1822,7 @@ void View::DrawMeasureChildren(DeviceContext *dc, Object *parent, Measure *measu
             this->DrawMeasureEditorialElement(dc, dynamic_cast<EditorialElement *>(current), measure, system);
         }
         else {
-            LogDebug("Current is %s", current->GetClassName().c_str());
+            VRV_LOG_DEBUG("Current is %s", current->GetClassName().c_str());
             assert(false);
         }
     }
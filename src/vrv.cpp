@@ -9,13 +9,18 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <condition_variable>
 #include <cstdlib>
 #include <iostream>
 #include <locale>
+#include <mutex>
 #include <regex>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #ifndef _WIN32
@@ -68,7 +73,16 @@ LogLevel logLevel = LOG_WARNING;
 /** By default log to stderr or JS console */
 bool loggingToBuffer = false;
 
-std::vector<std::string> logBuffer;
+/** The maximum number of log entries buffered, in total and for a same code */
+#define LOG_SINK_MAX_ENTRIES 1000
+#define LOG_SINK_MAX_CODE_ENTRIES 50
+
+/** The sink of the current thread and the one used when none is set */
+thread_local std::weak_ptr<LogSink> threadLogSink;
+std::shared_ptr<LogSink> defaultLogSink = std::make_shared<LogSink>();
+
+/** Serialize the logging when jobs are run in parallel */
+std::mutex logMutex;
 
 void LogElapsedTimeStart()
 {
@@ -82,7 +96,58 @@ void LogElapsedTimeStop(const char *msg)
     gettimeofday(&end, NULL);
     elapsedTime = (end.tv_sec - start.tv_sec) * 1000.0; // sec to ms
     elapsedTime += (end.tv_usec - start.tv_usec) / 1000.0; // us to ms
-    LogInfo("Elapsed time (%s): %.3fs", msg, elapsedTime / 1000);
+    VRV_LOG_INFO("Elapsed time (%s): %.3fs", msg, elapsedTime / 1000);
+}
+
+/**
+ * Format and log a message once the level has been checked
+ */
+static void LogMessageVariable(LogLevel level, const std::string &id, const char *fmt, va_list args)
+{
+    if (loggingToBuffer) {
+        // FNV-1a hash of the format string
+        uint32_t code = 2166136261u;
+        for (const char *c = fmt; *c; ++c) {
+            code = (code ^ (unsigned char)*c) * 16777619u;
+        }
+        std::shared_ptr<LogSink> sink = GetLogSink();
+        // Do not format messages that will be dropped anyway
+        if (!sink->CanAdd(code)) return;
+
+        sink->Add({ level, code, id, StringFormatVariable(fmt, args) });
+        return;
+    }
+
+    const std::string message = LogLevelPrefix(level) + StringFormatVariable(fmt, args) + "\n";
+
+    std::lock_guard<std::mutex> lock(logMutex);
+#ifdef __EMSCRIPTEN__
+    switch (level) {
+        case LOG_DEBUG: EM_ASM_ARGS({ console.debug(UTF8ToString($0)); }, message.c_str()); break;
+        case LOG_ERROR: EM_ASM_ARGS({ console.error(UTF8ToString($0)); }, message.c_str()); break;
+        case LOG_WARNING: EM_ASM_ARGS({ console.warn(UTF8ToString($0)); }, message.c_str()); break;
+        case LOG_INFO: EM_ASM_ARGS({ console.info(UTF8ToString($0)); }, message.c_str()); break;
+        default: EM_ASM_ARGS({ console.log(UTF8ToString($0)); }, message.c_str()); break;
+    }
+#elif defined ANDROID
+    switch (level) {
+        case LOG_DEBUG: android_log_puts(ANDROID_LOG_DEBUG, message.c_str()); break;
+        case LOG_ERROR: android_log_puts(ANDROID_LOG_ERROR, message.c_str()); break;
+        case LOG_WARNING: android_log_puts(ANDROID_LOG_WARN, message.c_str()); break;
+        case LOG_INFO:
+        default: android_log_puts(ANDROID_LOG_INFO, message.c_str()); break;
+    }
+#else
+    fputs(message.c_str(), stderr);
+#endif
+}
+
+void LogMessage(LogLevel level, const std::string &id, const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    LogMessageVariable(level, id, fmt, args);
+    va_end(args);
 }
 
 void LogDebug(const char *fmt, ...)
@@ -90,11 +155,9 @@ void LogDebug(const char *fmt, ...)
     if (logLevel < LOG_DEBUG) return;
 
 #if defined(DEBUG)
-    std::string s;
     va_list args;
     va_start(args, fmt);
-    s = "[Debug] " + StringFormatVariable(fmt, args) + "\n";
-    LogString(s, LOG_DEBUG);
+    LogMessageVariable(LOG_DEBUG, "", fmt, args);
     va_end(args);
 #endif
 }
@@ -103,11 +166,9 @@ void LogError(const char *fmt, ...)
 {
     if (logLevel < LOG_ERROR) return;
 
-    std::string s;
     va_list args;
     va_start(args, fmt);
-    s = "[Error] " + StringFormatVariable(fmt, args) + "\n";
-    LogString(s, LOG_ERROR);
+    LogMessageVariable(LOG_ERROR, "", fmt, args);
     va_end(args);
 }
 
@@ -115,11 +176,9 @@ void LogInfo(const char *fmt, ...)
 {
     if (logLevel < LOG_INFO) return;
 
-    std::string s;
     va_list args;
     va_start(args, fmt);
-    s = "[Info] " + StringFormatVariable(fmt, args) + "\n";
-    LogString(s, LOG_INFO);
+    LogMessageVariable(LOG_INFO, "", fmt, args);
     va_end(args);
 }
 
@@ -127,41 +186,125 @@ void LogWarning(const char *fmt, ...)
 {
     if (logLevel < LOG_WARNING) return;
 
-    std::string s;
     va_list args;
     va_start(args, fmt);
-    s = "[Warning] " + StringFormatVariable(fmt, args) + "\n";
-    LogString(s, LOG_WARNING);
+    LogMessageVariable(LOG_WARNING, "", fmt, args);
     va_end(args);
 }
 
-void LogString(std::string message, LogLevel level)
+void LogElementError(const std::string &id, const char *fmt, ...)
 {
-    if (loggingToBuffer) {
-        if (LogBufferContains(message)) return;
-        logBuffer.push_back(message);
+    if (logLevel < LOG_ERROR) return;
+
+    va_list args;
+    va_start(args, fmt);
+    LogMessageVariable(LOG_ERROR, id, fmt, args);
+    va_end(args);
+}
+
+void LogElementWarning(const std::string &id, const char *fmt, ...)
+{
+    if (logLevel < LOG_WARNING) return;
+
+    va_list args;
+    va_start(args, fmt);
+    LogMessageVariable(LOG_WARNING, id, fmt, args);
+    va_end(args);
+}
+
+const char *LogLevelPrefix(LogLevel level)
+{
+    switch (level) {
+        case LOG_ERROR: return "[Error] ";
+        case LOG_WARNING: return "[Warning] ";
+        case LOG_INFO: return "[Info] ";
+        case LOG_DEBUG: return "[Debug] ";
+        default: return "";
     }
-    else {
-#ifdef __EMSCRIPTEN__
-        switch (level) {
-            case LOG_DEBUG: EM_ASM_ARGS({ console.debug(UTF8ToString($0)); }, message.c_str()); break;
-            case LOG_ERROR: EM_ASM_ARGS({ console.error(UTF8ToString($0)); }, message.c_str()); break;
-            case LOG_WARNING: EM_ASM_ARGS({ console.warn(UTF8ToString($0)); }, message.c_str()); break;
-            case LOG_INFO: EM_ASM_ARGS({ console.info(UTF8ToString($0)); }, message.c_str()); break;
-            default: EM_ASM_ARGS({ console.log(UTF8ToString($0)); }, message.c_str()); break;
-        }
-#elif defined ANDROID
-        switch (level) {
-            case LOG_DEBUG: android_log_puts(ANDROID_LOG_DEBUG, message.c_str()); break;
-            case LOG_ERROR: android_log_puts(ANDROID_LOG_ERROR, message.c_str()); break;
-            case LOG_WARNING: android_log_puts(ANDROID_LOG_WARN, message.c_str()); break;
-            case LOG_INFO:
-            default: android_log_puts(ANDROID_LOG_INFO, message.c_str()); break;
-        }
-#else
-        fputs(message.c_str(), stderr);
-#endif
+}
+
+void SetLogSink(const std::shared_ptr<LogSink> &sink)
+{
+    threadLogSink = sink;
+}
+
+std::shared_ptr<LogSink> GetLogSink()
+{
+    std::shared_ptr<LogSink> sink = threadLogSink.lock();
+    return (sink) ? sink : defaultLogSink;
+}
+
+//----------------------------------------------------------------------------
+// LogSink
+//----------------------------------------------------------------------------
+
+bool LogSink::CanAdd(uint32_t code)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto iter = m_codeCounts.find(code);
+    const int count = (iter != m_codeCounts.end()) ? iter->second : 0;
+    if ((m_entries.size() >= LOG_SINK_MAX_ENTRIES) || (count >= LOG_SINK_MAX_CODE_ENTRIES)) {
+        ++m_dropped;
+        return false;
+    }
+    return true;
+}
+
+void LogSink::Add(LogEntry &&entry)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Check the duplicates first since they do not count towards the limits
+    std::string line = LogLevelPrefix(entry.m_level) + entry.m_message;
+    if (m_lines.count(line)) return;
+
+    int &count = m_codeCounts[entry.m_code];
+    if ((m_entries.size() >= LOG_SINK_MAX_ENTRIES) || (count >= LOG_SINK_MAX_CODE_ENTRIES)) {
+        ++m_dropped;
+        return;
     }
+    ++count;
+    m_lines.insert(std::move(line));
+    m_entries.push_back(std::move(entry));
+}
+
+void LogSink::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_entries.clear();
+    m_lines.clear();
+    m_codeCounts.clear();
+    m_dropped = 0;
+}
+
+std::vector<LogEntry> LogSink::GetEntries() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_entries;
+}
+
+int LogSink::GetDropped() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_dropped;
+}
+
+std::string LogSink::GetString() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::string str;
+    for (const LogEntry &entry : m_entries) {
+        str += LogLevelPrefix(entry.m_level) + entry.m_message + "\n";
+    }
+    if (m_dropped > 0) {
+        str += StringFormat("%s%d more messages were not logged\n", LogLevelPrefix(LOG_WARNING), m_dropped);
+    }
+    return str;
 }
 
 LogLevel StrToLogLevel(const std::string &level)
@@ -172,16 +315,19 @@ LogLevel StrToLogLevel(const std::string &level)
     if (level == "info") return LOG_INFO;
     if (level == "debug") return LOG_DEBUG;
 
-    LogWarning("Unkown log level '%s' (warning is default)", level.c_str());
+    VRV_LOG_WARNING("Unkown log level '%s' (warning is default)", level.c_str());
     return LOG_WARNING;
 }
 
-bool LogBufferContains(const std::string &s)
+std::string LogLevelToStr(LogLevel level)
 {
-    for (const std::string &logStr : logBuffer) {
-        if (logStr == s) return true;
+    switch (level) {
+        case LOG_ERROR: return "error";
+        case LOG_WARNING: return "warning";
+        case LOG_INFO: return "info";
+        case LOG_DEBUG: return "debug";
+        default: return "off";
     }
-    return false;
 }
 
 bool Check(Object *object)
@@ -459,6 +605,130 @@ std::string ToCamelCase(const std::string &s)
     return result;
 }
 
+//----------------------------------------------------------------------------
+// Parallel processing
+//----------------------------------------------------------------------------
+
+/** Set for the threads running parallel jobs, so that nested jobs are run in order */
+thread_local bool runningParallelJobs = false;
+
+/**
+ * A pool of threads kept alive between runs of parallel jobs.
+ * Only one run is processed at a time and the calling thread takes part in it.
+ */
+class JobPool {
+public:
+    JobPool() = default;
+    ~JobPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wakeUp.notify_all();
+        for (std::thread &thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    static JobPool &GetInstance()
+    {
+        static JobPool pool;
+        return pool;
+    }
+
+    void Run(int count, int threadCount, const std::function<void(int)> &job)
+    {
+        std::lock_guard<std::mutex> runLock(m_runMutex);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            while ((int)m_threads.size() < threadCount - 1) {
+                m_threads.emplace_back(&JobPool::Work, this, (int)m_threads.size());
+            }
+            m_job = &job;
+            m_count = count;
+            m_next = 0;
+            m_workers = threadCount - 1;
+            m_running = m_workers;
+            // The jobs log to the sink of the calling thread
+            m_sink = GetLogSink();
+            ++m_run;
+        }
+        m_wakeUp.notify_all();
+
+        for (int i = m_next++; i < count; i = m_next++) {
+            job(i);
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return (m_running == 0); });
+        m_job = NULL;
+        m_sink.reset();
+    }
+
+private:
+    void Work(int index)
+    {
+        runningParallelJobs = true;
+        int run = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_wakeUp.wait(lock, [this, run]() { return (m_stop || (m_run != run)); });
+            if (m_stop) return;
+            run = m_run;
+            // Threads beyond the count of the run stay idle
+            if (index >= m_workers) continue;
+
+            const std::function<void(int)> *job = m_job;
+            const int count = m_count;
+            SetLogSink(m_sink);
+            lock.unlock();
+            for (int i = m_next++; i < count; i = m_next++) {
+                (*job)(i);
+            }
+            lock.lock();
+            SetLogSink(NULL);
+            if (--m_running == 0) m_done.notify_all();
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+    /** Held for the duration of a run */
+    std::mutex m_runMutex;
+    /** Guards the state of the current run */
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;
+    std::condition_variable m_done;
+    /** The current run, its job and the number of threads of the pool taking part in it */
+    int m_run = 0;
+    const std::function<void(int)> *m_job = NULL;
+    int m_count = 0;
+    std::atomic<int> m_next = 0;
+    int m_workers = 0;
+    int m_running = 0;
+    std::shared_ptr<LogSink> m_sink;
+    bool m_stop = false;
+};
+
+void RunParallelJobs(int count, int threadCount, const std::function<void(int)> &job)
+{
+#ifdef __EMSCRIPTEN__
+    threadCount = 1;
+#endif
+    threadCount = std::min(threadCount, count);
+    // Jobs started from a parallel job are run in order on its thread
+    if ((threadCount <= 1) || runningParallelJobs) {
+        for (int i = 0; i < count; ++i) {
+            job(i);
+        }
+        return;
+    }
+
+    runningParallelJobs = true;
+    JobPool::GetInstance().Run(count, threadCount, job);
+    runningParallelJobs = false;
+}
+
 //----------------------------------------------------------------------------
 // Notation type checks
 //----------------------------------------------------------------------------
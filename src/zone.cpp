@@ -47,6 +47,8 @@ void Zone::ShiftByXY(int xDiff, int yDiff)
     this->SetLrx(this->GetLrx() + xDiff);
     this->SetUly(this->GetUly() + yDiff);
     this->SetLry(this->GetLry() + yDiff);
+    // For the extents cached by the facsimile
+    this->Modify();
 }
 
 int Zone::GetLogicalUly() const
@@ -0,0 +1,67 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test.h
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_TEST_H__
+#define __VRV_TEST_H__
+
+#include <functional>
+#include <string>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+namespace test {
+
+    /**
+     * Register a test case in a group.
+     * The test cases of a group are run with `verovio-tests <group>`.
+     */
+    int RegisterTest(const std::string &group, const std::string &name, const std::function<void()> &test);
+
+    /**
+     * Report a failed check. The test case carries on and fails at the end.
+     */
+    void ReportFailure(const char *file, int line, const std::string &message);
+
+    /**
+     * Return the path of the test data and of the Verovio resources
+     */
+    ///@{
+    std::string GetDataPath(const std::string &filename);
+    std::string GetResourcePath();
+    ///@}
+
+    /**
+     * Read a file in the test data directory
+     */
+    std::string ReadDataFile(const std::string &filename);
+
+} // namespace test
+
+} // namespace vrv
+
+//----------------------------------------------------------------------------
+// Macros for defining the test cases and checking the results
+//----------------------------------------------------------------------------
+
+#define VRV_TEST(group, name)                                                                                          \
+    static void vrvTest_##group##_##name();                                                                            \
+    static int vrvTestRegistered_##group##_##name                                                                      \
+        = vrv::test::RegisterTest(#group, #name, vrvTest_##group##_##name);                                            \
+    static void vrvTest_##group##_##name()
+
+#define VRV_CHECK(expr)                                                                                                \
+    do {                                                                                                               \
+        if (!(expr)) vrv::test::ReportFailure(__FILE__, __LINE__, #expr);                                             \
+    } while (0)
+
+#define VRV_CHECK_EQUAL(left, right)                                                                                   \
+    do {                                                                                                               \
+        if (!((left) == (right))) vrv::test::ReportFailure(__FILE__, __LINE__, #left " == " #right);                  \
+    } while (0)
+
+#endif // __VRV_TEST_H__
@@ -0,0 +1,89 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test_benchmark.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+
+//----------------------------------------------------------------------------
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+//----------------------------------------------------------------------------
+
+#include "doc.h"
+#include "iopae.h"
+#include "toolkit.h"
+
+//----------------------------------------------------------------------------
+
+using namespace vrv;
+
+// The benchmarks are not part of the test suite and are run with `verovio-tests benchmark`.
+// They print the timings, which can be compared between two builds.
+
+VRV_TEST(benchmark, SvgOutput)
+{
+    Toolkit toolkit;
+    toolkit.SetOptions("{\"xmlIdSeed\": 1}");
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("layout.mei")));
+    const int pageCount = toolkit.GetPageCount();
+
+    // Lay out the pages once so only the SVG output is timed, which includes the formatting of the path, points and
+    // transform attribute values (see SvgDeviceContext::FormatToBuffer)
+    std::string svg;
+    for (int page = 1; page <= pageCount; ++page) {
+        svg = toolkit.RenderToSVG(page);
+    }
+
+    const int rounds = 200;
+    size_t size = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        for (int page = 1; page <= pageCount; ++page) {
+            size += toolkit.RenderToSVG(page).size();
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    VRV_CHECK(size > 0);
+
+    const double perPage = std::chrono::duration<double, std::micro>(end - start).count() / (rounds * pageCount);
+    std::cout << "SVG output: " << perPage << " us per page (" << pageCount << " pages, " << rounds << " rounds)"
+              << std::endl;
+}
+
+#ifndef NO_PAE_SUPPORT
+VRV_TEST(benchmark, PaeImport)
+{
+    // The incipits of the PAE documentation
+    std::vector<std::string> incipits;
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(test::GetDataPath("../../doc/tests/pae"))) {
+        if (entry.path().extension() != ".pae") continue;
+        std::ifstream file(entry.path(), std::ios::binary);
+        incipits.push_back(std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+    }
+    VRV_CHECK(!incipits.empty());
+
+    // Only the import is timed (see PAEInput::Import), without the layout done by the toolkit
+    Doc doc;
+    const int rounds = 200;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        for (const std::string &incipit : incipits) {
+            PAEInput input(&doc);
+            input.Import(incipit);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    const double perIncipit
+        = std::chrono::duration<double, std::micro>(end - start).count() / (rounds * incipits.size());
+    std::cout << "PAE import: " << perIncipit << " us per incipit (" << incipits.size() << " incipits, " << rounds
+              << " rounds)" << std::endl;
+}
+#endif
@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test_corpus.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+
+//----------------------------------------------------------------------------
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "toolkit.h"
+
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+
+//----------------------------------------------------------------------------
+
+using namespace vrv;
+
+namespace {
+
+/**
+ * Extract the features of the files with the number of threads and return the binary output
+ */
+std::string ExtractFeatures(const std::vector<std::string> &filenames, int threads)
+{
+    // A unique name, since the tests can be run in parallel with each other
+    std::random_device random;
+    std::filesystem::path output;
+    do {
+        output = std::filesystem::temp_directory_path()
+            / ("verovio-tests-" + std::to_string(random()) + "-" + std::to_string(threads) + ".bin");
+    } while (std::filesystem::exists(output));
+    std::string inputs;
+    for (const std::string &filename : filenames) {
+        inputs += (inputs.empty() ? "\"" : ", \"") + test::GetDataPath(filename) + "\"";
+    }
+
+    Toolkit toolkit;
+    const std::string result = toolkit.ExtractCorpusFeatures("{\"inputs\": [" + inputs + "], \"output\": \""
+        + output.string() + "\", \"threads\": " + std::to_string(threads) + "}");
+    jsonxx::Object resultObj;
+    VRV_CHECK(resultObj.parse(result));
+    VRV_CHECK(resultObj.has<jsonxx::Array>("failed") && (resultObj.get<jsonxx::Array>("failed").size() == 0));
+
+    std::ifstream file(output, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    file.close();
+    std::filesystem::remove(output);
+    return content.str();
+}
+
+/**
+ * Return the files of the corpus, without the formats that are not supported by the build
+ */
+std::vector<std::string> GetCorpus()
+{
+    // The formats are mixed, with files of the same format next to each other
+    const std::vector<std::string> corpus = { "corpus/dmajor.abc", "corpus/cmajor.abc", "corpus/chorale.krn",
+        "corpus/beams.pae", "corpus/keys.pae", "corpus/minuet.musicxml", "layout.mei", "crossstaff.mei",
+        "corpus/cmajor.abc", "corpus/chorale.krn", "corpus/dmajor.abc", "corpus/minuet.musicxml" };
+
+    std::vector<std::string> filenames;
+    for (const std::string &filename : corpus) {
+#ifdef NO_ABC_SUPPORT
+        if (filename.ends_with(".abc")) continue;
+#endif
+#ifdef NO_HUMDRUM_SUPPORT
+        if (filename.ends_with(".krn")) continue;
+#endif
+#ifdef NO_MUSICXML_SUPPORT
+        if (filename.ends_with(".musicxml")) continue;
+#endif
+#ifdef NO_PAE_SUPPORT
+        if (filename.ends_with(".pae")) continue;
+#endif
+        filenames.push_back(filename);
+    }
+    return filenames;
+}
+
+} // namespace
+
+VRV_TEST(corpus, SameWithThreads)
+{
+    const std::vector<std::string> corpus = GetCorpus();
+    const std::string features = ExtractFeatures(corpus, 1);
+    VRV_CHECK(!features.empty());
+    for (int threads : { 2, 4, 8 }) {
+        VRV_CHECK(ExtractFeatures(corpus, threads) == features);
+    }
+}
+
+#ifndef NO_ABC_SUPPORT
+
+VRV_TEST(corpus, NoStateAcrossFiles)
+{
+    // The key signature of the previous ABC file does not alter the pitches
+    const std::string cmajor = ExtractFeatures({ "corpus/cmajor.abc" }, 1);
+    ExtractFeatures({ "corpus/dmajor.abc" }, 1);
+    VRV_CHECK(ExtractFeatures({ "corpus/cmajor.abc" }, 1) == cmajor);
+}
+
+#endif // NO_ABC_SUPPORT
@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test_editor.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+
+//----------------------------------------------------------------------------
+
+#include "toolkit.h"
+
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+
+//----------------------------------------------------------------------------
+
+// The neume editor is only available without Humdrum support
+#ifdef NO_HUMDRUM_SUPPORT
+
+using namespace vrv;
+
+namespace {
+
+void LoadNeumes(Toolkit &toolkit)
+{
+    toolkit.SetResourcePath(test::GetResourcePath());
+    toolkit.SetOptions("{\"useFacsimile\": true, \"xmlIdSeed\": 1}");
+    toolkit.LoadData(test::ReadDataFile("neume.mei"));
+    toolkit.RenderToSVG(1);
+}
+
+// Return the @n of the system begin in which an element is encoded
+std::string GetSbN(const std::string &mei, const std::string &id)
+{
+    size_t position = mei.find("xml:id=\"" + id + "\"");
+    if (position == std::string::npos) return "";
+    size_t sb = mei.rfind("<sb ", position);
+    if (sb == std::string::npos) return "";
+    size_t n = mei.find(" n=\"", sb);
+    if (n == std::string::npos) return "";
+    n += 4;
+    return mei.substr(n, mei.find('"', n) - n);
+}
+
+std::string Insert(Toolkit &toolkit, const std::string &elementType, int ulx, int uly,
+    const jsonxx::Object &attributes = jsonxx::Object())
+{
+    jsonxx::Object param;
+    param << "attributes" << attributes;
+    param << "elementType" << elementType;
+    param << "staffId"
+          << "auto";
+    param << "ulx" << ulx;
+    param << "uly" << uly;
+    jsonxx::Object action;
+    action << "action"
+           << "insert";
+    action << "param" << param;
+    if (!toolkit.Edit(action.json())) return "";
+    jsonxx::Object info;
+    info.parse(toolkit.EditInfo());
+    return info.get<jsonxx::String>("uuid", "");
+}
+
+} // namespace
+
+VRV_TEST(editor, InsertInClosestStaff)
+{
+    Toolkit toolkit(false);
+    LoadNeumes(toolkit);
+
+    // The staves are 200 high and start at 200, 600 and 1000, so the middles between them are at 500 and 900
+    const std::vector<std::pair<int, std::string>> positions = { { 150, "1" }, { 250, "1" }, { 450, "1" },
+        { 550, "2" }, { 700, "2" }, { 880, "2" }, { 920, "3" }, { 1100, "3" }, { 1350, "3" } };
+    for (const auto &position : positions) {
+        const std::string id = Insert(toolkit, "nc", 500, position.first);
+        VRV_CHECK(!id.empty());
+        VRV_CHECK_EQUAL(GetSbN(toolkit.GetMEI(), id), position.second);
+    }
+}
+
+VRV_TEST(editor, InsertInClosestNeume)
+{
+    Toolkit toolkit(false);
+    LoadNeumes(toolkit);
+
+    // A new divLine is a child of the layer and is moved to the syllable of the closest neume
+    jsonxx::Object attributes;
+    attributes << "form"
+               << "virgula";
+    const std::string id = Insert(toolkit, "divLine", 850, 670, attributes);
+    VRV_CHECK(!id.empty());
+    if (id.empty()) return;
+
+    jsonxx::Object param;
+    param << "elementId" << id;
+    jsonxx::Object action;
+    action << "action"
+           << "insertToSyllable";
+    action << "param" << param;
+    VRV_CHECK(toolkit.Edit(action.json()));
+    const std::string mei = toolkit.GetMEI();
+    VRV_CHECK_EQUAL(GetSbN(mei, id), "2");
+    // The closest neume is the second one of the staff
+    VRV_CHECK(mei.rfind("<syllable", mei.find("xml:id=\"" + id + "\"")) == mei.find("<syllable xml:id=\"sy1_1\""));
+}
+
+#endif // NO_HUMDRUM_SUPPORT
@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test_facsimile.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+
+//----------------------------------------------------------------------------
+
+#include "facsimile.h"
+#include "surface.h"
+#include "zone.h"
+
+//----------------------------------------------------------------------------
+
+using namespace vrv;
+
+namespace {
+
+Facsimile *CreateFacsimile(int zoneCount)
+{
+    Facsimile *facsimile = new Facsimile();
+    Surface *surface = new Surface();
+    surface->SetID("surface");
+    for (int i = 0; i < zoneCount; ++i) {
+        Zone *zone = new Zone();
+        zone->SetID("zone-" + std::to_string(i));
+        zone->SetUlx(i * 10);
+        zone->SetUly(0);
+        zone->SetLrx(i * 10 + 10);
+        zone->SetLry(100);
+        surface->AddChild(zone);
+    }
+    facsimile->AddChild(surface);
+    return facsimile;
+}
+
+} // namespace
+
+VRV_TEST(facsimile, FindWithAndWithoutIndex)
+{
+    Facsimile *facsimile = CreateFacsimile(10);
+
+    VRV_CHECK(facsimile->FindZoneByID("zone-3"));
+    VRV_CHECK(!facsimile->FindZoneByID("zone-10"));
+    VRV_CHECK(!facsimile->FindZoneByID("surface"));
+    VRV_CHECK(facsimile->FindIndexedDescendantByID("surface"));
+
+    facsimile->IndexDescendants();
+    Zone *zone = facsimile->FindZoneByID("zone-3");
+    VRV_CHECK(zone && (zone->GetID() == "zone-3"));
+    VRV_CHECK(!facsimile->FindZoneByID("zone-10"));
+    VRV_CHECK(facsimile->FindIndexedDescendantByID("surface"));
+    facsimile->ClearIndex();
+
+    delete facsimile;
+}
+
+VRV_TEST(facsimile, ChangesBetweenSessions)
+{
+    Facsimile *facsimile = CreateFacsimile(10);
+    Surface *surface = vrv_cast<Surface *>(facsimile->GetFirst(SURFACE));
+
+    facsimile->IndexDescendants();
+    VRV_CHECK(facsimile->FindZoneByID("zone-5"));
+    facsimile->ClearIndex();
+
+    // Detach and delete a zone
+    Object *zone5 = surface->DetachChild(5);
+    delete zone5;
+    VRV_CHECK(!facsimile->FindZoneByID("zone-5"));
+
+    // Change the ID of a zone
+    Zone *zone6 = facsimile->FindZoneByID("zone-6");
+    VRV_CHECK(zone6);
+    zone6->SetID("zone-60");
+    facsimile->IndexDescendants();
+    VRV_CHECK(!facsimile->FindZoneByID("zone-5"));
+    VRV_CHECK(!facsimile->FindZoneByID("zone-6"));
+    VRV_CHECK(facsimile->FindZoneByID("zone-60") == zone6);
+    facsimile->ClearIndex();
+
+    delete facsimile;
+}
+
+VRV_TEST(facsimile, Extents)
+{
+    Facsimile *facsimile = CreateFacsimile(10);
+    Surface *surface = vrv_cast<Surface *>(facsimile->GetFirst(SURFACE));
+    VRV_CHECK_EQUAL(facsimile->GetMaxX(), 100);
+    VRV_CHECK_EQUAL(facsimile->GetMaxY(), 100);
+
+    // Shifting a zone resets the cached extents
+    Zone *zone = facsimile->FindZoneByID("zone-9");
+    VRV_CHECK(zone);
+    zone->ShiftByXY(20, 50);
+    VRV_CHECK_EQUAL(facsimile->GetMaxX(), 120);
+    VRV_CHECK_EQUAL(facsimile->GetMaxY(), 150);
+
+    // Changes through the attribute setters need an explicit reset
+    zone->SetLrx(250);
+    zone->SetLry(300);
+    VRV_CHECK_EQUAL(facsimile->GetMaxX(), 120);
+    facsimile->ResetCachedExtents();
+    VRV_CHECK_EQUAL(facsimile->GetMaxX(), 250);
+    VRV_CHECK_EQUAL(facsimile->GetMaxY(), 300);
+
+    // Adding and removing a zone resets them too
+    Zone *added = new Zone();
+    added->SetLrx(400);
+    added->SetLry(500);
+    surface->AddChild(added);
+    VRV_CHECK_EQUAL(facsimile->GetMaxX(), 400);
+    VRV_CHECK_EQUAL(facsimile->GetMaxY(), 500);
+    surface->DeleteChild(added);
+    VRV_CHECK_EQUAL(facsimile->GetMaxX(), 250);
+    VRV_CHECK_EQUAL(facsimile->GetMaxY(), 300);
+
+    delete facsimile;
+}
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test_iomei.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+
+//----------------------------------------------------------------------------
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <regex>
+#include <sstream>
+
+//----------------------------------------------------------------------------
+
+#include "toolkit.h"
+
+//----------------------------------------------------------------------------
+
+using namespace vrv;
+
+namespace {
+
+/**
+ * Return the number of matches of the expression in the MEI
+ */
+int CountMatches(const std::string &mei, const std::string &expression)
+{
+    const std::regex regex(expression);
+    return (int)std::distance(std::sregex_iterator(mei.begin(), mei.end(), regex), std::sregex_iterator());
+}
+
+/**
+ * Remove the dates, since the header gets the date of the output
+ */
+std::string RemoveDates(const std::string &mei)
+{
+    static const std::regex date(" isodate=\"[^\"]*\"");
+    return std::regex_replace(mei, date, "");
+}
+
+/**
+ * Save the MEI to a file with the options and return its content
+ */
+std::string SaveFile(Toolkit &toolkit, const std::string &jsonOptions)
+{
+    // A unique name, since the tests can be run in parallel with each other
+    std::random_device random;
+    std::filesystem::path output;
+    do {
+        output = std::filesystem::temp_directory_path() / ("verovio-tests-" + std::to_string(random()) + ".mei");
+    } while (std::filesystem::exists(output));
+
+    VRV_CHECK(toolkit.SaveFile(output.string(), jsonOptions));
+    std::ifstream file(output, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    file.close();
+    std::filesystem::remove(output);
+    return content.str();
+}
+
+} // namespace
+
+VRV_TEST(iomei, Output)
+{
+    // The MEI is streamed measure by measure, and the output has to be a complete document
+    Toolkit toolkit;
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("layout.mei")));
+    for (const std::string options : { "{}", "{\"basic\": true}", "{\"scoreBased\": false}" }) {
+        const std::string mei = toolkit.GetMEI(options);
+        VRV_CHECK_EQUAL(CountMatches(mei, "<measure "), 24);
+        VRV_CHECK_EQUAL(CountMatches(mei, "</mei>\n$"), 1);
+        VRV_CHECK(RemoveDates(SaveFile(toolkit, options)) == RemoveDates(mei));
+
+        Toolkit reloaded;
+        VRV_CHECK(reloaded.LoadData(mei));
+        VRV_CHECK_EQUAL(CountMatches(reloaded.GetMEI(options), "<measure "), 24);
+    }
+
+    // The score-based output is read back as it was written
+    const std::string mei = toolkit.GetMEI();
+    Toolkit reloaded;
+    VRV_CHECK(reloaded.LoadData(mei));
+    VRV_CHECK(RemoveDates(reloaded.GetMEI()) == RemoveDates(mei));
+
+    toolkit.SetOptions("{\"outputFormatRaw\": true}");
+    const std::string raw = toolkit.GetMEI();
+    VRV_CHECK_EQUAL(CountMatches(raw, "<measure "), 24);
+    VRV_CHECK(raw.find('\n') == std::string::npos);
+}
+
+VRV_TEST(iomei, MeasureFilter)
+{
+    // Only the measures in the range are written, in their section
+    Toolkit toolkit;
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("layout.mei")));
+    const std::string mei = toolkit.GetMEI("{\"firstMeasure\": \"m5\", \"lastMeasure\": \"m8\"}");
+    VRV_CHECK_EQUAL(CountMatches(mei, "<measure "), 4);
+    for (const std::string id : { "m5", "m6", "m7", "m8" }) {
+        VRV_CHECK(mei.find("xml:id=\"" + id + "\"") != std::string::npos);
+    }
+    VRV_CHECK_EQUAL(CountMatches(mei, "<section"), CountMatches(mei, "</section>"));
+
+    Toolkit reloaded;
+    VRV_CHECK(reloaded.LoadData(mei));
+    VRV_CHECK_EQUAL(CountMatches(reloaded.GetMEI(), "<measure "), 4);
+}
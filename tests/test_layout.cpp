@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test_layout.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <regex>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "toolkit.h"
+
+//----------------------------------------------------------------------------
+
+using namespace vrv;
+
+namespace {
+
+/**
+ * Render all the pages of the file with the number of layout threads
+ */
+std::vector<std::string> RenderPages(const std::string &filename, int threads, const std::string &options = "{}")
+{
+    Toolkit toolkit;
+    toolkit.SetOptions(options);
+    // Seed the IDs for comparing the output of different toolkits and use the glyph sheet because the glyph
+    // <defs> of a page are ordered by address and have a per-render postfix
+    toolkit.SetOptions("{\"layoutThreads\": " + std::to_string(threads)
+        + ", \"xmlIdSeed\": 1, \"svgGlyphSheet\": true}");
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile(filename)));
+    std::vector<std::string> pages;
+    for (int page = 1; page <= toolkit.GetPageCount(); ++page) {
+        pages.push_back(toolkit.RenderToSVG(page));
+    }
+    return pages;
+}
+
+/**
+ * Remove the ids, since the systems and the scoreDef elements in them get new ids when the layout is redone
+ */
+std::string RemoveIDs(const std::string &svg)
+{
+    static const std::regex id(" id=\"[^\"]*\"");
+    return std::regex_replace(svg, id, "");
+}
+
+void CheckSameLayout(const std::string &filename, const std::string &options = "{}")
+{
+    const std::vector<std::string> pages = RenderPages(filename, 1, options);
+    VRV_CHECK(!pages.empty());
+    for (int threads : { 2, 4 }) {
+        const std::vector<std::string> threadPages = RenderPages(filename, threads, options);
+        VRV_CHECK_EQUAL(threadPages.size(), pages.size());
+        for (int i = 0; i < (int)std::min(pages.size(), threadPages.size()); ++i) {
+            VRV_CHECK(threadPages.at(i) == pages.at(i));
+        }
+    }
+}
+
+} // namespace
+
+VRV_TEST(layout, SameWithThreads)
+{
+    // Systems (ProcessSystems) and measures (ProcessMeasures) processed in parallel
+    CheckSameLayout("layout.mei");
+}
+
+VRV_TEST(layout, SameWithThreadsNarrow)
+{
+    // More systems per page, with extenders across systems
+    CheckSameLayout("layout.mei", "{\"pageWidth\": 1200, \"pageHeight\": 6000}");
+}
+
+VRV_TEST(layout, SameWithThreadsCrossStaff)
+{
+    CheckSameLayout("crossstaff.mei");
+}
+
+VRV_TEST(layout, RepeatedLayout)
+{
+    // The threads of the pool are reused across layouts and toolkits
+    Toolkit toolkit;
+    toolkit.SetOptions("{\"layoutThreads\": 4, \"svgGlyphSheet\": true}");
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("layout.mei")));
+    const std::string svg = RemoveIDs(toolkit.RenderToSVG(1));
+    for (int i = 0; i < 5; ++i) {
+        toolkit.RedoLayout();
+        VRV_CHECK(RemoveIDs(toolkit.RenderToSVG(1)) == svg);
+    }
+}
+
+VRV_TEST(layout, Progressive)
+{
+    // The content is laid out and cast off by chunks of measures as the pages are requested
+    // Seed the IDs since the ones of the spanning elements are in the class of the SVG elements
+    const std::string options
+        = "{\"pageWidth\": 1200, \"pageHeight\": 2000, \"xmlIdSeed\": 1, \"svgGlyphSheet\": true}";
+    Toolkit toolkit;
+    toolkit.SetOptions(options);
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("layout.mei")));
+    Toolkit progressiveToolkit;
+    progressiveToolkit.SetOptions(options);
+    progressiveToolkit.SetOptions("{\"progressiveLayout\": true}");
+    VRV_CHECK(progressiveToolkit.LoadData(test::ReadDataFile("layout.mei")));
+
+    const int pageCount = toolkit.GetPageCount();
+    VRV_CHECK(pageCount > 2);
+    for (int page = 1; page <= pageCount; ++page) {
+        VRV_CHECK(RemoveIDs(progressiveToolkit.RenderToSVG(page)) == RemoveIDs(toolkit.RenderToSVG(page)));
+    }
+    VRV_CHECK_EQUAL(progressiveToolkit.GetPageCount(), pageCount);
+}
+
+VRV_TEST(layout, ProgressiveRedoLayout)
+{
+    // Redoing the layout before the content is completely cast off, with the horizontal layout of the measures
+    // already cast off kept in cache - the layout is compared to the one redone with the cache without the
+    // progressive layout
+    // Seed the IDs since the ones of the spanning elements are in the class of the SVG elements
+    const std::string options
+        = "{\"pageWidth\": 1200, \"pageHeight\": 2000, \"xmlIdSeed\": 1, \"svgGlyphSheet\": true}";
+    Toolkit toolkit;
+    toolkit.SetOptions(options);
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("layout.mei")));
+    Toolkit progressiveToolkit;
+    progressiveToolkit.SetOptions(options);
+    progressiveToolkit.SetOptions("{\"progressiveLayout\": true}");
+    VRV_CHECK(progressiveToolkit.LoadData(test::ReadDataFile("layout.mei")));
+    progressiveToolkit.RenderToSVG(1);
+    progressiveToolkit.RedoLayout("{\"resetCache\": false}");
+    toolkit.RenderToSVG(1);
+    toolkit.RedoLayout("{\"resetCache\": false}");
+
+    const int pageCount = toolkit.GetPageCount();
+    for (int page = pageCount; page >= 1; --page) {
+        VRV_CHECK(RemoveIDs(progressiveToolkit.RenderToSVG(page)) == RemoveIDs(toolkit.RenderToSVG(page)));
+    }
+    VRV_CHECK_EQUAL(progressiveToolkit.GetPageCount(), pageCount);
+}
+
+VRV_TEST(layout, MeasureWindow)
+{
+    // Only the measures of the window are rendered, in a single system, and the cast off is not changed
+    Toolkit toolkit;
+    toolkit.SetOptions("{\"svgGlyphSheet\": true}");
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("layout.mei")));
+    const int pageCount = toolkit.GetPageCount();
+    const std::string page = toolkit.RenderToSVG(1);
+
+    const std::string svg = toolkit.RenderMeasureWindowToSVG("m5", "m8");
+    for (const std::string id : { "m5", "m6", "m7", "m8" }) {
+        VRV_CHECK(svg.find("id=\"" + id + "\"") != std::string::npos);
+    }
+    for (const std::string id : { "m4", "m9" }) {
+        VRV_CHECK(svg.find("id=\"" + id + "\"") == std::string::npos);
+    }
+    const std::regex system("class=\"system\"");
+    VRV_CHECK_EQUAL(std::distance(std::sregex_iterator(svg.begin(), svg.end(), system), std::sregex_iterator()), 1);
+
+    VRV_CHECK_EQUAL(toolkit.GetPageCount(), pageCount);
+    VRV_CHECK(toolkit.RenderToSVG(1) == page);
+}
+
+VRV_TEST(layout, GlyphSheet)
+{
+    // The sheet holds the glyphs of the pages rendered for the document loaded
+    Toolkit toolkit;
+    toolkit.SetOptions("{\"svgGlyphSheet\": true}");
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("layout.mei")));
+    VRV_CHECK(toolkit.RenderToSVGGlyphSheet().find("<symbol") == std::string::npos);
+    toolkit.RenderToSVG(1);
+    VRV_CHECK(toolkit.RenderToSVGGlyphSheet().find("<symbol") != std::string::npos);
+
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("crossstaff.mei")));
+    VRV_CHECK(toolkit.RenderToSVGGlyphSheet().find("<symbol") == std::string::npos);
+}
@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test_log.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+
+//----------------------------------------------------------------------------
+
+#include "vrv.h"
+
+//----------------------------------------------------------------------------
+
+using namespace vrv;
+
+VRV_TEST(log, DuplicatesDoNotCount)
+{
+    LogSink sink;
+    for (int i = 0; i < 100; ++i) {
+        VRV_CHECK(sink.CanAdd(1));
+        sink.Add({ LOG_WARNING, 1, "", "same message" });
+    }
+    VRV_CHECK_EQUAL(sink.GetEntries().size(), 1);
+    VRV_CHECK_EQUAL(sink.GetDropped(), 0);
+
+    // The duplicates did not use the quota of the code
+    for (int i = 0; i < 49; ++i) {
+        VRV_CHECK(sink.CanAdd(1));
+        sink.Add({ LOG_WARNING, 1, "", "message " + std::to_string(i) });
+    }
+    VRV_CHECK_EQUAL(sink.GetEntries().size(), 50);
+    VRV_CHECK_EQUAL(sink.GetDropped(), 0);
+}
+
+VRV_TEST(log, LimitPerCode)
+{
+    LogSink sink;
+    for (int i = 0; i < 60; ++i) {
+        if (!sink.CanAdd(1)) continue;
+        sink.Add({ LOG_WARNING, 1, "", "message " + std::to_string(i) });
+    }
+    // Another code has its own quota
+    sink.Add({ LOG_ERROR, 2, "id", "other message" });
+    VRV_CHECK_EQUAL(sink.GetEntries().size(), 51);
+    VRV_CHECK_EQUAL(sink.GetDropped(), 10);
+    VRV_CHECK_EQUAL(sink.GetEntries().back().m_id, std::string("id"));
+
+    // Entries added without checking first are dropped too
+    sink.Add({ LOG_WARNING, 1, "", "message 100" });
+    VRV_CHECK_EQUAL(sink.GetEntries().size(), 51);
+    VRV_CHECK_EQUAL(sink.GetDropped(), 11);
+
+    sink.Clear();
+    VRV_CHECK(sink.GetEntries().empty());
+    VRV_CHECK_EQUAL(sink.GetDropped(), 0);
+}
+
+VRV_TEST(log, LogToSink)
+{
+    std::shared_ptr<LogSink> sink = std::make_shared<LogSink>();
+    SetLogSink(sink);
+    EnableLog(LOG_WARNING);
+    EnableLogToBuffer(true);
+
+    // The functions can be called qualified
+    vrv::LogWarning("Warning %d", 1);
+    vrv::LogElementError("note-1", "Error on %s", "note-1");
+    vrv::LogInfo("Info not logged");
+    VRV_CHECK_EQUAL(sink->GetString(), std::string("[Warning] Warning 1\n[Error] Error on note-1\n"));
+    VRV_CHECK_EQUAL(sink->GetEntries().back().m_id, std::string("note-1"));
+
+    EnableLogToBuffer(false);
+    EnableLog(LOG_OFF);
+    SetLogSink(NULL);
+}
+
+VRV_TEST(log, MacrosCheckTheLevelFirst)
+{
+    std::shared_ptr<LogSink> sink = std::make_shared<LogSink>();
+    SetLogSink(sink);
+    EnableLog(LOG_WARNING);
+    EnableLogToBuffer(true);
+
+    int evaluated = 0;
+    auto argument = [&evaluated]() {
+        ++evaluated;
+        return evaluated;
+    };
+    VRV_LOG_INFO("Info %d", argument());
+    VRV_LOG_DEBUG("Debug %d", argument());
+    VRV_CHECK_EQUAL(evaluated, 0);
+    VRV_LOG_WARNING("Warning %d", argument());
+    VRV_CHECK_EQUAL(evaluated, 1);
+
+    // Without DEBUG, the debug logs are compiled out whatever the level
+    EnableLog(LOG_DEBUG);
+    VRV_LOG_DEBUG("Debug %d", argument());
+#if defined(DEBUG)
+    VRV_CHECK_EQUAL(evaluated, 2);
+#else
+    VRV_CHECK_EQUAL(evaluated, 1);
+#endif
+    VRV_LOG_ELEMENT_WARNING("note-1", "Warning on %s", "note-1");
+    VRV_CHECK_EQUAL(sink->GetEntries().back().m_id, std::string("note-1"));
+
+    EnableLogToBuffer(false);
+    EnableLog(LOG_OFF);
+    SetLogSink(NULL);
+}
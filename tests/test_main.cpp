@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test_main.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "toolkitdef.h"
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+namespace test {
+
+    struct TestCase {
+        std::string m_group;
+        std::string m_name;
+        std::function<void()> m_test;
+    };
+
+    static std::vector<TestCase> &GetTestCases()
+    {
+        static std::vector<TestCase> testCases;
+        return testCases;
+    }
+
+    static int s_failures = 0;
+
+    int RegisterTest(const std::string &group, const std::string &name, const std::function<void()> &test)
+    {
+        GetTestCases().push_back({ group, name, test });
+        return (int)GetTestCases().size();
+    }
+
+    void ReportFailure(const char *file, int line, const std::string &message)
+    {
+        std::cerr << file << ":" << line << ": check failed: " << message << std::endl;
+        ++s_failures;
+    }
+
+    std::string GetDataPath(const std::string &filename)
+    {
+        return std::string(VRV_TEST_DATA_DIR) + "/" + filename;
+    }
+
+    std::string GetResourcePath()
+    {
+        return VRV_TEST_RESOURCE_DIR;
+    }
+
+    std::string ReadDataFile(const std::string &filename)
+    {
+        std::ifstream file(GetDataPath(filename), std::ios::binary);
+        if (!file.is_open()) {
+            ReportFailure(__FILE__, __LINE__, "cannot read " + filename);
+            return "";
+        }
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+} // namespace test
+
+} // namespace vrv
+
+//----------------------------------------------------------------------------
+// Run the test cases of the groups given as arguments (or all of them)
+//----------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+    using namespace vrv::test;
+
+    vrv::EnableLog(vrv::LOG_OFF);
+    vrv::SetDefaultResourcePath(GetResourcePath());
+
+    std::vector<std::string> groups(argv + 1, argv + argc);
+    int count = 0;
+    int failed = 0;
+    for (const TestCase &testCase : GetTestCases()) {
+        if (!groups.empty() && (std::find(groups.begin(), groups.end(), testCase.m_group) == groups.end())) continue;
+        const int failures = s_failures;
+        testCase.m_test();
+        ++count;
+        if (s_failures != failures) {
+            std::cerr << "FAILED " << testCase.m_group << "." << testCase.m_name << std::endl;
+            ++failed;
+        }
+        else {
+            std::cout << "passed " << testCase.m_group << "." << testCase.m_name << std::endl;
+        }
+    }
+
+    if (count == 0) {
+        std::cerr << "No test case found" << std::endl;
+        return 1;
+    }
+    std::cout << count - failed << "/" << count << " test cases passed" << std::endl;
+
+    return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,276 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        test_object.cpp
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+
+//----------------------------------------------------------------------------
+
+#include <sstream>
+
+//----------------------------------------------------------------------------
+
+#include "alignfunctor.h"
+#include "doc.h"
+#include "functor.h"
+#include "iomei.h"
+#include "layer.h"
+#include "measure.h"
+#include "note.h"
+#include "page.h"
+#include "resetfunctor.h"
+#include "rest.h"
+#include "staff.h"
+#include "system.h"
+#include "toolkit.h"
+
+//----------------------------------------------------------------------------
+
+using namespace vrv;
+
+namespace {
+
+/**
+ * Count the objects visited by a functor, optionally limited to some ClassIds
+ */
+class CountVisitedFunctor : public Functor {
+public:
+    CountVisitedFunctor(const std::vector<ClassId> &classIds) { this->SetVisitedClassIds(classIds); }
+
+    bool ImplementsEndInterface() const override { return false; }
+
+    FunctorCode VisitObject(Object *object) override
+    {
+        ++m_counts[object->GetClassId()];
+        return FUNCTOR_CONTINUE;
+    }
+
+    int m_counts[UNSPECIFIED + 1] = {};
+};
+
+/**
+ * A measure with a staff containing a note and a staff containing a rest
+ */
+Measure *CreateMeasure(Layer *&noteLayer, Layer *&restLayer)
+{
+    Measure *measure = new Measure();
+    Staff *staff1 = new Staff(1);
+    noteLayer = new Layer();
+    noteLayer->AddChild(new Note());
+    noteLayer->AddChild(new Rest());
+    staff1->AddChild(noteLayer);
+    measure->AddChild(staff1);
+    Staff *staff2 = new Staff(2);
+    restLayer = new Layer();
+    restLayer->AddChild(new Rest());
+    staff2->AddChild(restLayer);
+    measure->AddChild(staff2);
+    return measure;
+}
+
+/**
+ * Write the alignments of the staves and of the layer elements for comparing them
+ */
+class WriteAlignmentsFunctor : public ConstFunctor {
+public:
+    bool ImplementsEndInterface() const override { return false; }
+
+    FunctorCode VisitLayerElement(const LayerElement *layerElement) override
+    {
+        m_output << layerElement->GetID();
+        if (const Alignment *alignment = layerElement->GetAlignment()) {
+            m_output << " " << alignment->GetIdx() << " " << alignment->GetType() << " " << alignment->GetTime();
+        }
+        m_output << "\n";
+        return FUNCTOR_CONTINUE;
+    }
+
+    FunctorCode VisitMeasure(const Measure *measure) override
+    {
+        m_output << measure->GetID() << " " << measure->m_measureAligner.GetChildCount() << "\n";
+        return FUNCTOR_CONTINUE;
+    }
+
+    FunctorCode VisitStaff(const Staff *staff) override
+    {
+        m_output << staff->GetID();
+        if (const StaffAlignment *alignment = staff->GetAlignment()) m_output << " " << alignment->GetIdx();
+        m_output << "\n";
+        return FUNCTOR_CONTINUE;
+    }
+
+    FunctorCode VisitSystem(const System *system) override
+    {
+        m_output << system->GetID() << " " << system->m_systemAligner.GetChildCount() << "\n";
+        return FUNCTOR_CONTINUE;
+    }
+
+    std::ostringstream m_output;
+};
+
+/**
+ * Load the file in the document (without casting it off) and return its page with the horizontal alignment reset
+ */
+Page *LoadPage(Doc &doc, const std::string &filename)
+{
+    doc.GetResourcesForModification().InitFonts();
+    Object::SeedID(1);
+    MEIInput input(&doc);
+    VRV_CHECK(input.Import(test::ReadDataFile(filename)));
+    doc.PrepareData();
+    doc.ScoreDefSetCurrentDoc();
+
+    Page *page = doc.SetDrawingPage(0);
+    ResetHorizontalAlignmentFunctor resetHorizontalAlignment;
+    page->Process(resetHorizontalAlignment);
+    return page;
+}
+
+} // namespace
+
+VRV_TEST(object, VisitAll)
+{
+    Layer *noteLayer, *restLayer;
+    Measure *measure = CreateMeasure(noteLayer, restLayer);
+
+    CountVisitedFunctor countVisited({});
+    measure->Process(countVisited);
+    VRV_CHECK_EQUAL(countVisited.m_counts[STAFF], 2);
+    VRV_CHECK_EQUAL(countVisited.m_counts[NOTE], 1);
+    VRV_CHECK_EQUAL(countVisited.m_counts[REST], 2);
+
+    delete measure;
+}
+
+VRV_TEST(object, PruneSubtrees)
+{
+    Layer *noteLayer, *restLayer;
+    Measure *measure = CreateMeasure(noteLayer, restLayer);
+
+    // The staff with only a rest is not visited, nor the rest next to the note
+    CountVisitedFunctor countVisited({ NOTE });
+    measure->Process(countVisited);
+    VRV_CHECK_EQUAL(countVisited.m_counts[MEASURE], 1);
+    VRV_CHECK_EQUAL(countVisited.m_counts[STAFF], 1);
+    VRV_CHECK_EQUAL(countVisited.m_counts[LAYER], 1);
+    VRV_CHECK_EQUAL(countVisited.m_counts[NOTE], 1);
+    VRV_CHECK_EQUAL(countVisited.m_counts[REST], 0);
+
+    // Container ClassIds are visited with all their ancestors but without their children
+    CountVisitedFunctor countStaves({ STAFF });
+    measure->Process(countStaves);
+    VRV_CHECK_EQUAL(countStaves.m_counts[STAFF], 2);
+    VRV_CHECK_EQUAL(countStaves.m_counts[LAYER], 0);
+
+    delete measure;
+}
+
+VRV_TEST(object, InvalidateOnAddAndDetach)
+{
+    Layer *noteLayer, *restLayer;
+    Measure *measure = CreateMeasure(noteLayer, restLayer);
+    ClassIdSet notes;
+    notes[NOTE] = true;
+
+    Object *staff2 = restLayer->GetParent();
+    VRV_CHECK(measure->HasClassIdInSubtree(notes));
+    VRV_CHECK(!staff2->HasClassIdInSubtree(notes));
+
+    // Adding a child invalidates the cache of all the ancestors
+    Note *note = new Note();
+    restLayer->AddChild(note);
+    VRV_CHECK(staff2->HasClassIdInSubtree(notes));
+    CountVisitedFunctor countVisited({ NOTE });
+    measure->Process(countVisited);
+    VRV_CHECK_EQUAL(countVisited.m_counts[STAFF], 2);
+    VRV_CHECK_EQUAL(countVisited.m_counts[NOTE], 2);
+
+    // So does detaching it
+    restLayer->DetachChild(note->GetIdx());
+    delete note;
+    VRV_CHECK(!staff2->HasClassIdInSubtree(notes));
+
+    // And clearing the children
+    Object *staff1 = noteLayer->GetParent();
+    VRV_CHECK(staff1->HasClassIdInSubtree(notes));
+    noteLayer->ClearChildren();
+    VRV_CHECK(!staff1->HasClassIdInSubtree(notes));
+    VRV_CHECK(!measure->HasClassIdInSubtree(notes));
+
+    delete measure;
+}
+
+VRV_TEST(object, InvalidateOnModification)
+{
+    Layer *noteLayer, *restLayer;
+    Measure *measure = CreateMeasure(noteLayer, restLayer);
+    ClassIdSet notes;
+    notes[NOTE] = true;
+    measure->CacheSubtreeClassIds();
+
+    // Children added directly to the list by AddChild overrides
+    Note *note = new Note();
+    note->SetParent(restLayer);
+    restLayer->GetChildrenForModification().push_back(note);
+    VRV_CHECK(restLayer->GetParent()->HasClassIdInSubtree(notes));
+
+    delete measure;
+}
+
+VRV_TEST(object, ReferenceObject)
+{
+    Layer *noteLayer, *restLayer;
+    Measure *measure = CreateMeasure(noteLayer, restLayer);
+
+    // The children of a reference object are not owned and the object is never pruned
+    Layer reference;
+    reference.SetAsReferenceObject();
+    ClassIdSet notes;
+    notes[NOTE] = true;
+    VRV_CHECK(reference.HasClassIdInSubtree(notes));
+
+    delete measure;
+}
+
+VRV_TEST(object, CrossStaffLedgerLines)
+{
+    // The second staff has no note and is not visited by CalcLedgerLinesFunctor but gets ledger lines
+    Toolkit toolkit;
+    VRV_CHECK(toolkit.LoadData(test::ReadDataFile("crossstaff.mei")));
+    const std::string svg = toolkit.RenderToSVG();
+    VRV_CHECK(svg.find("class=\"ledgerLines above\"") != std::string::npos);
+    VRV_CHECK(svg.find("class=\"ledgerLines below\"") != std::string::npos);
+}
+
+VRV_TEST(object, ProcessFunctors)
+{
+    // Processing functors in a single traversal gives the same output as processing them one after the other, here
+    // with the functors aligning the page in Page::ResetAligners
+    for (const std::string filename : { "layout.mei", "crossstaff.mei" }) {
+        Doc doc;
+        Page *page = LoadPage(doc, filename);
+        ResetVerticalAlignmentFunctor resetVerticalAlignment;
+        AlignHorizontallyFunctor alignHorizontally(&doc);
+        AlignVerticallyFunctor alignVertically(&doc);
+        page->Process({ &resetVerticalAlignment, &alignHorizontally, &alignVertically });
+        WriteAlignmentsFunctor writeAlignments;
+        page->Process(writeAlignments);
+
+        Doc sequentialDoc;
+        Page *sequentialPage = LoadPage(sequentialDoc, filename);
+        ResetVerticalAlignmentFunctor sequentialResetVerticalAlignment;
+        sequentialPage->Process(sequentialResetVerticalAlignment);
+        AlignHorizontallyFunctor sequentialAlignHorizontally(&sequentialDoc);
+        sequentialPage->Process(sequentialAlignHorizontally);
+        AlignVerticallyFunctor sequentialAlignVertically(&sequentialDoc);
+        sequentialPage->Process(sequentialAlignVertically);
+        WriteAlignmentsFunctor sequentialWriteAlignments;
+        sequentialPage->Process(sequentialWriteAlignments);
+
+        const std::string output = writeAlignments.m_output.str();
+        VRV_CHECK(output.find(" " + std::to_string(ALIGNMENT_DEFAULT) + " ") != std::string::npos);
+        VRV_CHECK(output == sequentialWriteAlignments.m_output.str());
+    }
+}
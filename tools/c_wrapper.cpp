@@ -45,15 +45,22 @@ void *vrvToolkit_constructorResourcePath(const char *resourcePath)
 void vrvToolkit_destructor(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
-    LogInfo("Deleting toolkit");
+    VRV_LOG_INFO("Deleting toolkit");
     delete tk;
 }
 
+const char *vrvToolkit_activateOptionProfile(void *tkPtr, int handle)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->ActivateOptionProfile(handle));
+    return tk->GetCString();
+}
+
 bool vrvToolkit_edit(void *tkPtr, const char *editorAction)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
     if (!tk->Edit(editorAction)) {
-        LogError("Could not perform editor action.");
+        VRV_LOG_ERROR("Could not perform editor action.");
         return false;
     }
     return true;
@@ -66,6 +73,13 @@ const char *vrvToolkit_editInfo(void *tkPtr)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_extractCorpusFeatures(void *tkPtr, const char *c_options)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->ExtractCorpusFeatures(c_options));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getAvailableOptions(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -158,6 +172,13 @@ const char *vrvToolkit_getLog(void *tkPtr)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getLogEntries(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetLogEntries());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getMEI(void *tkPtr, const char *options)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -186,6 +207,12 @@ const char *vrvToolkit_getOptions(void *tkPtr)
     return tk->GetCString();
 }
 
+int vrvToolkit_getOptionProfile(void *tkPtr, const char *name)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return tk->GetOptionProfile(name);
+}
+
 const char *vrvToolkit_getOptionUsageString(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -274,6 +301,12 @@ void vrvToolkit_redoPagePitchPosLayout(void *tkPtr)
     tk->RedoPagePitchPosLayout();
 }
 
+int vrvToolkit_registerOptionProfile(void *tkPtr, const char *name, const char *options)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return tk->RegisterOptionProfile(name, options);
+}
+
 const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *options)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -281,6 +314,14 @@ const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *opt
     return tk->GetCString();
 }
 
+const char *vrvToolkit_renderMeasureWindowToSVG(
+    void *tkPtr, const char *startId, const char *endId, bool xmlDeclaration)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderMeasureWindowToSVG(startId, endId, xmlDeclaration));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_renderToExpansionMap(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -333,6 +374,13 @@ bool vrvToolkit_renderToSVGFile(void *tkPtr, const char *filename, int pageNo)
     return tk->RenderToSVGFile(filename, pageNo);
 }
 
+const char *vrvToolkit_renderToSVGGlyphSheet(void *tkPtr, bool xmlDeclaration)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderToSVGGlyphSheet(xmlDeclaration));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
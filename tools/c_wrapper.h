@@ -20,8 +20,10 @@ void *vrvToolkit_constructor();
 void *vrvToolkit_constructorResourcePath(const char *resourcePath);
 
 void vrvToolkit_destructor(void *tkPtr);
+const char *vrvToolkit_activateOptionProfile(void *tkPtr, int handle);
 bool vrvToolkit_edit(void *tkPtr, const char *editorAction);
 const char *vrvToolkit_editInfo(void *tkPtr);
+const char *vrvToolkit_extractCorpusFeatures(void *tkPtr, const char *c_options);
 const char *vrvToolkit_getAvailableOptions(void *tkPtr);
 const char *vrvToolkit_getDefaultOptions(void *tkPtr);
 const char *vrvToolkit_getDescriptiveFeatures(void *tkPtr, const char *options);
@@ -35,10 +37,12 @@ const char *vrvToolkit_convertHumdrumToHumdrum(void *tkPtr, const char *humdrumD
 const char *vrvToolkit_convertHumdrumToMIDI(void *tkPtr, const char *humdrumData);
 const char *vrvToolkit_convertMEIToHumdrum(void *tkPtr, const char *meiData);
 const char *vrvToolkit_getLog(void *tkPtr);
+const char *vrvToolkit_getLogEntries(void *tkPtr);
 const char *vrvToolkit_getMEI(void *tkPtr, const char *options);
 const char *vrvToolkit_getMIDIValuesForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getNotatedIdForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getOptions(void *tkPtr);
+int vrvToolkit_getOptionProfile(void *tkPtr, const char *name);
 const char *vrvToolkit_getOptionUsageString(void *tkPtr);
 int vrvToolkit_getPageCount(void *tkPtr);
 int vrvToolkit_getPageWithElement(void *tkPtr, const char *xmlId);
@@ -53,7 +57,10 @@ bool vrvToolkit_loadZipDataBase64(void *tkPtr, const char *data);
 bool vrvToolkit_loadZipDataBuffer(void *tkPtr, const unsigned char *data, int length);
 void vrvToolkit_redoLayout(void *tkPtr, const char *c_options);
 void vrvToolkit_redoPagePitchPosLayout(void *tkPtr);
+int vrvToolkit_registerOptionProfile(void *tkPtr, const char *name, const char *options);
 const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *options);
+const char *vrvToolkit_renderMeasureWindowToSVG(
+    void *tkPtr, const char *startId, const char *endId, bool xmlDeclaration);
 const char *vrvToolkit_renderToExpansionMap(void *tkPtr);
 bool vrvToolkit_renderToExpansionMapFile(void *tkPtr, const char *filename);
 const char *vrvToolkit_renderToMIDI(void *tkPtr);
@@ -62,6 +69,7 @@ const char *vrvToolkit_renderToPAE(void *tkPtr);
 bool vrvToolkit_renderToPAEFile(void *tkPtr, const char *filename);
 const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration);
 bool vrvToolkit_renderToSVGFile(void *tkPtr, const char *filename, int pageNo);
+const char *vrvToolkit_renderToSVGGlyphSheet(void *tkPtr, bool xmlDeclaration);
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options);
 bool vrvToolkit_renderToTimemapFile(void *tkPtr, const char *filename, const char *c_options);
 void vrvToolkit_resetOptions(void *tkPtr);
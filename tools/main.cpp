@@ -6,8 +6,13 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <regex>
 #include <sstream>
 #include <string>
@@ -15,6 +20,9 @@
 
 #ifndef _WIN32
 #include <getopt.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 #else
 #include "win_getopt.h"
 #endif
@@ -78,12 +86,388 @@ option optionStruct(vrv::Option *option, const std::map<vrv::Option *, std::stri
         option->GetShortOption() };
 }
 
+//----------------------------------------------------------------------------
+// Server mode
+//----------------------------------------------------------------------------
+
+/**
+ * The command-line settings used as a base for every job in server mode.
+ * Each job starts from these and applies its own options on top.
+ */
+struct ServeDefaults {
+    vrv::Options options;
+    std::string resourcePath;
+    std::string inputFrom = "auto";
+    std::string outputTo = "svg";
+    int scale = 0;
+    int xmlIdSeed = 0;
+    int page = 1;
+    bool allPages = false;
+};
+
+/**
+ * A pool of toolkits kept warm between jobs, one per resource path.
+ * The fonts are loaded once when a toolkit is created and reused by all the following jobs.
+ */
+class ToolkitPool {
+public:
+    ToolkitPool(vrv::Toolkit *toolkit, const std::string &resourcePath) { m_toolkits[resourcePath] = toolkit; }
+
+    vrv::Toolkit *Get(const std::string &resourcePath)
+    {
+        if (m_toolkits.contains(resourcePath)) return m_toolkits.at(resourcePath);
+        if (!dir_exists(resourcePath)) return NULL;
+        std::unique_ptr<vrv::Toolkit> toolkit = std::make_unique<vrv::Toolkit>(false);
+        if (!toolkit->SetResourcePath(resourcePath)) return NULL;
+        m_toolkits[resourcePath] = toolkit.get();
+        m_owned.push_back(std::move(toolkit));
+        return m_toolkits.at(resourcePath);
+    }
+
+private:
+    std::map<std::string, vrv::Toolkit *> m_toolkits;
+    std::vector<std::unique_ptr<vrv::Toolkit>> m_owned;
+};
+
+// Write a JSON object on a single line - line breaks in strings are escaped by jsonxx
+std::string serveJsonLine(const jsonxx::Object &object)
+{
+    std::string json = object.json();
+    json.erase(std::remove_if(json.begin(), json.end(), [](char ch) { return (ch == '\n') || (ch == '\t'); }),
+        json.end());
+    return json;
+}
+
+double serveElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string serveError(jsonxx::Object &response, const std::string &error, const std::string &log = "")
+{
+    response << "ok" << false;
+    response << "error" << error;
+    response << "log" << log;
+    return serveJsonLine(response);
+}
+
+/**
+ * Process one job and return the response on a single line.
+ * A job is a JSON object with an "input" path or "data", and optional "id", "options", "format", "pages", "output",
+ * "inputFrom" and "resourcePath".
+ */
+std::string serveJob(const std::string &line, ToolkitPool &pool, const ServeDefaults &defaults)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    jsonxx::Object response;
+    jsonxx::Object job;
+    if (!job.parse(line)) {
+        return serveError(response, "The job could not be parsed.");
+    }
+    if (job.has<jsonxx::String>("id")) {
+        response << "id" << job.get<jsonxx::String>("id");
+    }
+    else if (job.has<jsonxx::Number>("id")) {
+        response << "id" << job.get<jsonxx::Number>("id");
+    }
+
+    const std::string resourcePath = job.get<jsonxx::String>("resourcePath", defaults.resourcePath);
+    vrv::Toolkit *toolkit = pool.Get(resourcePath);
+    if (!toolkit) {
+        return serveError(response, "The resource path " + resourcePath + " could not be loaded.");
+    }
+
+    const std::string format = job.get<jsonxx::String>("format", defaults.outputTo);
+    const std::vector<std::string> formats = { "mei", "mei-basic", "mei-pb", "mei-facs", "svg", "midi", "timemap",
+        "expansionmap", "humdrum", "hum", "pae" };
+    if (std::find(formats.begin(), formats.end(), format) == formats.end()) {
+        return serveError(response, "Output format (" + format + ") is not supported.");
+    }
+    const bool humdrum = (format == "humdrum") || (format == "hum");
+
+    // Start from the command-line options and apply the job options
+    *toolkit->GetOptionsObj() = defaults.options;
+    toolkit->GetOptionsObj()->m_scale.SetValue(defaults.scale);
+    if (defaults.xmlIdSeed != 0) toolkit->ResetXmlIdSeed(defaults.xmlIdSeed);
+    const std::string inputFrom = job.get<jsonxx::String>("inputFrom", defaults.inputFrom);
+    toolkit->SetInputFrom(inputFrom);
+    toolkit->SetOutputTo(format);
+    jsonxx::Object jobOptions;
+    if (job.has<jsonxx::Object>("options")) jobOptions = job.get<jsonxx::Object>("options");
+    // Always set the font since a previous job might have changed it
+    if (!jobOptions.has<jsonxx::String>("font")) jobOptions << "font" << defaults.options.m_font.GetValue();
+    // Skip the layout for MIDI and timemap output as the command-line does
+    if (((format == "midi") || (format == "timemap") || (format == "expansionmap"))
+        && !jobOptions.has<jsonxx::String>("breaks")) {
+        jobOptions << "breaks"
+                   << "none";
+    }
+    toolkit->GetLog();
+    toolkit->SetOptions(jobOptions.json());
+    // Loading resets the log buffer
+    std::string log = toolkit->GetLog();
+
+    // Load the input
+    const std::chrono::steady_clock::time_point loadStart = std::chrono::steady_clock::now();
+    bool loaded = false;
+    if (humdrum && (toolkit->GetInputFrom() == vrv::MEI)) {
+        std::string data = job.get<jsonxx::String>("data", "");
+        if (!job.has<jsonxx::String>("data")) {
+            std::ifstream instream(job.get<jsonxx::String>("input", "").c_str());
+            std::ostringstream input_data;
+            input_data << instream.rdbuf();
+            data = input_data.str();
+        }
+        // Output will be accessible from toolkit.GetHumdrum():
+        loaded = !data.empty();
+        if (loaded) toolkit->ConvertMEIToHumdrum(data);
+    }
+    else if (job.has<jsonxx::String>("data")) {
+        loaded = toolkit->LoadData(job.get<jsonxx::String>("data"));
+    }
+    else if (job.has<jsonxx::String>("input")) {
+        loaded = toolkit->LoadFile(job.get<jsonxx::String>("input"));
+    }
+    else {
+        return serveError(response, "The job has no input or data.", log);
+    }
+    const double loadTime = serveElapsedMs(loadStart);
+    // Rendering resets the log buffer too
+    log += toolkit->GetLog();
+    if (!loaded) {
+        return serveError(response, "The input could not be loaded.", log);
+    }
+
+    // Select the pages - a page number, an array of page numbers, or "all"
+    std::vector<int> pages;
+    bool allPages = defaults.allPages;
+    if (job.has<jsonxx::Number>("pages")) {
+        allPages = false;
+        pages.push_back(job.get<jsonxx::Number>("pages"));
+    }
+    else if (job.has<jsonxx::Array>("pages")) {
+        allPages = false;
+        const jsonxx::Array &values = job.get<jsonxx::Array>("pages");
+        for (int i = 0; i < (int)values.size(); ++i) {
+            if (values.has<jsonxx::Number>(i)) pages.push_back(values.get<jsonxx::Number>(i));
+        }
+    }
+    else if (job.has<jsonxx::String>("pages")) {
+        allPages = (job.get<jsonxx::String>("pages") == "all");
+    }
+    if (allPages) {
+        for (int page = 1; page <= toolkit->GetPageCount(); ++page) pages.push_back(page);
+    }
+    else if (pages.empty()) {
+        pages.push_back(defaults.page);
+    }
+    if ((format == "svg") || (format.starts_with("mei") && !allPages)) {
+        for (int page : pages) {
+            if ((page < 1) || (page > toolkit->GetPageCount())) {
+                return serveError(response,
+                    vrv::StringFormat("The page requested (%d) is not in the page range (max is %d).", page,
+                        toolkit->GetPageCount()),
+                    log);
+            }
+        }
+    }
+
+    // Render the output either inline or to files with the command-line naming
+    const std::chrono::steady_clock::time_point renderStart = std::chrono::steady_clock::now();
+    const bool toFile = job.has<jsonxx::String>("output");
+    const std::string outfile = (toFile) ? removeExtension(job.get<jsonxx::String>("output")) : "";
+    jsonxx::Array results;
+    std::string error;
+    auto emit = [&](const std::string &suffix, const std::function<std::string()> &render,
+                    const std::function<bool(const std::string &)> &save) {
+        if (!toFile) {
+            results << render();
+        }
+        else if (save(outfile + suffix)) {
+            results << outfile + suffix;
+        }
+        else if (error.empty()) {
+            error = "Unable to write " + outfile + suffix + ".";
+        }
+        log += toolkit->GetLog();
+    };
+
+    jsonxx::Array renderedPages;
+    if (format == "svg") {
+        for (int page : pages) {
+            const std::string suffix = ((allPages || (pages.size() > 1)) ? vrv::StringFormat("_%03d", page) : "") + ".svg";
+            emit(
+                suffix, [&]() { return toolkit->RenderToSVG(page); },
+                [&](const std::string &filename) { return toolkit->RenderToSVGFile(filename, page); });
+            renderedPages << page;
+        }
+    }
+    else if (format.starts_with("mei")) {
+        const char *scoreBased = (format == "mei-pb") ? "false" : "true";
+        const char *basic = (format == "mei-basic") ? "true" : "false";
+        const char *removeIds = (toolkit->GetOptionsObj()->m_removeIds.GetValue()) ? "true" : "false";
+        const char *generateFacs = (format == "mei-facs") ? "true" : "false";
+        std::vector<std::string> params;
+        if (allPages) {
+            params.push_back(vrv::StringFormat("{'scoreBased': %s, 'basic': %s, 'removeIds': %s, 'generateFacs': %s}",
+                scoreBased, basic, removeIds, generateFacs));
+        }
+        else {
+            for (int page : pages) {
+                params.push_back(vrv::StringFormat(
+                    "{'scoreBased': %s, 'basic': %s, 'pageNo': %d, 'removeIds': %s, 'generateFacs': %s}", scoreBased,
+                    basic, page, removeIds, generateFacs));
+                renderedPages << page;
+            }
+        }
+        for (int i = 0; i < (int)params.size(); ++i) {
+            const std::string suffix
+                = ((params.size() > 1) ? vrv::StringFormat("_%03d", pages.at(i)) : "") + ".mei";
+            emit(
+                suffix, [&]() { return toolkit->GetMEI(params.at(i)); },
+                [&](const std::string &filename) { return toolkit->SaveFile(filename, params.at(i)); });
+        }
+    }
+    else if (format == "midi") {
+        emit(
+            ".mid", [&]() { return toolkit->RenderToMIDI(); },
+            [&](const std::string &filename) { return toolkit->RenderToMIDIFile(filename); });
+    }
+    else if (format == "timemap") {
+        emit(
+            ".json", [&]() { return toolkit->RenderToTimemap(); },
+            [&](const std::string &filename) { return toolkit->RenderToTimemapFile(filename); });
+    }
+    else if (format == "expansionmap") {
+        emit(
+            "-em.json", [&]() { return toolkit->RenderToExpansionMap(); },
+            [&](const std::string &filename) { return toolkit->RenderToExpansionMapFile(filename); });
+    }
+    else if (humdrum) {
+        emit(
+            ".krn", [&]() { return toolkit->GetHumdrum(); },
+            [&](const std::string &filename) { return toolkit->GetHumdrumFile(filename); });
+    }
+    else if (format == "pae") {
+        emit(
+            ".pae", [&]() { return toolkit->RenderToPAE(); },
+            [&](const std::string &filename) { return toolkit->RenderToPAEFile(filename); });
+    }
+    const double renderTime = serveElapsedMs(renderStart);
+
+    if (!error.empty()) {
+        return serveError(response, error, log);
+    }
+
+    jsonxx::Object time;
+    jsonxx::Value loadValue(loadTime);
+    loadValue.precision_ = 3;
+    jsonxx::Value renderValue(renderTime);
+    renderValue.precision_ = 3;
+    jsonxx::Value totalValue(serveElapsedMs(start));
+    totalValue.precision_ = 3;
+    time << "load" << loadValue;
+    time << "render" << renderValue;
+    time << "total" << totalValue;
+
+    response << "ok" << true;
+    response << "format" << format;
+    if (renderedPages.size() > 0) response << "pages" << renderedPages;
+    response << ((toFile) ? "files" : "results") << results;
+    response << "log" << log;
+    response << "time" << time;
+    return serveJsonLine(response);
+}
+
+/**
+ * Read the jobs from the standard input, one per line, and write the responses to the standard output.
+ */
+void serveStdin(ToolkitPool &pool, const ServeDefaults &defaults)
+{
+    for (std::string line; getline(std::cin, line);) {
+        if (line.empty()) continue;
+        std::cout << serveJob(line, pool, defaults) << std::endl;
+    }
+}
+
+#ifndef _WIN32
+/**
+ * Listen on a Unix domain socket and process the jobs of each connection in turn.
+ * Responses are written back on the connection that sent the job.
+ */
+bool serveSocket(const std::string &path, ToolkitPool &pool, const ServeDefaults &defaults)
+{
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "The socket path " << path << " is too long." << std::endl;
+        return false;
+    }
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path.c_str());
+    if ((server < 0) || (bind(server, (sockaddr *)&address, sizeof(address)) < 0) || (listen(server, 8) < 0)) {
+        std::cerr << "Unable to listen on " << path << "." << std::endl;
+        if (server >= 0) close(server);
+        return false;
+    }
+    // Do not exit when a client closes its connection before reading the response
+    signal(SIGPIPE, SIG_IGN);
+    std::cerr << "Listening on " << path << "." << std::endl;
+
+    while (true) {
+        int client = accept(server, NULL, NULL);
+        if (client < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        std::string buffer;
+        char chunk[4096];
+        ssize_t size;
+        bool connected = true;
+        while (connected) {
+            size = recv(client, chunk, sizeof(chunk), 0);
+            if (size > 0) buffer.append(chunk, size);
+            // Process the remaining job without a final line break when the client closes the connection
+            if ((size <= 0) && !buffer.empty() && (buffer.back() != '\n')) buffer.push_back('\n');
+            connected = (size > 0);
+            size_t pos;
+            while ((pos = buffer.find('\n')) != std::string::npos) {
+                const std::string line = buffer.substr(0, pos);
+                buffer.erase(0, pos + 1);
+                if (line.empty()) continue;
+                const std::string response = serveJob(line, pool, defaults) + "\n";
+                for (size_t sent = 0; sent < response.size();) {
+                    ssize_t written = send(client, response.data() + sent, response.size() - sent, 0);
+                    if (written <= 0) {
+                        connected = false;
+                        break;
+                    }
+                    sent += written;
+                }
+            }
+        }
+        close(client);
+    }
+
+    close(server);
+    unlink(path.c_str());
+    return true;
+}
+#endif
+
 int main(int argc, char **argv)
 {
     std::string infile;
     std::string svgdir;
     std::string outfile;
     std::string outformat = "svg";
+    std::string informat = "auto";
+    std::string serve;
+    std::string corpus;
+    int corpusThreads = 0;
     bool std_output = false;
 
     int all_pages = 0;
@@ -125,6 +509,11 @@ int main(int argc, char **argv)
         optionStruct(&options->m_xmlIdSeed, optionNames), //
         // standard input - long options only or - as filename
         { "stdin", no_argument, 0, 'z' }, //
+        // server mode - long option only
+        { "serve", required_argument, 0, 'S' }, //
+        // corpus feature extraction - long options only
+        { "corpus", required_argument, 0, 'C' }, //
+        { "corpus-threads", required_argument, 0, 'T' }, //
         { 0, 0, 0, 0 }
     };
 
@@ -183,7 +572,7 @@ int main(int argc, char **argv)
                 opt = params->at(vrv::ToCamelCase(key));
                 optBool = dynamic_cast<vrv::OptionBool *>(opt);
                 if (std::string badOption; !optionExists("--" + key, argc, argv, badOption)) {
-                    vrv::LogError("Unrecognized option %s has been skipped.", badOption.c_str());
+                    VRV_LOG_ERROR("Unrecognized option %s has been skipped.", badOption.c_str());
                     continue;
                 }
 
@@ -192,12 +581,12 @@ int main(int argc, char **argv)
                 }
                 else if (opt) {
                     if (!opt->SetValue(optarg)) {
-                        vrv::LogWarning("Setting option %s with %s failed, default value used",
+                        VRV_LOG_WARNING("Setting option %s with %s failed, default value used",
                             long_options[option_index].name, optarg);
                     }
                 }
                 else {
-                    vrv::LogError("Something went wrong with option %s", long_options[option_index].name);
+                    VRV_LOG_ERROR("Something went wrong with option %s", long_options[option_index].name);
                     exit(1);
                 }
                 break;
@@ -208,6 +597,7 @@ int main(int argc, char **argv)
                 if (!toolkit.SetInputFrom(std::string(optarg))) {
                     exit(1);
                 };
+                informat = std::string(optarg);
                 break;
 
             case 'l': vrv::EnableLog(vrv::StrToLogLevel(std::string(optarg))); break;
@@ -225,7 +615,7 @@ int main(int argc, char **argv)
 
             case 's':
                 if (!options->m_scale.SetValue(optarg)) {
-                    vrv::LogWarning("Setting scale with %s failed, default value used", optarg);
+                    VRV_LOG_WARNING("Setting scale with %s failed, default value used", optarg);
                 }
                 break;
 
@@ -233,7 +623,7 @@ int main(int argc, char **argv)
 
             case 'x':
                 if (!options->m_xmlIdSeed.SetValue(optarg)) {
-                    vrv::LogWarning("Setting xml id seed with %s failed, default value used", optarg);
+                    VRV_LOG_WARNING("Setting xml id seed with %s failed, default value used", optarg);
                 }
                 vrv::Object::SeedID(options->m_xmlIdSeed.GetValue());
                 break;
@@ -244,6 +634,12 @@ int main(int argc, char **argv)
                 }
                 break;
 
+            case 'S': serve = std::string(optarg); break;
+
+            case 'C': corpus = std::string(optarg); break;
+
+            case 'T': corpusThreads = atoi(optarg); break;
+
             case 'h':
                 toolkit.PrintOptionUsage(optarg, std::cout);
                 exit(0);
@@ -271,6 +667,78 @@ int main(int argc, char **argv)
         toolkit.InitClock();
     }
 
+    if (!serve.empty()) {
+        // Make sure the user uses a valid Resource path
+        if (!dir_exists(resourcePath) || !toolkit.SetResourcePath(resourcePath)) {
+            std::cerr << "The resource path " << resourcePath << " could not be loaded; please use -r option."
+                      << std::endl;
+            exit(1);
+        }
+        vrv::EnableLogToBuffer(true);
+
+        ServeDefaults defaults;
+        defaults.options = *options;
+        defaults.resourcePath = resourcePath;
+        defaults.inputFrom = informat;
+        defaults.outputTo = outformat;
+        defaults.scale = options->m_scale.GetValue();
+        defaults.xmlIdSeed = options->m_xmlIdSeed.GetValue();
+        defaults.page = page;
+        defaults.allPages = all_pages;
+
+        ToolkitPool pool(&toolkit, resourcePath);
+        if (serve == "-") {
+            serveStdin(pool, defaults);
+        }
+        else {
+#ifndef _WIN32
+            if (!serveSocket(serve, pool, defaults)) exit(1);
+#else
+            std::cerr << "Server mode with a socket is not supported on this platform." << std::endl;
+            exit(1);
+#endif
+        }
+        free(long_options);
+        return 0;
+    }
+
+    if (!corpus.empty()) {
+        if (!dir_exists(resourcePath) || !toolkit.SetResourcePath(resourcePath)) {
+            std::cerr << "The resource path " << resourcePath << " could not be loaded; please use -r option."
+                      << std::endl;
+            exit(1);
+        }
+        if (outfile.empty()) {
+            std::cerr << "No output file for the corpus features; please use -o option." << std::endl;
+            exit(1);
+        }
+        // The list of files, one per line
+        std::ifstream listFile;
+        if (corpus != "-") {
+            listFile.open(corpus);
+            if (!listFile.is_open()) {
+                std::cerr << "The corpus list " << corpus << " could not be opened." << std::endl;
+                exit(1);
+            }
+        }
+        std::istream &list = (corpus == "-") ? std::cin : listFile;
+        jsonxx::Array inputs;
+        std::string line;
+        while (std::getline(list, line)) {
+            if (!line.empty() && (line.back() == '\r')) line.pop_back();
+            if (!line.empty()) inputs << line;
+        }
+
+        jsonxx::Object corpusOptions;
+        corpusOptions << "inputs" << inputs;
+        corpusOptions << "output" << outfile;
+        if (corpusThreads > 0) corpusOptions << "threads" << corpusThreads;
+        const std::string summary = toolkit.ExtractCorpusFeatures(corpusOptions.json());
+        std::cout << summary << std::endl;
+        free(long_options);
+        return (summary == "{}") ? 1 : 0;
+    }
+
     std::cerr << infile;
     if (optind <= argc - 1) {
         infile = std::string(argv[optind]);
@@ -368,6 +836,11 @@ int main(int argc, char **argv)
     }
 
     if (outformat == "svg") {
+        // With a shared glyph sheet, the pages refer by default to the sheet file written next to them
+        const bool glyphSheet = options->m_svgGlyphSheet.GetValue();
+        if (glyphSheet && !std_output && options->m_svgGlyphSheetUrl.GetValue().empty()) {
+            options->m_svgGlyphSheetUrl.SetValue(basename(outfile) + "-glyphs.svg");
+        }
         int p;
         for (p = from; p < to; ++p) {
             std::string cur_outfile = outfile;
@@ -385,6 +858,23 @@ int main(int argc, char **argv)
             else {
                 std::cerr << "Output written to " << cur_outfile << "." << std::endl;
             }
+            // The page count can change with progressive layout
+            if (all_pages) to = toolkit.GetPageCount() + 1;
+        }
+        if (glyphSheet) {
+            std::string sheet_outfile = outfile + "-glyphs.svg";
+            if (std_output) {
+                std::cout << toolkit.RenderToSVGGlyphSheet();
+            }
+            else {
+                std::ofstream sheet_stream(sheet_outfile.c_str());
+                if (!sheet_stream.is_open()) {
+                    std::cerr << "Unable to write the glyph sheet to " << sheet_outfile << "." << std::endl;
+                    exit(1);
+                }
+                sheet_stream << toolkit.RenderToSVGGlyphSheet(true);
+                std::cerr << "Output written to " << sheet_outfile << "." << std::endl;
+            }
         }
     }
 